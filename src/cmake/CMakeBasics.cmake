@@ -130,6 +130,44 @@ else()
     message(STATUS "Building without coverage flags (ENABLE_COVERAGE == OFF)")
 endif()
 
+################################
+# Tracing Spans
+################################
+if(ENABLE_TRACING)
+    message(STATUS "Building with tracing spans (ENABLE_TRACING == ON)")
+    set(CONDUIT_ENABLE_TRACING 1)
+else()
+    message(STATUS "Building without tracing spans (ENABLE_TRACING == OFF)")
+endif()
+
+################################
+# SIMD Kernels
+################################
+# the SSSE3, SSE4.2 and AVX2 kernels are only compiled when the compiler
+# targets those instruction sets, the resulting binaries need a cpu 
+# that supports them
+if(ENABLE_SIMD)
+    if(NOT CONDUIT_SIMD_FLAGS)
+        if(MSVC)
+            set(CONDUIT_SIMD_FLAGS "/arch:AVX2")
+        else()
+            set(CONDUIT_SIMD_FLAGS "-mavx2")
+        endif()
+    endif()
+    include(CheckCXXCompilerFlag)
+    check_cxx_compiler_flag("${CONDUIT_SIMD_FLAGS}" CONDUIT_SIMD_FLAGS_SUPPORTED)
+    if(NOT CONDUIT_SIMD_FLAGS_SUPPORTED)
+        message(FATAL_ERROR "ENABLE_SIMD is true, but the compiler doesn't "
+                            "support CONDUIT_SIMD_FLAGS (${CONDUIT_SIMD_FLAGS})")
+    endif()
+    message(STATUS "Building SIMD kernels (ENABLE_SIMD == ON, "
+                   "CONDUIT_SIMD_FLAGS == ${CONDUIT_SIMD_FLAGS})")
+    set(CMAKE_C_FLAGS   "${CMAKE_C_FLAGS} ${CONDUIT_SIMD_FLAGS}")
+    set(CMAKE_CXX_FLAGS "${CMAKE_CXX_FLAGS} ${CONDUIT_SIMD_FLAGS}")
+else()
+    message(STATUS "Building without SIMD kernels (ENABLE_SIMD == OFF)")
+endif()
+
 
 ################################
 # Standard CTest Options
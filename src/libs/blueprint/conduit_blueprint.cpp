@@ -102,6 +102,9 @@ verify(const std::string &protocol,
        const Node &n,
        Node &info)
 {
+    CONDUIT_TRACE_SCOPE("blueprint::verify");
+    CONDUIT_TRACE_BYTES(n.total_bytes_compact());
+
     bool res = false;
     info.reset();
     
@@ -2037,6 +2037,9 @@ mesh::verify(const std::string &protocol,
              const Node &n,
              Node &info)
 {
+    CONDUIT_TRACE_SCOPE("blueprint::mesh::verify");
+    CONDUIT_TRACE_BYTES(n.total_bytes_compact());
+
     bool res = false;
     info.reset();
 
@@ -2367,6 +2370,9 @@ bool
 mesh::verify(const Node &n,
              Node &info)
 {
+    CONDUIT_TRACE_SCOPE("blueprint::mesh::verify");
+    CONDUIT_TRACE_BYTES(n.total_bytes_compact());
+
     bool res = true;
     info.reset();
     
@@ -59,10 +59,13 @@
 #include "conduit_core.hpp"
 #include "conduit_error.hpp"
 #include "conduit_endianness.hpp"
+#include "conduit_kernels.hpp"
 #include "conduit_data_type.hpp"
 #include "conduit_data_array.hpp"
 #include "conduit_schema.hpp"
 #include "conduit_node.hpp"
+#include "conduit_node_path.hpp"
+#include "conduit_node_leaf_index.hpp"
 #include "conduit_generator.hpp"
 #include "conduit_utils.hpp"
 
@@ -58,6 +58,18 @@
 // Note: This header is only needed a compile time.
 #include "conduit_license.hpp"
 
+#ifdef CONDUIT_USE_CXX11
+//-----------------------------------------------------------------------------
+// thread pool support
+//-----------------------------------------------------------------------------
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+#endif
+
 //-----------------------------------------------------------------------------
 // -- begin conduit:: --
 //-----------------------------------------------------------------------------
@@ -65,6 +77,294 @@ namespace conduit
 {
 
 
+//-----------------------------------------------------------------------------
+// -- thread pool --
+//-----------------------------------------------------------------------------
+
+// leaf data bytes below which tree operations run serially
+static index_t parallel_min_bytes_value = 1024 * 1024;
+
+#ifdef CONDUIT_USE_CXX11
+//-----------------------------------------------------------------------------
+// Runs one parallel_for at a time. Workers wait for a new job, then take
+// task ids from a shared counter until none are left. The calling thread
+// takes tasks too.
+//-----------------------------------------------------------------------------
+class ThreadPool
+{
+  public:
+      ThreadPool();
+      ~ThreadPool();
+
+      //----------------------------------------------------------------------
+      void    resize(index_t num_threads);
+
+      //----------------------------------------------------------------------
+      index_t num_threads() const
+          { return (index_t)m_workers.size() + 1; }
+
+      //----------------------------------------------------------------------
+      void    run(index_t num_tasks,
+                  void (*func)(index_t task, void *ctx),
+                  void *ctx);
+
+  private:
+      void    stop_workers();
+      void    worker_main(uint64 last_job_id);
+      void    run_tasks();
+
+      std::vector<std::thread>   m_workers;
+
+      // serializes calls to run()
+      std::mutex                 m_run_mutex;
+
+      // guards the job state below
+      std::mutex                 m_mutex;
+      std::condition_variable    m_job_cv;
+      std::condition_variable    m_done_cv;
+      uint64                     m_job_id;
+      index_t                    m_num_busy;
+      bool                       m_stop;
+
+      // current job
+      index_t                    m_num_tasks;
+      std::atomic<index_t>       m_next_task;
+      void                     (*m_func)(index_t, void*);
+      void                      *m_ctx;
+      std::exception_ptr         m_error;
+
+      // true for threads that are running tasks
+      static thread_local bool   m_in_task;
+};
+
+thread_local bool ThreadPool::m_in_task = false;
+
+//---------------------------------------------------------------------------//
+ThreadPool::ThreadPool()
+: m_workers(),
+  m_job_id(0),
+  m_num_busy(0),
+  m_stop(false),
+  m_num_tasks(0),
+  m_next_task(0),
+  m_func(NULL),
+  m_ctx(NULL),
+  m_error()
+{
+    // empty
+}
+
+//---------------------------------------------------------------------------//
+ThreadPool::~ThreadPool()
+{
+    stop_workers();
+}
+
+//---------------------------------------------------------------------------//
+void
+ThreadPool::stop_workers()
+{
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_job_cv.notify_all();
+    for(size_t i = 0; i < m_workers.size(); i++)
+    {
+        m_workers[i].join();
+    }
+    m_workers.clear();
+    m_stop = false;
+}
+
+//---------------------------------------------------------------------------//
+void
+ThreadPool::resize(index_t num_threads)
+{
+    std::lock_guard<std::mutex> run_lock(m_run_mutex);
+    stop_workers();
+    for(index_t i = 1; i < num_threads; i++)
+    {
+        // workers start waiting for the job after the current one
+        m_workers.push_back(std::thread(&ThreadPool::worker_main,
+                                        this,
+                                        m_job_id));
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+ThreadPool::run_tasks()
+{
+    m_in_task = true;
+    index_t task = m_next_task++;
+    while(task < m_num_tasks)
+    {
+        try
+        {
+            m_func(task,m_ctx);
+        }
+        catch(...)
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if(!m_error)
+            {
+                m_error = std::current_exception();
+            }
+            // skip the remaining tasks
+            m_next_task = m_num_tasks;
+        }
+        task = m_next_task++;
+    }
+    m_in_task = false;
+}
+
+//---------------------------------------------------------------------------//
+void
+ThreadPool::worker_main(uint64 last_job_id)
+{
+    while(true)
+    {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            while(!m_stop && m_job_id == last_job_id)
+            {
+                m_job_cv.wait(lock);
+            }
+            if(m_stop)
+            {
+                return;
+            }
+            last_job_id = m_job_id;
+        }
+
+        run_tasks();
+
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_num_busy--;
+        }
+        m_done_cv.notify_all();
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+ThreadPool::run(index_t num_tasks,
+                void (*func)(index_t task, void *ctx),
+                void *ctx)
+{
+    // serial cases, nested calls run in the calling task
+    if(m_workers.empty() || num_tasks == 1 || m_in_task)
+    {
+        for(index_t task = 0; task < num_tasks; task++)
+        {
+            func(task,ctx);
+        }
+        return;
+    }
+
+    std::lock_guard<std::mutex> run_lock(m_run_mutex);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_num_tasks = num_tasks;
+        m_next_task = 0;
+        m_func      = func;
+        m_ctx       = ctx;
+        m_error     = std::exception_ptr();
+        m_num_busy  = (index_t)m_workers.size();
+        m_job_id++;
+    }
+    m_job_cv.notify_all();
+
+    run_tasks();
+
+    std::exception_ptr error;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        while(m_num_busy > 0)
+        {
+            m_done_cv.wait(lock);
+        }
+        error = m_error;
+        m_error = std::exception_ptr();
+    }
+
+    if(error)
+    {
+        std::rethrow_exception(error);
+    }
+}
+
+//---------------------------------------------------------------------------//
+static ThreadPool &
+thread_pool()
+{
+    static ThreadPool pool;
+    return pool;
+}
+#endif
+
+//---------------------------------------------------------------------------//
+void
+set_num_threads(index_t num_threads)
+{
+#ifdef CONDUIT_USE_CXX11
+    if(num_threads <= 0)
+    {
+        num_threads = (index_t)std::thread::hardware_concurrency();
+    }
+    if(num_threads < 1)
+    {
+        num_threads = 1;
+    }
+    thread_pool().resize(num_threads);
+#else
+    (void)num_threads;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+index_t
+num_threads()
+{
+#ifdef CONDUIT_USE_CXX11
+    return thread_pool().num_threads();
+#else
+    return 1;
+#endif
+}
+
+//---------------------------------------------------------------------------//
+void
+set_parallel_min_bytes(index_t num_bytes)
+{
+    parallel_min_bytes_value = num_bytes;
+}
+
+//---------------------------------------------------------------------------//
+index_t
+parallel_min_bytes()
+{
+    return parallel_min_bytes_value;
+}
+
+//---------------------------------------------------------------------------//
+void
+parallel_for(index_t num_tasks,
+             void (*func)(index_t task, void *ctx),
+             void *ctx)
+{
+#ifdef CONDUIT_USE_CXX11
+    thread_pool().run(num_tasks,func,ctx);
+#else
+    for(index_t task = 0; task < num_tasks; task++)
+    {
+        func(task,ctx);
+    }
+#endif
+}
+
 //---------------------------------------------------------------------------//
 std::string
 about()
@@ -99,6 +399,8 @@ about(Node &n)
 #endif
     
     n["system"] = CONDUIT_SYSTEM_TYPE;
+    n["num_threads"] = num_threads();
+    utils::memory_stats(n["memory"]);
     n["install_prefix"] = CONDUIT_INSTALL_PREFIX;
     n["license"] = CONDUIT_LICENSE_TEXT;
     
@@ -72,6 +72,16 @@
 //-----------------------------------------------------------------------------
 #include "conduit_bitwidth_style_types.h"
 
+//-----------------------------------------------------------------------------
+// -- detect rvalue reference support in client code -- 
+//-----------------------------------------------------------------------------
+// Move constructors and move assignment operators are defined inline on top
+// of swap(), so they only depend on how client code is compiled, not on
+// how conduit was built.
+#if (__cplusplus >= 201103L) || (defined(_MSC_VER) && _MSC_VER >= 1900)
+#define CONDUIT_HAS_MOVE_SEMANTICS 1
+#endif
+
 //-----------------------------------------------------------------------------
 // -- begin conduit:: --
 //-----------------------------------------------------------------------------
@@ -114,6 +124,34 @@ typedef conduit_index_t   index_t;
 std::string CONDUIT_API about();
 void        CONDUIT_API about(Node &);
 
+//-----------------------------------------------------------------------------
+/// Threads used by the parallel tree operations. Node::set_node (and set),
+/// Node::compact_to, Node::update and Node::diff set up the structure of 
+/// their results first, then copy or compare the leaves of large trees 
+/// concurrently, in pieces of similar byte counts.
+///
+/// Threading is off by default (1 thread). It is only available when 
+/// conduit is built with C++11 support, otherwise the thread count stays 1.
+/// Don't change these settings while a parallel operation is running.
+//-----------------------------------------------------------------------------
+/// sets the number of threads used (including the calling thread),
+/// 0 selects the number of hardware threads
+void        CONDUIT_API set_num_threads(index_t num_threads);
+index_t     CONDUIT_API num_threads();
+
+/// operations on trees with fewer bytes of leaf data than this run
+/// serially (default 1 MiB)
+void        CONDUIT_API set_parallel_min_bytes(index_t num_bytes);
+index_t     CONDUIT_API parallel_min_bytes();
+
+/// calls func(task, ctx) for each task in [0, num_tasks) using the threads,
+/// in order of task id, and returns when all of them have finished.
+/// Runs serially when threading is off, or when called from inside a task.
+/// If tasks throw, the first exception is rethrown.
+void        CONDUIT_API parallel_for(index_t num_tasks,
+                                     void (*func)(index_t task, void *ctx),
+                                     void *ctx);
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit:: --
@@ -55,6 +55,11 @@
 #include <algorithm>
 #include <cstring>
 #include <limits>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
 
 
 //-----------------------------------------------------------------------------
@@ -62,6 +67,7 @@
 //-----------------------------------------------------------------------------
 #include "conduit_node.hpp"
 #include "conduit_utils.hpp"
+#include "conduit_kernels.hpp"
 #include "conduit_log.hpp"
 
 // Easier access to the Conduit logging functions
@@ -73,6 +79,578 @@ using namespace conduit::utils;
 namespace conduit
 {
 
+//-----------------------------------------------------------------------------
+// -- begin conduit::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+// maps a c++ numeric type to the bitwidth style dtype id with the same
+// layout (returns EMPTY_ID for types without one)
+//-----------------------------------------------------------------------------
+template <typename T>
+index_t
+numeric_dtype_id()
+{
+    index_t nbytes = (index_t) sizeof(T);
+    if(!std::numeric_limits<T>::is_integer)
+    {
+        if(nbytes == 4)
+            return DataType::FLOAT32_ID;
+        else if(nbytes == 8)
+            return DataType::FLOAT64_ID;
+    }
+    else if(std::numeric_limits<T>::is_signed)
+    {
+        if(nbytes == 1)
+            return DataType::INT8_ID;
+        else if(nbytes == 2)
+            return DataType::INT16_ID;
+        else if(nbytes == 4)
+            return DataType::INT32_ID;
+        else if(nbytes == 8)
+            return DataType::INT64_ID;
+    }
+    else
+    {
+        if(nbytes == 1)
+            return DataType::UINT8_ID;
+        else if(nbytes == 2)
+            return DataType::UINT16_ID;
+        else if(nbytes == 4)
+            return DataType::UINT32_ID;
+        else if(nbytes == 8)
+            return DataType::UINT64_ID;
+    }
+    return DataType::EMPTY_ID;
+}
+
+//-----------------------------------------------------------------------------
+// converts values into a data array using the conversion kernels
+//-----------------------------------------------------------------------------
+template <typename T, typename S>
+void
+convert_values(DataArray<T> &dest,
+               const S *src,
+               index_t src_stride,
+               index_t num_elements)
+{
+    index_t dest_id = numeric_dtype_id<T>();
+    if(dest_id != DataType::EMPTY_ID)
+    {
+        kernels::convert(dest.element_ptr(0),
+                         dest_id,
+                         dest.dtype().stride(),
+                         src,
+                         numeric_dtype_id<S>(),
+                         src_stride,
+                         num_elements);
+    }
+    else
+    {
+        const uint8 *src_ptr = (const uint8*)src;
+        for(index_t i=0; i < num_elements; i++)
+        {
+            dest.element(i) = (T)*((const S*)(src_ptr + i * src_stride));
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// reduction helpers
+//-----------------------------------------------------------------------------
+// min and max start from these values: +/- inf for floating point
+// types (so arrays of +/- inf reduce correctly), the numeric max / lowest
+// value for integers
+//-----------------------------------------------------------------------------
+template <typename T>
+inline T
+min_identity()
+{
+    return std::numeric_limits<T>::has_infinity ?
+                std::numeric_limits<T>::infinity() :
+                std::numeric_limits<T>::max();
+}
+
+//-----------------------------------------------------------------------------
+template <typename T>
+inline T
+max_identity()
+{
+    return std::numeric_limits<T>::has_infinity ?
+               -std::numeric_limits<T>::infinity() :
+                std::numeric_limits<T>::min();
+}
+
+//-----------------------------------------------------------------------------
+template <typename T>
+inline bool
+is_finite(T val)
+{
+    // nan and +/- inf produce nan
+    return std::numeric_limits<T>::is_integer || (val - val) == (val - val);
+}
+
+//-----------------------------------------------------------------------------
+// contiguous reductions use independent accumulators to break the 
+// dependency chain, float32 and float64 have explicit SSE / AVX versions
+// below (compilers won't vectorize floating point min, max and sum 
+// reductions without relaxed math flags)
+//-----------------------------------------------------------------------------
+template <typename T>
+T
+contiguous_min(const T *ptr, index_t num_ele)
+{
+    T a0 = min_identity<T>();
+    T a1 = a0, a2 = a0, a3 = a0;
+
+    index_t i = 0;
+    for(; i + 4 <= num_ele; i += 4)
+    {
+        a0 = ptr[i]   < a0 ? ptr[i]   : a0;
+        a1 = ptr[i+1] < a1 ? ptr[i+1] : a1;
+        a2 = ptr[i+2] < a2 ? ptr[i+2] : a2;
+        a3 = ptr[i+3] < a3 ? ptr[i+3] : a3;
+    }
+
+    a0 = a1 < a0 ? a1 : a0;
+    a2 = a3 < a2 ? a3 : a2;
+    a0 = a2 < a0 ? a2 : a0;
+    for(; i < num_ele; i++)
+    {
+        a0 = ptr[i] < a0 ? ptr[i] : a0;
+    }
+    return a0;
+}
+
+//-----------------------------------------------------------------------------
+template <typename T>
+T
+contiguous_max(const T *ptr, index_t num_ele)
+{
+    T a0 = max_identity<T>();
+    T a1 = a0, a2 = a0, a3 = a0;
+
+    index_t i = 0;
+    for(; i + 4 <= num_ele; i += 4)
+    {
+        a0 = ptr[i]   > a0 ? ptr[i]   : a0;
+        a1 = ptr[i+1] > a1 ? ptr[i+1] : a1;
+        a2 = ptr[i+2] > a2 ? ptr[i+2] : a2;
+        a3 = ptr[i+3] > a3 ? ptr[i+3] : a3;
+    }
+
+    a0 = a1 > a0 ? a1 : a0;
+    a2 = a3 > a2 ? a3 : a2;
+    a0 = a2 > a0 ? a2 : a0;
+    for(; i < num_ele; i++)
+    {
+        a0 = ptr[i] > a0 ? ptr[i] : a0;
+    }
+    return a0;
+}
+
+//-----------------------------------------------------------------------------
+template <typename T, typename A>
+A
+contiguous_sum(const T *ptr, index_t num_ele)
+{
+    A a0 = 0, a1 = 0, a2 = 0, a3 = 0;
+
+    index_t i = 0;
+    for(; i + 4 <= num_ele; i += 4)
+    {
+        a0 += (A)ptr[i];
+        a1 += (A)ptr[i+1];
+        a2 += (A)ptr[i+2];
+        a3 += (A)ptr[i+3];
+    }
+
+    a0 = (a0 + a1) + (a2 + a3);
+    for(; i < num_ele; i++)
+    {
+        a0 += (A)ptr[i];
+    }
+    return a0;
+}
+
+#if defined(__SSE2__)
+//-----------------------------------------------------------------------------
+// note: min / max instructions return their second operand when either
+// is a nan, passing the accumulator second skips nans
+//-----------------------------------------------------------------------------
+#if defined(__AVX__)
+#define CONDUIT_REDUCE_PD(name, op, init)                                   \
+template <>                                                                 \
+float64                                                                     \
+name<float64>(const float64 *ptr, index_t num_ele)                          \
+{                                                                           \
+    __m256d acc0 = _mm256_set1_pd(init);                                    \
+    __m256d acc1 = acc0;                                                    \
+    index_t i = 0;                                                          \
+    for(; i + 8 <= num_ele; i += 8)                                         \
+    {                                                                       \
+        acc0 = _mm256_##op##_pd(_mm256_loadu_pd(ptr + i), acc0);            \
+        acc1 = _mm256_##op##_pd(_mm256_loadu_pd(ptr + i + 4), acc1);        \
+    }                                                                       \
+    acc0 = _mm256_##op##_pd(acc1, acc0);                                    \
+    __m128d res = _mm_##op##_pd(_mm256_castpd256_pd128(acc0),               \
+                                _mm256_extractf128_pd(acc0, 1));            \
+    float64 vals[2];                                                        \
+    _mm_storeu_pd(vals, res);                                               \
+    res = _mm_##op##_sd(_mm_set_sd(vals[1]), _mm_set_sd(vals[0]));          \
+    for(; i < num_ele; i++)                                                 \
+    {                                                                       \
+        res = _mm_##op##_sd(_mm_set_sd(ptr[i]), res);                       \
+    }                                                                       \
+    return _mm_cvtsd_f64(res);                                              \
+}
+#else
+#define CONDUIT_REDUCE_PD(name, op, init)                                   \
+template <>                                                                 \
+float64                                                                     \
+name<float64>(const float64 *ptr, index_t num_ele)                          \
+{                                                                           \
+    __m128d acc0 = _mm_set1_pd(init);                                       \
+    __m128d acc1 = acc0;                                                    \
+    index_t i = 0;                                                          \
+    for(; i + 4 <= num_ele; i += 4)                                         \
+    {                                                                       \
+        acc0 = _mm_##op##_pd(_mm_loadu_pd(ptr + i), acc0);                  \
+        acc1 = _mm_##op##_pd(_mm_loadu_pd(ptr + i + 2), acc1);              \
+    }                                                                       \
+    __m128d res = _mm_##op##_pd(acc1, acc0);                                \
+    float64 vals[2];                                                        \
+    _mm_storeu_pd(vals, res);                                               \
+    res = _mm_##op##_sd(_mm_set_sd(vals[1]), _mm_set_sd(vals[0]));          \
+    for(; i < num_ele; i++)                                                 \
+    {                                                                       \
+        res = _mm_##op##_sd(_mm_set_sd(ptr[i]), res);                       \
+    }                                                                       \
+    return _mm_cvtsd_f64(res);                                              \
+}
+#endif
+
+//-----------------------------------------------------------------------------
+#define CONDUIT_REDUCE_PS(name, op, init)                                   \
+template <>                                                                 \
+float32                                                                     \
+name<float32>(const float32 *ptr, index_t num_ele)                          \
+{                                                                           \
+    __m128 acc0 = _mm_set1_ps(init);                                        \
+    __m128 acc1 = acc0;                                                     \
+    index_t i = 0;                                                          \
+    for(; i + 8 <= num_ele; i += 8)                                         \
+    {                                                                       \
+        acc0 = _mm_##op##_ps(_mm_loadu_ps(ptr + i), acc0);                  \
+        acc1 = _mm_##op##_ps(_mm_loadu_ps(ptr + i + 4), acc1);              \
+    }                                                                       \
+    acc0 = _mm_##op##_ps(acc1, acc0);                                       \
+    float32 vals[4];                                                        \
+    _mm_storeu_ps(vals, acc0);                                              \
+    __m128 res = _mm_set_ss(vals[0]);                                       \
+    for(int l = 1; l < 4; l++)                                              \
+    {                                                                       \
+        res = _mm_##op##_ss(_mm_set_ss(vals[l]), res);                      \
+    }                                                                       \
+    for(; i < num_ele; i++)                                                 \
+    {                                                                       \
+        res = _mm_##op##_ss(_mm_set_ss(ptr[i]), res);                       \
+    }                                                                       \
+    return _mm_cvtss_f32(res);                                              \
+}
+
+CONDUIT_REDUCE_PD(contiguous_min, min, min_identity<float64>())
+CONDUIT_REDUCE_PD(contiguous_max, max, max_identity<float64>())
+CONDUIT_REDUCE_PS(contiguous_min, min, min_identity<float32>())
+CONDUIT_REDUCE_PS(contiguous_max, max, max_identity<float32>())
+
+#undef CONDUIT_REDUCE_PD
+#undef CONDUIT_REDUCE_PS
+
+//-----------------------------------------------------------------------------
+template <>
+float64
+contiguous_sum<float64,float64>(const float64 *ptr, index_t num_ele)
+{
+    __m128d acc0 = _mm_setzero_pd();
+    __m128d acc1 = acc0;
+    index_t i = 0;
+    for(; i + 4 <= num_ele; i += 4)
+    {
+        acc0 = _mm_add_pd(acc0, _mm_loadu_pd(ptr + i));
+        acc1 = _mm_add_pd(acc1, _mm_loadu_pd(ptr + i + 2));
+    }
+    float64 vals[2];
+    _mm_storeu_pd(vals, _mm_add_pd(acc0, acc1));
+    float64 res = vals[0] + vals[1];
+    for(; i < num_ele; i++)
+    {
+        res += ptr[i];
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+template <>
+float32
+contiguous_sum<float32,float32>(const float32 *ptr, index_t num_ele)
+{
+    __m128 acc0 = _mm_setzero_ps();
+    __m128 acc1 = acc0;
+    index_t i = 0;
+    for(; i + 8 <= num_ele; i += 8)
+    {
+        acc0 = _mm_add_ps(acc0, _mm_loadu_ps(ptr + i));
+        acc1 = _mm_add_ps(acc1, _mm_loadu_ps(ptr + i + 4));
+    }
+    float32 vals[4];
+    _mm_storeu_ps(vals, _mm_add_ps(acc0, acc1));
+    float32 res = (vals[0] + vals[1]) + (vals[2] + vals[3]);
+    for(; i < num_ele; i++)
+    {
+        res += ptr[i];
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+template <>
+float64
+contiguous_sum<float32,float64>(const float32 *ptr, index_t num_ele)
+{
+    __m128d acc0 = _mm_setzero_pd();
+    __m128d acc1 = acc0;
+    index_t i = 0;
+    for(; i + 4 <= num_ele; i += 4)
+    {
+        __m128 v = _mm_loadu_ps(ptr + i);
+        acc0 = _mm_add_pd(acc0, _mm_cvtps_pd(v));
+        acc1 = _mm_add_pd(acc1, _mm_cvtps_pd(_mm_movehl_ps(v, v)));
+    }
+    float64 vals[2];
+    _mm_storeu_pd(vals, _mm_add_pd(acc0, acc1));
+    float64 res = vals[0] + vals[1];
+    for(; i < num_ele; i++)
+    {
+        res += (float64)ptr[i];
+    }
+    return res;
+}
+#endif
+
+//-----------------------------------------------------------------------------
+// index of the first smallest value, nans are skipped (0 if all are nan)
+template <typename T>
+index_t
+contiguous_argmin(const T *ptr, index_t num_ele)
+{
+    index_t res = 0;
+    T res_val = min_identity<T>();
+    for(index_t i = 0; i < num_ele; i++)
+    {
+        if(ptr[i] < res_val)
+        {
+            res_val = ptr[i];
+            res = i;
+        }
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+// index of the first largest value, nans are skipped (0 if all are nan)
+template <typename T>
+index_t
+contiguous_argmax(const T *ptr, index_t num_ele)
+{
+    index_t res = 0;
+    T res_val = max_identity<T>();
+    for(index_t i = 0; i < num_ele; i++)
+    {
+        if(ptr[i] > res_val)
+        {
+            res_val = ptr[i];
+            res = i;
+        }
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+template <typename T>
+index_t
+contiguous_count_nonfinite(const T *ptr, index_t num_ele)
+{
+    index_t res = 0;
+    for(index_t i = 0; i < num_ele; i++)
+    {
+        res += is_finite(ptr[i]) ? 0 : 1;
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+// true if the array is not empty and all of its values are nan
+//-----------------------------------------------------------------------------
+template <typename T>
+bool
+all_nan(const DataArray<T> &values)
+{
+    index_t num_ele = values.number_of_elements();
+    for(index_t i = 0; i < num_ele; i++)
+    {
+        T val = values.element(i);
+        if(val == val)
+        {
+            return false;
+        }
+    }
+    return num_ele > 0;
+}
+
+//-----------------------------------------------------------------------------
+// chunked reductions: large contiguous arrays are split into one chunk 
+// per thread, the chunks are reduced with parallel_for and the per chunk
+// results are combined by the caller
+//-----------------------------------------------------------------------------
+inline index_t
+number_of_chunks(index_t num_ele, index_t ele_bytes)
+{
+    index_t n_threads = num_threads();
+    if(n_threads < 2 || num_ele * ele_bytes < parallel_min_bytes())
+    {
+        return 1;
+    }
+    return n_threads < num_ele ? n_threads : num_ele;
+}
+
+//-----------------------------------------------------------------------------
+template <typename T, typename R>
+struct ChunkReduction
+{
+    R            (*kernel)(const T *, index_t);
+    const T       *ptr;
+    index_t        num_ele;
+    index_t        chunk_size;
+    std::vector<R> results;
+
+    index_t chunk_start(index_t chunk) const
+    {
+        return chunk * chunk_size;
+    }
+
+    index_t chunk_length(index_t chunk) const
+    {
+        index_t end = chunk_start(chunk) + chunk_size;
+        return (end < num_ele ? end : num_ele) - chunk_start(chunk);
+    }
+};
+
+//-----------------------------------------------------------------------------
+template <typename T, typename R>
+void
+chunk_reduction_task(index_t chunk, void *ctx)
+{
+    ChunkReduction<T,R> &red = *(ChunkReduction<T,R>*)ctx;
+    red.results[(size_t)chunk] = red.kernel(red.ptr + red.chunk_start(chunk),
+                                            red.chunk_length(chunk));
+}
+
+//-----------------------------------------------------------------------------
+// fills red.results with the kernel result for each chunk of ptr
+template <typename T, typename R>
+void
+reduce_chunks(R (*kernel)(const T *, index_t),
+              const T *ptr,
+              index_t num_ele,
+              ChunkReduction<T,R> &red)
+{
+    index_t num_chunks = number_of_chunks(num_ele,(index_t)sizeof(T));
+    red.kernel     = kernel;
+    red.ptr        = ptr;
+    red.num_ele    = num_ele;
+    red.chunk_size = (num_ele + num_chunks - 1) / num_chunks;
+    red.results.resize((size_t)num_chunks);
+
+    if(num_chunks == 1)
+    {
+        red.results[0] = kernel(ptr,num_ele);
+    }
+    else
+    {
+        parallel_for(num_chunks,chunk_reduction_task<T,R>,&red);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// histogram bin of val, or -1 if val is outside of the range (or nan)
+inline index_t
+histogram_bin(float64 val,
+              float64 range_min,
+              float64 range_max,
+              float64 scale,
+              index_t num_bins)
+{
+    if( !(val >= range_min && val <= range_max) )
+    {
+        return -1;
+    }
+
+    index_t bin = (index_t)((val - range_min) * scale);
+    // range_max lands in the last bin
+    return bin < num_bins ? bin : num_bins - 1;
+}
+
+//-----------------------------------------------------------------------------
+template <typename T>
+struct ChunkHistogram
+{
+    const T             *ptr;
+    index_t              num_ele;
+    index_t              chunk_size;
+    float64              range_min;
+    float64              range_max;
+    index_t              num_bins;
+    // num_bins counts per chunk
+    std::vector<int64>   counts;
+};
+
+//-----------------------------------------------------------------------------
+template <typename T>
+void
+chunk_histogram_task(index_t chunk, void *ctx)
+{
+    ChunkHistogram<T> &hist = *(ChunkHistogram<T>*)ctx;
+    index_t start = chunk * hist.chunk_size;
+    index_t end   = start + hist.chunk_size;
+    if(end > hist.num_ele)
+    {
+        end = hist.num_ele;
+    }
+
+    int64 *counts = &hist.counts[(size_t)(chunk * hist.num_bins)];
+    float64 scale = (float64) hist.num_bins / 
+                    (hist.range_max - hist.range_min);
+    for(index_t i = start; i < end; i++)
+    {
+        index_t bin = histogram_bin((float64) hist.ptr[i],
+                                    hist.range_min,
+                                    hist.range_max,
+                                    scale,
+                                    hist.num_bins);
+        if(bin >= 0)
+        {
+            counts[bin]++;
+        }
+    }
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::detail --
+//-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
 //
@@ -129,18 +707,337 @@ DataArray<T>::operator=(const DataArray<T> &array)
 
 //---------------------------------------------------------------------------//
 template <typename T> 
-T &
-DataArray<T>::element(index_t idx)
+bool
+DataArray<T>::is_contiguous() const
 { 
-    return (*(T*)(element_ptr(idx)));
+    return m_dtype.stride() == (index_t)sizeof(T) ||
+           m_dtype.number_of_elements() < 2;
 }
 
 //---------------------------------------------------------------------------//
 template <typename T> 
-T &             
-DataArray<T>::element(index_t idx) const 
+T *
+DataArray<T>::contiguous_data_ptr() const
 { 
-    return (*(T*)(element_ptr(idx)));
+    if(!is_contiguous())
+    {
+        return NULL;
+    }
+    return (T*)begin_ptr();
+}
+
+//---------------------------------------------------------------------------//
+template <typename T> 
+T
+DataArray<T>::min() const
+{
+    index_t num_ele = number_of_elements();
+    const T *ptr = contiguous_data_ptr();
+    T res = detail::min_identity<T>();
+    if(ptr != NULL)
+    {
+        detail::ChunkReduction<T,T> red;
+        detail::reduce_chunks(&detail::contiguous_min<T>,ptr,num_ele,red);
+        res = detail::contiguous_min(&red.results[0],
+                                     (index_t)red.results.size());
+    }
+    else
+    {
+        for(index_t i = 0; i < num_ele; i++)
+        {
+            T val = element(i);
+            res = val < res ? val : res;
+        }
+    }
+
+    // nothing compared below the start value: all +inf, or all nan
+    if(res == detail::min_identity<T>() && detail::all_nan(*this))
+    {
+        res = element(0);
+    }
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+template <typename T> 
+T
+DataArray<T>::max() const
+{
+    index_t num_ele = number_of_elements();
+    const T *ptr = contiguous_data_ptr();
+    T res = detail::max_identity<T>();
+    if(ptr != NULL)
+    {
+        detail::ChunkReduction<T,T> red;
+        detail::reduce_chunks(&detail::contiguous_max<T>,ptr,num_ele,red);
+        res = detail::contiguous_max(&red.results[0],
+                                     (index_t)red.results.size());
+    }
+    else
+    {
+        for(index_t i = 0; i < num_ele; i++)
+        {
+            T val = element(i);
+            res = val > res ? val : res;
+        }
+    }
+
+    // nothing compared above the start value: all -inf, or all nan
+    if(res == detail::max_identity<T>() && detail::all_nan(*this))
+    {
+        res = element(0);
+    }
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+template <typename T> 
+typename DataArray<T>::sum_type
+DataArray<T>::sum() const
+{
+    index_t num_ele = number_of_elements();
+    const T *ptr = contiguous_data_ptr();
+    if(ptr != NULL)
+    {
+        detail::ChunkReduction<T,sum_type> red;
+        detail::reduce_chunks(&detail::contiguous_sum<T,sum_type>,
+                              ptr,
+                              num_ele,
+                              red);
+        return detail::contiguous_sum<sum_type,sum_type>(&red.results[0],
+                                          (index_t)red.results.size());
+    }
+
+    sum_type res = 0;
+    for(index_t i = 0; i < num_ele; i++)
+    {
+        res += (sum_type)element(i);
+    }
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+template <typename T> 
+float64
+DataArray<T>::mean() const
+{
+    index_t num_ele = number_of_elements();
+    const T *ptr = contiguous_data_ptr();
+    float64 res = 0.0;
+    if(ptr != NULL)
+    {
+        detail::ChunkReduction<T,float64> red;
+        detail::reduce_chunks(&detail::contiguous_sum<T,float64>,
+                              ptr,
+                              num_ele,
+                              red);
+        res = detail::contiguous_sum<float64,float64>(&red.results[0],
+                                          (index_t)red.results.size());
+    }
+    else
+    {
+        for(index_t i = 0; i < num_ele; i++)
+        {
+            res += (float64)element(i);
+        }
+    }
+    return res / (float64) num_ele;
+}
+
+//---------------------------------------------------------------------------//
+template <typename T> 
+index_t
+DataArray<T>::argmin() const
+{
+    index_t num_ele = number_of_elements();
+    if(num_ele == 0)
+    {
+        return -1;
+    }
+
+    index_t res = 0;
+    T res_val = detail::min_identity<T>();
+    const T *ptr = contiguous_data_ptr();
+    if(ptr != NULL)
+    {
+        detail::ChunkReduction<T,index_t> red;
+        detail::reduce_chunks(&detail::contiguous_argmin<T>,ptr,num_ele,red);
+        // chunks are in order, so the first smallest value wins
+        for(size_t c = 0; c < red.results.size(); c++)
+        {
+            index_t idx = red.chunk_start((index_t)c) + red.results[c];
+            if(ptr[idx] < res_val)
+            {
+                res_val = ptr[idx];
+                res = idx;
+            }
+        }
+        return res;
+    }
+
+    for(index_t i = 0; i < num_ele; i++)
+    {
+        T val = element(i);
+        if(val < res_val)
+        {
+            res_val = val;
+            res = i;
+        }
+    }
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+template <typename T> 
+index_t
+DataArray<T>::argmax() const
+{
+    index_t num_ele = number_of_elements();
+    if(num_ele == 0)
+    {
+        return -1;
+    }
+
+    index_t res = 0;
+    T res_val = detail::max_identity<T>();
+    const T *ptr = contiguous_data_ptr();
+    if(ptr != NULL)
+    {
+        detail::ChunkReduction<T,index_t> red;
+        detail::reduce_chunks(&detail::contiguous_argmax<T>,ptr,num_ele,red);
+        // chunks are in order, so the first largest value wins
+        for(size_t c = 0; c < red.results.size(); c++)
+        {
+            index_t idx = red.chunk_start((index_t)c) + red.results[c];
+            if(ptr[idx] > res_val)
+            {
+                res_val = ptr[idx];
+                res = idx;
+            }
+        }
+        return res;
+    }
+
+    for(index_t i = 0; i < num_ele; i++)
+    {
+        T val = element(i);
+        if(val > res_val)
+        {
+            res_val = val;
+            res = i;
+        }
+    }
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+template <typename T> 
+index_t
+DataArray<T>::count_nonfinite() const
+{
+    index_t res = 0;
+    if(std::numeric_limits<T>::is_integer)
+    {
+        return res;
+    }
+
+    index_t num_ele = number_of_elements();
+    const T *ptr = contiguous_data_ptr();
+    if(ptr != NULL)
+    {
+        detail::ChunkReduction<T,index_t> red;
+        detail::reduce_chunks(&detail::contiguous_count_nonfinite<T>,
+                              ptr,
+                              num_ele,
+                              red);
+        for(size_t c = 0; c < red.results.size(); c++)
+        {
+            res += red.results[c];
+        }
+    }
+    else
+    {
+        for(index_t i = 0; i < num_ele; i++)
+        {
+            res += detail::is_finite(element(i)) ? 0 : 1;
+        }
+    }
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+template <typename T> 
+void
+DataArray<T>::histogram(float64 range_min,
+                        float64 range_max,
+                        index_t num_bins,
+                        Node &res) const
+{
+    if(num_bins < 1)
+    {
+        CONDUIT_ERROR("DataArray::histogram: num_bins must be >= 1 "
+                      << "(passed num_bins = " << num_bins << ")");
+    }
+
+    if( !(range_max > range_min) )
+    {
+        CONDUIT_ERROR("DataArray::histogram: range_max must be greater "
+                      << "than range_min "
+                      << "(passed range = [" << range_min << ", " 
+                      << range_max << "])");
+    }
+
+    res.set(DataType::int64(num_bins));
+    int64 *counts = res.value();
+    memset(counts, 0, sizeof(int64) * (size_t) num_bins);
+
+    index_t num_ele = number_of_elements();
+    const T *ptr = contiguous_data_ptr();
+    if(ptr != NULL)
+    {
+        index_t num_chunks = detail::number_of_chunks(num_ele,
+                                                      (index_t)sizeof(T));
+        detail::ChunkHistogram<T> hist;
+        hist.ptr        = ptr;
+        hist.num_ele    = num_ele;
+        hist.chunk_size = (num_ele + num_chunks - 1) / num_chunks;
+        hist.range_min  = range_min;
+        hist.range_max  = range_max;
+        hist.num_bins   = num_bins;
+        hist.counts.assign((size_t)(num_chunks * num_bins),0);
+
+        if(num_chunks == 1)
+        {
+            detail::chunk_histogram_task<T>(0,&hist);
+        }
+        else
+        {
+            parallel_for(num_chunks,detail::chunk_histogram_task<T>,&hist);
+        }
+
+        for(index_t c = 0; c < num_chunks; c++)
+        {
+            for(index_t b = 0; b < num_bins; b++)
+            {
+                counts[b] += hist.counts[(size_t)(c * num_bins + b)];
+            }
+        }
+        return;
+    }
+
+    float64 scale = (float64) num_bins / (range_max - range_min);
+    for(index_t i = 0; i < num_ele; i++)
+    {
+        index_t bin = detail::histogram_bin((float64) element(i),
+                                            range_min,
+                                            range_max,
+                                            scale,
+                                            num_bins);
+        if(bin >= 0)
+        {
+            counts[bin]++;
+        }
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -383,55 +1280,96 @@ DataArray<T>::to_json(std::ostream &os) const
 template <typename T> 
 void            
 DataArray<T>::to_json_stream(std::ostream &os) const 
+{ 
+    utils::TextWriter w(os);
+    to_json_stream(w);
+}
+
+//---------------------------------------------------------------------------//
+template <typename T> 
+void            
+DataArray<T>::to_json_stream(utils::TextWriter &w) const 
 { 
     index_t nele = number_of_elements();
     if(nele > 1)
-        os << "[";
+        w.write('[');
 
-    bool first=true;
-    for(index_t idx = 0; idx < nele; idx++)
+    switch(m_dtype.id())
     {
-        if(!first)
-            os << ", ";
-        switch(m_dtype.id())
+        // ints 
+        case DataType::INT8_ID:
+        case DataType::INT16_ID: 
+        case DataType::INT32_ID:
+        case DataType::INT64_ID:
         {
-            // ints 
-            case DataType::INT8_ID:
-            case DataType::INT16_ID: 
-            case DataType::INT32_ID:
-            case DataType::INT64_ID:
+            for(index_t idx = 0; idx < nele; idx++)
             {
-                 os << (int64) element(idx);
-                 break;
+                if(idx > 0)
+                    w.write(", ",2);
+                w.write_int64((int64) element(idx));
             }
-            // uints
-            case DataType::UINT8_ID:
-            case DataType::UINT16_ID:
-            case DataType::UINT32_ID:
-            case DataType::UINT64_ID:
+            break;
+        }
+        // uints
+        case DataType::UINT8_ID:
+        case DataType::UINT16_ID:
+        case DataType::UINT32_ID:
+        case DataType::UINT64_ID:
+        {
+            for(index_t idx = 0; idx < nele; idx++)
             {
-                os << (uint64) element(idx);
-                break;
+                if(idx > 0)
+                    w.write(", ",2);
+                w.write_uint64((uint64) element(idx));
+            }
+            break;
+        }
+        // floats 
+        case DataType::FLOAT32_ID: 
+        {
+            for(index_t idx = 0; idx < nele; idx++)
+            {
+                if(idx > 0)
+                    w.write(", ",2);
+                float32 val = (float32) element(idx);
+                // inf and nan are written as strings
+                if(detail::is_finite(val))
+                {
+                    w.write_float32(val);
+                }
+                else
+                {
+                    w.write('"');
+                    w.write_float32(val);
+                    w.write('"');
+                }
             }
-            // floats 
-            case DataType::FLOAT32_ID: 
-            case DataType::FLOAT64_ID: 
+            break;
+        }
+        case DataType::FLOAT64_ID: 
+        {
+            for(index_t idx = 0; idx < nele; idx++)
             {
-                std::string fs = utils::float64_to_string((float64)element(idx));
-                //check for inf and nan
-                // looking for 'n' covers inf and nan
-                bool inf_or_nan = fs.find('n') != std::string::npos;
-                
-                if(inf_or_nan)
-                    os << "\"";
-                
-                os << fs;
-
-                if(inf_or_nan)
-                    os << "\"";
-                break;
+                if(idx > 0)
+                    w.write(", ",2);
+                float64 val = (float64) element(idx);
+                // inf and nan are written as strings
+                if(detail::is_finite(val))
+                {
+                    w.write_float64(val);
+                }
+                else
+                {
+                    w.write('"');
+                    w.write_float64(val);
+                    w.write('"');
+                }
             }
-            default:
+            break;
+        }
+        default:
+        {
+            if(nele > 0)
             {
                 CONDUIT_ERROR("Leaf type \"" 
                               <<  m_dtype.name()
@@ -439,11 +1377,10 @@ DataArray<T>::to_json_stream(std::ostream &os) const
                               << "is not supported in conduit::DataArray.")
             }
         }
-        first=false;
     }
 
     if(nele > 1)
-        os << "]";
+        w.write(']');
 }
 
 //---------------------------------------------------------------------------//
@@ -470,10 +1407,10 @@ template <typename T>
 void            
 DataArray<T>::set(const int8 *values, index_t num_elements)
 { 
-    for(index_t i=0;i<num_elements;i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert_values(*this,
+                           values,
+                           (index_t)sizeof(int8),
+                           num_elements);
 }
 
 //---------------------------------------------------------------------------//
@@ -481,10 +1418,10 @@ template <typename T>
 void            
 DataArray<T>::set(const  int16 *values, index_t num_elements)
 { 
-    for(index_t i=0;i<num_elements;i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert_values(*this,
+                           values,
+                           (index_t)sizeof(int16),
+                           num_elements);
 }
 
 //---------------------------------------------------------------------------//
@@ -492,10 +1429,10 @@ template <typename T>
 void            
 DataArray<T>::set(const int32 *values, index_t num_elements)
 { 
-    for(index_t i=0;i<num_elements;i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert_values(*this,
+                           values,
+                           (index_t)sizeof(int32),
+                           num_elements);
 }
 
 //---------------------------------------------------------------------------//
@@ -503,10 +1440,10 @@ template <typename T>
 void            
 DataArray<T>::set(const  int64 *values, index_t num_elements)
 { 
-    for(index_t i=0;i<num_elements;i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert_values(*this,
+                           values,
+                           (index_t)sizeof(int64),
+                           num_elements);
 }
 
 //---------------------------------------------------------------------------//
@@ -514,10 +1451,10 @@ template <typename T>
 void            
 DataArray<T>::set(const  uint8 *values, index_t num_elements)
 { 
-    for(index_t i=0;i<num_elements;i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert_values(*this,
+                           values,
+                           (index_t)sizeof(uint8),
+                           num_elements);
 }
 
 //---------------------------------------------------------------------------//
@@ -525,10 +1462,10 @@ template <typename T>
 void            
 DataArray<T>::set(const  uint16 *values, index_t num_elements)
 { 
-    for(index_t i=0;i<num_elements;i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert_values(*this,
+                           values,
+                           (index_t)sizeof(uint16),
+                           num_elements);
 }
 
 //---------------------------------------------------------------------------//
@@ -536,10 +1473,10 @@ template <typename T>
 void            
 DataArray<T>::set(const uint32 *values, index_t num_elements)
 { 
-    for(index_t i=0;i<num_elements;i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert_values(*this,
+                           values,
+                           (index_t)sizeof(uint32),
+                           num_elements);
 }
 
 //---------------------------------------------------------------------------//
@@ -547,10 +1484,10 @@ template <typename T>
 void            
 DataArray<T>::set(const uint64 *values, index_t num_elements)
 { 
-    for(index_t i=0;i<num_elements;i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert_values(*this,
+                           values,
+                           (index_t)sizeof(uint64),
+                           num_elements);
 }
 
 //---------------------------------------------------------------------------//
@@ -558,10 +1495,10 @@ template <typename T>
 void            
 DataArray<T>::set(const float32 *values, index_t num_elements)
 { 
-    for(index_t i=0;i<num_elements;i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert_values(*this,
+                           values,
+                           (index_t)sizeof(float32),
+                           num_elements);
 }
 
 //---------------------------------------------------------------------------//
@@ -569,10 +1506,10 @@ template <typename T>
 void            
 DataArray<T>::set(const float64 *values, index_t num_elements)
 { 
-    for(index_t i=0;i<num_elements;i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert_values(*this,
+                           values,
+                           (index_t)sizeof(float64),
+                           num_elements);
 }
 
 //---------------------------------------------------------------------------//
@@ -588,11 +1525,11 @@ template <typename T>
 void            
 DataArray<T>::set(const DataArray<int8> &values)
 { 
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert_values(*this,
+                           (const int8*)values.element_ptr(0),
+                           values.dtype().stride(),
+                           std::min(m_dtype.number_of_elements(),
+                                    values.number_of_elements()));
 }
 
 //---------------------------------------------------------------------------//
@@ -600,11 +1537,11 @@ template <typename T>
 void            
 DataArray<T>::set(const DataArray<int16> &values)
 { 
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert_values(*this,
+                           (const int16*)values.element_ptr(0),
+                           values.dtype().stride(),
+                           std::min(m_dtype.number_of_elements(),
+                                    values.number_of_elements()));
 }
 
 //---------------------------------------------------------------------------//
@@ -612,11 +1549,11 @@ template <typename T>
 void            
 DataArray<T>::set(const DataArray<int32> &values)
 { 
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert_values(*this,
+                           (const int32*)values.element_ptr(0),
+                           values.dtype().stride(),
+                           std::min(m_dtype.number_of_elements(),
+                                    values.number_of_elements()));
 }
 
 //---------------------------------------------------------------------------//
@@ -624,11 +1561,11 @@ template <typename T>
 void            
 DataArray<T>::set(const DataArray<int64> &values)
 { 
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert_values(*this,
+                           (const int64*)values.element_ptr(0),
+                           values.dtype().stride(),
+                           std::min(m_dtype.number_of_elements(),
+                                    values.number_of_elements()));
 }
 
 //---------------------------------------------------------------------------//
@@ -640,11 +1577,11 @@ template <typename T>
 void            
 DataArray<T>::set(const DataArray<uint8> &values)
 { 
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert_values(*this,
+                           (const uint8*)values.element_ptr(0),
+                           values.dtype().stride(),
+                           std::min(m_dtype.number_of_elements(),
+                                    values.number_of_elements()));
 }
 
 //---------------------------------------------------------------------------//
@@ -652,11 +1589,11 @@ template <typename T>
 void            
 DataArray<T>::set(const DataArray<uint16> &values)
 { 
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert_values(*this,
+                           (const uint16*)values.element_ptr(0),
+                           values.dtype().stride(),
+                           std::min(m_dtype.number_of_elements(),
+                                    values.number_of_elements()));
 }
 
 //---------------------------------------------------------------------------//
@@ -664,11 +1601,11 @@ template <typename T>
 void            
 DataArray<T>::set(const DataArray<uint32> &values)
 { 
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert_values(*this,
+                           (const uint32*)values.element_ptr(0),
+                           values.dtype().stride(),
+                           std::min(m_dtype.number_of_elements(),
+                                    values.number_of_elements()));
 }
 
 //---------------------------------------------------------------------------//
@@ -676,11 +1613,11 @@ template <typename T>
 void            
 DataArray<T>::set(const DataArray<uint64> &values)
 { 
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert_values(*this,
+                           (const uint64*)values.element_ptr(0),
+                           values.dtype().stride(),
+                           std::min(m_dtype.number_of_elements(),
+                                    values.number_of_elements()));
 }
 
 //---------------------------------------------------------------------------//
@@ -692,11 +1629,11 @@ template <typename T>
 void            
 DataArray<T>::set(const DataArray<float32> &values)
 { 
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert_values(*this,
+                           (const float32*)values.element_ptr(0),
+                           values.dtype().stride(),
+                           std::min(m_dtype.number_of_elements(),
+                                    values.number_of_elements()));
 }
 
 //---------------------------------------------------------------------------//
@@ -704,11 +1641,11 @@ template <typename T>
 void            
 DataArray<T>::set(const DataArray<float64> &values)
 { 
-    index_t num_elems = m_dtype.number_of_elements();
-    for(index_t i=0; i <num_elems; i++)
-    {
-        this->element(i) = (T)values[i];
-    }
+    detail::convert_values(*this,
+                           (const float64*)values.element_ptr(0),
+                           values.dtype().stride(),
+                           std::min(m_dtype.number_of_elements(),
+                                    values.number_of_elements()));
 }
 
 
@@ -721,14 +1658,11 @@ DataArray<T>::compact_elements_to(uint8 *data) const
     // copy all elements 
     index_t num_ele   = m_dtype.number_of_elements();
     index_t ele_bytes = DataType::default_bytes(m_dtype.id());
-    uint8 *data_ptr = data;
-    for(index_t i=0;i<num_ele;i++)
-    {
-        memcpy(data_ptr,
-               element_ptr(i),
-               (size_t)ele_bytes);
-        data_ptr+=ele_bytes;
-    }
+    kernels::gather(data,
+                    element_ptr(0),
+                    m_dtype.stride(),
+                    num_ele,
+                    ele_bytes);
 }
 
 
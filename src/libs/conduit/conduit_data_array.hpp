@@ -58,12 +58,52 @@
 #include "conduit_data_type.hpp"
 #include "conduit_utils.hpp"
 
+//-----------------------------------------------------------------------------
+// -- standard lib includes -- 
+//-----------------------------------------------------------------------------
+#include <iterator>
+#include <limits>
+
 //-----------------------------------------------------------------------------
 // -- begin conduit:: --
 //-----------------------------------------------------------------------------
 namespace conduit
 {
 
+//-----------------------------------------------------------------------------
+// -- begin conduit::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+//-----------------------------------------------------------------------------
+/// accumulator type used by DataArray<T>::sum: int64 for signed integers,
+/// uint64 for unsigned integers and float64 for floating point types
+//-----------------------------------------------------------------------------
+template <typename T,
+          bool IS_INTEGER = std::numeric_limits<T>::is_integer,
+          bool IS_SIGNED  = std::numeric_limits<T>::is_signed>
+struct SumType
+{
+    typedef float64 type;
+};
+
+template <typename T>
+struct SumType<T,true,true>
+{
+    typedef int64 type;
+};
+
+template <typename T>
+struct SumType<T,true,false>
+{
+    typedef uint64 type;
+};
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::detail --
+//-----------------------------------------------------------------------------
+
 //-----------------------------------------------------------------------------
 // -- begin conduit::DataArray --
 //-----------------------------------------------------------------------------
@@ -109,8 +149,14 @@ public:
     T              &operator[](index_t idx) const
                     {return element(idx);}
     
-    T              &element(index_t idx);
-    T              &element(index_t idx) const;
+    T              &element(index_t idx)
+                    {
+                        return *(T*)(begin_ptr() + m_dtype.stride() * idx);
+                    }
+    T              &element(index_t idx) const
+                    {
+                        return *(T*)(begin_ptr() + m_dtype.stride() * idx);
+                    }
 
     void           *element_ptr(index_t idx)
                     {
@@ -131,6 +177,143 @@ public:
     void           *data_ptr() const 
                         { return m_data;}
 
+//-----------------------------------------------------------------------------
+// Contiguous access
+//-----------------------------------------------------------------------------
+    /// true if the elements are packed (stride == sizeof(T))
+    bool            is_contiguous() const;
+    /// returns a raw pointer to the first element when the array is
+    /// contiguous (elements [0, number_of_elements()) can be accessed 
+    /// directly), returns NULL otherwise
+    T              *contiguous_data_ptr() const;
+
+//-----------------------------------------------------------------------------
+// Iterators
+//-----------------------------------------------------------------------------
+    /// random access iterator over the (possibly strided) elements,
+    /// usable with std algorithms
+    template <typename V>
+    class Iterator
+    {
+    public:
+        typedef std::random_access_iterator_tag  iterator_category;
+        typedef T                                value_type;
+        typedef index_t                          difference_type;
+        typedef V                               *pointer;
+        typedef V                               &reference;
+
+        Iterator()
+        : m_ptr(NULL), m_stride(0)
+        {}
+
+        Iterator(char *ptr, index_t stride)
+        : m_ptr(ptr), m_stride(stride)
+        {}
+
+        /// copy, and iterator to const_iterator conversion
+        /// (there is no const_iterator to iterator conversion)
+        Iterator(const Iterator<T> &itr)
+        : m_ptr(itr.ptr()), m_stride(itr.stride())
+        {}
+
+        char       *ptr()    const { return m_ptr;}
+        index_t     stride() const { return m_stride;}
+
+        reference   operator*()  const { return *(V*)m_ptr;}
+        pointer     operator->() const { return (V*)m_ptr;}
+        reference   operator[](difference_type n) const
+                        { return *(V*)(m_ptr + n * m_stride);}
+
+        Iterator   &operator++()    { m_ptr += m_stride; return *this;}
+        Iterator   &operator--()    { m_ptr -= m_stride; return *this;}
+        Iterator    operator++(int) 
+                        { Iterator res(*this); m_ptr += m_stride; return res;}
+        Iterator    operator--(int)
+                        { Iterator res(*this); m_ptr -= m_stride; return res;}
+
+        Iterator   &operator+=(difference_type n)
+                        { m_ptr += n * m_stride; return *this;}
+        Iterator   &operator-=(difference_type n)
+                        { m_ptr -= n * m_stride; return *this;}
+        Iterator    operator+(difference_type n) const
+                        { return Iterator(m_ptr + n * m_stride, m_stride);}
+        Iterator    operator-(difference_type n) const
+                        { return Iterator(m_ptr - n * m_stride, m_stride);}
+        friend Iterator operator+(difference_type n, const Iterator &itr)
+                        { return itr + n;}
+
+        difference_type operator-(const Iterator &itr) const
+                        { return m_stride == 0 ? 0 :
+                                 (m_ptr - itr.m_ptr) / m_stride;}
+
+        bool  operator==(const Iterator &itr) const
+                        { return m_ptr == itr.m_ptr;}
+        bool  operator!=(const Iterator &itr) const
+                        { return m_ptr != itr.m_ptr;}
+        bool  operator<(const Iterator &itr) const
+                        { return m_ptr < itr.m_ptr;}
+        bool  operator>(const Iterator &itr) const
+                        { return m_ptr > itr.m_ptr;}
+        bool  operator<=(const Iterator &itr) const
+                        { return m_ptr <= itr.m_ptr;}
+        bool  operator>=(const Iterator &itr) const
+                        { return m_ptr >= itr.m_ptr;}
+
+    private:
+        char       *m_ptr;
+        index_t     m_stride;
+    };
+
+    typedef Iterator<T>        iterator;
+    typedef Iterator<const T>  const_iterator;
+
+    iterator        begin()
+                        { return iterator(begin_ptr(), m_dtype.stride());}
+    iterator        end()
+                        { return begin() + number_of_elements();}
+    const_iterator  begin() const
+                        { return const_iterator(begin_ptr(),
+                                                m_dtype.stride());}
+    const_iterator  end() const
+                        { return begin() + number_of_elements();}
+
+//-----------------------------------------------------------------------------
+// Reductions
+//
+/// Contiguous arrays use vectorizable loops, strided arrays are reduced 
+/// element by element. Contiguous arrays of at least 
+/// conduit::parallel_min_bytes() are reduced in chunks on the conduit 
+/// threads (see conduit::set_num_threads).
+///
+/// NaN values are ignored by min, max, argmin, argmax and histogram.
+//-----------------------------------------------------------------------------
+    /// accumulator type of sum (int64, uint64 or float64)
+    typedef typename detail::SumType<T>::type sum_type;
+
+    /// smallest value (+inf for empty floating point arrays, numeric max 
+    /// for empty integer arrays, NaN if all values are NaN)
+    T               min()  const;
+    /// largest value (-inf for empty floating point arrays, numeric lowest
+    /// for empty integer arrays, NaN if all values are NaN)
+    T               max()  const;
+    /// sum of all values, accumulated in sum_type
+    sum_type        sum()  const;
+    /// mean of all values (accumulated in float64)
+    float64         mean() const;
+    /// index of the first smallest / largest value (-1 for empty arrays,
+    /// 0 if all values are NaN)
+    index_t         argmin() const;
+    index_t         argmax() const;
+    /// number of NaN and +/- inf values (always 0 for integer types)
+    index_t         count_nonfinite() const;
+    /// fills res with an int64 array holding counts of the values in 
+    /// num_bins equal width bins spanning [range_min, range_max].
+    /// values outside of the range are not counted.
+    void            histogram(float64 range_min,
+                              float64 range_max,
+                              index_t num_bins,
+                              Node &res) const;
+
     bool            compatible(const DataArray<T> &array) const;
     bool            diff(const DataArray<T> &array,
                          Node &info,
@@ -214,6 +397,8 @@ public:
 
     std::string     to_json() const;
     void            to_json_stream(std::ostream &os) const;
+    /// variant that writes to a buffered utils::TextWriter
+    void            to_json_stream(utils::TextWriter &w) const;
     
     /// DEPRECATED: to_json(std::ostream &os) is deprecated in favor of 
     ///             to_json_stream(std::ostream &os)
@@ -233,6 +418,10 @@ public:
 
 
 private:
+    /// address of the first element
+    char           *begin_ptr() const
+                        { return static_cast<char*>(m_data) +
+                                 m_dtype.offset();}
 
 //-----------------------------------------------------------------------------
 //
@@ -1326,29 +1326,52 @@ DataType::to_json_stream(std::ostream &os,
                          const std::string &pad,
                          const std::string &eoe) const
 {
-    os << eoe;
-    utils::indent(os,indent,depth,pad);
-    os << "{" << eoe;
-    utils::indent(os,indent,depth,pad);
-    os << "\"dtype\":" << "\"" << id_to_name(m_id) << "\"";
+    utils::TextWriter w(os);
+    to_json_stream(w,indent,depth,pad,eoe);
+}
+
+//---------------------------------------------------------------------------// 
+void
+DataType::to_json_stream(utils::TextWriter &w,
+                         index_t indent,
+                         index_t depth,
+                         const std::string &pad,
+                         const std::string &eoe) const
+{
+    w.write(eoe);
+    w.write_indent(indent,depth,pad);
+    w.write('{');
+    w.write(eoe);
+    w.write_indent(indent,depth,pad);
+    w.write("\"dtype\":\"");
+    w.write(id_to_name(m_id));
+    w.write('"');
 
     if(is_number() || is_string())
     {
-        os << "," << eoe;
-        utils::indent(os,indent,depth,pad);
-        os << "\"number_of_elements\": " << m_num_ele;
-
-        os << "," << eoe;
-        utils::indent(os,indent,depth,pad);
-        os << "\"offset\": " << m_offset;
-
-        os << "," << eoe;
-        utils::indent(os,indent,depth,pad);
-        os << "\"stride\": " << m_stride;
-
-        os << "," << eoe;
-        utils::indent(os,indent,depth,pad);
-        os << "\"element_bytes\": " << m_ele_bytes;
+        w.write(',');
+        w.write(eoe);
+        w.write_indent(indent,depth,pad);
+        w.write("\"number_of_elements\": ");
+        w.write_int64(m_num_ele);
+
+        w.write(',');
+        w.write(eoe);
+        w.write_indent(indent,depth,pad);
+        w.write("\"offset\": ");
+        w.write_int64(m_offset);
+
+        w.write(',');
+        w.write(eoe);
+        w.write_indent(indent,depth,pad);
+        w.write("\"stride\": ");
+        w.write_int64(m_stride);
+
+        w.write(',');
+        w.write(eoe);
+        w.write_indent(indent,depth,pad);
+        w.write("\"element_bytes\": ");
+        w.write_int64(m_ele_bytes);
 
         std::string endian_str;
         if(m_endianness == Endianness::DEFAULT_ID)
@@ -1361,13 +1384,17 @@ DataType::to_json_stream(std::ostream &os,
             endian_str = Endianness::id_to_name(m_endianness);
         }
 
-        os << "," << eoe;
-        utils::indent(os,indent,depth,pad);
-        os << "\"endianness\": \"" << endian_str << "\"";
+        w.write(',');
+        w.write(eoe);
+        w.write_indent(indent,depth,pad);
+        w.write("\"endianness\": \"");
+        w.write(endian_str);
+        w.write('"');
     }
-    os << eoe;
-    utils::indent(os,indent,depth,pad);
-    os << "}" << eoe;
+    w.write(eoe);
+    w.write_indent(indent,depth,pad);
+    w.write('}');
+    w.write(eoe);
 }
 
 //---------------------------------------------------------------------------// 
@@ -1403,22 +1430,45 @@ DataType::to_yaml_stream(std::ostream &os,
                          const std::string &pad,
                          const std::string &eoe) const
 {
-    utils::indent(os,indent,depth,pad);
-    os << "dtype: " << "\"" << id_to_name(m_id) << "\"" << eoe;
+    utils::TextWriter w(os);
+    to_yaml_stream(w,indent,depth,pad,eoe);
+}
+
+//---------------------------------------------------------------------------// 
+void
+DataType::to_yaml_stream(utils::TextWriter &w,
+                         index_t indent,
+                         index_t depth,
+                         const std::string &pad,
+                         const std::string &eoe) const
+{
+    w.write_indent(indent,depth,pad);
+    w.write("dtype: \"");
+    w.write(id_to_name(m_id));
+    w.write('"');
+    w.write(eoe);
 
     if(is_number() || is_string())
     {
-        utils::indent(os,indent,depth,pad);
-        os << "number_of_elements: " << m_num_ele << eoe;
-
-        utils::indent(os,indent,depth,pad);
-        os << "offset: " << m_offset << eoe;
-
-        utils::indent(os,indent,depth,pad);
-        os << "stride: " << m_stride << eoe;
-
-        utils::indent(os,indent,depth,pad);
-        os << "element_bytes: " << m_ele_bytes << eoe;
+        w.write_indent(indent,depth,pad);
+        w.write("number_of_elements: ");
+        w.write_int64(m_num_ele);
+        w.write(eoe);
+
+        w.write_indent(indent,depth,pad);
+        w.write("offset: ");
+        w.write_int64(m_offset);
+        w.write(eoe);
+
+        w.write_indent(indent,depth,pad);
+        w.write("stride: ");
+        w.write_int64(m_stride);
+        w.write(eoe);
+
+        w.write_indent(indent,depth,pad);
+        w.write("element_bytes: ");
+        w.write_int64(m_ele_bytes);
+        w.write(eoe);
 
         std::string endian_str;
         if(m_endianness == Endianness::DEFAULT_ID)
@@ -1431,8 +1481,11 @@ DataType::to_yaml_stream(std::ostream &os,
             endian_str = Endianness::id_to_name(m_endianness);
         }
 
-        utils::indent(os,indent,depth,pad);
-        os << "endianness: \"" << endian_str << "\"" << eoe;
+        w.write_indent(indent,depth,pad);
+        w.write("endianness: \"");
+        w.write(endian_str);
+        w.write('"');
+        w.write(eoe);
     }
 }
 
@@ -63,6 +63,7 @@
 //-----------------------------------------------------------------------------
 #include "conduit_core.hpp"
 #include "conduit_endianness.hpp"
+#include "conduit_utils.hpp"
 
 //-----------------------------------------------------------------------------
 // -- begin conduit:: --
@@ -576,6 +577,13 @@ public:
                                        const std::string &pad=" ",
                                        const std::string &eoe="\n") const;
 
+    /// variant that writes to a buffered utils::TextWriter
+    void                to_json_stream(utils::TextWriter &w,
+                                       index_t indent=2,
+                                       index_t depth=0,
+                                       const std::string &pad=" ",
+                                       const std::string &eoe="\n") const;
+
     // NOTE(cyrush): The primary reason this function exists is to enable 
     // easier compatibility with debugging tools (e.g. totalview, gdb) that
     // have difficulty allocating default string parameters.
@@ -603,6 +611,13 @@ public:
                                        const std::string &pad=" ",
                                        const std::string &eoe="\n") const;
 
+    /// variant that writes to a buffered utils::TextWriter
+    void                to_yaml_stream(utils::TextWriter &w,
+                                       index_t indent=2,
+                                       index_t depth=0,
+                                       const std::string &pad=" ",
+                                       const std::string &eoe="\n") const;
+
     // NOTE(cyrush): The primary reason this function exists is to enable 
     // easier compatibility with debugging tools (e.g. totalview, gdb) that
     // have difficulty allocating default string parameters.
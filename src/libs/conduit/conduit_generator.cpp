@@ -54,12 +54,24 @@
 // -- standard lib includes -- 
 //-----------------------------------------------------------------------------
 #include <stdio.h>
+#include <string.h>
 #include <cstdlib>
+#include <limits>
+#include <map>
+#include <algorithm>
+
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+#include <errno.h>
+#include <unistd.h>
+#else
+#include <io.h>
+#endif
 
 //-----------------------------------------------------------------------------
 // -- rapidjson includes -- 
 //-----------------------------------------------------------------------------
 #include "rapidjson/document.h"
+#include "rapidjson/reader.h"
 #include "rapidjson/error/en.h"
 
 //-----------------------------------------------------------------------------
@@ -127,6 +139,17 @@ namespace conduit
 class Generator::Parser
 {
 public:
+//-----------------------------------------------------------------------------
+// Helpers shared by the incremental json and yaml parsers.
+//-----------------------------------------------------------------------------
+  // chunked text sources
+  class Input;
+  class MemoryInput;
+  class IStreamInput;
+  class FileDescriptorInput;
+  // builds a Node tree from parse events
+  class TreeBuilder;
+
 //-----------------------------------------------------------------------------
 // Generator::Parser::JSON handles parsing via rapidjson.
 // We want to isolate the conduit API from the rapidjson headers
@@ -138,7 +161,9 @@ public:
   {
   public:
       
-    static const rapidjson::ParseFlag RAPIDJSON_PARSE_OPTS = rapidjson::kParseNoFlags;
+    // full precision number parsing, so the shortest round trip floating
+    // point values written by the json emitters parse back exactly
+    static const rapidjson::ParseFlag RAPIDJSON_PARSE_OPTS = rapidjson::kParseFullPrecisionFlag;
     
     static index_t json_to_numeric_dtype(const rapidjson::Value &jvalue);
     
@@ -190,22 +215,35 @@ public:
                                     const   rapidjson::Value &jvalue,
                                     index_t curr_offset);
                                     
-    static void    walk_pure_json_schema(Node  *node,
-                                         Schema *schema,
-                                         const rapidjson::Value &jvalue);
-
     static void    walk_json_schema(Node   *node,
                                     Schema *schema,
                                     void   *data,
                                     const rapidjson::Value &jvalue,
                                     index_t curr_offset);
     
-    static void    parse_base64(Node *node,
-                                const rapidjson::Value &jvalue);
-
     static void    parse_error_details(const std::string &json,
                                        const rapidjson::Document &document,
                                        std::ostream &os);
+
+    //-------------------------------------------------------------------------
+    // incremental (SAX) parsing of pure json, used for the "json" protocol
+    //-------------------------------------------------------------------------
+    // rapidjson input stream that applies the utils::json_sanitize rules
+    class SanitizedStream;
+    // rapidjson handler that passes parse events to a TreeBuilder
+    class PureJSONHandler;
+
+    static void    parse_pure_json(Input &input,
+                                   Node &node);
+
+    //-------------------------------------------------------------------------
+    // incremental parsing of the "conduit_base64_json" protocol, decodes
+    // the base64 payload in blocks as it is read
+    //-------------------------------------------------------------------------
+    class Base64Reader;
+
+    static void    parse_base64(Input &input,
+                                Node &node);
   };
 //-----------------------------------------------------------------------------
 // Generator::Parser::YAML handles parsing via libyaml.
@@ -231,22 +269,36 @@ public:
         YAMLParserWrapper();
        ~YAMLParserWrapper();
 
-       // parses and creates doc tree, throws exception
-       // when things go wrong
-       void         parse(const char *yaml_txt);
+       // sets the text source (read incrementally)
+       void          set_input(Input &input);
 
-       yaml_document_t *yaml_doc_ptr();
-       yaml_node_t     *yaml_doc_root_ptr();
+       // parses and returns the next event, throws exception
+       // when things go wrong
+       yaml_event_t &next_event();
 
     private:
-        yaml_document_t m_yaml_doc;
-        yaml_parser_t   m_yaml_parser;
+        // libyaml read callback
+        static int read_handler(void *data,
+                                unsigned char *buffer,
+                                size_t size,
+                                size_t *size_read);
+
+        yaml_parser_t m_yaml_parser;
+        yaml_event_t  m_yaml_event;
 
         bool m_yaml_parser_is_valid;
-        bool m_yaml_doc_is_valid;
+        bool m_yaml_event_is_valid;
 
+        Input        *m_input;
+        const char   *m_chunk;
+        index_t       m_chunk_size;
+        index_t       m_chunk_pos;
+        std::string   m_input_error;
     };
 
+    // passes libyaml parse events to a TreeBuilder
+    class PureYAMLHandler;
+
     // 
     // yaml scalar (aka leaf) values are always strings, however that is
     // not a very useful way to parse into Conduit tree. We apply json
@@ -263,76 +315,571 @@ public:
     // with the yaml parser
     //
 
-    // TODO: try to inline these helpers? Not sure it matters since
-    // they call other routines
+    // finds if leaf string is int64, float64, or neither (DataType::EMPTY_ID)
+    // and provides the converted value. Plain decimal numbers are parsed
+    // directly, other cases follow strtol and strtod.
+    static index_t parse_yaml_number(const char *txt_value,
+                                     size_t txt_len,
+                                     int64 &int64_value,
+                                     float64 &float64_value);
 
-    // checks if c-string is a null pointer or empty
-    static bool string_is_empty(const char *txt_value);
+    // main entry point for parsing pure yaml
+    static void    parse_pure_yaml(Input &input,
+                                   Node &node);
+    
+    // extract human readable parser errors
+    static void    parse_error_details(yaml_parser_t *yaml_parser,
+                                       std::ostream &os);
 
-    // checks if input c-string is an integer or a double
-    static bool string_is_number(const char *txt_value);
+  };
 
-    // checks if input string holds something that converts
-    // to a double (integer c-string will pass this check )
-    static bool string_is_double(const char *txt_value);
+};
 
-    // checks if input c-string holds something that converts
-    // to an integer
-    static bool string_is_integer(const char *txt_value);
+//-----------------------------------------------------------------------------
+// -- begin conduit::Generator::Parser --
+//-----------------------------------------------------------------------------
 
-    // converts c-string to double
-    static double string_to_double(const char *txt_value);
-    // converts c-string to long
-    static long int string_to_long(const char *txt_value);
+//-----------------------------------------------------------------------------
+/// Provides the text to parse in chunks.
+//-----------------------------------------------------------------------------
+class Generator::Parser::Input
+{
+public:
+    virtual ~Input() {}
 
-    // assumes res is already inited to DataType::int64 w/ proper size
-    static void parse_yaml_int64_array(yaml_document_t *yaml_doc,
-                                       yaml_node_t *yaml_node,
-                                       Node &res);
+    /// provides the next chunk of text, returns false at the end
+    virtual bool next_chunk(const char *&chunk, index_t &chunk_size) = 0;
 
-    // assumes res is already inited to DataType::float64 w/ proper size
-    static void parse_yaml_float64_array(yaml_document_t *yaml_doc,
-                                         yaml_node_t *yaml_node,
-                                         Node &res);
-    // parses generic leaf and places value in res
-    static void parse_yaml_inline_leaf(const char *yaml_txt,
-                                       Node &res);
+    /// full text (used in parse error messages), NULL for streams
+    virtual const std::string *text() const { return NULL; }
+};
 
-    // finds if leaf string is int64, float64, or neither (DataType::EMPTY_T)
-    static index_t yaml_leaf_to_numeric_dtype(const char *txt_value);
+//-----------------------------------------------------------------------------
+class Generator::Parser::MemoryInput : public Generator::Parser::Input
+{
+public:
+    MemoryInput(const std::string &text)
+    : m_text(text),
+      m_done(false)
+    {}
 
-    // checks if the input yaml node is a homogenous numeric sequence
-    // 
-    // if not: returns DataType::EMPTY_T and seq_size = -1
-    //
-    // if so:
-    //  seq_size contains the sequence length and:
-    //  if homogenous integer sequence returns DataType::INT64_T 
-    //  if homogenous floating point sequence returns DataType::FLOAT64_T 
-    static index_t check_homogenous_yaml_numeric_sequence(const Node &node,
-                                                          yaml_document_t *yaml_doc,
-                                                          yaml_node_t *yaml_node,
-                                                          index_t &seq_size);
+    virtual bool next_chunk(const char *&chunk, index_t &chunk_size)
+    {
+        if(m_done || m_text.empty())
+        {
+            return false;
+        }
+        chunk = m_text.c_str();
+        chunk_size = (index_t)m_text.size();
+        m_done = true;
+        return true;
+    }
 
-    // main entry point for parsing pure yaml
-    static void    walk_pure_yaml_schema(Node  *node,
-                                         Schema *schema,
-                                         const char *yaml_txt);
-
-    // workhorse for parsing a pure yaml tree
-    static void    walk_pure_yaml_schema(Node  *node,
-                                         Schema *schema,
-                                         yaml_document_t *yaml_doc,
-                                         yaml_node_t *yaml_node);
-    
-    // extract human readable parser errors
-    static void    parse_error_details(yaml_parser_t *yaml_parser,
-                                       std::ostream &os);
+    virtual const std::string *text() const
+    {
+        return &m_text;
+    }
 
-  };
+private:
+    const std::string &m_text;
+    bool               m_done;
+};
+
+//-----------------------------------------------------------------------------
+class Generator::Parser::IStreamInput : public Generator::Parser::Input
+{
+public:
+    IStreamInput(std::istream &is)
+    : m_is(is),
+      m_buffer(65536)
+    {}
+
+    virtual bool next_chunk(const char *&chunk, index_t &chunk_size)
+    {
+        if(!m_is.good())
+        {
+            return false;
+        }
+        m_is.read(&m_buffer[0],(std::streamsize)m_buffer.size());
+        chunk = &m_buffer[0];
+        chunk_size = (index_t)m_is.gcount();
+        return chunk_size > 0;
+    }
+
+private:
+    std::istream      &m_is;
+    std::vector<char>  m_buffer;
+};
+
+//-----------------------------------------------------------------------------
+class Generator::Parser::FileDescriptorInput : public Generator::Parser::Input
+{
+public:
+    FileDescriptorInput(int fd)
+    : m_fd(fd),
+      m_buffer(65536)
+    {}
+
+    virtual bool next_chunk(const char *&chunk, index_t &chunk_size)
+    {
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+        ssize_t nread = -1;
+        do
+        {
+            nread = ::read(m_fd,&m_buffer[0],m_buffer.size());
+        } while(nread < 0 && errno == EINTR);
+#else
+        int nread = ::_read(m_fd,&m_buffer[0],(unsigned int)m_buffer.size());
+#endif
+        if(nread < 0)
+        {
+            CONDUIT_ERROR("Generator error:\n"
+                          << "failed to read from file descriptor " 
+                          << m_fd);
+        }
+        chunk = &m_buffer[0];
+        chunk_size = (index_t)nread;
+        return chunk_size > 0;
+    }
+
+private:
+    int                m_fd;
+    std::vector<char>  m_buffer;
+};
+
+//-----------------------------------------------------------------------------
+/// Builds a Node tree from parse events (used by both the json and yaml
+/// incremental parsers).
+///
+/// Arrays are assumed to be numeric until a non-numeric value is found.
+/// Numeric values are written into a growing buffer (allocated with the
+/// Node's allocator), which becomes the data of the int64 or float64 array
+/// leaf. If the array turns out to be mixed, the buffered values become
+/// children of a list.
+//-----------------------------------------------------------------------------
+class Generator::Parser::TreeBuilder
+{
+public:
+    /// format_name is used in error messages ("JSON" or "YAML"),
+    /// empty_list_role controls if an empty array becomes an empty list
+    /// or stays an empty node
+    TreeBuilder(Node &root,
+                const std::string &format_name,
+                bool empty_list_role)
+    : m_root(root),
+      m_format_name(format_name),
+      m_empty_list_role(empty_list_role)
+    {}
+
+    ~TreeBuilder()
+    {
+        // release the buffers of any unfinished numeric arrays
+        for(size_t i=0; i < m_stack.size(); i++)
+        {
+            if(m_stack[i].values != NULL)
+            {
+                utils::free_memory(m_stack[i].node->allocator(),
+                                   m_stack[i].values);
+            }
+        }
+    }
+
+    /// node of the innermost open object or array (the root if none)
+    Node *current_node() const
+    {
+        return m_stack.empty() ? &m_root : m_stack.back().node;
+    }
+
+    /// true if node is an open object or array
+    bool is_open(const Node *node) const
+    {
+        for(size_t i=0; i < m_stack.size(); i++)
+        {
+            if(m_stack[i].node == node)
+            {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /// true if the innermost open array only holds numbers so far
+    bool in_numeric_array() const
+    {
+        return !m_stack.empty() && m_stack.back().type == NUMERIC_FRAME;
+    }
+
+    /// true if the innermost open object is waiting for a name
+    bool expecting_key() const
+    {
+        return !m_stack.empty() && 
+               m_stack.back().type == OBJECT_FRAME &&
+               !m_stack.back().has_key;
+    }
+
+    /// sets the name of the next object child
+    void set_key(const char *key, size_t key_len)
+    {
+        Frame &frame = m_stack.back();
+        frame.key.assign(key,key_len);
+        frame.has_key = true;
+    }
+
+    /// creates (or selects) the node that receives the next value
+    Node *next_node();
+
+    /// opens an object / array held by node (from next_node())
+    void begin_object(Node *node)
+    {
+        // if we make it here and have an empty object
+        // we still want the conduit node to take on the
+        // object role
+        node->schema_ptr()->set(DataType::object());
+        m_stack.push_back(Frame(node,OBJECT_FRAME));
+    }
+
+    void begin_array(Node *node)
+    {
+        m_stack.push_back(Frame(node,NUMERIC_FRAME));
+    }
+
+    void end_object()
+    {
+        m_stack.pop_back();
+    }
+
+    void end_array()
+    {
+        Frame &frame = m_stack.back();
+        if(frame.type == NUMERIC_FRAME)
+        {
+            finish_numeric_array(frame);
+        }
+        m_stack.pop_back();
+    }
+
+    /// append a value to the numeric array at the top of the stack
+    void append_int64(int64 value)
+    {
+        uint64 bits = 0;
+        memcpy(&bits,&value,sizeof(uint64));
+        append_number(INT64_KIND,bits);
+    }
+
+    void append_uint64(uint64 value)
+    {
+        append_number(UINT64_KIND,value);
+    }
+
+    void append_float64(float64 value)
+    {
+        uint64 bits = 0;
+        memcpy(&bits,&value,sizeof(uint64));
+        append_number(FLOAT64_KIND,bits);
+    }
+
+private:
+    enum FrameType
+    {
+        OBJECT_FRAME,
+        LIST_FRAME,
+        NUMERIC_FRAME
+    };
 
+    enum NumberKind
+    {
+        INT64_KIND,
+        UINT64_KIND,
+        FLOAT64_KIND
+    };
+
+    // an object or array that is being parsed
+    struct Frame
+    {
+        Frame(Node *frame_node, FrameType frame_type)
+        : node(frame_node),
+          type(frame_type),
+          has_key(false),
+          values(NULL),
+          num_values(0),
+          capacity(0),
+          first_kind(INT64_KIND),
+          has_float64(false)
+        {}
+
+        Node               *node;
+        FrameType           type;
+        // name of the next object child
+        std::string         key;
+        bool                has_key;
+        // numeric array values (64-bit patterns of each value)
+        uint64             *values;
+        index_t             num_values;
+        index_t             capacity;
+        NumberKind          first_kind;
+        bool                has_float64;
+        // kind of each value, only kept once an array holds mixed kinds
+        std::vector<uint8>  kinds;
+    };
+
+    NumberKind value_kind(const Frame &frame, index_t idx) const
+    {
+        return frame.kinds.empty() ? frame.first_kind 
+                                   : (NumberKind)frame.kinds[idx];
+    }
+
+    void  append_number(NumberKind kind, uint64 bits);
+    void  numeric_array_to_list(Frame &frame);
+    void  finish_numeric_array(Frame &frame);
+    Node *append_list_child(Node *node);
+    Node *create_child(Node *node, Schema *curr_schema);
+
+    Node               &m_root;
+    std::string         m_format_name;
+    bool                m_empty_list_role;
+    std::vector<Frame>  m_stack;
 };
 
+//---------------------------------------------------------------------------//
+Node *
+Generator::Parser::TreeBuilder::next_node()
+{
+    if(m_stack.empty())
+    {
+        return &m_root;
+    }
+
+    Frame &frame = m_stack.back();
+    if(frame.type == NUMERIC_FRAME)
+    {
+        numeric_array_to_list(frame);
+    }
+
+    if(frame.type == LIST_FRAME)
+    {
+        return append_list_child(frame.node);
+    }
+
+    // object case
+    Schema *schema = frame.node->schema_ptr();
+    frame.has_key = false;
+
+    // files may have duplicate object names
+    // we could provide some clear semantics, such as:
+    //   always use first instance, or always use last instance
+    // however duplicate object names are most likely a
+    // typo, so it's best to throw an error
+    if(schema->has_child(frame.key))
+    {
+        CONDUIT_ERROR(m_format_name << " Generator error:\n"
+                      << "Duplicate " << m_format_name << " object name: " 
+                      << utils::join_path(frame.node->path(),frame.key));
+    }
+
+    return create_child(frame.node,&schema->add_child(frame.key));
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::TreeBuilder::append_number(NumberKind kind,
+                                              uint64 bits)
+{
+    Frame &frame = m_stack.back();
+
+    if(frame.num_values == frame.capacity)
+    {
+        index_t new_capacity = frame.capacity == 0 ? 16 
+                                                   : frame.capacity * 2;
+        index_t allocator_id = frame.node->allocator();
+        uint64 *new_values = (uint64*) utils::allocate_memory(
+                                            allocator_id,
+                                            new_capacity * 8);
+        if(frame.values != NULL)
+        {
+            memcpy(new_values,frame.values,(size_t)(frame.num_values * 8));
+            utils::free_memory(allocator_id,frame.values);
+        }
+        frame.values = new_values;
+        frame.capacity = new_capacity;
+    }
+
+    if(frame.num_values == 0)
+    {
+        frame.first_kind = kind;
+    }
+    else if(frame.kinds.empty() && kind != frame.first_kind)
+    {
+        frame.kinds.assign((size_t)frame.num_values,
+                           (uint8)frame.first_kind);
+    }
+
+    if(!frame.kinds.empty())
+    {
+        frame.kinds.push_back((uint8)kind);
+    }
+
+    if(kind == FLOAT64_KIND)
+    {
+        frame.has_float64 = true;
+    }
+
+    frame.values[frame.num_values++] = bits;
+}
+
+//---------------------------------------------------------------------------//
+// turns a numeric array into a list
+void
+Generator::Parser::TreeBuilder::numeric_array_to_list(Frame &frame)
+{
+    frame.type = LIST_FRAME;
+    Node *node = frame.node;
+    node->schema_ptr()->set(DataType::list());
+
+    for(index_t i=0; i < frame.num_values; i++)
+    {
+        Node *child = append_list_child(node);
+        uint64 bits = frame.values[i];
+        switch(value_kind(frame,i))
+        {
+            case INT64_KIND:
+            {
+                int64 value;
+                memcpy(&value,&bits,sizeof(int64));
+                child->set(value);
+                break;
+            }
+            case UINT64_KIND:
+            {
+                child->set(bits);
+                break;
+            }
+            case FLOAT64_KIND:
+            {
+                float64 value;
+                memcpy(&value,&bits,sizeof(float64));
+                child->set(value);
+                break;
+            }
+        }
+    }
+
+    if(frame.values != NULL)
+    {
+        utils::free_memory(node->allocator(),frame.values);
+        frame.values = NULL;
+    }
+    frame.num_values = 0;
+    frame.capacity = 0;
+    frame.kinds.clear();
+}
+
+//---------------------------------------------------------------------------//
+// hands the values buffer to the node as an int64 or float64 array
+void
+Generator::Parser::TreeBuilder::finish_numeric_array(Frame &frame)
+{
+    Node *node = frame.node;
+
+    if(frame.num_values == 0)
+    {
+        if(m_empty_list_role)
+        {
+            // if we make it here and have an empty list
+            // we still want the conduit node to take on the
+            // list role
+            node->schema_ptr()->set(DataType::list());
+        }
+        return;
+    }
+
+    DataType dtype = DataType::int64(frame.num_values);
+
+    if(frame.has_float64)
+    {
+        // promote to float64 as the most wide type
+        // (this is a heuristic decision)
+        dtype = DataType::float64(frame.num_values);
+        if(!frame.kinds.empty())
+        {
+            for(index_t i=0; i < frame.num_values; i++)
+            {
+                uint64 bits = frame.values[i];
+                float64 value = 0.0;
+                switch(value_kind(frame,i))
+                {
+                    case INT64_KIND:
+                    {
+                        int64 ival;
+                        memcpy(&ival,&bits,sizeof(int64));
+                        value = (float64)ival;
+                        break;
+                    }
+                    case UINT64_KIND:
+                    {
+                        value = (float64)bits;
+                        break;
+                    }
+                    case FLOAT64_KIND:
+                    {
+                        memcpy(&value,&bits,sizeof(float64));
+                        break;
+                    }
+                }
+                memcpy(&frame.values[i],&value,sizeof(float64));
+            }
+        }
+    }
+
+    index_t allocator_id = node->allocator();
+    if(frame.num_values < frame.capacity)
+    {
+        // trim to the final size
+        uint64 *values = (uint64*) utils::allocate_memory(
+                                            allocator_id,
+                                            frame.num_values * 8);
+        memcpy(values,frame.values,(size_t)(frame.num_values * 8));
+        utils::free_memory(allocator_id,frame.values);
+        frame.values   = values;
+        frame.capacity = frame.num_values;
+    }
+
+    node->schema_ptr()->set(dtype);
+    node->m_data      = frame.values;
+    node->m_data_size = frame.num_values * 8;
+    node->m_data_tag  = utils::memory_stats_allocate(node->m_data_size);
+    node->m_alloced   = true;
+    node->m_mmaped    = false;
+
+    frame.values = NULL;
+}
+
+//---------------------------------------------------------------------------//
+Node *
+Generator::Parser::TreeBuilder::append_list_child(Node *node)
+{
+    Schema *schema = node->schema_ptr();
+    schema->append();
+    Schema *curr_schema = schema->child_ptr(schema->number_of_children()-1);
+    return create_child(node,curr_schema);
+}
+
+//---------------------------------------------------------------------------//
+Node *
+Generator::Parser::TreeBuilder::create_child(Node *node,
+                                             Schema *curr_schema)
+{
+    Node *curr_node = new Node();
+    curr_node->set_allocator(node->allocator());
+    curr_node->set_schema_ptr(curr_schema);
+    curr_node->set_parent(node);
+    node->append_node_ptr(curr_node);
+    return curr_node;
+}
+
+//-----------------------------------------------------------------------------
+// -- end conduit::Generator::Parser --
+//-----------------------------------------------------------------------------
+
 //-----------------------------------------------------------------------------
 // -- begin conduit::Generator::Parser::JSON --
 //-----------------------------------------------------------------------------
@@ -1078,139 +1625,11 @@ Generator::Parser::JSON::walk_json_schema(Schema *schema,
 
 //---------------------------------------------------------------------------//
 void 
-Generator::Parser::JSON::walk_pure_json_schema(Node *node,
-                                               Schema *schema,
-                                               const rapidjson::Value &jvalue)
-{
-    // object cases
-    if(jvalue.IsObject())
-    {
-        // if we make it here and have an empty json object
-        // we still want the conduit node to take on the
-        // object role
-        schema->set(DataType::object());
-        // loop over all entries
-        for (rapidjson::Value::ConstMemberIterator itr = jvalue.MemberBegin(); 
-             itr != jvalue.MemberEnd(); ++itr)
-        {
-            std::string entry_name(itr->name.GetString());
-            
-            // json files may have duplicate object names
-            // we could provide some clear semantics, such as:
-            //   always use first instance, or always use last instance
-            // however duplicate object names are most likely a
-            // typo, so it's best to throw an error
-
-            if(schema->has_child(entry_name))
-            {
-                CONDUIT_ERROR("JSON Generator error:\n"
-                              << "Duplicate JSON object name: " 
-                              << utils::join_path(node->path(),entry_name));
-            }
-
-            Schema *curr_schema = &schema->add_child(entry_name);
-
-            Node *curr_node = new Node();
-            curr_node->set_schema_ptr(curr_schema);
-            curr_node->set_parent(node);
-            node->append_node_ptr(curr_node);
-
-            walk_pure_json_schema(curr_node,
-                                  curr_schema,
-                                  itr->value);
-        }
-    }
-    // List case 
-    else if (jvalue.IsArray()) 
-    {
-        index_t hval_type = check_homogenous_json_array(jvalue);
-        if(hval_type == DataType::INT64_ID)
-        {
-            node->set(DataType::int64(jvalue.Size()));
-            int64_array vals = node->value();
-            parse_json_int64_array(jvalue,vals);
-        }
-        else if(hval_type == DataType::FLOAT64_ID)
-        {
-            node->set(DataType::float64(jvalue.Size()));
-            float64_array vals = node->value();
-            parse_json_float64_array(jvalue,vals);
-        }
-        else // not numeric array
-        {
-            // if we make it here and have an empty json list
-            // we still want the conduit node to take on the
-            // list role
-            schema->set(DataType::list());
-            
-            for (rapidjson::SizeType i = 0; i < jvalue.Size(); i++)
-            {
-                schema->append();
-                Schema *curr_schema = schema->child_ptr(i);
-                Node * curr_node = new Node();
-                curr_node->set_schema_ptr(curr_schema);
-                curr_node->set_parent(node);
-                node->append_node_ptr(curr_node);
-                walk_pure_json_schema(curr_node,curr_schema,jvalue[i]);
-            }
-        }
-    }
-    // Simplest case, handles "uint32", "float64", with extended type info
-    else if(jvalue.IsString()) // bytestr case
-    {
-        std::string sval(jvalue.GetString());
-        node->set(sval);
-    }
-    else if(jvalue.IsNull())
-    {
-        node->reset();
-    }
-    else if(jvalue.IsBool())
-    {
-        // we store bools as uint8s
-        if(jvalue.IsTrue())
-        {
-            node->set((uint8)1);
-        }
-        else
-        {
-            node->set((uint8)0);
-        }
-    }
-    else if(jvalue.IsNumber())
-    {
-        // use 64bit types by default ... 
-        if(jvalue.IsInt() || jvalue.IsInt64())
-        {
-            node->set((int64)jvalue.GetInt64());
-        }
-        else if(jvalue.IsUint() || jvalue.IsUint64())
-        {
-            node->set((uint64)jvalue.GetUint64());
-        }
-        else  // double case
-        {
-            node->set((float64)jvalue.GetDouble());
-        }
-    }
-    else
-    {
-        // not sure if can an even land here, but catch error just in case.
-        CONDUIT_ERROR("JSON Generator error:\n"
-                      << "Invalid JSON type for parsing Node from pure JSON."
-                      << " Expected: JSON Object, Array, String, Null,"
-                      << " Boolean, or Number");
-    }
-}
-
-
-//---------------------------------------------------------------------------//
-void 
-Generator::Parser::JSON::walk_json_schema(Node   *node,
-                                          Schema *schema,
-                                          void   *data,
-                                          const rapidjson::Value &jvalue,
-                                          index_t curr_offset)
+Generator::Parser::JSON::walk_json_schema(Node   *node,
+                                          Schema *schema,
+                                          void   *data,
+                                          const rapidjson::Value &jvalue,
+                                          index_t curr_offset)
 {
     // object cases
     if(jvalue.IsObject())
@@ -1253,6 +1672,7 @@ Generator::Parser::JSON::walk_json_schema(Node   *node,
                     schema->append();
                     Schema *curr_schema = schema->child_ptr(i);
                     Node *curr_node = new Node();
+                    curr_node->set_allocator(node->allocator());
                     curr_node->set_schema_ptr(curr_schema);
                     curr_node->set_parent(node);
                     node->append_node_ptr(curr_node);
@@ -1324,6 +1744,7 @@ Generator::Parser::JSON::walk_json_schema(Node   *node,
                 Schema *curr_schema = &schema->add_child(entry_name);
                 
                 Node *curr_node = new Node();
+                curr_node->set_allocator(node->allocator());
                 curr_node->set_schema_ptr(curr_schema);
                 curr_node->set_parent(node);
                 node->append_node_ptr(curr_node);
@@ -1350,6 +1771,7 @@ Generator::Parser::JSON::walk_json_schema(Node   *node,
             schema->append();
             Schema *curr_schema = schema->child_ptr(i);
             Node *curr_node = new Node();
+            curr_node->set_allocator(node->allocator());
             curr_node->set_schema_ptr(curr_schema);
             curr_node->set_parent(node);
             node->append_node_ptr(curr_node);
@@ -1391,61 +1813,6 @@ Generator::Parser::JSON::walk_json_schema(Node   *node,
     }
 }
 
-//---------------------------------------------------------------------------//
-void 
-Generator::Parser::JSON::parse_base64(Node *node,
-                                      const rapidjson::Value &jvalue)
-{
-    // object case
-
-    std::string base64_str = "";
-    
-    if(jvalue.IsObject())
-    {
-        Schema s;
-        if (jvalue.HasMember("data") && jvalue["data"].HasMember("base64"))
-        {
-            base64_str = jvalue["data"]["base64"].GetString();
-        }
-        else
-        {
-            CONDUIT_ERROR("conduit_base64_json protocol error: missing data/base64");
-        }
-        
-        if (jvalue.HasMember("schema"))
-        {
-            // parse schema
-            index_t curr_offset = 0;
-            walk_json_schema(&s,jvalue["schema"],curr_offset);
-        }
-        else
-        {
-            CONDUIT_ERROR("conduit_base64_json protocol error: missing schema");
-        }
-        
-        const char *src_ptr = base64_str.c_str();
-        index_t encoded_len = (index_t) base64_str.length();
-        index_t dec_buff_size = utils::base64_decode_buffer_size(encoded_len);
-
-        // decode buffer
-        Node bb64_decode;
-        bb64_decode.set(DataType::char8_str(dec_buff_size));
-        char *decode_ptr = (char*)bb64_decode.data_ptr();
-        memset(decode_ptr,0,dec_buff_size);
-
-        utils::base64_decode(src_ptr,
-                             encoded_len,
-                             decode_ptr);
-
-        node->set(s,decode_ptr);
-
-    }
-    else
-    {
-        CONDUIT_ERROR("conduit_base64_json protocol error: missing schema and data/base64");
-    }
-}
-
 //---------------------------------------------------------------------------//
 void 
 Generator::Parser::JSON::parse_error_details(const std::string &json,
@@ -1482,555 +1849,1464 @@ Generator::Parser::JSON::parse_error_details(const std::string &json,
 }
 
 //-----------------------------------------------------------------------------
-// -- end conduit::Generator::Parser::JSON --
+//
+// -- incremental (SAX) parsing of pure json --
+//
 //-----------------------------------------------------------------------------
 
 //-----------------------------------------------------------------------------
-// -- begin conduit::Generator::YAML --
+/// rapidjson input stream over an Input. Applies the same rules as 
+/// utils::json_sanitize (removes // comments and quotes bare identifiers) 
+/// as the text is read, and tracks line and character positions for 
+/// error messages.
 //-----------------------------------------------------------------------------
+class Generator::Parser::JSON::SanitizedStream
+{
+public:
+    typedef char Ch;
+
+    SanitizedStream(Input &input)
+    : m_input(input),
+      m_chunk(NULL),
+      m_chunk_size(0),
+      m_chunk_pos(0),
+      m_input_done(false),
+      m_index(0),
+      m_prev(0),
+      m_in_string(false),
+      m_in_comment(false),
+      m_in_id(false),
+      m_out_pos(0),
+      m_tell(0),
+      m_line(0),
+      m_line_start(0)
+    {}
+
+    Ch Peek()
+    {
+        if(m_out_pos == m_out.size())
+        {
+            fill();
+        }
+        return m_out_pos < m_out.size() ? m_out[m_out_pos] : '\0';
+    }
 
+    Ch Take()
+    {
+        Ch c = Peek();
+        if(c != '\0')
+        {
+            m_out_pos++;
+            m_tell++;
+            if(c == '\n')
+            {
+                m_line++;
+                m_line_start = m_tell;
+            }
+        }
+        return c;
+    }
 
-//-----------------------------------------------------------------------------
-// -- begin conduit::Generator::YAML::YAMLParserWrapper --
-//-----------------------------------------------------------------------------
+    size_t Tell() const { return m_tell; }
 
+    // takes the chars up to the next quote, backslash or newline that are
+    // already buffered (used to consume long string values in bulk), 
+    // returns the number of chars taken
+    size_t TakeRun(const Ch *&run)
+    {
+        Peek();
+        size_t start = m_out_pos;
+        size_t end   = start;
+        size_t size  = m_out.size();
+        while(end < size && 
+              m_out[end] != '\"' &&
+              m_out[end] != '\\' &&
+              m_out[end] != '\n')
+        {
+            end++;
+        }
+        run = m_out.data() + start;
+        m_out_pos = end;
+        m_tell   += end - start;
+        return end - start;
+    }
 
-//---------------------------------------------------------------------------//
-Generator::Parser::YAML::YAMLParserWrapper::YAMLParserWrapper()
-: m_yaml_parser_is_valid(false),
-  m_yaml_doc_is_valid(false)
-{
+    // write interface, not used for parsing
+    Ch    *PutBegin() { RAPIDJSON_ASSERT(false); return 0; }
+    void   Put(Ch) { RAPIDJSON_ASSERT(false); }
+    void   Flush() { RAPIDJSON_ASSERT(false); }
+    size_t PutEnd(Ch*) { RAPIDJSON_ASSERT(false); return 0; }
 
-}
+    index_t line() const { return m_line; }
+    index_t character() const { return (index_t)(m_tell - m_line_start); }
 
-//---------------------------------------------------------------------------//
-Generator::Parser::YAML::YAMLParserWrapper::~YAMLParserWrapper()
-{
-    // cleanup!
-    if(m_yaml_parser_is_valid)
+private:
+    // next input char, returns -1 at the end
+    int  next_input()
     {
-        yaml_parser_delete(&m_yaml_parser);
+        if(m_chunk_pos == m_chunk_size && !load_chunk())
+        {
+            return -1;
+        }
+        return (unsigned char)m_chunk[m_chunk_pos++];
     }
 
-    if(m_yaml_doc_is_valid)
+    // peeks at the next input char, returns -1 at the end
+    int  peek_input()
     {
-        yaml_document_delete(&m_yaml_doc);
+        if(m_chunk_pos == m_chunk_size && !load_chunk())
+        {
+            return -1;
+        }
+        return (unsigned char)m_chunk[m_chunk_pos];
     }
-}
 
-//---------------------------------------------------------------------------//
-void
-Generator::Parser::YAML::YAMLParserWrapper::parse(const char *yaml_txt)
-{
-    // Initialize parser
-    if(yaml_parser_initialize(&m_yaml_parser) == 0)
-    {
-        // error!
-        CONDUIT_ERROR("yaml_parser_initialize failed");
-    }
-    else
+    bool load_chunk()
     {
-        m_yaml_parser_is_valid = true;
+        m_chunk_pos  = 0;
+        m_chunk_size = 0;
+        if(!m_input_done && !m_input.next_chunk(m_chunk,m_chunk_size))
+        {
+            m_input_done = true;
+            m_chunk_size = 0;
+        }
+        return m_chunk_size > 0;
     }
 
-    // set input
-    yaml_parser_set_input_string(&m_yaml_parser,
-                                 (const unsigned char*)yaml_txt,
-                                 strlen(yaml_txt));
+    void fill();
 
-    // use parser to construct document
-    if( yaml_parser_load(&m_yaml_parser, &m_yaml_doc) == 0 )
+    // same char classes as utils::json_sanitize
+    static bool is_word_char(char c)
     {
-        CONDUIT_YAML_PARSE_ERROR(&m_yaml_doc,
-                                 &m_yaml_parser);
+        return ('A' <= c && c <= 'Z') ||
+               ('a' <= c && c <= 'z') ||
+               c == '_';
     }
-    else
+
+    static bool is_num_char(char c)
     {
-        m_yaml_doc_is_valid = true;
+        return '0' <= c && c <= '9';
     }
-}
 
-//---------------------------------------------------------------------------//
-yaml_document_t *
-Generator::Parser::YAML::YAMLParserWrapper::yaml_doc_ptr()
-{
-    yaml_document_t *res = NULL;
+    Input       &m_input;
+    const char  *m_chunk;
+    index_t      m_chunk_size;
+    index_t      m_chunk_pos;
+    bool         m_input_done;
 
-    if(m_yaml_doc_is_valid)
-    {
-        res = &m_yaml_doc;
-    }
+    // sanitize state
+    index_t      m_index;
+    char         m_prev;
+    bool         m_in_string;
+    bool         m_in_comment;
+    bool         m_in_id;
+    std::string  m_cur_id;
 
-    return res;
-}
+    // sanitized text ready for the parser
+    std::string  m_out;
+    size_t       m_out_pos;
+    size_t       m_tell;
+    index_t      m_line;
+    size_t       m_line_start;
+};
 
 //---------------------------------------------------------------------------//
-yaml_node_t *
-Generator::Parser::YAML::YAMLParserWrapper::yaml_doc_root_ptr()
+void
+Generator::Parser::JSON::SanitizedStream::fill()
 {
-    yaml_node_t *res = NULL;
+    // char by char version of utils::json_sanitize
+    m_out.clear();
+    m_out_pos = 0;
 
-    if(m_yaml_doc_is_valid)
+    while(m_out.size() < 16384)
     {
-        res = yaml_document_get_root_node(&m_yaml_doc);
-    }
+        // inside strings, copy runs without quotes or escapes directly
+        if(m_in_string && m_chunk_pos < m_chunk_size)
+        {
+            const char *run = m_chunk + m_chunk_pos;
+            index_t run_max = std::min(m_chunk_size - m_chunk_pos,
+                                       (index_t)(16384 - m_out.size()));
+            index_t run_size = 0;
+            while(run_size < run_max &&
+                  run[run_size] != '\"' &&
+                  run[run_size] != '\\')
+            {
+                run_size++;
+            }
 
-    return res;
-}
+            if(run_size > 0)
+            {
+                m_out.append(run,(size_t)run_size);
+                m_prev = run[run_size-1];
+                m_index      += run_size;
+                m_chunk_pos  += run_size;
+                continue;
+            }
+        }
 
-//-----------------------------------------------------------------------------
-// -- end conduit::Generator::YAML::YAMLParserWrapper --
-//-----------------------------------------------------------------------------
+        int ic = next_input();
+        if(ic < 0)
+        {
+            break;
+        }
+        char c = (char)ic;
+        bool emit = true;
 
-//---------------------------------------------------------------------------//
-// checks if input string is a null pointer or empty
-bool
-Generator::Parser::YAML::string_is_empty(const char *txt_value)
-{
-    if(txt_value == NULL)
-        return true;
-    return strlen(txt_value) == 0;
-}
+        // check for start & end of a string
+        if(c == '\"' && m_index > 0 && m_prev != '\\')
+        {
+            m_in_string = !m_in_string;
+        }
 
-//---------------------------------------------------------------------------//
-// checks if input string holds something that converts
-// to a double (integer strings will pass this check )
-bool
-Generator::Parser::YAML::string_is_number(const char *txt_value)
-{
-    return string_is_integer(txt_value) || string_is_double(txt_value);
-}
+        // handle two cases were we want to sanitize:
+        // comments '//' to end of line & unquoted ids
+        if(!m_in_string)
+        {
+            if(!m_in_comment && c == '/' && peek_input() == '/')
+            {
+                m_in_comment = true;
+                emit = false;
+            }
 
-//---------------------------------------------------------------------------//
-// checks if input string holds something that converts
-// to a double (integer strings will pass this check )
-bool
-Generator::Parser::YAML::string_is_double(const char *txt_value)
-{
-    // TODO: inline check for empty ?
-    if(string_is_empty(txt_value))
-        return false;
-    char *val_end = NULL;
-    strtod(txt_value,&val_end);
-    return *val_end == 0;
-}
+            if(!m_in_comment)
+            {
+                if(!m_in_id && is_word_char(c))
+                {
+                    // ids can't start with numbers ,
+                    // check the prior char if it exists
+                    if(m_index > 0 &&
+                       !is_num_char(m_prev) &&
+                       m_prev != '.')
+                    {
+                        m_in_id = true;
+                        m_cur_id += c;
+                        emit = false;
+                    }
+                }
+                else if(m_in_id) // finish the id
+                {
+                    if(is_word_char(c) || is_num_char(c))
+                    {
+                        m_cur_id += c;
+                        emit = false;
+                    }
+                    else
+                    {
+                        m_in_id = false;
+                        // don't quote true, false and null
+                        if( !(m_cur_id == "true"  ||
+                              m_cur_id == "false" ||
+                              m_cur_id == "null" ))
+                        {
+                            m_out += '\"';
+                            m_out += m_cur_id;
+                            m_out += '\"';
+                        }
+                        else
+                        {
+                            m_out += m_cur_id;
+                        }
+                        m_cur_id.clear();
+                    }
+                }
+            }
 
-//---------------------------------------------------------------------------//
-// checks if input string holds something that converts
-// to an integer
-bool
-Generator::Parser::YAML::string_is_integer(const char *txt_value)
-{
-    // TODO: inline check for empty ?
-    if(string_is_empty(txt_value))
-        return false;
-    char *val_end = NULL;
-    strtol(txt_value,&val_end,10);
-    return *val_end == 0;
-}
+            if(m_in_comment)
+            {
+                emit = false;
+                if(c == '\n')
+                {
+                    m_in_comment = false;
+                }
+            }
+        }
 
-//---------------------------------------------------------------------------//
-double 
-Generator::Parser::YAML::string_to_double(const char *txt_value)
-{
-    char *val_end = NULL;
-    return strtod(txt_value,&val_end);
-}
+        if(emit)
+        {
+            m_out += c;
+        }
 
-//---------------------------------------------------------------------------//
-long int
-Generator::Parser::YAML::string_to_long(const char *txt_value)
-{
-    char *val_end = NULL;
-    return strtol(txt_value,&val_end,10);
+        m_prev = c;
+        m_index++;
+    }
 }
 
-//---------------------------------------------------------------------------//
-index_t 
-Generator::Parser::YAML::yaml_leaf_to_numeric_dtype(const char *txt_value)
+//-----------------------------------------------------------------------------
+/// rapidjson handler that passes parse events to a TreeBuilder.
+///
+/// Integers use int64, unless they only fit in a uint64. Bools are stored 
+/// as uint8s and nulls leave an empty node.
+//-----------------------------------------------------------------------------
+class Generator::Parser::JSON::PureJSONHandler
 {
-    index_t res = DataType::EMPTY_ID;
-    if(string_is_integer(txt_value))
+public:
+    PureJSONHandler(Node &root)
+    : m_builder(root,"JSON",true)
+    {}
+
+    bool Null()
     {
-        res = DataType::INT64_ID;
+        m_builder.next_node();
+        return true;
     }
-    else if(string_is_double(txt_value))
+
+    bool Bool(bool value)
     {
-        res = DataType::FLOAT64_ID;
+        // we store bools as uint8s
+        m_builder.next_node()->set((uint8)(value ? 1 : 0));
+        return true;
     }
-    //else, already inited to DataType::EMPTY_ID
 
-    return res;
-}
+    bool Int(int value)
+    {
+        return Int64((int64)value);
+    }
 
-//---------------------------------------------------------------------------//
-// NOTE: Assumes Node res is already DataType::int64, w/ proper len
-void
-Generator::Parser::YAML::parse_yaml_int64_array(yaml_document_t *yaml_doc,
-                                                yaml_node_t *yaml_node,
-                                                Node &res)
-{
-    int64_array res_vals = res.value();
-    int cld_idx = 0;
-    while( yaml_node->data.sequence.items.start + cld_idx < yaml_node->data.sequence.items.top )
+    bool Uint(unsigned value)
     {
-        yaml_node_t *yaml_child = yaml_document_get_node(yaml_doc,
-                                                 yaml_node->data.sequence.items.start[cld_idx]);
-                                     
-        if(yaml_child == NULL || yaml_child->type != YAML_SCALAR_NODE )
+        return Int64((int64)value);
+    }
+
+    bool Int64(int64_t value)
+    {
+        if(m_builder.in_numeric_array())
+        {
+            m_builder.append_int64((int64)value);
+        }
+        else
+        {
+            m_builder.next_node()->set((int64)value);
+        }
+        return true;
+    }
+
+    bool Uint64(uint64_t value)
+    {
+        if(value <= (uint64)std::numeric_limits<int64>::max())
+        {
+            return Int64((int64)value);
+        }
+
+        if(m_builder.in_numeric_array())
+        {
+            m_builder.append_uint64((uint64)value);
+        }
+        else
+        {
+            m_builder.next_node()->set((uint64)value);
+        }
+        return true;
+    }
+
+    bool Double(double value)
+    {
+        if(m_builder.in_numeric_array())
+        {
+            m_builder.append_float64((float64)value);
+        }
+        else
+        {
+            m_builder.next_node()->set((float64)value);
+        }
+        return true;
+    }
+
+    bool String(const char *str, rapidjson::SizeType length, bool)
+    {
+        m_builder.next_node()->set(std::string(str,length));
+        return true;
+    }
+
+    bool StartObject()
+    {
+        m_builder.begin_object(m_builder.next_node());
+        return true;
+    }
+
+    bool Key(const char *str, rapidjson::SizeType length, bool)
+    {
+        m_builder.set_key(str,length);
+        return true;
+    }
+
+    bool EndObject(rapidjson::SizeType)
+    {
+        m_builder.end_object();
+        return true;
+    }
+
+    bool StartArray()
+    {
+        m_builder.begin_array(m_builder.next_node());
+        return true;
+    }
+
+    bool EndArray(rapidjson::SizeType)
+    {
+        m_builder.end_array();
+        return true;
+    }
+
+private:
+    TreeBuilder m_builder;
+};
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::JSON::parse_pure_json(Input &input,
+                                         Node &node)
+{
+    try
+    {
+        SanitizedStream stream(input);
+        PureJSONHandler handler(node);
+        rapidjson::Reader reader;
+
+        if(reader.Parse<RAPIDJSON_PARSE_OPTS>(stream,handler).IsError())
+        {
+            std::ostringstream oss;
+            oss << " parse error message:\n"
+                << GetParseError_En(reader.GetParseErrorCode()) << "\n"
+                << " offset: "    << reader.GetErrorOffset() << "\n"
+                << " line: "      << stream.line() << "\n"
+                << " character: " << stream.character() << "\n";
+
+            if(input.text() != NULL)
+            {
+                oss << " json:\n" 
+                    << utils::json_sanitize(*input.text()) << "\n";
+            }
+
+            CONDUIT_ERROR("JSON parse error: \n"
+                          << oss.str()
+                          << "\n");
+        }
+    }
+    catch(conduit::Error &)
+    {
+        // don't leave a partial tree behind
+        node.reset();
+        throw;
+    }
+}
+
+//-----------------------------------------------------------------------------
+/// Reads "conduit_base64_json" text:
+///
+///   {"schema": <conduit json schema>, "data": {"base64": "<payload>"}}
+///
+/// The schema is parsed with rapidjson. The payload is not buffered: it is
+/// decoded in blocks straight into the data of the resulting node. 
+/// (If the payload comes before the schema, it has to be held until the 
+/// schema is known.)
+//-----------------------------------------------------------------------------
+class Generator::Parser::JSON::Base64Reader
+{
+public:
+    Base64Reader(Input &input,
+                 Node &node)
+    : m_stream(input),
+      m_node(node),
+      m_has_schema(false),
+      m_has_data(false),
+      m_data_offset(0),
+      m_buffer(BLOCK_SIZE / 4 * 3 + 3)
+    {}
+
+    void read();
+
+private:
+    // max number of base64 chars decoded at once
+    static const index_t BLOCK_SIZE = 65536;
+
+    void skip_whitespace();
+    bool read_string(std::string *text);
+    void read_value(std::string *text);
+    void read_schema();
+    void read_data();
+    void read_base64();
+
+    void decode(const char *txt, index_t txt_size);
+    void write_decoded(index_t nbytes);
+
+    void error(const std::string &msg);
+
+    SanitizedStream        m_stream;
+    Node                  &m_node;
+    bool                   m_has_schema;
+    bool                   m_has_data;
+    // base64 text that arrived before the schema
+    std::string            m_pending;
+    utils::Base64Decoder   m_decoder;
+    index_t                m_data_offset;
+    std::vector<uint8>     m_buffer;
+};
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::JSON::Base64Reader::read()
+{
+    skip_whitespace();
+    if(m_stream.Take() != '{')
+    {
+        CONDUIT_ERROR("conduit_base64_json protocol error: "
+                      "missing schema and data/base64");
+    }
+
+    std::string key;
+    skip_whitespace();
+    if(m_stream.Peek() == '}')
+    {
+        m_stream.Take();
+    }
+    else
+    {
+        while(true)
+        {
+            key.clear();
+            skip_whitespace();
+            if(!read_string(&key))
+            {
+                error("expected object name");
+            }
+            skip_whitespace();
+            if(m_stream.Take() != ':')
+            {
+                error("expected ':'");
+            }
+            skip_whitespace();
+
+            // key holds the quoted name
+            if(key == "\"schema\"")
+            {
+                read_schema();
+            }
+            else if(key == "\"data\"")
+            {
+                read_data();
+            }
+            else
+            {
+                read_value(NULL);
+            }
+
+            skip_whitespace();
+            char c = m_stream.Take();
+            if(c == '}')
+            {
+                break;
+            }
+            else if(c != ',')
+            {
+                error("expected ',' or '}'");
+            }
+        }
+    }
+
+    if(!m_has_data)
+    {
+        CONDUIT_ERROR("conduit_base64_json protocol error: "
+                      "missing data/base64");
+    }
+
+    if(!m_has_schema)
+    {
+        CONDUIT_ERROR("conduit_base64_json protocol error: missing schema");
+    }
+
+    if(!m_pending.empty())
+    {
+        decode(m_pending.data(),(index_t)m_pending.size());
+        std::string().swap(m_pending);
+    }
+
+    // unpadded trailing group
+    write_decoded(m_decoder.finish(&m_buffer[0]));
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::JSON::Base64Reader::skip_whitespace()
+{
+    char c = m_stream.Peek();
+    while(c == ' ' || c == '\t' || c == '\n' || c == '\r')
+    {
+        m_stream.Take();
+        c = m_stream.Peek();
+    }
+}
+
+//---------------------------------------------------------------------------//
+bool
+Generator::Parser::JSON::Base64Reader::read_string(std::string *text)
+{
+    // appends the string (with its quotes and escapes) to text
+    if(m_stream.Peek() != '\"')
+    {
+        return false;
+    }
+    m_stream.Take();
+
+    if(text != NULL)
+    {
+        text->push_back('\"');
+    }
+
+    while(true)
+    {
+        const char *run = NULL;
+        size_t run_size = m_stream.TakeRun(run);
+        if(text != NULL)
+        {
+            text->append(run,run_size);
+        }
+
+        char c = m_stream.Take();
+        if(c == '\0')
+        {
+            error("unterminated string");
+        }
+        else if(text != NULL)
+        {
+            text->push_back(c);
+        }
+
+        if(c == '\"')
+        {
+            return true;
+        }
+        else if(c == '\\')
+        {
+            c = m_stream.Take();
+            if(c == '\0')
+            {
+                error("unterminated string");
+            }
+            else if(text != NULL)
+            {
+                text->push_back(c);
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::JSON::Base64Reader::read_value(std::string *text)
+{
+    // appends the text of the next value to text
+    char c = m_stream.Peek();
+    if(c == '\"')
+    {
+        read_string(text);
+    }
+    else if(c == '{' || c == '[')
+    {
+        index_t depth = 0;
+        do
+        {
+            c = m_stream.Peek();
+            if(c == '\"')
+            {
+                read_string(text);
+                continue;
+            }
+            else if(c == '\0')
+            {
+                error("unexpected end of input");
+            }
+            else if(c == '{' || c == '[')
+            {
+                depth++;
+            }
+            else if(c == '}' || c == ']')
+            {
+                depth--;
+            }
+
+            m_stream.Take();
+            if(text != NULL)
+            {
+                text->push_back(c);
+            }
+        } while(depth > 0);
+    }
+    else
+    {
+        // number or literal
+        while(c != '\0' && c != ',' && c != '}' && c != ']' &&
+              c != ' ' && c != '\t' && c != '\n' && c != '\r')
+        {
+            m_stream.Take();
+            if(text != NULL)
+            {
+                text->push_back(c);
+            }
+            c = m_stream.Peek();
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::JSON::Base64Reader::read_schema()
+{
+    std::string schema_json;
+    read_value(&schema_json);
+
+    rapidjson::Document document;
+    if(document.Parse<RAPIDJSON_PARSE_OPTS>(schema_json.c_str()).HasParseError())
+    {
+        CONDUIT_JSON_PARSE_ERROR(schema_json, document);
+    }
+
+    Schema schema;
+    index_t curr_offset = 0;
+    walk_json_schema(&schema,document,curr_offset);
+
+    // zero initialized, in case the payload is short
+    m_node.set(schema);
+    m_data_offset = 0;
+    m_has_schema = true;
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::JSON::Base64Reader::read_data()
+{
+    if(m_stream.Peek() != '{')
+    {
+        read_value(NULL);
+        return;
+    }
+    m_stream.Take();
+
+    std::string key;
+    skip_whitespace();
+    if(m_stream.Peek() == '}')
+    {
+        m_stream.Take();
+        return;
+    }
+
+    while(true)
+    {
+        key.clear();
+        skip_whitespace();
+        if(!read_string(&key))
+        {
+            error("expected object name");
+        }
+        skip_whitespace();
+        if(m_stream.Take() != ':')
+        {
+            error("expected ':'");
+        }
+        skip_whitespace();
+
+        if(key == "\"base64\"" && m_stream.Peek() == '\"')
+        {
+            read_base64();
+            m_has_data = true;
+        }
+        else
+        {
+            read_value(NULL);
+        }
+
+        skip_whitespace();
+        char c = m_stream.Take();
+        if(c == '}')
+        {
+            return;
+        }
+        else if(c != ',')
+        {
+            error("expected ',' or '}'");
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::JSON::Base64Reader::read_base64()
+{
+    // opening quote
+    m_stream.Take();
+
+    while(true)
+    {
+        const char *run = NULL;
+        size_t run_size = m_stream.TakeRun(run);
+        if(run_size > 0)
+        {
+            if(m_has_schema)
+            {
+                decode(run,(index_t)run_size);
+            }
+            else
+            {
+                m_pending.append(run,run_size);
+            }
+        }
+
+        char c = m_stream.Take();
+        if(c == '\"')
+        {
+            return;
+        }
+        else if(c == '\0')
+        {
+            error("unterminated string");
+        }
+        else if(c == '\\')
+        {
+            // escaped '/' is part of the payload, other escapes 
+            // (whitespace) are skipped by the decoder
+            c = m_stream.Take();
+            if(c == '\0')
+            {
+                error("unterminated string");
+            }
+            else if(c != '/')
+            {
+                continue;
+            }
+        }
+
+        // a run ends at a newline or at the end of the stream's buffer
+        if(m_has_schema)
+        {
+            decode(&c,1);
+        }
+        else
+        {
+            m_pending.push_back(c);
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::JSON::Base64Reader::decode(const char *txt,
+                                              index_t txt_size)
+{
+    while(txt_size > 0)
+    {
+        index_t n = std::min(txt_size,BLOCK_SIZE);
+        write_decoded(m_decoder.decode(txt,n,&m_buffer[0]));
+        txt      += n;
+        txt_size -= n;
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::JSON::Base64Reader::write_decoded(index_t nbytes)
+{
+    // extra bytes past what the schema spans are ignored
+    nbytes = std::min(nbytes, m_node.m_data_size - m_data_offset);
+    if(nbytes > 0)
+    {
+        memcpy(((uint8*)m_node.m_data) + m_data_offset,
+               &m_buffer[0],
+               (size_t)nbytes);
+        m_data_offset += nbytes;
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::JSON::Base64Reader::error(const std::string &msg)
+{
+    CONDUIT_ERROR("conduit_base64_json protocol error: " << msg << "\n"
+                  << " line: "      << m_stream.line() << "\n"
+                  << " character: " << m_stream.character() << "\n");
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::JSON::parse_base64(Input &input,
+                                      Node &node)
+{
+    try
+    {
+        Base64Reader reader(input,node);
+        reader.read();
+    }
+    catch(conduit::Error &)
+    {
+        node.reset();
+        throw;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// -- end conduit::Generator::Parser::JSON --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::Generator::YAML --
+//-----------------------------------------------------------------------------
+
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::Generator::YAML::YAMLParserWrapper --
+//-----------------------------------------------------------------------------
+
+
+//---------------------------------------------------------------------------//
+Generator::Parser::YAML::YAMLParserWrapper::YAMLParserWrapper()
+: m_yaml_parser_is_valid(false),
+  m_yaml_event_is_valid(false),
+  m_input(NULL),
+  m_chunk(NULL),
+  m_chunk_size(0),
+  m_chunk_pos(0)
+{
+
+}
+
+//---------------------------------------------------------------------------//
+Generator::Parser::YAML::YAMLParserWrapper::~YAMLParserWrapper()
+{
+    // cleanup!
+    if(m_yaml_event_is_valid)
+    {
+        yaml_event_delete(&m_yaml_event);
+    }
+
+    if(m_yaml_parser_is_valid)
+    {
+        yaml_parser_delete(&m_yaml_parser);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::YAML::YAMLParserWrapper::set_input(Input &input)
+{
+    // Initialize parser
+    if(yaml_parser_initialize(&m_yaml_parser) == 0)
+    {
+        // error!
+        CONDUIT_ERROR("yaml_parser_initialize failed");
+    }
+    else
+    {
+        m_yaml_parser_is_valid = true;
+    }
+
+    m_input = &input;
+    yaml_parser_set_input(&m_yaml_parser,
+                          read_handler,
+                          this);
+}
+
+//---------------------------------------------------------------------------//
+yaml_event_t &
+Generator::Parser::YAML::YAMLParserWrapper::next_event()
+{
+    if(m_yaml_event_is_valid)
+    {
+        yaml_event_delete(&m_yaml_event);
+        m_yaml_event_is_valid = false;
+    }
+
+    if( yaml_parser_parse(&m_yaml_parser, &m_yaml_event) == 0 )
+    {
+        // errors from reading the input can't pass through libyaml,
+        // so they are raised here
+        if(!m_input_error.empty())
+        {
+            CONDUIT_ERROR(m_input_error);
+        }
+
+        CONDUIT_YAML_PARSE_ERROR(NULL,
+                                 &m_yaml_parser);
+    }
+
+    m_yaml_event_is_valid = true;
+    return m_yaml_event;
+}
+
+//---------------------------------------------------------------------------//
+int
+Generator::Parser::YAML::YAMLParserWrapper::read_handler(void *data,
+                                                         unsigned char *buffer,
+                                                         size_t size,
+                                                         size_t *size_read)
+{
+    YAMLParserWrapper *self = (YAMLParserWrapper*)data;
+    *size_read = 0;
+
+    try
+    {
+        while(self->m_chunk_pos == self->m_chunk_size)
+        {
+            self->m_chunk_pos  = 0;
+            self->m_chunk_size = 0;
+            if(!self->m_input->next_chunk(self->m_chunk,
+                                          self->m_chunk_size))
+            {
+                // end of input
+                self->m_chunk_size = 0;
+                return 1;
+            }
+        }
+    }
+    catch(conduit::Error &e)
+    {
+        self->m_input_error = e.message();
+        return 0;
+    }
+
+    size_t nbytes = (size_t)(self->m_chunk_size - self->m_chunk_pos);
+    if(nbytes > size)
+    {
+        nbytes = size;
+    }
+
+    memcpy(buffer,self->m_chunk + self->m_chunk_pos,nbytes);
+    self->m_chunk_pos += (index_t)nbytes;
+    *size_read = nbytes;
+    return 1;
+}
+
+//-----------------------------------------------------------------------------
+// -- end conduit::Generator::YAML::YAMLParserWrapper --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+/// Passes libyaml parse events to a TreeBuilder.
+///
+/// Aliases are expanded: aliased scalars are parsed again from their text,
+/// aliased mappings and sequences are copied from the anchored Node.
+//-----------------------------------------------------------------------------
+class Generator::Parser::YAML::PureYAMLHandler
+{
+public:
+    PureYAMLHandler(Node &root)
+    : m_builder(root,"YAML",false),
+      m_found_document(false),
+      m_done(false)
+    {}
+
+    // like yaml_parser_load, we only read the first document
+    bool done() const { return m_done; }
+
+    bool found_document() const { return m_found_document; }
+
+    void process(const yaml_event_t &event);
+
+private:
+    // an anchored scalar (text) or mapping / sequence (node)
+    struct Anchor
+    {
+        Anchor()
+        : node(NULL)
+        {}
+
+        std::string  text;
+        Node        *node;
+    };
+
+    void  scalar(const char *value, size_t length);
+    void  alias(const char *anchor_name);
+    Node *container_node(const char *anchor_name);
+
+    TreeBuilder                    m_builder;
+    std::map<std::string,Anchor>   m_anchors;
+    bool                           m_found_document;
+    bool                           m_done;
+};
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::YAML::PureYAMLHandler::process(const yaml_event_t &event)
+{
+    switch(event.type)
+    {
+        case YAML_DOCUMENT_START_EVENT:
+        {
+            m_found_document = true;
+            break;
+        }
+        case YAML_DOCUMENT_END_EVENT:
+        case YAML_STREAM_END_EVENT:
+        {
+            m_done = true;
+            break;
+        }
+        case YAML_SCALAR_EVENT:
+        {
+            const char *anchor_name = (const char*)event.data.scalar.anchor;
+            const char *value       = (const char*)event.data.scalar.value;
+            size_t      length      = event.data.scalar.length;
+
+            if(value == NULL)
+            {
+                CONDUIT_ERROR("YAML Generator error:\n"
+                              << "Invalid yaml scalar value at path: "
+                              << m_builder.current_node()->path());
+            }
+
+            if(anchor_name != NULL)
+            {
+                Anchor &anchor = m_anchors[anchor_name];
+                anchor.text.assign(value,length);
+                anchor.node = NULL;
+            }
+
+            scalar(value,length);
+            break;
+        }
+        case YAML_ALIAS_EVENT:
+        {
+            alias((const char*)event.data.alias.anchor);
+            break;
+        }
+        case YAML_MAPPING_START_EVENT:
+        {
+            const char *anchor_name = (const char*)event.data.mapping_start.anchor;
+            m_builder.begin_object(container_node(anchor_name));
+            break;
+        }
+        case YAML_MAPPING_END_EVENT:
+        {
+            m_builder.end_object();
+            break;
+        }
+        case YAML_SEQUENCE_START_EVENT:
         {
-            CONDUIT_ERROR("YAML Generator error:\n"
-                          << "Invalid int64 array value at path: "
-                          << res.path() << "[" << cld_idx << "]");
+            const char *anchor_name = (const char*)event.data.sequence_start.anchor;
+            m_builder.begin_array(container_node(anchor_name));
+            break;
         }
-
-
-        // check type of string contents
-        const char *yaml_value_str = (const char*)yaml_child->data.scalar.value;
-
-        if(yaml_value_str == NULL )
+        case YAML_SEQUENCE_END_EVENT:
         {
-            CONDUIT_ERROR("YAML Generator error:\n"
-                          << "Invalid int64 array value at path: "
-                          << res.path() << "[" << cld_idx << "]");
+            m_builder.end_array();
+            break;
+        }
+        default:
+        {
+            // YAML_STREAM_START_EVENT, YAML_NO_EVENT
+            break;
         }
-
-        res_vals[cld_idx] = (int64) string_to_long(yaml_value_str);
-
-        cld_idx++;
     }
 }
 
 //---------------------------------------------------------------------------//
-// NOTE: Assumes Node res is already DataType::float64, w/ proper len
 void
-Generator::Parser::YAML::parse_yaml_float64_array(yaml_document_t *yaml_doc,
-                                                  yaml_node_t *yaml_node,
-                                                  Node &res)
+Generator::Parser::YAML::PureYAMLHandler::scalar(const char *value,
+                                                 size_t length)
 {
-    float64_array res_vals = res.value();
-    int cld_idx = 0;
-    while( yaml_node->data.sequence.items.start + cld_idx < yaml_node->data.sequence.items.top )
+    if(m_builder.expecting_key())
     {
-        yaml_node_t *yaml_child = yaml_document_get_node(yaml_doc,
-                                                 yaml_node->data.sequence.items.start[cld_idx]);
-                                     
-        if(yaml_child == NULL || yaml_child->type != YAML_SCALAR_NODE )
-        {
-            CONDUIT_ERROR("YAML Generator error:\n"
-                          << "Invalid float64 array value at path: "
-                          << res.path() << "[" << cld_idx << "]");
-        }
-
-
-        // check type of string contents
-        const char *yaml_value_str = (const char*)yaml_child->data.scalar.value;
-
-        if(yaml_value_str == NULL )
-        {
-            CONDUIT_ERROR("YAML Generator error:\n"
-                          << "Invalid float64 array value at path: "
-                          << res.path() << "[" << cld_idx << "]");
-        }
-
-        res_vals[cld_idx] = (float64) string_to_double(yaml_value_str);
-
-        cld_idx++;
+        m_builder.set_key(value,length);
+        return;
     }
-}
 
-//---------------------------------------------------------------------------//
-index_t
-Generator::Parser::YAML::check_homogenous_yaml_numeric_sequence(const Node &node,
-                                                                yaml_document_t *yaml_doc,
-                                                                yaml_node_t *yaml_node,
-                                                                index_t &seq_size)
-{
-     index_t res = DataType::EMPTY_ID;
-     seq_size = -1;
-     bool ok = true;
-     int cld_idx = 0;
-     while( ok && yaml_node->data.sequence.items.start + cld_idx < yaml_node->data.sequence.items.top )
-     {
-         yaml_node_t *yaml_child = yaml_document_get_node(yaml_doc,
-                                                 yaml_node->data.sequence.items.start[cld_idx]);
-                                                 
-        if(yaml_child == NULL )
-        {
-            CONDUIT_ERROR("YAML Generator error:\n"
-                          << "Invalid sequence child at path: "
-                          << node.path() << "[" << cld_idx << "]");
-        }
+    int64   int64_value   = 0;
+    float64 float64_value = 0.0;
+    index_t dtype_id = parse_yaml_number(value,
+                                         length,
+                                         int64_value,
+                                         float64_value);
 
-        // first make sure we only have yaml scalars
-        if(yaml_child->type == YAML_SCALAR_NODE)
+    if(m_builder.in_numeric_array())
+    {
+        if(dtype_id == DataType::INT64_ID)
         {
-
-            // check type of string contents
-            const char *yaml_value_str = (const char*)yaml_child->data.scalar.value;
-
-            if(yaml_value_str == NULL )
-            {
-                CONDUIT_ERROR("YAML Generator error:\n"
-                              << "Invalid value for sequence child at path: "
-                              << node.path() << "[" << cld_idx << "]");
-            }
-
-            // check for integers, then widen to floats
-
-            index_t child_dtype_id = yaml_leaf_to_numeric_dtype(yaml_value_str);
-
-            if(child_dtype_id == DataType::EMPTY_ID)
-            {
-                ok = false;
-            }
-            else if(res == DataType::EMPTY_ID)
-            {
-                // good so far, promote to child's dtype
-                res = child_dtype_id;
-            }
-            else if( res == DataType::INT64_ID && child_dtype_id == DataType::FLOAT64_ID)
-            {
-                // promote to float64
-                res = DataType::FLOAT64_ID;
-            }
+            m_builder.append_int64(int64_value);
+            return;
         }
-        else
+        else if(dtype_id == DataType::FLOAT64_ID)
         {
-            ok = false;
+            m_builder.append_float64(float64_value);
+            return;
         }
+    }
 
-        cld_idx++;
-     }
-
-     // if we are ok, seq_size is the final cld_idx
-     if(ok)
-     {
-         seq_size = cld_idx;
-     }
-     else
-     {
-        res = DataType::EMPTY_ID;
-     }
+    Node *node = m_builder.next_node();
 
-     return res;
+    if(dtype_id == DataType::INT64_ID)
+    {
+        node->set(int64_value);
+    }
+    else if(dtype_id == DataType::FLOAT64_ID)
+    {
+        node->set(float64_value);
+    }
+    else if(length > 0) // general string case
+    {
+        node->set_char8_str(value);
+    }
+    // else, empty values leave an empty node
 }
 
 //---------------------------------------------------------------------------//
 void
-Generator::Parser::YAML::parse_yaml_inline_leaf(const char *yaml_txt,
-                                                Node &node)
+Generator::Parser::YAML::PureYAMLHandler::alias(const char *anchor_name)
 {
-    if(string_is_integer(yaml_txt))
+    std::map<std::string,Anchor>::const_iterator itr;
+    if(anchor_name != NULL)
     {
-        node.set((int64)string_to_long(yaml_txt));
+        itr = m_anchors.find(anchor_name);
     }
-    else if(string_is_double(yaml_txt))
+
+    if(anchor_name == NULL || itr == m_anchors.end())
     {
-        node.set((float64)string_to_double(yaml_txt));
+        CONDUIT_ERROR("YAML Generator error:\n"
+                      << "Undefined YAML alias at path: "
+                      << m_builder.current_node()->path());
     }
-    else if(string_is_empty(yaml_txt))
+
+    const Anchor &anchor = itr->second;
+    if(anchor.node == NULL)
     {
-        node.reset();
+        scalar(anchor.text.c_str(),anchor.text.size());
+        return;
     }
-    else // general string case
+
+    if(m_builder.is_open(anchor.node))
     {
-        node.set_char8_str(yaml_txt);
+        CONDUIT_ERROR("YAML Generator error:\n"
+                      << "Recursive YAML alias at path: "
+                      << m_builder.current_node()->path());
     }
-}
 
+    container_node(NULL)->set(*anchor.node);
+}
 
 //---------------------------------------------------------------------------//
-void 
-Generator::Parser::YAML::walk_pure_yaml_schema(Node *node,
-                                               Schema *schema,
-                                               const char *yaml_txt)
+// node for a mapping or sequence value
+Node *
+Generator::Parser::YAML::PureYAMLHandler::container_node(const char *anchor_name)
 {
-    YAMLParserWrapper parser;
-    parser.parse(yaml_txt);
-
-    yaml_document_t *yaml_doc  = parser.yaml_doc_ptr();
-    yaml_node_t     *yaml_node = parser.yaml_doc_root_ptr();
+    if(m_builder.expecting_key())
+    {
+        CONDUIT_ERROR("YAML Generator error:\n"
+                      << "Invalid mapping key type at path: "
+                      << m_builder.current_node()->path());
+    }
 
+    Node *node = m_builder.next_node();
 
-    if(yaml_doc == NULL || yaml_node == NULL)
+    if(anchor_name != NULL)
     {
-        CONDUIT_ERROR("failed to fetch yaml document root");
+        Anchor &anchor = m_anchors[anchor_name];
+        anchor.text.clear();
+        anchor.node = node;
     }
 
-    walk_pure_yaml_schema(node,
-                          schema,
-                          yaml_doc,
-                          yaml_node);
-
-    // YAMLParserWrapper cleans up for us
+    return node;
 }
 
+//---------------------------------------------------------------------------//
+// exact powers of ten for the fast path of parse_yaml_number
+static const float64 yaml_exact_pow10[] = { 1e0,  1e1,  1e2,  1e3,  1e4,
+                                            1e5,  1e6,  1e7,  1e8,  1e9,
+                                            1e10, 1e11, 1e12, 1e13, 1e14,
+                                            1e15, 1e16, 1e17, 1e18, 1e19,
+                                            1e20, 1e21, 1e22 };
 
 //---------------------------------------------------------------------------//
-void 
-Generator::Parser::YAML::walk_pure_yaml_schema(Node *node,
-                                               Schema *schema,
-                                               yaml_document_t *yaml_doc,
-                                               yaml_node_t *yaml_node)
+index_t
+Generator::Parser::YAML::parse_yaml_number(const char *txt_value,
+                                           size_t txt_len,
+                                           int64 &int64_value,
+                                           float64 &float64_value)
 {
-    
-    // object cases
-    if( yaml_node->type == YAML_MAPPING_NODE )
+    if(txt_len == 0)
     {
-        // if we make it here and have an empty json object
-        // we still want the conduit node to take on the
-        // object role
-        schema->set(DataType::object());
-        // loop over all entries
-        
-        int cld_idx = 0;
-        // while (has_next) --> grab next, then process
-        while( (yaml_node->data.mapping.pairs.start + cld_idx) < yaml_node->data.mapping.pairs.top)
-        {
-            yaml_node_pair_t *yaml_pair = yaml_node->data.mapping.pairs.start + cld_idx;
-
-            if(yaml_pair == NULL)
-            {
-                CONDUIT_ERROR("YAML Generator error:\n"
-                              << "failed to fetch mapping pair at path: "
-                              << node->path() << "[" << cld_idx << "]");
-            }
+        return DataType::EMPTY_ID;
+    }
 
-            yaml_node_t *yaml_key = yaml_document_get_node(yaml_doc, yaml_pair->key);
-            
-            if(yaml_key == NULL)
-            {
-                CONDUIT_ERROR("YAML Generator error:\n"
-                              << "failed to fetch mapping key at path: "
-                              << node->path() << "[" << cld_idx << "]");
-            }
+    // fast path for plain decimal numbers:
+    //  [+-]digits[.digits][(e|E)[+-]digits]
+    const char *ptr = txt_value;
+    const char *end = txt_value + txt_len;
 
-            if(yaml_key->type != YAML_SCALAR_NODE )
-            {
-                CONDUIT_ERROR("YAML Generator error:\n"
-                              << "Invalid mapping key type at path: "
-                              << node->path() << "[" << cld_idx << "]");
-            }
+    bool negative = false;
+    if(*ptr == '+' || *ptr == '-')
+    {
+        negative = (*ptr == '-');
+        ptr++;
+    }
 
-            const char *yaml_key_str = (const char *) yaml_key->data.scalar.value;
+    uint64 mantissa     = 0;
+    int    num_sig      = 0; // significant digits in the mantissa
+    int    num_digits   = 0;
+    int    num_int      = 0;
+    int    exp10        = 0;
+    bool   truncated    = false;
+    bool   is_float     = false;
 
-            if(yaml_key_str == NULL )
+    while(ptr < end && *ptr >= '0' && *ptr <= '9')
+    {
+        if(num_sig < 19)
+        {
+            mantissa = mantissa * 10 + (uint64)(*ptr - '0');
+            if(mantissa != 0)
             {
-                CONDUIT_ERROR("YAML Generator error:\n"
-                              << "Invalid mapping key value at path: "
-                              << node->path() << "[" << cld_idx << "]");
+                num_sig++;
             }
-            
-            std::string entry_name(yaml_key_str);
-
-            yaml_node_t *yaml_child = yaml_document_get_node(yaml_doc, yaml_pair->value);
+        }
+        else
+        {
+            truncated = true;
+            exp10++;
+        }
+        num_int++;
+        ptr++;
+    }
+    num_digits = num_int;
 
-            if(yaml_child == NULL )
+    if(ptr < end && *ptr == '.')
+    {
+        is_float = true;
+        ptr++;
+        while(ptr < end && *ptr >= '0' && *ptr <= '9')
+        {
+            if(num_sig < 19)
             {
-                CONDUIT_ERROR("YAML Generator error:\n"
-                              << "Invalid mapping child at path: "
-                              << utils::join_path(node->path(),entry_name));
+                mantissa = mantissa * 10 + (uint64)(*ptr - '0');
+                if(mantissa != 0)
+                {
+                    num_sig++;
+                }
+                exp10--;
             }
-
-            // yaml files may have duplicate object names
-            // we could provide some clear semantics, such as:
-            //   always use first instance, or always use last instance
-            // however duplicate object names are most likely a
-            // typo, so it's best to throw an error
-
-            if(schema->has_child(entry_name))
+            else
             {
-                CONDUIT_ERROR("YAML Generator error:\n"
-                              << "Duplicate YAML object name: "
-                              << utils::join_path(node->path(),entry_name));
+                truncated = true;
             }
-
-            Schema *curr_schema = &schema->add_child(entry_name);
-
-            Node *curr_node = new Node();
-            curr_node->set_schema_ptr(curr_schema);
-            curr_node->set_parent(node);
-            node->append_node_ptr(curr_node);
-        
-            walk_pure_yaml_schema(curr_node,
-                                  curr_schema,
-                                  yaml_doc,
-                                  yaml_child);
-            cld_idx++;
+            num_digits++;
+            ptr++;
         }
     }
-    // List case
-    else if( yaml_node->type == YAML_SEQUENCE_NODE )
-    {
-        index_t seq_size  = -1;
-        index_t hval_type = check_homogenous_yaml_numeric_sequence(*node,
-                                                                   yaml_doc,
-                                                                   yaml_node,
-                                                                   seq_size);
 
-        if(hval_type == DataType::INT64_ID)
+    if(num_digits > 0 && ptr < end && (*ptr == 'e' || *ptr == 'E'))
+    {
+        is_float = true;
+        ptr++;
+        bool exp_negative = false;
+        if(ptr < end && (*ptr == '+' || *ptr == '-'))
         {
+            exp_negative = (*ptr == '-');
+            ptr++;
+        }
 
-            node->set(DataType::int64(seq_size));
-            parse_yaml_int64_array(yaml_doc, yaml_node, *node);
+        int exp_value = 0;
+        int exp_digits = 0;
+        while(ptr < end && *ptr >= '0' && *ptr <= '9')
+        {
+            if(exp_value < 100000)
+            {
+                exp_value = exp_value * 10 + (*ptr - '0');
+            }
+            exp_digits++;
+            ptr++;
+        }
 
+        if(exp_digits == 0)
+        {
+            // not a number, make sure we skip the fast path
+            num_digits = 0;
         }
-        else if(hval_type == DataType::FLOAT64_ID)
+        exp10 += exp_negative ? -exp_value : exp_value;
+    }
+
+    if(ptr == end && num_digits > 0)
+    {
+        if(!is_float)
         {
-            node->set(DataType::float64(seq_size));
-            parse_yaml_float64_array(yaml_doc, yaml_node, *node);
+            // anything that may not fit in an int64 uses strtol below
+            if(num_int <= 18)
+            {
+                int64_value = negative ? -(int64)mantissa : (int64)mantissa;
+                return DataType::INT64_ID;
+            }
         }
         else
         {
-            // general case (not a numeric array)
-            index_t cld_idx = 0;
-            while( yaml_node->data.sequence.items.start + cld_idx < yaml_node->data.sequence.items.top )
+            // values that are exact as doubles, scaled by an exact 
+            // power of ten, give correctly rounded results
+            if(!truncated &&
+               mantissa <= ((uint64)1 << 53) &&
+               exp10 >= -22 && exp10 <= 22)
             {
-                yaml_node_t *yaml_child = yaml_document_get_node(yaml_doc,
-                                                        yaml_node->data.sequence.items.start[cld_idx]);
-            
-                if(yaml_child == NULL )
+                float64_value = (float64)mantissa;
+                if(exp10 < 0)
                 {
-                    CONDUIT_ERROR("YAML Generator error:\n"
-                                  << "Invalid sequence child at path: "
-                                  << node->path() << "[" << cld_idx << "]");
+                    float64_value /= yaml_exact_pow10[-exp10];
                 }
-
-                schema->append();
-                Schema *curr_schema = schema->child_ptr(cld_idx);
-                Node * curr_node = new Node();
-                curr_node->set_schema_ptr(curr_schema);
-                curr_node->set_parent(node);
-                node->append_node_ptr(curr_node);
-                walk_pure_yaml_schema(curr_node,
-                                      curr_schema,
-                                      yaml_doc,
-                                      yaml_child);
-                cld_idx++;
+                else
+                {
+                    float64_value *= yaml_exact_pow10[exp10];
+                }
+                if(negative)
+                {
+                    float64_value = -float64_value;
+                }
+                return DataType::FLOAT64_ID;
             }
+
+            char *val_end = NULL;
+            float64_value = (float64)strtod(txt_value,&val_end);
+            return DataType::FLOAT64_ID;
         }
     }
-    else if(yaml_node->type == YAML_SCALAR_NODE)// bytestr case
+
+    // everything else (leading whitespace, large integers, hex, inf, nan ...)
+    // follows strtol / strtod 
+    char *val_end = NULL;
+    long int long_value = strtol(txt_value,&val_end,10);
+    if(*val_end == 0)
+    {
+        int64_value = (int64)long_value;
+        return DataType::INT64_ID;
+    }
+
+    val_end = NULL;
+    double double_value = strtod(txt_value,&val_end);
+    if(*val_end == 0)
+    {
+        float64_value = (float64)double_value;
+        return DataType::FLOAT64_ID;
+    }
+
+    return DataType::EMPTY_ID;
+}
+
+//---------------------------------------------------------------------------//
+void
+Generator::Parser::YAML::parse_pure_yaml(Input &input,
+                                         Node &node)
+{
+    try
     {
-        const char *yaml_value_str = (const char*)yaml_node->data.scalar.value;
+        YAMLParserWrapper parser;
+        parser.set_input(input);
 
-        if( yaml_value_str == NULL )
+        PureYAMLHandler handler(node);
+        while(!handler.done())
         {
-            CONDUIT_ERROR("YAML Generator error:\n"
-                          << "Invalid yaml scalar value at path: "
-                          << node->path());
+            handler.process(parser.next_event());
         }
 
-        parse_yaml_inline_leaf(yaml_value_str,*node);
+        if(!handler.found_document())
+        {
+            CONDUIT_ERROR("failed to fetch yaml document root");
+        }
+        // YAMLParserWrapper cleans up for us
     }
-    else // this will include unknown enum vals and YAML_NO_NODE
+    catch(conduit::Error &)
     {
-        // not sure if can an even land here, but catch error just in case.
-        CONDUIT_ERROR("YAML Generator error:\n"
-                      << "Invalid YAML type for parsing Node from pure YAML."
-                      << " Expected: YAML Map, Sequence, String, Null,"
-                      << " Boolean, or Number");
+        // don't leave a partial tree behind
+        node.reset();
+        throw;
     }
 }
 
@@ -2184,6 +3460,26 @@ Generator::walk(Schema &schema) const
     Parser::JSON::walk_json_schema(&schema,document,curr_offset);
 }
 
+//---------------------------------------------------------------------------//
+void 
+Generator::compact_result(Node &n_src, Node &n_dest) const
+{
+    // conduit_base64_json is decoded into a compact buffer (unless the 
+    // schema has strides or offsets), avoid another copy
+    if(m_protocol == "conduit_base64_json" &&
+       n_src.allocator() == n_dest.allocator() &&
+       n_src.is_compact() && 
+       n_src.is_contiguous())
+    {
+        n_dest.reset();
+        n_dest.swap(n_src);
+    }
+    else
+    {
+        n_src.compact_to(n_dest);
+    }
+}
+
 //---------------------------------------------------------------------------//
 void 
 Generator::walk(Node &node) const
@@ -2191,7 +3487,7 @@ Generator::walk(Node &node) const
     /// TODO: This is an inefficient code path, need better solution?
     Node n;
     walk_external(n);
-    n.compact_to(node);
+    compact_result(n,node);
 }
 
 //---------------------------------------------------------------------------//
@@ -2202,37 +3498,19 @@ Generator::walk_external(Node &node) const
     // if data is null, we can parse the schema via the other 'walk' method
     if(m_protocol == "json")
     {
-        rapidjson::Document document;
-        std::string res = utils::json_sanitize(m_schema);
-                
-        if(document.Parse<Parser::JSON::RAPIDJSON_PARSE_OPTS>(res.c_str()).HasParseError())
-        {
-            CONDUIT_JSON_PARSE_ERROR(res, document);
-        }
-
-        Parser::JSON::walk_pure_json_schema(&node,
-                                            node.schema_ptr(),
-                                            document);
+        Parser::MemoryInput input(m_schema);
+        Parser::JSON::parse_pure_json(input,node);
     }
     else if(m_protocol == "yaml")
     {
         // errors will flow up from this call 
-        Parser::YAML::walk_pure_yaml_schema(&node,
-                                            node.schema_ptr(),
-                                            m_schema.c_str());
+        Parser::MemoryInput input(m_schema);
+        Parser::YAML::parse_pure_yaml(input,node);
     }
     else if( m_protocol == "conduit_base64_json")
     {
-        rapidjson::Document document;
-        std::string res = utils::json_sanitize(m_schema);
-        
-        if(document.Parse<Parser::JSON::RAPIDJSON_PARSE_OPTS>(res.c_str()).HasParseError())
-        {
-            CONDUIT_JSON_PARSE_ERROR(res, document);
-        }
-
-        Parser::JSON::parse_base64(&node,
-                                   document);
+        Parser::MemoryInput input(m_schema);
+        Parser::JSON::parse_base64(input,node);
     }
     else if( m_protocol == "conduit_json")
     {
@@ -2257,6 +3535,132 @@ Generator::walk_external(Node &node) const
     }
 }
 
+//---------------------------------------------------------------------------//
+bool
+Generator::streams_owned_data() const
+{
+    // these parsers build nodes that own compact leaves
+    return m_protocol == "json" ||
+           m_protocol == "yaml" ||
+           m_protocol == "conduit_base64_json";
+}
+
+//---------------------------------------------------------------------------//
+void 
+Generator::compact_in_place(Node &node) const
+{
+    // only conduit_base64_json schemas with strides or offsets
+    // produce leaves that aren't compact
+    if(!node.is_compact())
+    {
+        Node n;
+        n.swap(node);
+        n.compact_to(node);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void 
+Generator::walk(std::istream &is, Node &node) const
+{
+    if(streams_owned_data())
+    {
+        // build straight into node, avoiding a second copy of the data
+        walk_external(is,node);
+        compact_in_place(node);
+        return;
+    }
+
+    Node n;
+    walk_external(is,n);
+    compact_result(n,node);
+}
+
+//---------------------------------------------------------------------------//
+void 
+Generator::walk(int fd, Node &node) const
+{
+    if(streams_owned_data())
+    {
+        // build straight into node, avoiding a second copy of the data
+        walk_external(fd,node);
+        compact_in_place(node);
+        return;
+    }
+
+    Node n;
+    walk_external(fd,n);
+    compact_result(n,node);
+}
+
+//---------------------------------------------------------------------------//
+void 
+Generator::walk_external(std::istream &is, Node &node) const
+{
+    if(m_protocol == "json")
+    {
+        node.reset();
+        Parser::IStreamInput input(is);
+        Parser::JSON::parse_pure_json(input,node);
+    }
+    else if(m_protocol == "yaml")
+    {
+        node.reset();
+        Parser::IStreamInput input(is);
+        Parser::YAML::parse_pure_yaml(input,node);
+    }
+    else if(m_protocol == "conduit_base64_json")
+    {
+        node.reset();
+        Parser::IStreamInput input(is);
+        Parser::JSON::parse_base64(input,node);
+    }
+    else
+    {
+        std::string text((std::istreambuf_iterator<char>(is)),
+                          std::istreambuf_iterator<char>());
+        Generator g(text,m_protocol,m_data);
+        g.walk_external(node);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void 
+Generator::walk_external(int fd, Node &node) const
+{
+    if(m_protocol == "json")
+    {
+        node.reset();
+        Parser::FileDescriptorInput input(fd);
+        Parser::JSON::parse_pure_json(input,node);
+    }
+    else if(m_protocol == "yaml")
+    {
+        node.reset();
+        Parser::FileDescriptorInput input(fd);
+        Parser::YAML::parse_pure_yaml(input,node);
+    }
+    else if(m_protocol == "conduit_base64_json")
+    {
+        node.reset();
+        Parser::FileDescriptorInput input(fd);
+        Parser::JSON::parse_base64(input,node);
+    }
+    else
+    {
+        std::string text;
+        Parser::FileDescriptorInput input(fd);
+        const char *chunk = NULL;
+        index_t chunk_size = 0;
+        while(input.next_chunk(chunk,chunk_size))
+        {
+            text.append(chunk,(size_t)chunk_size);
+        }
+        Generator g(text,m_protocol,m_data);
+        g.walk_external(node);
+    }
+}
+
 
 //-----------------------------------------------------------------------------
 // -- end conduit::Generator --
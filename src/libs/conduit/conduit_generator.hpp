@@ -127,11 +127,35 @@ public:
     void walk(Node &ndest) const;
     void walk_external(Node &ndest) const;
 
+    /// parse text read from a stream or file descriptor to a Node object, 
+    /// instead of the schema text held by the generator.
+    ///
+    /// the "json", "yaml" and "conduit_base64_json" protocols are parsed 
+    /// incrementally as text is read, other protocols read all of the text
+    /// before parsing.
+    ///
+    /// for the incremental protocols walk builds straight into ndest: the
+    /// result is compact and owns its data, but unlike walk(Node&) each 
+    /// leaf may have its own allocation (it isn't compacted into one 
+    /// contiguous buffer).
+    void walk(std::istream &is, Node &ndest) const;
+    void walk(int fd, Node &ndest) const;
+    void walk_external(std::istream &is, Node &ndest) const;
+    void walk_external(int fd, Node &ndest) const;
+
     // private class used to encapsulate RapidJSON logic. 
     class Parser;
 
 
 private:
+    /// moves or compacts the result of walk_external into ndest
+    void compact_result(Node &nsrc, Node &ndest) const;
+    /// true if the streaming parser for the protocol builds nodes that 
+    /// own their data (so walk can parse straight into its destination)
+    bool streams_owned_data() const;
+    /// compacts node if its layout isn't compact
+    void compact_in_place(Node &node) const;
+
 //-----------------------------------------------------------------------------
 //
 // -- conduit::Generator private data members --
@@ -0,0 +1,1324 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2019, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_kernels.cpp
+///
+//-----------------------------------------------------------------------------
+#include "conduit_kernels.hpp"
+
+//-----------------------------------------------------------------------------
+// -- standard lib includes -- 
+//-----------------------------------------------------------------------------
+#include <string.h>
+
+#if defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+#if defined(__SSE4_2__)
+#include <nmmintrin.h>
+#endif
+
+#if defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#endif
+
+//-----------------------------------------------------------------------------
+// -- conduit includes -- 
+//-----------------------------------------------------------------------------
+#include "conduit_data_type.hpp"
+#include "conduit_endianness.hpp"
+#include "conduit_error.hpp"
+#include "conduit_utils.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::kernels --
+//-----------------------------------------------------------------------------
+namespace kernels
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::kernels::detail --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+// fixed size element copy, memcpy with a constant size compiles to a
+// single (unaligned) load and store
+//-----------------------------------------------------------------------------
+template<typename T>
+inline void
+copy_element(uint8 *dest, const uint8 *src)
+{
+    T val;
+    memcpy(&val,src,sizeof(T));
+    memcpy(dest,&val,sizeof(T));
+}
+
+//-----------------------------------------------------------------------------
+// gathers into a contiguous destination, returns the number of elements
+// copied with SIMD (the caller copies the rest)
+//-----------------------------------------------------------------------------
+template<typename T>
+inline index_t
+simd_gather(uint8 * /*dest*/,
+            const uint8 * /*src*/,
+            index_t /*src_stride*/,
+            index_t /*num_elements*/)
+{
+    return 0;
+}
+
+#if defined(__AVX2__)
+//-----------------------------------------------------------------------------
+// gather indices are 32-bit byte offsets, the caller makes sure
+// 8 * src_stride fits
+//-----------------------------------------------------------------------------
+template<>
+inline index_t
+simd_gather<uint32>(uint8 *dest,
+                    const uint8 *src,
+                    index_t src_stride,
+                    index_t num_elements)
+{
+    int s = (int)src_stride;
+    __m256i vidx = _mm256_setr_epi32(0, s, 2*s, 3*s, 4*s, 5*s, 6*s, 7*s);
+    index_t i = 0;
+    for(; i + 8 <= num_elements; i += 8)
+    {
+        __m256i v = _mm256_i32gather_epi32((const int*)(src + i * src_stride),
+                                           vidx,
+                                           1);
+        _mm256_storeu_si256((__m256i*)(dest + i * 4), v);
+    }
+    return i;
+}
+
+//-----------------------------------------------------------------------------
+template<>
+inline index_t
+simd_gather<uint64>(uint8 *dest,
+                    const uint8 *src,
+                    index_t src_stride,
+                    index_t num_elements)
+{
+    int s = (int)src_stride;
+    __m128i vidx = _mm_setr_epi32(0, s, 2*s, 3*s);
+    index_t i = 0;
+    for(; i + 4 <= num_elements; i += 4)
+    {
+        __m256i v = _mm256_i32gather_epi64(
+                            (const long long*)(src + i * src_stride),
+                            vidx,
+                            1);
+        _mm256_storeu_si256((__m256i*)(dest + i * 8), v);
+    }
+    return i;
+}
+#endif
+
+//-----------------------------------------------------------------------------
+template<typename T>
+void
+strided_copy(uint8 *dest,
+             index_t dest_stride,
+             const uint8 *src,
+             index_t src_stride,
+             index_t num_elements)
+{
+    const index_t ele_bytes = (index_t)sizeof(T);
+    index_t i = 0;
+
+    if(dest_stride == ele_bytes)
+    {
+        // gather
+        if(src_stride > 0 && src_stride < 0x0FFFFFFF / 8)
+        {
+            i = simd_gather<T>(dest,src,src_stride,num_elements);
+        }
+
+        for(; i < num_elements; i++)
+        {
+            copy_element<T>(dest + i * ele_bytes, src + i * src_stride);
+        }
+    }
+    else if(src_stride == ele_bytes)
+    {
+        // scatter
+        for(; i < num_elements; i++)
+        {
+            copy_element<T>(dest + i * dest_stride, src + i * ele_bytes);
+        }
+    }
+    else
+    {
+        for(; i < num_elements; i++)
+        {
+            copy_element<T>(dest + i * dest_stride, src + i * src_stride);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// byte swap helpers
+//-----------------------------------------------------------------------------
+inline uint16
+bswap(uint16 v)
+{
+    return (uint16)((v >> 8) | (v << 8));
+}
+
+//-----------------------------------------------------------------------------
+inline uint32
+bswap(uint32 v)
+{
+#if defined(__GNUC__)
+    return __builtin_bswap32(v);
+#else
+    return ((v & 0x000000FFu) << 24) |
+           ((v & 0x0000FF00u) <<  8) |
+           ((v & 0x00FF0000u) >>  8) |
+           ((v & 0xFF000000u) >> 24);
+#endif
+}
+
+//-----------------------------------------------------------------------------
+inline uint64
+bswap(uint64 v)
+{
+#if defined(__GNUC__)
+    return __builtin_bswap64(v);
+#else
+    return ((uint64)bswap((uint32)(v & 0xFFFFFFFFu)) << 32) |
+            (uint64)bswap((uint32)(v >> 32));
+#endif
+}
+
+//-----------------------------------------------------------------------------
+// swaps contiguous elements, returns the number of elements swapped with
+// SIMD (the caller swaps the rest)
+//-----------------------------------------------------------------------------
+template<typename T>
+inline index_t
+simd_byte_swap(uint8 *dest,
+               const uint8 *src,
+               index_t num_elements)
+{
+    index_t i = 0;
+#if defined(__AVX2__) || defined(__SSSE3__)
+    // byte shuffle masks that reverse each element
+    char m[16];
+    for(int b = 0; b < 16; b++)
+    {
+        int e = (int)sizeof(T);
+        m[b] = (char)((b / e) * e + (e - 1 - b % e));
+    }
+    __m128i mask = _mm_loadu_si128((const __m128i*)m);
+    const index_t lanes = 16 / (index_t)sizeof(T);
+#if defined(__AVX2__)
+    __m256i mask_256 = _mm256_broadcastsi128_si256(mask);
+    for(; i + 2 * lanes <= num_elements; i += 2 * lanes)
+    {
+        index_t off = i * (index_t)sizeof(T);
+        __m256i v = _mm256_loadu_si256((const __m256i*)(src + off));
+        _mm256_storeu_si256((__m256i*)(dest + off),
+                            _mm256_shuffle_epi8(v, mask_256));
+    }
+#endif
+    for(; i + lanes <= num_elements; i += lanes)
+    {
+        index_t off = i * (index_t)sizeof(T);
+        __m128i v = _mm_loadu_si128((const __m128i*)(src + off));
+        _mm_storeu_si128((__m128i*)(dest + off), _mm_shuffle_epi8(v, mask));
+    }
+#else
+    (void)dest;
+    (void)src;
+    (void)num_elements;
+#endif
+    return i;
+}
+
+//-----------------------------------------------------------------------------
+template<typename T>
+void
+byte_swap_copy(uint8 *dest,
+               index_t dest_stride,
+               const uint8 *src,
+               index_t src_stride,
+               index_t num_elements)
+{
+    const index_t ele_bytes = (index_t)sizeof(T);
+    index_t i = 0;
+
+    if(dest_stride == ele_bytes && src_stride == ele_bytes)
+    {
+        i = simd_byte_swap<T>(dest, src, num_elements);
+    }
+
+    for(; i < num_elements; i++)
+    {
+        T val;
+        memcpy(&val, src + i * src_stride, sizeof(T));
+        val = bswap(val);
+        memcpy(dest + i * dest_stride, &val, sizeof(T));
+    }
+}
+
+//-----------------------------------------------------------------------------
+// converts contiguous values, returns the number of elements converted
+// with explicit SIMD (the caller converts the rest)
+//-----------------------------------------------------------------------------
+template<typename D, typename S>
+inline index_t
+simd_convert(D * /*dest*/,
+             const S * /*src*/,
+             index_t /*num_elements*/)
+{
+    return 0;
+}
+
+#if defined(__SSE2__)
+//-----------------------------------------------------------------------------
+template<>
+inline index_t
+simd_convert<float64,float32>(float64 *dest,
+                              const float32 *src,
+                              index_t num_elements)
+{
+    index_t i = 0;
+#if defined(__AVX__)
+    for(; i + 4 <= num_elements; i += 4)
+    {
+        _mm256_storeu_pd(dest + i, _mm256_cvtps_pd(_mm_loadu_ps(src + i)));
+    }
+#endif
+    for(; i + 2 <= num_elements; i += 2)
+    {
+        __m128 v = _mm_castpd_ps(_mm_load_sd((const double*)(src + i)));
+        _mm_storeu_pd(dest + i, _mm_cvtps_pd(v));
+    }
+    return i;
+}
+
+//-----------------------------------------------------------------------------
+template<>
+inline index_t
+simd_convert<float32,float64>(float32 *dest,
+                              const float64 *src,
+                              index_t num_elements)
+{
+    index_t i = 0;
+#if defined(__AVX__)
+    for(; i + 4 <= num_elements; i += 4)
+    {
+        _mm_storeu_ps(dest + i, _mm256_cvtpd_ps(_mm256_loadu_pd(src + i)));
+    }
+#endif
+    for(; i + 2 <= num_elements; i += 2)
+    {
+        __m128 v = _mm_cvtpd_ps(_mm_loadu_pd(src + i));
+        _mm_store_sd((double*)(dest + i), _mm_castps_pd(v));
+    }
+    return i;
+}
+#endif
+
+#if defined(__AVX2__)
+//-----------------------------------------------------------------------------
+template<>
+inline index_t
+simd_convert<int64,int32>(int64 *dest,
+                          const int32 *src,
+                          index_t num_elements)
+{
+    index_t i = 0;
+    for(; i + 4 <= num_elements; i += 4)
+    {
+        __m128i v = _mm_loadu_si128((const __m128i*)(src + i));
+        _mm256_storeu_si256((__m256i*)(dest + i), _mm256_cvtepi32_epi64(v));
+    }
+    return i;
+}
+
+//-----------------------------------------------------------------------------
+template<>
+inline index_t
+simd_convert<int32,int64>(int32 *dest,
+                          const int64 *src,
+                          index_t num_elements)
+{
+    // keep the low 32 bits of each value (same as a c style cast)
+    const __m256i lo = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+    index_t i = 0;
+    for(; i + 4 <= num_elements; i += 4)
+    {
+        __m256i v = _mm256_loadu_si256((const __m256i*)(src + i));
+        v = _mm256_permutevar8x32_epi32(v, lo);
+        _mm_storeu_si128((__m128i*)(dest + i), _mm256_castsi256_si128(v));
+    }
+    return i;
+}
+#elif defined(__SSE4_1__)
+//-----------------------------------------------------------------------------
+template<>
+inline index_t
+simd_convert<int64,int32>(int64 *dest,
+                          const int32 *src,
+                          index_t num_elements)
+{
+    index_t i = 0;
+    for(; i + 2 <= num_elements; i += 2)
+    {
+        __m128i v = _mm_loadl_epi64((const __m128i*)(src + i));
+        _mm_storeu_si128((__m128i*)(dest + i), _mm_cvtepi32_epi64(v));
+    }
+    return i;
+}
+#endif
+
+//-----------------------------------------------------------------------------
+template<typename D, typename S>
+void
+convert(uint8 *dest,
+        index_t dest_stride,
+        const uint8 *src,
+        index_t src_stride,
+        index_t num_elements)
+{
+    if(dest_stride == (index_t)sizeof(D) && src_stride == (index_t)sizeof(S))
+    {
+        // contiguous, simple loop the compiler can vectorize
+        D *d_ptr = (D*)dest;
+        const S *s_ptr = (const S*)src;
+        index_t i = simd_convert<D,S>(d_ptr,s_ptr,num_elements);
+        for(; i < num_elements; i++)
+        {
+            d_ptr[i] = (D)s_ptr[i];
+        }
+    }
+    else
+    {
+        for(index_t i = 0; i < num_elements; i++)
+        {
+            *((D*)(dest + i * dest_stride)) = 
+                (D)*((const S*)(src + i * src_stride));
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+template<typename D>
+void
+convert_to(uint8 *dest,
+           index_t dest_stride,
+           const uint8 *src,
+           index_t src_dtype_id,
+           index_t src_stride,
+           index_t num_elements)
+{
+    switch(src_dtype_id)
+    {
+        /* ints */
+        case DataType::INT8_ID:
+        {
+            convert<D,int8>(dest,dest_stride,src,src_stride,num_elements);
+            break;
+        }
+        case DataType::INT16_ID:
+        {
+            convert<D,int16>(dest,dest_stride,src,src_stride,num_elements);
+            break;
+        }
+        case DataType::INT32_ID:
+        {
+            convert<D,int32>(dest,dest_stride,src,src_stride,num_elements);
+            break;
+        }
+        case DataType::INT64_ID:
+        {
+            convert<D,int64>(dest,dest_stride,src,src_stride,num_elements);
+            break;
+        }
+        /* uints */
+        case DataType::UINT8_ID:
+        {
+            convert<D,uint8>(dest,dest_stride,src,src_stride,num_elements);
+            break;
+        }
+        case DataType::UINT16_ID:
+        {
+            convert<D,uint16>(dest,dest_stride,src,src_stride,num_elements);
+            break;
+        }
+        case DataType::UINT32_ID:
+        {
+            convert<D,uint32>(dest,dest_stride,src,src_stride,num_elements);
+            break;
+        }
+        case DataType::UINT64_ID:
+        {
+            convert<D,uint64>(dest,dest_stride,src,src_stride,num_elements);
+            break;
+        }
+        /* floats */
+        case DataType::FLOAT32_ID:
+        {
+            convert<D,float32>(dest,dest_stride,src,src_stride,num_elements);
+            break;
+        }
+        case DataType::FLOAT64_ID:
+        {
+            convert<D,float64>(dest,dest_stride,src,src_stride,num_elements);
+            break;
+        }
+        default:
+        {
+            CONDUIT_ERROR("kernels::convert does not support source type: "
+                          << DataType::id_to_name(src_dtype_id));
+        }
+    }
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::kernels::detail --
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+void
+strided_copy(void *dest,
+             index_t dest_stride,
+             const void *src,
+             index_t src_stride,
+             index_t num_elements,
+             index_t element_bytes)
+{
+    if(num_elements <= 0 || element_bytes <= 0)
+    {
+        return;
+    }
+
+    uint8 *dest_ptr = (uint8*)dest;
+    const uint8 *src_ptr = (const uint8*)src;
+
+    // fully contiguous
+    if(dest_stride == element_bytes && src_stride == element_bytes)
+    {
+        memcpy(dest_ptr, src_ptr, (size_t)(num_elements * element_bytes));
+        return;
+    }
+
+    switch(element_bytes)
+    {
+        case 1:
+            detail::strided_copy<uint8>(dest_ptr, dest_stride,
+                                        src_ptr, src_stride,
+                                        num_elements);
+            break;
+        case 2:
+            detail::strided_copy<uint16>(dest_ptr, dest_stride,
+                                         src_ptr, src_stride,
+                                         num_elements);
+            break;
+        case 4:
+            detail::strided_copy<uint32>(dest_ptr, dest_stride,
+                                         src_ptr, src_stride,
+                                         num_elements);
+            break;
+        case 8:
+            detail::strided_copy<uint64>(dest_ptr, dest_stride,
+                                         src_ptr, src_stride,
+                                         num_elements);
+            break;
+        default:
+        {
+            for(index_t i=0; i < num_elements; i++)
+            {
+                memcpy(dest_ptr + i * dest_stride,
+                       src_ptr  + i * src_stride,
+                       (size_t)element_bytes);
+            }
+        }
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+gather(void *dest,
+       const void *src,
+       index_t src_stride,
+       index_t num_elements,
+       index_t element_bytes)
+{
+    strided_copy(dest, element_bytes,
+                 src, src_stride,
+                 num_elements, element_bytes);
+}
+
+//---------------------------------------------------------------------------//
+void
+scatter(void *dest,
+        index_t dest_stride,
+        const void *src,
+        index_t num_elements,
+        index_t element_bytes)
+{
+    strided_copy(dest, dest_stride,
+                 src, element_bytes,
+                 num_elements, element_bytes);
+}
+
+//---------------------------------------------------------------------------//
+void
+byte_swap(void *data,
+          index_t stride,
+          index_t num_elements,
+          index_t element_bytes)
+{
+    byte_swap_copy(data, stride,
+                   data, stride,
+                   num_elements, element_bytes);
+}
+
+//---------------------------------------------------------------------------//
+void
+byte_swap_copy(void *dest,
+               index_t dest_stride,
+               const void *src,
+               index_t src_stride,
+               index_t num_elements,
+               index_t element_bytes)
+{
+    if(num_elements <= 0)
+    {
+        return;
+    }
+
+    uint8 *dest_ptr = (uint8*)dest;
+    const uint8 *src_ptr = (const uint8*)src;
+
+    switch(element_bytes)
+    {
+        case 2:
+            detail::byte_swap_copy<uint16>(dest_ptr, dest_stride,
+                                           src_ptr, src_stride,
+                                           num_elements);
+            break;
+        case 4:
+            detail::byte_swap_copy<uint32>(dest_ptr, dest_stride,
+                                           src_ptr, src_stride,
+                                           num_elements);
+            break;
+        case 8:
+            detail::byte_swap_copy<uint64>(dest_ptr, dest_stride,
+                                           src_ptr, src_stride,
+                                           num_elements);
+            break;
+        default:
+            // nothing to swap, just copy
+            if(dest_ptr != src_ptr)
+            {
+                strided_copy(dest_ptr, dest_stride,
+                             src_ptr, src_stride,
+                             num_elements, element_bytes);
+            }
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+convert(void *dest,
+        index_t dest_dtype_id,
+        index_t dest_stride,
+        const void *src,
+        index_t src_dtype_id,
+        index_t src_stride,
+        index_t num_elements)
+{
+    if(num_elements <= 0)
+    {
+        return;
+    }
+
+    uint8 *dest_ptr = (uint8*)dest;
+    const uint8 *src_ptr = (const uint8*)src;
+
+    // same type, plain copy
+    if(dest_dtype_id == src_dtype_id)
+    {
+        DataType dt(dest_dtype_id,1);
+        if(dt.is_number())
+        {
+            strided_copy(dest_ptr, dest_stride,
+                         src_ptr, src_stride,
+                         num_elements,
+                         DataType::default_bytes(dest_dtype_id));
+            return;
+        }
+    }
+
+    switch(dest_dtype_id)
+    {
+        /* ints */
+        case DataType::INT8_ID:
+        {
+            detail::convert_to<int8>(dest_ptr, dest_stride,
+                                     src_ptr, src_dtype_id, src_stride,
+                                     num_elements);
+            break;
+        }
+        case DataType::INT16_ID:
+        {
+            detail::convert_to<int16>(dest_ptr, dest_stride,
+                                      src_ptr, src_dtype_id, src_stride,
+                                      num_elements);
+            break;
+        }
+        case DataType::INT32_ID:
+        {
+            detail::convert_to<int32>(dest_ptr, dest_stride,
+                                      src_ptr, src_dtype_id, src_stride,
+                                      num_elements);
+            break;
+        }
+        case DataType::INT64_ID:
+        {
+            detail::convert_to<int64>(dest_ptr, dest_stride,
+                                      src_ptr, src_dtype_id, src_stride,
+                                      num_elements);
+            break;
+        }
+        /* uints */
+        case DataType::UINT8_ID:
+        {
+            detail::convert_to<uint8>(dest_ptr, dest_stride,
+                                      src_ptr, src_dtype_id, src_stride,
+                                      num_elements);
+            break;
+        }
+        case DataType::UINT16_ID:
+        {
+            detail::convert_to<uint16>(dest_ptr, dest_stride,
+                                       src_ptr, src_dtype_id, src_stride,
+                                       num_elements);
+            break;
+        }
+        case DataType::UINT32_ID:
+        {
+            detail::convert_to<uint32>(dest_ptr, dest_stride,
+                                       src_ptr, src_dtype_id, src_stride,
+                                       num_elements);
+            break;
+        }
+        case DataType::UINT64_ID:
+        {
+            detail::convert_to<uint64>(dest_ptr, dest_stride,
+                                       src_ptr, src_dtype_id, src_stride,
+                                       num_elements);
+            break;
+        }
+        /* floats */
+        case DataType::FLOAT32_ID:
+        {
+            detail::convert_to<float32>(dest_ptr, dest_stride,
+                                        src_ptr, src_dtype_id, src_stride,
+                                        num_elements);
+            break;
+        }
+        case DataType::FLOAT64_ID:
+        {
+            detail::convert_to<float64>(dest_ptr, dest_stride,
+                                        src_ptr, src_dtype_id, src_stride,
+                                        num_elements);
+            break;
+        }
+        default:
+        {
+            CONDUIT_ERROR("kernels::convert does not support destination "
+                          "type: " << DataType::id_to_name(dest_dtype_id));
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::kernels::detail (hashing) --
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+// strided data is gathered into blocks of this size before hashing
+static const index_t HASH_BLOCK_BYTES = 4096;
+
+#if !defined(__SSE4_2__) && !defined(__ARM_FEATURE_CRC32)
+//-----------------------------------------------------------------------------
+// crc32c lookup tables for slicing by 8, table k advances a byte that is
+// k bytes further from the end of the block
+//-----------------------------------------------------------------------------
+class CRC32CTables
+{
+public:
+    CRC32CTables()
+    {
+        for(uint32 i = 0; i < 256; i++)
+        {
+            uint32 c = i;
+            for(int b = 0; b < 8; b++)
+            {
+                c = (c & 1) ? (c >> 1) ^ 0x82F63B78u : (c >> 1);
+            }
+            table[0][i] = c;
+        }
+
+        for(uint32 i = 0; i < 256; i++)
+        {
+            for(int k = 1; k < 8; k++)
+            {
+                uint32 prev = table[k-1][i];
+                table[k][i] = (prev >> 8) ^ table[0][prev & 0xFF];
+            }
+        }
+    }
+
+    uint32 table[8][256];
+};
+
+// built at load time, so concurrent use needs no locking
+static const CRC32CTables crc32c_tables;
+#endif
+
+//-----------------------------------------------------------------------------
+// advances the (non-inverted) crc state over a buffer 
+//-----------------------------------------------------------------------------
+inline uint32
+crc32c_update(uint32 c,
+              const uint8 *p,
+              index_t num_bytes)
+{
+#if defined(__SSE4_2__) || defined(__ARM_FEATURE_CRC32)
+    // bytes until p is 8 byte aligned
+    while(num_bytes > 0 && ((size_t)p & 7) != 0)
+    {
+#if defined(__SSE4_2__)
+        c = _mm_crc32_u8(c,*p);
+#else
+        c = __crc32cb(c,*p);
+#endif
+        p++;
+        num_bytes--;
+    }
+
+#if defined(__SSE4_2__) && (defined(__x86_64__) || defined(_M_X64))
+    uint64 c64 = c;
+    for(; num_bytes >= 8; num_bytes -= 8, p += 8)
+    {
+        c64 = _mm_crc32_u64(c64,*(const uint64*)p);
+    }
+    c = (uint32)c64;
+#elif defined(__SSE4_2__)
+    for(; num_bytes >= 4; num_bytes -= 4, p += 4)
+    {
+        c = _mm_crc32_u32(c,*(const uint32*)p);
+    }
+#else
+    for(; num_bytes >= 8; num_bytes -= 8, p += 8)
+    {
+        c = __crc32cd(c,*(const uint64*)p);
+    }
+#endif
+
+    for(; num_bytes > 0; num_bytes--, p++)
+    {
+#if defined(__SSE4_2__)
+        c = _mm_crc32_u8(c,*p);
+#else
+        c = __crc32cb(c,*p);
+#endif
+    }
+#else
+    const uint32 (*t)[256] = crc32c_tables.table;
+    for(; num_bytes >= 8; num_bytes -= 8, p += 8)
+    {
+        uint32 one = c ^ ( (uint32)p[0]        | ((uint32)p[1] << 8) |
+                          ((uint32)p[2] << 16) | ((uint32)p[3] << 24));
+        uint32 two =     ( (uint32)p[4]        | ((uint32)p[5] << 8) |
+                          ((uint32)p[6] << 16) | ((uint32)p[7] << 24));
+        c = t[7][ one        & 0xFF] ^ t[6][(one >>  8) & 0xFF] ^
+            t[5][(one >> 16) & 0xFF] ^ t[4][ one >> 24        ] ^
+            t[3][ two        & 0xFF] ^ t[2][(two >>  8) & 0xFF] ^
+            t[1][(two >> 16) & 0xFF] ^ t[0][ two >> 24        ];
+    }
+
+    for(; num_bytes > 0; num_bytes--, p++)
+    {
+        c = (c >> 8) ^ t[0][(c ^ *p) & 0xFF];
+    }
+#endif
+    return c;
+}
+
+//-----------------------------------------------------------------------------
+// gf(2) matrix helpers for crc32c_combine (see zlib's crc32_combine)
+//-----------------------------------------------------------------------------
+inline uint32
+gf2_matrix_times(const uint32 *mat,
+                 uint32 vec)
+{
+    uint32 sum = 0;
+    while(vec)
+    {
+        if(vec & 1)
+        {
+            sum ^= *mat;
+        }
+        vec >>= 1;
+        mat++;
+    }
+    return sum;
+}
+
+//-----------------------------------------------------------------------------
+inline void
+gf2_matrix_square(uint32 *square,
+                  const uint32 *mat)
+{
+    for(int n = 0; n < 32; n++)
+    {
+        square[n] = gf2_matrix_times(mat, mat[n]);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// xxhash64 primes and helpers
+//-----------------------------------------------------------------------------
+static const uint64 XXH_P1 = 0x9E3779B185EBCA87ULL;
+static const uint64 XXH_P2 = 0xC2B2AE3D27D4EB4FULL;
+static const uint64 XXH_P3 = 0x165667B19E3779F9ULL;
+static const uint64 XXH_P4 = 0x85EBCA77C2B2AE63ULL;
+static const uint64 XXH_P5 = 0x27D4EB2F165667C5ULL;
+
+static const bool xxh_big_endian = Endianness::machine_is_big_endian();
+
+//-----------------------------------------------------------------------------
+inline uint64
+xxh_rotl(uint64 v, int r)
+{
+    return (v << r) | (v >> (64 - r));
+}
+
+//-----------------------------------------------------------------------------
+// xxhash reads its input as little endian words
+//-----------------------------------------------------------------------------
+inline uint64
+xxh_read64(const uint8 *p)
+{
+    uint64 v;
+    memcpy(&v,p,8);
+    return xxh_big_endian ? bswap(v) : v;
+}
+
+//-----------------------------------------------------------------------------
+inline uint32
+xxh_read32(const uint8 *p)
+{
+    uint32 v;
+    memcpy(&v,p,4);
+    return xxh_big_endian ? bswap(v) : v;
+}
+
+//-----------------------------------------------------------------------------
+inline uint64
+xxh_round(uint64 acc, uint64 input)
+{
+    acc += input * XXH_P2;
+    acc  = xxh_rotl(acc,31);
+    return acc * XXH_P1;
+}
+
+//-----------------------------------------------------------------------------
+inline uint64
+xxh_merge_round(uint64 acc, uint64 val)
+{
+    acc ^= xxh_round(0,val);
+    return acc * XXH_P1 + XXH_P4;
+}
+
+//-----------------------------------------------------------------------------
+// processes whole 32 byte stripes, returns the number of bytes consumed
+//-----------------------------------------------------------------------------
+inline index_t
+xxh_stripes(uint64 *acc,
+            const uint8 *p,
+            index_t num_bytes)
+{
+    uint64 v1 = acc[0];
+    uint64 v2 = acc[1];
+    uint64 v3 = acc[2];
+    uint64 v4 = acc[3];
+
+    index_t i = 0;
+    for(; i + 32 <= num_bytes; i += 32)
+    {
+        v1 = xxh_round(v1, xxh_read64(p + i));
+        v2 = xxh_round(v2, xxh_read64(p + i + 8));
+        v3 = xxh_round(v3, xxh_read64(p + i + 16));
+        v4 = xxh_round(v4, xxh_read64(p + i + 24));
+    }
+
+    acc[0] = v1;
+    acc[1] = v2;
+    acc[2] = v3;
+    acc[3] = v4;
+    return i;
+}
+
+//-----------------------------------------------------------------------------
+// calls func(ctx, ptr, num_bytes) with the elements in contiguous blocks
+//-----------------------------------------------------------------------------
+template<typename Func>
+inline void
+for_each_block(const void *data,
+               index_t stride,
+               index_t num_elements,
+               index_t element_bytes,
+               Func &func)
+{
+    const uint8 *src = (const uint8*)data;
+
+    if(stride == element_bytes || num_elements == 1)
+    {
+        func(src, num_elements * element_bytes);
+    }
+    else if(element_bytes > HASH_BLOCK_BYTES / 4)
+    {
+        // large elements are already big enough blocks
+        for(index_t i = 0; i < num_elements; i++)
+        {
+            func(src + i * stride, element_bytes);
+        }
+    }
+    else
+    {
+        uint8 block[HASH_BLOCK_BYTES];
+        index_t block_ele = HASH_BLOCK_BYTES / element_bytes;
+        for(index_t i = 0; i < num_elements; i += block_ele)
+        {
+            index_t n = num_elements - i;
+            if(n > block_ele)
+            {
+                n = block_ele;
+            }
+            gather(block, src + i * stride, stride, n, element_bytes);
+            func(block, n * element_bytes);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+struct CRC32CBlocks
+{
+    uint32 c;
+    void operator()(const uint8 *p, index_t num_bytes)
+        { c = crc32c_update(c, p, num_bytes); }
+};
+
+//-----------------------------------------------------------------------------
+struct Hash64Blocks
+{
+    Hash64 *hash;
+    void operator()(const uint8 *p, index_t num_bytes)
+        { hash->update(p, num_bytes); }
+};
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::kernels::detail (hashing) --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+uint32
+crc32c(const void *data,
+       index_t num_bytes,
+       uint32 crc)
+{
+    return ~detail::crc32c_update(~crc, (const uint8*)data, num_bytes);
+}
+
+//-----------------------------------------------------------------------------
+uint32
+crc32c_strided(const void *data,
+               index_t stride,
+               index_t num_elements,
+               index_t element_bytes,
+               uint32 crc)
+{
+    if(num_elements <= 0 || element_bytes <= 0)
+    {
+        return crc;
+    }
+
+    detail::CRC32CBlocks blocks;
+    blocks.c = ~crc;
+    detail::for_each_block(data, stride, num_elements, element_bytes, blocks);
+    return ~blocks.c;
+}
+
+//-----------------------------------------------------------------------------
+uint32
+crc32c_combine(uint32 crc_1,
+               uint32 crc_2,
+               index_t num_bytes_2)
+{
+    if(num_bytes_2 <= 0)
+    {
+        return crc_1;
+    }
+
+    // operators that append 1, 2, 4, ... zero bits to a crc
+    uint32 even[32];
+    uint32 odd[32];
+
+    odd[0] = 0x82F63B78u;
+    uint32 row = 1;
+    for(int n = 1; n < 32; n++)
+    {
+        odd[n] = row;
+        row <<= 1;
+    }
+
+    // 2 and 4 zero bits
+    detail::gf2_matrix_square(even, odd);
+    detail::gf2_matrix_square(odd, even);
+
+    // append num_bytes_2 zero bytes to crc_1
+    uint64 len = (uint64)num_bytes_2;
+    do
+    {
+        detail::gf2_matrix_square(even, odd);
+        if(len & 1)
+        {
+            crc_1 = detail::gf2_matrix_times(even, crc_1);
+        }
+        len >>= 1;
+
+        if(len == 0)
+        {
+            break;
+        }
+
+        detail::gf2_matrix_square(odd, even);
+        if(len & 1)
+        {
+            crc_1 = detail::gf2_matrix_times(odd, crc_1);
+        }
+        len >>= 1;
+    } while(len != 0);
+
+    return crc_1 ^ crc_2;
+}
+
+//-----------------------------------------------------------------------------
+Hash64::Hash64(uint64 seed)
+{
+    reset(seed);
+}
+
+//-----------------------------------------------------------------------------
+void
+Hash64::reset(uint64 seed)
+{
+    m_seed   = seed;
+    m_acc[0] = seed + detail::XXH_P1 + detail::XXH_P2;
+    m_acc[1] = seed + detail::XXH_P2;
+    m_acc[2] = seed;
+    m_acc[3] = seed - detail::XXH_P1;
+    m_total_bytes  = 0;
+    m_buffer_bytes = 0;
+}
+
+//-----------------------------------------------------------------------------
+void
+Hash64::update(const void *data,
+               index_t num_bytes)
+{
+    if(num_bytes <= 0)
+    {
+        return;
+    }
+
+    const uint8 *p = (const uint8*)data;
+    m_total_bytes += (uint64)num_bytes;
+
+    // fill up a partial stripe first
+    if(m_buffer_bytes > 0)
+    {
+        index_t n = 32 - m_buffer_bytes;
+        if(n > num_bytes)
+        {
+            n = num_bytes;
+        }
+        memcpy(m_buffer + m_buffer_bytes, p, (size_t)n);
+        m_buffer_bytes += n;
+        p += n;
+        num_bytes -= n;
+
+        if(m_buffer_bytes < 32)
+        {
+            return;
+        }
+
+        detail::xxh_stripes(m_acc, m_buffer, 32);
+        m_buffer_bytes = 0;
+    }
+
+    index_t done = detail::xxh_stripes(m_acc, p, num_bytes);
+
+    if(done < num_bytes)
+    {
+        m_buffer_bytes = num_bytes - done;
+        memcpy(m_buffer, p + done, (size_t)m_buffer_bytes);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+Hash64::update_strided(const void *data,
+                       index_t stride,
+                       index_t num_elements,
+                       index_t element_bytes)
+{
+    if(num_elements <= 0 || element_bytes <= 0)
+    {
+        return;
+    }
+
+    detail::Hash64Blocks blocks;
+    blocks.hash = this;
+    detail::for_each_block(data, stride, num_elements, element_bytes, blocks);
+}
+
+//-----------------------------------------------------------------------------
+uint64
+Hash64::digest() const
+{
+    using namespace detail;
+
+    uint64 h;
+    if(m_total_bytes >= 32)
+    {
+        h = xxh_rotl(m_acc[0], 1)  + xxh_rotl(m_acc[1], 7) +
+            xxh_rotl(m_acc[2], 12) + xxh_rotl(m_acc[3], 18);
+        h = xxh_merge_round(h, m_acc[0]);
+        h = xxh_merge_round(h, m_acc[1]);
+        h = xxh_merge_round(h, m_acc[2]);
+        h = xxh_merge_round(h, m_acc[3]);
+    }
+    else
+    {
+        h = m_seed + XXH_P5;
+    }
+
+    h += m_total_bytes;
+
+    // the rest of the bytes (less than a stripe)
+    const uint8 *p = m_buffer;
+    index_t n = m_buffer_bytes;
+
+    for(; n >= 8; n -= 8, p += 8)
+    {
+        h ^= xxh_round(0, xxh_read64(p));
+        h  = xxh_rotl(h, 27) * XXH_P1 + XXH_P4;
+    }
+
+    if(n >= 4)
+    {
+        h ^= (uint64)xxh_read32(p) * XXH_P1;
+        h  = xxh_rotl(h, 23) * XXH_P2 + XXH_P3;
+        p += 4;
+        n -= 4;
+    }
+
+    for(; n > 0; n--, p++)
+    {
+        h ^= (uint64)(*p) * XXH_P5;
+        h  = xxh_rotl(h, 11) * XXH_P1;
+    }
+
+    h ^= h >> 33;
+    h *= XXH_P2;
+    h ^= h >> 29;
+    h *= XXH_P3;
+    h ^= h >> 32;
+    return h;
+}
+
+//-----------------------------------------------------------------------------
+uint64
+xxhash64(const void *data,
+         index_t num_bytes,
+         uint64 seed)
+{
+    Hash64 hash(seed);
+    hash.update(data, num_bytes);
+    return hash.digest();
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::kernels --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
@@ -0,0 +1,234 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2019, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_kernels.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef CONDUIT_KERNELS_HPP
+#define CONDUIT_KERNELS_HPP
+
+//-----------------------------------------------------------------------------
+// -- conduit includes -- 
+//-----------------------------------------------------------------------------
+#include "conduit_core.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::kernels --
+//-----------------------------------------------------------------------------
+///
+/// Low level kernels that move array data described by offsets and 
+/// strides (in bytes). These are used by Node and DataArray to copy 
+/// non-contiguous data.
+///
+//-----------------------------------------------------------------------------
+namespace kernels
+{
+
+//-----------------------------------------------------------------------------
+/// Strided copy (gather / scatter)
+///
+/// Copies `num_elements` elements of `element_bytes` bytes each from `src` 
+/// to `dest`. Consecutive elements are `src_stride` bytes apart in the 
+/// source and `dest_stride` bytes apart in the destination. Pointers and 
+/// strides don't need to be aligned.
+///
+/// 1, 2, 4, and 8 byte elements use typed copy loops (with AVX2 gathers
+/// for 4 and 8 byte elements into contiguous destinations when conduit 
+/// is compiled with AVX2 support). Contiguous source and destination 
+/// use a single memcpy. Other element sizes copy element by element.
+//-----------------------------------------------------------------------------
+    void CONDUIT_API strided_copy(void *dest,
+                                  index_t dest_stride,
+                                  const void *src,
+                                  index_t src_stride,
+                                  index_t num_elements,
+                                  index_t element_bytes);
+
+    /// gathers strided elements into a contiguous destination
+    void CONDUIT_API gather(void *dest,
+                            const void *src,
+                            index_t src_stride,
+                            index_t num_elements,
+                            index_t element_bytes);
+
+    /// scatters contiguous elements into a strided destination
+    void CONDUIT_API scatter(void *dest,
+                             index_t dest_stride,
+                             const void *src,
+                             index_t num_elements,
+                             index_t element_bytes);
+
+//-----------------------------------------------------------------------------
+/// Byte swap
+///
+/// Reverses the bytes of `num_elements` elements of `element_bytes` 
+/// bytes each (2, 4, or 8, other sizes are left as is). 
+/// 
+/// byte_swap() swaps in place, byte_swap_copy() swaps while copying from 
+/// `src` to `dest` (a single pass, used to convert endianness on copy).
+/// src and dest may be the same location if their strides match.
+///
+/// Contiguous data uses SSSE3 / AVX2 byte shuffles when conduit is 
+/// compiled with support for them.
+//-----------------------------------------------------------------------------
+    void CONDUIT_API byte_swap(void *data,
+                               index_t stride,
+                               index_t num_elements,
+                               index_t element_bytes);
+
+    void CONDUIT_API byte_swap_copy(void *dest,
+                                    index_t dest_stride,
+                                    const void *src,
+                                    index_t src_stride,
+                                    index_t num_elements,
+                                    index_t element_bytes);
+
+//-----------------------------------------------------------------------------
+/// Numeric conversion
+///
+/// Converts `num_elements` values of type `src_dtype_id` to type 
+/// `dest_dtype_id` (C style casts). Both ids must be numeric bitwidth style
+/// ids (INT8_ID ... FLOAT64_ID), strides are in bytes. Values must be 
+/// aligned for their type.
+///
+/// Contiguous data uses loops the compiler can vectorize. int32 <-> int64 
+/// and float32 <-> float64 also use SSE / AVX conversion instructions
+/// when conduit is compiled with support for them.
+//-----------------------------------------------------------------------------
+    void CONDUIT_API convert(void *dest,
+                             index_t dest_dtype_id,
+                             index_t dest_stride,
+                             const void *src,
+                             index_t src_dtype_id,
+                             index_t src_stride,
+                             index_t num_elements);
+
+//-----------------------------------------------------------------------------
+/// Hashing and checksums
+///
+/// crc32c() computes the CRC-32C (Castagnoli) checksum of `num_bytes` bytes.
+/// It can be continued across buffers: pass the result for the previous 
+/// bytes as `crc` (0 to start). It uses the SSE4.2 / ARMv8 crc32c 
+/// instructions when conduit is compiled with support for them, and a
+/// table based (slicing by 8) loop otherwise.
+///
+/// crc32c_combine() returns the checksum of the concatenation of two byte 
+/// ranges from the checksums of each (`num_bytes_2` is the length of the
+/// second), so parts of a buffer can be checksummed independently.
+///
+/// The `_strided` variants process `num_elements` elements of
+/// `element_bytes` bytes each, `stride` bytes apart, as if the elements 
+/// were contiguous (strided data is gathered in small blocks, it is 
+/// never compacted as a whole).
+//-----------------------------------------------------------------------------
+    uint32 CONDUIT_API crc32c(const void *data,
+                              index_t num_bytes,
+                              uint32 crc = 0);
+
+    uint32 CONDUIT_API crc32c_strided(const void *data,
+                                      index_t stride,
+                                      index_t num_elements,
+                                      index_t element_bytes,
+                                      uint32 crc = 0);
+
+    uint32 CONDUIT_API crc32c_combine(uint32 crc_1,
+                                      uint32 crc_2,
+                                      index_t num_bytes_2);
+
+//-----------------------------------------------------------------------------
+/// Hash64 computes the 64 bit xxHash (XXH64) of a stream of bytes passed 
+/// to update() in any number of pieces. The result doesn't depend on how 
+/// the stream is split. xxhash64() hashes a single buffer.
+//-----------------------------------------------------------------------------
+    class CONDUIT_API Hash64
+    {
+    public:
+        Hash64(uint64 seed = 0);
+
+        /// starts a new stream
+        void    reset(uint64 seed = 0);
+
+        void    update(const void *data,
+                       index_t num_bytes);
+
+        void    update_strided(const void *data,
+                               index_t stride,
+                               index_t num_elements,
+                               index_t element_bytes);
+
+        /// hash of the bytes so far (the stream can be continued)
+        uint64  digest() const;
+
+    private:
+        uint64  m_acc[4];
+        uint64  m_seed;
+        uint64  m_total_bytes;
+        uint8   m_buffer[32];
+        index_t m_buffer_bytes;
+    };
+
+    uint64 CONDUIT_API xxhash64(const void *data,
+                                index_t num_bytes,
+                                uint64 seed = 0);
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::kernels --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
+
+#endif
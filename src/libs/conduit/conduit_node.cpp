@@ -48,6 +48,7 @@
 ///
 //-----------------------------------------------------------------------------
 #include "conduit_node.hpp"
+#include "conduit_node_path.hpp"
 #include "conduit_log.hpp"
 
 #if !defined(CONDUIT_PLATFORM_WINDOWS)
@@ -55,7 +56,9 @@
 // mmap interface not available on windows
 // 
 #include <sys/mman.h>
+#include <sys/uio.h>
 #include <unistd.h>
+#include <climits>
 #else
 #define NOMINMAX
 #undef min
@@ -69,10 +72,16 @@
 #include <algorithm>
 #include <iostream>
 #include <map>
+#include <new>
+
+#ifdef CONDUIT_USE_CXX11
+#include <atomic>
+#endif
 
 //-----------------------------------------------------------------------------
 // -- standard c lib includes -- 
 //-----------------------------------------------------------------------------
+#include <cerrno>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
@@ -86,6 +95,7 @@
 //-----------------------------------------------------------------------------
 #include "conduit_error.hpp"
 #include "conduit_utils.hpp"
+#include "conduit_kernels.hpp"
 
 // Easier access to the Conduit logging functions
 using namespace conduit::utils;
@@ -118,6 +128,778 @@ using namespace conduit::utils;
 namespace conduit
 {
 
+//-----------------------------------------------------------------------------
+// Node::StridedCopies helper class
+//-----------------------------------------------------------------------------
+// This private class collects the leaf copies of set_node(), compact_to()
+// and update(), which first set up the structure (and so the destination
+// offsets) of their result. Copies of large trees are split into pieces 
+// of similar byte counts that run on the conduit thread pool.
+//-----------------------------------------------------------------------------
+class Node::StridedCopies
+{
+  public:
+      StridedCopies();
+
+      //----------------------------------------------------------------------
+      // queues a copy of num_ele elements of ele_bytes bytes each
+      void  add(void *dest,
+                index_t dest_stride,
+                const void *src,
+                index_t src_stride,
+                index_t num_ele,
+                index_t ele_bytes);
+
+      //----------------------------------------------------------------------
+      // runs and clears the queued copies
+      void  execute();
+
+  private:
+      struct Copy
+      {
+          uint8       *dest;
+          index_t      dest_stride;
+          const uint8 *src;
+          index_t      src_stride;
+          index_t      num_ele;
+          index_t      ele_bytes;
+      };
+
+      // a range of the elements of one copy
+      struct Piece
+      {
+          size_t       copy;
+          index_t      start;
+          index_t      num_ele;
+      };
+
+      static void run_task(index_t task,
+                           void *ctx);
+
+      std::vector<Copy>    m_copies;
+      index_t              m_num_bytes;
+
+      // the pieces of task i are [m_task_pieces[i], m_task_pieces[i+1])
+      std::vector<Piece>   m_pieces;
+      std::vector<size_t>  m_task_pieces;
+};
+
+//-----------------------------------------------------------------------------
+Node::StridedCopies::StridedCopies()
+: m_copies(),
+  m_num_bytes(0),
+  m_pieces(),
+  m_task_pieces()
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::StridedCopies::add(void *dest,
+                         index_t dest_stride,
+                         const void *src,
+                         index_t src_stride,
+                         index_t num_ele,
+                         index_t ele_bytes)
+{
+    if(num_ele <= 0 || ele_bytes <= 0)
+    {
+        return;
+    }
+
+    Copy c;
+    c.dest        = (uint8*)dest;
+    c.dest_stride = dest_stride;
+    c.src         = (const uint8*)src;
+    c.src_stride  = src_stride;
+    c.num_ele     = num_ele;
+    c.ele_bytes   = ele_bytes;
+
+    // contiguous copies are split by byte
+    if(num_ele == 1 || 
+       (src_stride == ele_bytes && dest_stride == ele_bytes))
+    {
+        c.dest_stride = 1;
+        c.src_stride  = 1;
+        c.num_ele     = num_ele * ele_bytes;
+        c.ele_bytes   = 1;
+    }
+
+    m_copies.push_back(c);
+    m_num_bytes += num_ele * ele_bytes;
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::StridedCopies::run_task(index_t task,
+                              void *ctx)
+{
+    StridedCopies *copies = (StridedCopies*)ctx;
+    size_t pieces_end = copies->m_task_pieces[(size_t)task + 1];
+    for(size_t i = copies->m_task_pieces[(size_t)task]; i < pieces_end; i++)
+    {
+        const Piece &p = copies->m_pieces[i];
+        const Copy  &c = copies->m_copies[p.copy];
+        kernels::strided_copy(c.dest + p.start * c.dest_stride,
+                              c.dest_stride,
+                              c.src + p.start * c.src_stride,
+                              c.src_stride,
+                              p.num_ele,
+                              c.ele_bytes);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::StridedCopies::execute()
+{
+    index_t nthreads = num_threads();
+    if(nthreads <= 1 || m_num_bytes < parallel_min_bytes())
+    {
+        for(size_t i = 0; i < m_copies.size(); i++)
+        {
+            const Copy &c = m_copies[i];
+            kernels::strided_copy(c.dest,
+                                  c.dest_stride,
+                                  c.src,
+                                  c.src_stride,
+                                  c.num_ele,
+                                  c.ele_bytes);
+        }
+    }
+    else
+    {
+        // a few tasks per thread, so threads that finish early can help 
+        index_t num_tasks  = nthreads * 4;
+        index_t task_bytes = std::max((m_num_bytes + num_tasks - 1) / 
+                                      num_tasks,
+                                      (index_t)65536);
+
+        // fill tasks with pieces up to task_bytes, large copies are 
+        // split across tasks
+        m_task_pieces.push_back(0);
+        index_t curr_bytes = 0;
+        for(size_t i = 0; i < m_copies.size(); i++)
+        {
+            const Copy &c = m_copies[i];
+            index_t start = 0;
+            while(start < c.num_ele)
+            {
+                index_t n = std::max((task_bytes - curr_bytes) / c.ele_bytes,
+                                     (index_t)1);
+                n = std::min(n, c.num_ele - start);
+                Piece p;
+                p.copy    = i;
+                p.start   = start;
+                p.num_ele = n;
+                m_pieces.push_back(p);
+                start      += n;
+                curr_bytes += n * c.ele_bytes;
+                if(curr_bytes >= task_bytes)
+                {
+                    m_task_pieces.push_back(m_pieces.size());
+                    curr_bytes = 0;
+                }
+            }
+        }
+        if(m_task_pieces.back() != m_pieces.size())
+        {
+            m_task_pieces.push_back(m_pieces.size());
+        }
+
+        parallel_for((index_t)m_task_pieces.size() - 1,
+                     run_task,
+                     this);
+    }
+
+    m_copies.clear();
+    m_pieces.clear();
+    m_task_pieces.clear();
+    m_num_bytes = 0;
+}
+
+//-----------------------------------------------------------------------------
+// Node::LeafDiffs helper class
+//-----------------------------------------------------------------------------
+// This private class holds the results of diff() for each node of the 
+// compared trees. The structure is compared first, then the leaves are 
+// compared (in parallel for large trees, largest leaves first).
+//-----------------------------------------------------------------------------
+class Node::LeafDiffs
+{
+  public:
+      LeafDiffs(float64 epsilon);
+
+      //----------------------------------------------------------------------
+      // adds the result of a non-leaf comparison, returns its id.
+      // results must be added before the results of their children
+      index_t add(Node *info,
+                  index_t parent,
+                  bool res);
+
+      //----------------------------------------------------------------------
+      // queues the comparison of two leaves
+      void    add_leaf(const Node *t_leaf,
+                       const Node *n_leaf,
+                       Node *info,
+                       index_t parent);
+
+      //----------------------------------------------------------------------
+      void    set_different(index_t id)
+                  { m_results[(size_t)id].res = true; }
+
+      //----------------------------------------------------------------------
+      // compares the leaves, adds the validation entries to all info
+      // nodes, and returns the result for the root
+      bool    execute();
+
+  private:
+      struct Result
+      {
+          Node       *info;
+          const Node *t_leaf;
+          const Node *n_leaf;
+          index_t     parent;
+          index_t     num_bytes;
+          bool        res;
+      };
+
+      // orders leaves by size, largest first
+      struct LargerLeaf
+      {
+          const std::vector<Result> *results;
+          bool operator()(size_t a, size_t b) const
+              { return (*results)[a].num_bytes > (*results)[b].num_bytes; }
+      };
+
+      static void run_task(index_t task,
+                           void *ctx);
+
+      float64              m_epsilon;
+      std::vector<Result>  m_results;
+      std::vector<size_t>  m_leaves;
+      index_t              m_num_bytes;
+      // info for each leaf written by parallel comparisons, moved into
+      // the info tree once they are all finished
+      std::vector<Node>    m_leaf_infos;
+};
+
+//-----------------------------------------------------------------------------
+Node::LeafDiffs::LeafDiffs(float64 epsilon)
+: m_epsilon(epsilon),
+  m_results(),
+  m_leaves(),
+  m_num_bytes(0),
+  m_leaf_infos()
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+index_t
+Node::LeafDiffs::add(Node *info,
+                     index_t parent,
+                     bool res)
+{
+    Result r;
+    r.info      = info;
+    r.t_leaf    = NULL;
+    r.n_leaf    = NULL;
+    r.parent    = parent;
+    r.num_bytes = 0;
+    r.res       = res;
+    m_results.push_back(r);
+    return (index_t)m_results.size() - 1;
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::LeafDiffs::add_leaf(const Node *t_leaf,
+                          const Node *n_leaf,
+                          Node *info,
+                          index_t parent)
+{
+    index_t id = add(info,parent,false);
+    Result &r = m_results[(size_t)id];
+    r.t_leaf    = t_leaf;
+    r.n_leaf    = n_leaf;
+    r.num_bytes = t_leaf->dtype().bytes_compact();
+    m_leaves.push_back((size_t)id);
+    m_num_bytes += r.num_bytes;
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::LeafDiffs::run_task(index_t task,
+                          void *ctx)
+{
+    LeafDiffs *diffs = (LeafDiffs*)ctx;
+    Result &r = diffs->m_results[diffs->m_leaves[(size_t)task]];
+    Node &info = diffs->m_leaf_infos.empty() ? 
+                        *r.info : diffs->m_leaf_infos[(size_t)task];
+    r.res = r.t_leaf->diff_leaf(*r.n_leaf,info,diffs->m_epsilon);
+}
+
+//-----------------------------------------------------------------------------
+bool
+Node::LeafDiffs::execute()
+{
+    // parallel comparisons write to separate root nodes instead of the
+    // info tree: info nodes share their parents' schemas and allocators
+    // (which may be arenas or blocks), so the info tree is only changed 
+    // on this thread. the separate nodes allocate from the default 
+    // allocator, so this is only done with the (thread safe) calloc one.
+    if(num_threads() > 1 &&
+       m_num_bytes >= parallel_min_bytes() &&
+       utils::default_allocator() == 0)
+    {
+        LargerLeaf larger;
+        larger.results = &m_results;
+        std::stable_sort(m_leaves.begin(),m_leaves.end(),larger);
+        m_leaf_infos.resize(m_leaves.size());
+        parallel_for((index_t)m_leaves.size(),run_task,this);
+
+        for(size_t i = 0; i < m_leaves.size(); i++)
+        {
+            m_results[m_leaves[i]].info->move(m_leaf_infos[i]);
+        }
+        m_leaf_infos.clear();
+    }
+    else
+    {
+        for(size_t i = 0; i < m_leaves.size(); i++)
+        {
+            run_task((index_t)i,this);
+        }
+    }
+
+    // children were added after their parents, so walking backwards 
+    // finishes all children before their parent
+    for(size_t i = m_results.size(); i > 0; i--)
+    {
+        const Result &r = m_results[i-1];
+        log::validation(*r.info, !r.res);
+        if(r.parent >= 0 && r.res)
+        {
+            m_results[(size_t)r.parent].res = true;
+        }
+    }
+
+    return m_results.empty() ? false : m_results[0].res;
+}
+
+//-----------------------------------------------------------------------------
+// Node::LeafHashes collects the leaves of a tree, hashes them (in parallel
+// for large trees) and combines the results into the hash of the tree
+//-----------------------------------------------------------------------------
+class Node::LeafHashes
+{
+  public:
+      LeafHashes(const Node &options,
+                 const std::string &caller);
+
+      //----------------------------------------------------------------------
+      // adds the leaves of node (depth first)
+      void    add(const Node &node);
+
+      //----------------------------------------------------------------------
+      // hashes the leaves that were added
+      void    execute();
+
+      //----------------------------------------------------------------------
+      // hash of the tree whose leaves were added and hashed
+      uint64  tree_hash(const Node &node) const;
+
+      //----------------------------------------------------------------------
+      // sets res to the structure of the tree with the leaf hashes 
+      // in place of the leaves
+      void    leaf_hashes(const Node &node,
+                          Node &res) const;
+
+  private:
+      // a range of the elements of a leaf, large leaves are split into
+      // several pieces for crc32c (whose results can be combined)
+      struct Piece
+      {
+          index_t leaf;
+          index_t start;
+          index_t num_ele;
+          index_t num_bytes;
+          uint64  res;
+      };
+
+      // orders pieces by size, largest first
+      struct LargerPiece
+      {
+          const std::vector<Piece> *pieces;
+          bool operator()(size_t a, size_t b) const
+              { return (*pieces)[a].num_bytes > (*pieces)[b].num_bytes; }
+      };
+
+      // hashes integers as little endian bytes, so descriptors hash the 
+      // same on all machines
+      static void hash_int64(kernels::Hash64 &hash,
+                             int64 val);
+
+      uint64  hash_piece(const Piece &piece) const;
+
+      void    tree_hash(const Node &node,
+                        kernels::Hash64 &hash,
+                        index_t &leaf_idx) const;
+      void    leaf_hashes(const Node &node,
+                          Node &res,
+                          index_t &leaf_idx) const;
+
+      static void run_task(index_t task,
+                           void *ctx);
+
+      bool                      m_crc32c;
+      bool                      m_schema;
+      uint64                    m_seed;
+      std::vector<const Node*>  m_leaves;
+      std::vector<uint64>       m_leaf_res;
+      std::vector<Piece>        m_pieces;
+      std::vector<size_t>       m_order;
+      index_t                   m_num_bytes;
+};
+
+//-----------------------------------------------------------------------------
+Node::LeafHashes::LeafHashes(const Node &options,
+                             const std::string &caller)
+: m_crc32c(false),
+  m_schema(true),
+  m_seed(0),
+  m_leaves(),
+  m_leaf_res(),
+  m_pieces(),
+  m_order(),
+  m_num_bytes(0)
+{
+    if(options.has_child("algorithm"))
+    {
+        std::string algo = options["algorithm"].as_string();
+        if(algo == "crc32c")
+        {
+            m_crc32c = true;
+        }
+        else if(algo != "xxhash64")
+        {
+            CONDUIT_ERROR("<Node::" << caller << "> unsupported algorithm: "
+                          << "\"" << algo << "\"" 
+                          << " (expected \"xxhash64\" or \"crc32c\")");
+        }
+    }
+
+    if(options.has_child("schema"))
+    {
+        std::string schema = options["schema"].as_string();
+        if(schema == "false")
+        {
+            m_schema = false;
+        }
+        else if(schema != "true")
+        {
+            CONDUIT_ERROR("<Node::" << caller << "> unsupported schema "
+                          << "option: \"" << schema << "\"" 
+                          << " (expected \"true\" or \"false\")");
+        }
+    }
+
+    if(options.has_child("seed"))
+    {
+        m_seed = options["seed"].to_uint64();
+    }
+
+    // crc32c only covers the data
+    if(m_crc32c)
+    {
+        m_schema = false;
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::LeafHashes::add(const Node &node)
+{
+    index_t dt_id = node.dtype().id();
+    if(dt_id == DataType::OBJECT_ID || dt_id == DataType::LIST_ID)
+    {
+        index_t nchld = node.number_of_children();
+        for(index_t i = 0; i < nchld; i++)
+        {
+            add(*node.m_children[(size_t)i]);
+        }
+    }
+    else if(dt_id != DataType::EMPTY_ID)
+    {
+        Piece p;
+        p.leaf      = (index_t)m_leaves.size();
+        p.start     = 0;
+        p.num_ele   = node.dtype().number_of_elements();
+        p.num_bytes = node.dtype().bytes_compact();
+        p.res       = 0;
+        m_pieces.push_back(p);
+        m_leaves.push_back(&node);
+        m_num_bytes += p.num_bytes;
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::LeafHashes::hash_int64(kernels::Hash64 &hash,
+                             int64 val)
+{
+    uint8 bytes[8];
+    uint64 uval = (uint64)val;
+    for(int i = 0; i < 8; i++)
+    {
+        bytes[i] = (uint8)(uval >> (8 * i));
+    }
+    hash.update(bytes,8);
+}
+
+//-----------------------------------------------------------------------------
+uint64
+Node::LeafHashes::hash_piece(const Piece &piece) const
+{
+    const Node &leaf = *m_leaves[(size_t)piece.leaf];
+    const DataType &dt = leaf.dtype();
+    const void *ptr = NULL;
+    if(piece.num_ele > 0)
+    {
+        ptr = leaf.element_ptr(piece.start);
+    }
+
+    if(m_crc32c)
+    {
+        return kernels::crc32c_strided(ptr,
+                                       dt.stride(),
+                                       piece.num_ele,
+                                       dt.element_bytes());
+    }
+
+    kernels::Hash64 hash(m_seed);
+    if(m_schema)
+    {
+        index_t endianness = dt.endianness();
+        if(endianness == Endianness::DEFAULT_ID)
+        {
+            endianness = Endianness::machine_default();
+        }
+        hash_int64(hash,dt.id());
+        hash_int64(hash,dt.number_of_elements());
+        hash_int64(hash,dt.element_bytes());
+        hash_int64(hash,endianness);
+    }
+    hash.update_strided(ptr,
+                        dt.stride(),
+                        piece.num_ele,
+                        dt.element_bytes());
+    return hash.digest();
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::LeafHashes::run_task(index_t task,
+                           void *ctx)
+{
+    LeafHashes *hashes = (LeafHashes*)ctx;
+    Piece &p = hashes->m_pieces[hashes->m_order[(size_t)task]];
+    p.res = hashes->hash_piece(p);
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::LeafHashes::execute()
+{
+    index_t nthreads = num_threads();
+    bool parallel = nthreads > 1 && m_num_bytes >= parallel_min_bytes();
+
+    if(parallel && m_crc32c)
+    {
+        // split large leaves, so a single large leaf is still checksummed
+        // in parallel
+        index_t piece_bytes = m_num_bytes / (nthreads * 4);
+        if(piece_bytes < 64 * 1024)
+        {
+            piece_bytes = 64 * 1024;
+        }
+
+        std::vector<Piece> pieces;
+        for(size_t i = 0; i < m_pieces.size(); i++)
+        {
+            const Piece &p = m_pieces[i];
+            index_t ele_bytes = m_leaves[(size_t)p.leaf]->dtype()
+                                                         .element_bytes();
+            index_t piece_ele = ele_bytes > 0 ? piece_bytes / ele_bytes : 0;
+            if(piece_ele < 1)
+            {
+                piece_ele = 1;
+            }
+
+            Piece sub = p;
+            for(index_t start = 0; start < p.num_ele; start += piece_ele)
+            {
+                sub.start     = start;
+                sub.num_ele   = std::min(piece_ele, p.num_ele - start);
+                sub.num_bytes = sub.num_ele * ele_bytes;
+                pieces.push_back(sub);
+            }
+
+            if(p.num_ele == 0)
+            {
+                pieces.push_back(p);
+            }
+        }
+        m_pieces.swap(pieces);
+    }
+
+    m_order.resize(m_pieces.size());
+    for(size_t i = 0; i < m_order.size(); i++)
+    {
+        m_order[i] = i;
+    }
+
+    if(parallel)
+    {
+        LargerPiece larger;
+        larger.pieces = &m_pieces;
+        std::stable_sort(m_order.begin(),m_order.end(),larger);
+        parallel_for((index_t)m_order.size(),run_task,this);
+    }
+    else
+    {
+        for(size_t i = 0; i < m_order.size(); i++)
+        {
+            run_task((index_t)i,this);
+        }
+    }
+
+    // pieces are in leaf order, combine the pieces of each leaf
+    m_leaf_res.assign(m_leaves.size(),0);
+    index_t prev_leaf = -1;
+    for(size_t i = 0; i < m_pieces.size(); i++)
+    {
+        const Piece &p = m_pieces[i];
+        uint64 &res = m_leaf_res[(size_t)p.leaf];
+        if(p.leaf != prev_leaf)
+        {
+            res = p.res;
+        }
+        else
+        {
+            res = kernels::crc32c_combine((uint32)res,
+                                          (uint32)p.res,
+                                          p.num_bytes);
+        }
+        prev_leaf = p.leaf;
+    }
+}
+
+//-----------------------------------------------------------------------------
+uint64
+Node::LeafHashes::tree_hash(const Node &node) const
+{
+    if(m_crc32c)
+    {
+        // the checksum of all of the data in compact order
+        uint32 crc = 0;
+        for(size_t i = 0; i < m_leaves.size(); i++)
+        {
+            crc = kernels::crc32c_combine(crc,
+                                          (uint32)m_leaf_res[i],
+                                          m_leaves[i]->dtype()
+                                                      .bytes_compact());
+        }
+        return crc;
+    }
+
+    kernels::Hash64 hash(m_seed);
+    index_t leaf_idx = 0;
+    tree_hash(node,hash,leaf_idx);
+    return hash.digest();
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::LeafHashes::tree_hash(const Node &node,
+                            kernels::Hash64 &hash,
+                            index_t &leaf_idx) const
+{
+    index_t dt_id = node.dtype().id();
+
+    if(m_schema)
+    {
+        hash_int64(hash,dt_id);
+    }
+
+    if(dt_id == DataType::OBJECT_ID || dt_id == DataType::LIST_ID)
+    {
+        index_t nchld = node.number_of_children();
+        if(m_schema)
+        {
+            hash_int64(hash,nchld);
+        }
+
+        for(index_t i = 0; i < nchld; i++)
+        {
+            if(m_schema && dt_id == DataType::OBJECT_ID)
+            {
+                const std::string &name = node.child_names()[(size_t)i];
+                hash_int64(hash,(int64)name.size());
+                hash.update(name.c_str(),(index_t)name.size());
+            }
+            tree_hash(*node.m_children[(size_t)i],hash,leaf_idx);
+        }
+    }
+    else if(dt_id != DataType::EMPTY_ID)
+    {
+        hash_int64(hash,(int64)m_leaf_res[(size_t)leaf_idx]);
+        leaf_idx++;
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::LeafHashes::leaf_hashes(const Node &node,
+                              Node &res) const
+{
+    res.reset();
+    index_t leaf_idx = 0;
+    leaf_hashes(node,res,leaf_idx);
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::LeafHashes::leaf_hashes(const Node &node,
+                              Node &res,
+                              index_t &leaf_idx) const
+{
+    index_t dt_id = node.dtype().id();
+
+    if(dt_id == DataType::OBJECT_ID)
+    {
+        const std::vector<std::string> &names = node.child_names();
+        for(size_t i = 0; i < names.size(); i++)
+        {
+            leaf_hashes(*node.m_children[i],res.add_child(names[i]),leaf_idx);
+        }
+    }
+    else if(dt_id == DataType::LIST_ID)
+    {
+        for(size_t i = 0; i < node.m_children.size(); i++)
+        {
+            leaf_hashes(*node.m_children[i],res.append(),leaf_idx);
+        }
+    }
+    else if(dt_id != DataType::EMPTY_ID)
+    {
+        res.set_uint64(m_leaf_res[(size_t)leaf_idx]);
+        leaf_idx++;
+    }
+}
+
 //=============================================================================
 //-----------------------------------------------------------------------------
 //
@@ -166,6 +948,54 @@ Node::reset()
     m_schema->set(DataType::EMPTY_ID);
 }
 
+//---------------------------------------------------------------------------//
+void
+Node::swap(Node &node)
+{
+    if(this == &node)
+    {
+        return;
+    }
+
+    // swap schema contents instead of schema pointers: schemas of child 
+    // nodes are owned by their parent's schema and must stay in place
+    m_schema->swap(*node.m_schema);
+
+    std::swap(m_children,node.m_children);
+    std::swap(m_data,node.m_data);
+    std::swap(m_data_size,node.m_data_size);
+    std::swap(m_alloced,node.m_alloced);
+    std::swap(m_allocator_id,node.m_allocator_id);
+    std::swap(m_data_tag,node.m_data_tag);
+    std::swap(m_mmaped,node.m_mmaped);
+    std::swap(m_mmap,node.m_mmap);
+    std::swap(m_shared,node.m_shared);
+
+    // children now belong to the other node
+    for(size_t i=0; i < m_children.size(); i++)
+    {
+        m_children[i]->m_parent = this;
+    }
+
+    for(size_t i=0; i < node.m_children.size(); i++)
+    {
+        node.m_children[i]->m_parent = &node;
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::move(Node &node)
+{
+    if(this == &node)
+    {
+        return;
+    }
+
+    reset();
+    swap(node);
+}
+
 //-----------------------------------------------------------------------------
 // -- constructors for generic types --
 //-----------------------------------------------------------------------------
@@ -366,11 +1196,53 @@ Node::load(const std::string &stream_path,
 }
 
 
+//-----------------------------------------------------------------------------
+// verifies the data of a conduit_bin load if save() stored a checksum
+static void
+verify_conduit_bin_checksum(const Node &node,
+                            const std::string &ibase)
+{
+    std::string ifchecksum = ibase + "_checksum";
+    if(!utils::is_file(ifchecksum))
+    {
+        return;
+    }
+
+    std::ifstream ifs;
+    ifs.open(ifchecksum.c_str());
+    if(!ifs.is_open())
+    {
+        CONDUIT_ERROR("<Node::load> failed to open: " << ifchecksum);
+    }
+    std::string expected;
+    ifs >> expected;
+
+    if(!node.verify_checksum(expected))
+    {
+        std::string algo = expected.substr(0,expected.find(':'));
+        CONDUIT_ERROR("<Node::load> checksum mismatch for: " << ibase
+                      << " (expected: " << expected
+                      << ", found: " << node.checksum(algo) << ")");
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::load(const std::string &ibase,
+           const std::string &protocol)
+{
+    Node options;
+    load(ibase,protocol,options);
+}
+
 //---------------------------------------------------------------------------//
 void
 Node::load(const std::string &ibase,
-           const std::string &protocol)
+           const std::string &protocol,
+           const Node &options)
 {
+    CONDUIT_TRACE_SCOPE("conduit::Node::load");
+
     std::string proto = protocol;
     //auto detect protocol
     if(proto == "")
@@ -378,12 +1250,50 @@ Node::load(const std::string &ibase,
         identify_protocol(ibase,proto);
     }
 
+    bool    swap       = false;
+    index_t endianness = Endianness::DEFAULT_ID;
+    if(options.dtype().is_object() && options.has_child("endianness"))
+    {
+        std::string endian_name = options["endianness"].as_string();
+        if(endian_name != "default" &&
+           endian_name != "little" &&
+           endian_name != "big")
+        {
+            CONDUIT_ERROR("<Node::load> unsupported endianness: "
+                          << "\"" << endian_name << "\""
+                          << " (expected \"default\", \"little\", or"
+                          << " \"big\")");
+        }
+        swap       = true;
+        endianness = Endianness::name_to_id(endian_name);
+    }
+
     if(proto == "conduit_bin")
     {
         Schema s;
-        std::string ifschema = ibase + "_json";
-        s.load(ifschema);
-        load(ibase,s);
+        load_conduit_bin_schema(ibase,s);
+
+        if(swap && s.spanned_bytes() > 0)
+        {
+            // map the file and swap into this node's buffer in one pass,
+            // instead of reading it and then swapping in place
+            Node mmap_opts;
+            mmap_opts["mode"]   = "ro";
+            mmap_opts["advice"] = "sequential";
+            Node n_file;
+            n_file.mmap(ibase,s,mmap_opts);
+            verify_conduit_bin_checksum(n_file,ibase);
+            n_file.endian_swap_to(*this,endianness);
+        }
+        else
+        {
+            load(ibase,s);
+            verify_conduit_bin_checksum(*this,ibase);
+            if(swap)
+            {
+                endian_swap(endianness);
+            }
+        }
     }
     // single file json and yaml cases
     else
@@ -394,12 +1304,18 @@ Node::load(const std::string &ibase,
         {
             CONDUIT_ERROR("<Node::load> failed to open: " << ibase);
         }
-        std::string json_data((std::istreambuf_iterator<char>(ifile)),
-                               std::istreambuf_iterator<char>());
-        
-        Generator g(json_data,protocol);
-        g.walk(*this);
+        // the json, yaml and conduit_base64_json protocols are parsed as
+        // the file is read
+        Generator g("",proto);
+        g.walk(ifile,*this);
+
+        if(swap)
+        {
+            endian_swap(endianness);
+        }
     }
+
+    CONDUIT_TRACE_BYTES(total_bytes_compact());
 }
 
 //---------------------------------------------------------------------------//
@@ -407,6 +1323,19 @@ void
 Node::save(const std::string &obase,
            const std::string &protocol) const
 {
+    Node options;
+    save(obase,protocol,options);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::save(const std::string &obase,
+           const std::string &protocol,
+           const Node &options) const
+{
+    CONDUIT_TRACE_SCOPE("conduit::Node::save");
+    CONDUIT_TRACE_BYTES(total_bytes_compact());
+
     std::string proto = protocol;
     //auto detect protocol
     if(proto == "")
@@ -416,12 +1345,83 @@ Node::save(const std::string &obase,
 
     if(proto == "conduit_bin")
     {
-        Node res;
-        compact_to(res);
-        std::string ofschema = obase + "_json";
+        std::string schema_proto = "json";
+        if(options.has_child("schema_protocol"))
+        {
+            schema_proto = options["schema_protocol"].as_string();
+        }
+
+        std::string checksum_algo = "none";
+        if(options.has_child("checksum"))
+        {
+            checksum_algo = options["checksum"].as_string();
+        }
+
+        if(checksum_algo != "none" &&
+           checksum_algo != "crc32c" &&
+           checksum_algo != "xxhash64")
+        {
+            CONDUIT_ERROR("<Node::save> unsupported checksum: "
+                          << "\"" << checksum_algo << "\"" 
+                          << " (expected \"none\", \"crc32c\", or"
+                          << " \"xxhash64\")");
+        }
+
+        // the data is written straight from the leaves, only the
+        // schema needs to be compacted
+        Schema s_compact;
+        m_schema->compact_to(s_compact);
+
+        std::string ofschema_json = obase + "_json";
+        std::string ofschema_bin  = obase + "_schema_bin";
+
+        // remove the other schema file (if it exists) so a load 
+        // can't pick up a stale schema
+        if(schema_proto == "json")
+        {
+            s_compact.save(ofschema_json);
+            if(utils::is_file(ofschema_bin))
+            {
+                utils::remove_file(ofschema_bin);
+            }
+        }
+        else if(schema_proto == "binary")
+        {
+            s_compact.serialize_binary(ofschema_bin);
+            if(utils::is_file(ofschema_json))
+            {
+                utils::remove_file(ofschema_json);
+            }
+        }
+        else
+        {
+            CONDUIT_ERROR("<Node::save> unsupported schema_protocol: "
+                          << "\"" << schema_proto << "\"" 
+                          << " (expected \"json\" or \"binary\")");
+        }
 
-        res.schema().save(ofschema);
-        res.serialize(obase);
+        serialize(obase);
+
+        // as with the schema, remove an old checksum file so a load 
+        // doesn't verify against a stale checksum
+        std::string ofchecksum = obase + "_checksum";
+        if(checksum_algo == "none")
+        {
+            if(utils::is_file(ofchecksum))
+            {
+                utils::remove_file(ofchecksum);
+            }
+        }
+        else
+        {
+            std::ofstream ofs;
+            ofs.open(ofchecksum.c_str());
+            if(!ofs.is_open())
+            {
+                CONDUIT_ERROR("<Node::save> failed to open: " << ofchecksum);
+            }
+            ofs << checksum(checksum_algo) << std::endl;
+        }
     }
     else if( proto == "yaml")
     {
@@ -437,11 +1437,7 @@ Node::save(const std::string &obase,
 void
 Node::mmap(const std::string &stream_path)
 {
-    std::string ifschema = stream_path + "_json";
-
-    Schema s;
-    s.load(ifschema);
-    mmap(stream_path,s);
+    mmap(stream_path,Node());
 }
 
 
@@ -450,9 +1446,31 @@ void
 Node::mmap(const std::string &stream_path,
            const Schema &schema)
 {
+    mmap(stream_path,schema,Node());
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::mmap(const std::string &stream_path,
+           const Node &options)
+{
+    Schema s;
+    load_conduit_bin_schema(stream_path,s);
+    mmap(stream_path,s,options);
+}
+
+//---------------------------------------------------------------------------//
+void 
+Node::mmap(const std::string &stream_path,
+           const Schema &schema,
+           const Node &options)
+{
+    CONDUIT_TRACE_SCOPE("conduit::Node::mmap");
+
     reset();
     index_t dsize = schema.spanned_bytes();
-    Node::mmap(stream_path,dsize);
+    CONDUIT_TRACE_BYTES(dsize);
+    Node::mmap(stream_path,dsize,options);
 
     //
     // See Below
@@ -472,6 +1490,37 @@ Node::mmap(const std::string &stream_path,
     m_mmaped = true;
 }
 
+//---------------------------------------------------------------------------//
+void
+Node::load_lazy(const std::string &stream_path)
+{
+    Schema s;
+    load_conduit_bin_schema(stream_path,s);
+    load_lazy(stream_path,s);
+}
+
+//---------------------------------------------------------------------------//
+void 
+Node::load_lazy(const std::string &stream_path,
+                const Schema &schema)
+{
+    // copy-on-write, with no read ahead
+    Node opts;
+    opts["mode"]   = "private";
+    opts["advice"] = "random";
+
+    reset();
+    index_t dsize = schema.spanned_bytes();
+    Node::mmap(stream_path,dsize,opts);
+
+    // see the ownership note in mmap()
+    m_mmaped = false;
+    m_schema->set(schema);
+    walk_schema(this,m_schema,m_data);
+    m_mmaped = true;
+}
+
+
 //-----------------------------------------------------------------------------
 //
 // -- end definition of Node basic i/o methods --
@@ -493,6 +1542,24 @@ Node::mmap(const std::string &stream_path,
 void 
 Node::set_node(const Node &node)
 {
+    // set up the structure, then copy the leaves
+    StridedCopies copies;
+    set_node(node,copies);
+    copies.execute();
+}
+
+//---------------------------------------------------------------------------//
+void 
+Node::set_node(const Node &node,
+               StridedCopies &copies)
+{
+    // if we already own a buffer with the same compact layout, 
+    // reuse it
+    if(m_alloced && update_contiguous(node,copies))
+    {
+        return;
+    }
+
     if(node.dtype().id() == DataType::OBJECT_ID)
     {
         reset();
@@ -506,9 +1573,10 @@ Node::set_node(const Node &node)
             Schema *curr_schema = &this->m_schema->add_child(*itr);
             size_t idx = (size_t) this->m_schema->child_index(*itr);
             Node *curr_node = new Node();
+            curr_node->set_allocator(m_allocator_id);
             curr_node->set_schema_ptr(curr_schema);
             curr_node->set_parent(this);
-            curr_node->set(*node.m_children[idx]);
+            curr_node->set_node(*node.m_children[idx],copies);
             this->append_node_ptr(curr_node);
         }
     }
@@ -521,15 +1589,16 @@ Node::set_node(const Node &node)
             this->m_schema->append();
             Schema *curr_schema = this->m_schema->child_ptr(i);
             Node *curr_node = new Node();
+            curr_node->set_allocator(m_allocator_id);
             curr_node->set_schema_ptr(curr_schema);
             curr_node->set_parent(this);
-            curr_node->set(*node.m_children[i]);
+            curr_node->set_node(*node.m_children[i],copies);
             this->append_node_ptr(curr_node);
         }
     }
     else if (node.dtype().id() != DataType::EMPTY_ID)
     {
-        node.compact_to(*this);
+        node.compact_to(*this,copies);
     }
     else
     {
@@ -623,6 +1692,39 @@ Node::set(const DataType &dtype, void *data)
     set_data_using_dtype(dtype,data);
 }
 
+//-----------------------------------------------------------------------------
+// -- allocator selection --
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+void
+Node::set_allocator(index_t allocator_id)
+{
+    if(!utils::is_valid_allocator(allocator_id))
+    {
+        CONDUIT_ERROR("<Node::set_allocator> Invalid allocator id: "
+                      << allocator_id);
+    }
+
+    if(allocator_id != m_allocator_id && m_alloced && m_data != NULL)
+    {
+        // move the data we own into the new allocator's memory
+        void *old_data = m_data;
+        void *new_data = utils::allocate_memory(allocator_id,m_data_size);
+        memcpy(new_data,old_data,(size_t)m_data_size);
+        utils::free_memory(m_allocator_id,old_data);
+        // descendants created via walk_schema share our buffer
+        replace_data_ptr(old_data,new_data);
+    }
+
+    m_allocator_id = allocator_id;
+
+    for(size_t i=0; i < m_children.size(); i++)
+    {
+        m_children[i]->set_allocator(allocator_id);
+    }
+}
+
 //-----------------------------------------------------------------------------
 // -- set for scalar types ---
 //-----------------------------------------------------------------------------
@@ -1264,15 +2366,11 @@ Node::set_string(const std::string &data)
     // so we need to follow a 'compact_elements_to' style 
     // of copying the data
 
-    index_t ele_bytes = dtype().element_bytes();
-    const char *data_ptr = data.c_str();
-    for(index_t i=0; i< (index_t) str_size_with_term; i++)
-    {
-        memcpy(element_ptr(i),
-               data_ptr,
-               (size_t)ele_bytes);
-        data_ptr+=ele_bytes;
-    }
+    kernels::scatter(element_ptr(0),
+                     dtype().stride(),
+                     data.c_str(),
+                     (index_t)str_size_with_term,
+                     dtype().element_bytes());
 }
 
 //---------------------------------------------------------------------------//
@@ -1300,16 +2398,11 @@ Node::set_char8_str(const char *data)
     // so we need to follow a 'compact_elements_to' style 
     // of copying the data
 
-    const char *data_ptr = data;
-
-    index_t ele_bytes = dtype().element_bytes();
-    for(index_t i=0; i< (index_t)str_size_with_term; i++)
-    {
-        memcpy(element_ptr(i),
-               data_ptr,
-               (size_t)ele_bytes);
-        data_ptr+=ele_bytes;
-    }
+    kernels::scatter(element_ptr(0),
+                     dtype().stride(),
+                     data,
+                     (index_t)str_size_with_term,
+                     dtype().element_bytes());
 }
 
 
@@ -6674,90 +7767,306 @@ Node::set_path_external(const std::string &path,
     fetch(path).set_external(data);
 }
 
-//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+void
+Node::set_path_external(const std::string &path,
+                        const std::vector<unsigned int> &data)
+{
+    fetch(path).set_external(data);
+}
+//-----------------------------------------------------------------------------
+#endif // end use int check
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+#ifndef CONDUIT_USE_LONG
+//-----------------------------------------------------------------------------
+void
+Node::set_path_external(const std::string &path,
+                        const std::vector<long> &data)
+{
+    fetch(path).set_external(data);
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::set_path_external(const std::string &path,
+                        const std::vector<unsigned long> &data)
+{
+    fetch(path).set_external(data);
+}
+//-----------------------------------------------------------------------------
+#endif // end use long check
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+#if defined(CONDUIT_HAS_LONG_LONG) && !defined(CONDUIT_USE_LONG_LONG)
+//-----------------------------------------------------------------------------
+void
+Node::set_path_external(const std::string &path,
+                        const std::vector<long long> &data)
+{
+    fetch(path).set_external(data);
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::set_path_external(const std::string &path,
+                        const std::vector<unsigned long long> &data)
+{
+    fetch(path).set_external(data);
+}
+//-----------------------------------------------------------------------------
+#endif // end use long long check
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+#ifndef CONDUIT_USE_FLOAT
+//-----------------------------------------------------------------------------
+void
+Node::set_path_external(const std::string &path,
+                        const std::vector<float> &data)
+{
+    fetch(path).set_external(data);
+}
+//-----------------------------------------------------------------------------
+#endif // end use float check
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+#ifndef CONDUIT_USE_DOUBLE
+//-----------------------------------------------------------------------------
+void
+Node::set_path_external(const std::string &path,
+                        const std::vector<double> &data)
+{
+    fetch(path).set_external(data);
+}
+//-----------------------------------------------------------------------------
+#endif // end use double check
+//-----------------------------------------------------------------------------
+
+
+
+//-----------------------------------------------------------------------------
+//
+// -- end definition of Node set_path_external methods --
+//
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+//
+// -- begin definition of Node set_shared methods --
+//
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// Node::SharedBuffer helper class
+//-----------------------------------------------------------------------------
+// This private class holds a buffer that several nodes use. Each node that
+// holds a reference owns one count, the buffer is freed with the last one.
+//-----------------------------------------------------------------------------
+class Node::SharedBuffer
+{
+  public:
+      //----------------------------------------------------------------------
+      // takes over data (allocated with allocator_id and counted under 
+      // memory stats tag_id), the caller holds the first reference
+      SharedBuffer(void *data,
+                   index_t data_size,
+                   index_t allocator_id,
+                   index_t tag_id);
+
+      //----------------------------------------------------------------------
+      void     add_ref();
+      // drops a reference, the buffer is deleted with the last one
+      void     release();
+      index_t  use_count() const;
+
+      //----------------------------------------------------------------------
+      void    *data_ptr() const
+          { return m_data; }
+      index_t  data_size() const
+          { return m_data_size; }
+
+      //----------------------------------------------------------------------
+      bool     contains(const uint8 *start,
+                        index_t nbytes) const
+          { return start >= (const uint8*)m_data &&
+                   start + nbytes <= (const uint8*)m_data + m_data_size; }
+
+      //----------------------------------------------------------------------
+      // number of shared buffers, lets nodes skip looking for the buffer
+      // that holds their data when there are none
+      static index_t num_live();
+
+  private:
+      ~SharedBuffer();
+
+      void      *m_data;
+      index_t    m_data_size;
+      index_t    m_allocator_id;
+      index_t    m_tag_id;
+
+#ifdef CONDUIT_USE_CXX11
+      std::atomic<long>         m_use_count;
+      static std::atomic<long>  m_num_live;
+#else
+      volatile long             m_use_count;
+      static volatile long      m_num_live;
+
+      // adds delta to value atomically, returns the new value
+      static long atomic_add(volatile long *value, long delta)
+      {
+  #if defined(CONDUIT_PLATFORM_WINDOWS)
+          return InterlockedExchangeAdd(value,delta) + delta;
+  #else
+          return __sync_add_and_fetch(value,delta);
+  #endif
+      }
+#endif
+};
+
+#ifdef CONDUIT_USE_CXX11
+std::atomic<long> Node::SharedBuffer::m_num_live(0);
+#else
+volatile long Node::SharedBuffer::m_num_live = 0;
+#endif
+
+//---------------------------------------------------------------------------//
+Node::SharedBuffer::SharedBuffer(void *data,
+                                 index_t data_size,
+                                 index_t allocator_id,
+                                 index_t tag_id)
+: m_data(data),
+  m_data_size(data_size),
+  m_allocator_id(allocator_id),
+  m_tag_id(tag_id),
+  m_use_count(1)
+{
+#ifdef CONDUIT_USE_CXX11
+    m_num_live++;
+#else
+    atomic_add(&m_num_live,1);
+#endif
+}
+
+//---------------------------------------------------------------------------//
+Node::SharedBuffer::~SharedBuffer()
+{
+    utils::free_memory(m_allocator_id,m_data);
+    utils::memory_stats_free(m_data_size,m_tag_id);
+#ifdef CONDUIT_USE_CXX11
+    m_num_live--;
+#else
+    atomic_add(&m_num_live,-1);
+#endif
+}
+
+//---------------------------------------------------------------------------//
 void
-Node::set_path_external(const std::string &path,
-                        const std::vector<unsigned int> &data)
+Node::SharedBuffer::add_ref()
 {
-    fetch(path).set_external(data);
+#ifdef CONDUIT_USE_CXX11
+    m_use_count++;
+#else
+    atomic_add(&m_use_count,1);
+#endif
 }
-//-----------------------------------------------------------------------------
-#endif // end use int check
-//-----------------------------------------------------------------------------
 
-//-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_LONG
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set_path_external(const std::string &path,
-                        const std::vector<long> &data)
+Node::SharedBuffer::release()
 {
-    fetch(path).set_external(data);
+#ifdef CONDUIT_USE_CXX11
+    long count = --m_use_count;
+#else
+    long count = atomic_add(&m_use_count,-1);
+#endif
+    if(count == 0)
+    {
+        delete this;
+    }
 }
 
-//-----------------------------------------------------------------------------
-void
-Node::set_path_external(const std::string &path,
-                        const std::vector<unsigned long> &data)
+//---------------------------------------------------------------------------//
+index_t
+Node::SharedBuffer::use_count() const
 {
-    fetch(path).set_external(data);
+#ifdef CONDUIT_USE_CXX11
+    return (index_t)m_use_count.load();
+#else
+    return (index_t)atomic_add(const_cast<volatile long*>(&m_use_count),0);
+#endif
 }
-//-----------------------------------------------------------------------------
-#endif // end use long check
-//-----------------------------------------------------------------------------
 
-//-----------------------------------------------------------------------------
-#if defined(CONDUIT_HAS_LONG_LONG) && !defined(CONDUIT_USE_LONG_LONG)
-//-----------------------------------------------------------------------------
-void
-Node::set_path_external(const std::string &path,
-                        const std::vector<long long> &data)
+//---------------------------------------------------------------------------//
+index_t
+Node::SharedBuffer::num_live()
 {
-    fetch(path).set_external(data);
+#ifdef CONDUIT_USE_CXX11
+    return (index_t)m_num_live.load();
+#else
+    return (index_t)atomic_add(&m_num_live,0);
+#endif
 }
 
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set_path_external(const std::string &path,
-                        const std::vector<unsigned long long> &data)
+Node::set_shared_node(const Node &node)
 {
-    fetch(path).set_external(data);
+    // build the result in a temp node: node may be part of this node's 
+    // tree, the temp's reference keeps the buffer alive when we reset
+    Node n_tmp;
+    n_tmp.set_allocator(m_allocator_id);
+
+    SharedBuffer *buffer = node.share_data();
+    if(buffer != NULL)
+    {
+        buffer->add_ref();
+        n_tmp.set_external_node(node);
+        n_tmp.m_shared = buffer;
+    }
+    else
+    {
+        // no single buffer holds node's data, copy it into a buffer 
+        // that can be shared from now on
+        node.compact_to(n_tmp);
+        n_tmp.share_data();
+    }
+
+    move(n_tmp);
 }
-//-----------------------------------------------------------------------------
-#endif // end use long long check
-//-----------------------------------------------------------------------------
 
-//-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_FLOAT
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set_path_external(const std::string &path,
-                        const std::vector<float> &data)
+Node::set_shared(const Node &node)
 {
-    fetch(path).set_external(data);
+    set_shared_node(node);
 }
-//-----------------------------------------------------------------------------
-#endif // end use float check
-//-----------------------------------------------------------------------------
 
-//-----------------------------------------------------------------------------
-#ifndef CONDUIT_USE_DOUBLE
-//-----------------------------------------------------------------------------
+//---------------------------------------------------------------------------//
 void
-Node::set_path_external(const std::string &path,
-                        const std::vector<double> &data)
+Node::unshare()
 {
-    fetch(path).set_external(data);
+    index_t dtype_id = dtype().id();
+    if(dtype_id == DataType::OBJECT_ID ||
+       dtype_id == DataType::LIST_ID)
+    {
+        for(size_t i=0; i < m_children.size(); i++)
+        {
+            m_children[i]->unshare();
+        }
+    }
+    else
+    {
+        unshare_leaf();
+    }
 }
-//-----------------------------------------------------------------------------
-#endif // end use double check
-//-----------------------------------------------------------------------------
-
-
 
 //-----------------------------------------------------------------------------
 //
-// -- end definition of Node set_path_external methods --
+// -- end definition of Node set_shared methods --
 //
 //-----------------------------------------------------------------------------
 
@@ -7554,6 +8863,202 @@ Node::operator=(const std::vector<double> &data)
 // -- serialization methods ---
 //-----------------------------------------------------------------------------
 
+//-----------------------------------------------------------------------------
+// Node::IOVecWriter helper class
+//-----------------------------------------------------------------------------
+// This private class writes the blocks listed by Node::serialize_iovecs()
+// in order, to a file descriptor (with writev) or to a stream. Strided 
+// blocks are gathered into a fixed size bounce buffer, so the extra memory
+// used doesn't depend on the size of the data.
+//-----------------------------------------------------------------------------
+class Node::IOVecWriter
+{
+  public:
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+      IOVecWriter(int fd,
+                  const std::string &path);
+#endif
+      IOVecWriter(std::ostream &os);
+
+      //----------------------------------------------------------------------
+      void  write(const std::vector<IOVec> &iovecs);
+
+  private:
+      //----------------------------------------------------------------------
+      // queues a contiguous range for the next flush
+      void  add(const void *data,
+                index_t nbytes);
+
+      //----------------------------------------------------------------------
+      // writes the queued ranges, after which the bounce buffer is free
+      void  flush();
+
+      static const index_t BOUNCE_BUFFER_BYTES = 1024 * 1024;
+      static const size_t  MAX_BATCH_SIZE      = 512;
+
+      int                m_fd;
+      std::string        m_path;
+      std::ostream      *m_os;
+
+      std::vector<uint8> m_bounce;
+      index_t            m_bounce_used;
+
+      std::vector<const uint8*> m_batch_data;
+      std::vector<index_t>      m_batch_bytes;
+};
+
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+//-----------------------------------------------------------------------------
+Node::IOVecWriter::IOVecWriter(int fd,
+                               const std::string &path)
+: m_fd(fd),
+  m_path(path),
+  m_os(NULL),
+  m_bounce(),
+  m_bounce_used(0),
+  m_batch_data(),
+  m_batch_bytes()
+{
+    // empty
+}
+#endif
+
+//-----------------------------------------------------------------------------
+Node::IOVecWriter::IOVecWriter(std::ostream &os)
+: m_fd(-1),
+  m_path(),
+  m_os(&os),
+  m_bounce(),
+  m_bounce_used(0),
+  m_batch_data(),
+  m_batch_bytes()
+{
+    // empty
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::IOVecWriter::write(const std::vector<IOVec> &iovecs)
+{
+    for(size_t i = 0; i < iovecs.size(); i++)
+    {
+        const IOVec &iov = iovecs[i];
+        if(iov.is_contiguous())
+        {
+            add(iov.data,iov.number_of_bytes());
+            continue;
+        }
+
+        if(m_bounce.empty())
+        {
+            m_bounce.resize((size_t)BOUNCE_BUFFER_BYTES);
+        }
+
+        // gather in pieces that fit in what is left of the bounce buffer
+        const uint8 *src = (const uint8*)iov.data;
+        index_t num_left = iov.num_elements;
+        while(num_left > 0)
+        {
+            index_t num_fit = (BOUNCE_BUFFER_BYTES - m_bounce_used) /
+                              iov.element_bytes;
+            if(num_fit == 0)
+            {
+                flush();
+                continue;
+            }
+            index_t n = std::min(num_fit,num_left);
+            uint8 *dest = &m_bounce[(size_t)m_bounce_used];
+            kernels::gather(dest,
+                            src,
+                            iov.stride,
+                            n,
+                            iov.element_bytes);
+            m_bounce_used += n * iov.element_bytes;
+            add(dest,n * iov.element_bytes);
+            src      += n * iov.stride;
+            num_left -= n;
+        }
+    }
+    flush();
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::IOVecWriter::add(const void *data,
+                       index_t nbytes)
+{
+    if(nbytes <= 0)
+    {
+        return;
+    }
+    m_batch_data.push_back((const uint8*)data);
+    m_batch_bytes.push_back(nbytes);
+    if(m_batch_data.size() >= MAX_BATCH_SIZE)
+    {
+        flush();
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::IOVecWriter::flush()
+{
+    if(m_os != NULL)
+    {
+        for(size_t i = 0; i < m_batch_data.size(); i++)
+        {
+            m_os->write((const char*)m_batch_data[i],
+                        (std::streamsize)m_batch_bytes[i]);
+        }
+    }
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    else
+    {
+        size_t num_iovs = m_batch_data.size();
+        std::vector<struct iovec> iovs(num_iovs);
+        for(size_t i = 0; i < num_iovs; i++)
+        {
+            iovs[i].iov_base = (void*)m_batch_data[i];
+            iovs[i].iov_len  = (size_t)m_batch_bytes[i];
+        }
+
+        // writev may write less than asked, continue from where it stopped
+        size_t curr = 0;
+        while(curr < num_iovs)
+        {
+            int count = (int)std::min(num_iovs - curr,(size_t)IOV_MAX);
+            ssize_t nwritten = ::writev(m_fd,&iovs[curr],count);
+            if(nwritten < 0)
+            {
+                if(errno == EINTR)
+                {
+                    continue;
+                }
+                CONDUIT_ERROR("<Node::serialize> failed to write file: "
+                              << "\"" << m_path << "\" ("
+                              << strerror(errno) << ")");
+            }
+
+            size_t nleft = (size_t)nwritten;
+            while(curr < num_iovs && nleft >= iovs[curr].iov_len)
+            {
+                nleft -= iovs[curr].iov_len;
+                curr++;
+            }
+            if(curr < num_iovs)
+            {
+                iovs[curr].iov_base = (uint8*)iovs[curr].iov_base + nleft;
+                iovs[curr].iov_len -= nleft;
+            }
+        }
+    }
+#endif
+
+    m_batch_data.clear();
+    m_batch_bytes.clear();
+    m_bounce_used = 0;
+}
+
 //---------------------------------------------------------------------------//
 void
 Node::serialize(std::vector<uint8> &data) const
@@ -7566,6 +9071,39 @@ Node::serialize(std::vector<uint8> &data) const
 void
 Node::serialize(const std::string &stream_path) const
 {
+    CONDUIT_TRACE_SCOPE("conduit::Node::serialize");
+    CONDUIT_TRACE_BYTES(total_bytes_compact());
+
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    int fd = ::open(stream_path.c_str(),
+                    (O_WRONLY | O_CREAT | O_TRUNC),
+                    (S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP | 
+                     S_IROTH | S_IWOTH));
+    if(fd == -1)
+    {
+        CONDUIT_ERROR("<Node::serialize> failed to open file: "
+                     << "\"" << stream_path << "\"");
+    }
+
+    std::vector<IOVec> iovecs;
+    serialize_iovecs(iovecs);
+    try
+    {
+        IOVecWriter writer(fd,stream_path);
+        writer.write(iovecs);
+    }
+    catch(conduit::Error &)
+    {
+        ::close(fd);
+        throw;
+    }
+
+    if(::close(fd) == -1)
+    {
+        CONDUIT_ERROR("<Node::serialize> failed to close file: "
+                     << "\"" << stream_path << "\"");
+    }
+#else
     std::ofstream ofs;
     ofs.open(stream_path.c_str(), std::ios_base::binary);
     if(!ofs.is_open())
@@ -7575,6 +9113,7 @@ Node::serialize(const std::string &stream_path) const
     }
     serialize(ofs);
     ofs.close();
+#endif
 }
 
 
@@ -7582,36 +9121,18 @@ Node::serialize(const std::string &stream_path) const
 void
 Node::serialize(std::ofstream &ofs) const
 {
-    index_t dtype_id = dtype().id();
-    if( dtype_id == DataType::OBJECT_ID ||
-        dtype_id == DataType::LIST_ID)
-    {
-        std::vector<Node*>::const_iterator itr;
-        for(itr = m_children.begin(); itr < m_children.end(); ++itr)
-        {
-            (*itr)->serialize(ofs);
-        }
-    }
-    else if( dtype_id != DataType::EMPTY_ID)
-    {
-        if(is_compact())
-        {
-            // ser as is. This copies stride * num_ele bytes
-            {
-                ofs.write((const char*)element_ptr(0),
-                          total_strided_bytes());
-            }
-        }
-        else
-        {
-            // copy all elements 
-            size_t c_num_bytes = (size_t) total_bytes_compact();
-            uint8 *buffer = new uint8[c_num_bytes];
-            compact_elements_to(buffer);
-            ofs.write((const char*)buffer,c_num_bytes);
-            delete [] buffer;
-        }
-    }
+    std::vector<IOVec> iovecs;
+    serialize_iovecs(iovecs);
+    IOVecWriter writer(ofs);
+    writer.write(iovecs);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::serialize_iovecs(std::vector<IOVec> &iovecs) const
+{
+    iovecs.clear();
+    serialize_iovecs_to(iovecs);
 }
 
 //-----------------------------------------------------------------------------
@@ -7621,31 +9142,114 @@ Node::serialize(std::ofstream &ofs) const
 //---------------------------------------------------------------------------//
 void
 Node::compact_to(Node &n_dest) const
+{
+    CONDUIT_TRACE_SCOPE("conduit::Node::compact_to");
+    CONDUIT_TRACE_BYTES(total_bytes_compact());
+
+    StridedCopies copies;
+    compact_to(n_dest,copies);
+    copies.execute();
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::compact_to(Node &n_dest,
+                 StridedCopies &copies) const
 {
     n_dest.reset();
     index_t c_size = total_bytes_compact();
 
-    // avoid allocation for zero-bytes cases
-    if(c_size > 0)
+    // avoid allocation for zero-bytes cases
+    if(c_size > 0)
+    {
+        n_dest.allocate(c_size);
+    }
+
+    m_schema->compact_to(*n_dest.schema_ptr());
+    uint8 *n_dest_data = (uint8*)n_dest.m_data;
+    compact_to(n_dest_data,0,copies);
+    // need node structure
+    walk_schema(&n_dest,n_dest.m_schema,n_dest_data);
+}
+
+//-----------------------------------------------------------------------------
+// -- update methods ---
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+bool
+Node::update_contiguous(const Node &n_src,
+                        StridedCopies &copies)
+{
+    // equal schemas give the same leaves at the same offsets, most 
+    // unequal schemas are rejected by their (cached) fingerprints
+    // without walking the trees
+    if(!m_schema->equals(*n_src.m_schema))
+    {
+        return false;
+    }
+
+    // fingerprints don't cover strides, check both layouts
+    index_t nbytes = 0;
+    index_t dest_nbytes = 0;
+    if(!n_src.m_schema->is_compact_layout(nbytes) ||
+       !m_schema->is_compact_layout(dest_nbytes) ||
+       nbytes != dest_nbytes || nbytes == 0)
+    {
+        return false;
+    }
+
+    const void *src_ptr = n_src.contiguous_data_ptr();
+    void *dest_ptr = contiguous_data_ptr();
+    if(src_ptr == NULL || dest_ptr == NULL)
+    {
+        return false;
+    }
+
+    // if this node owns a buffer, only write inside it
+    // (set_node can't reuse memory it doesn't own)
+    if(m_alloced && 
+       ( (uint8*)dest_ptr < (uint8*)m_data ||
+         (uint8*)dest_ptr + nbytes > (uint8*)m_data + m_data_size) )
+    {
+        return false;
+    }
+
+    // writes to a buffer shared with other nodes are copy-on-write,
+    // leave them to the leaf by leaf update
+    if(in_used_shared_buffer((const uint8*)dest_ptr,nbytes))
     {
-        n_dest.allocate(c_size);
+        return false;
     }
 
-    m_schema->compact_to(*n_dest.schema_ptr());
-    uint8 *n_dest_data = (uint8*)n_dest.m_data;
-    compact_to(n_dest_data,0);
-    // need node structure
-    walk_schema(&n_dest,n_dest.m_schema,n_dest_data);
+    if(dest_ptr != src_ptr)
+    {
+        copies.add(dest_ptr,1,src_ptr,1,nbytes,1);
+    }
+    return true;
 }
 
-//-----------------------------------------------------------------------------
-// -- update methods ---
-//-----------------------------------------------------------------------------
-
 //---------------------------------------------------------------------------//
 void
 Node::update(const Node &n_src)
 {
+    // set up the structure, then copy the leaves
+    StridedCopies copies;
+    update(n_src,copies);
+    copies.execute();
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::update(const Node &n_src,
+             StridedCopies &copies)
+{
+    // identical compact layouts are copied in one shot
+    if(update_contiguous(n_src,copies))
+    {
+        return;
+    }
+
     // walk src and add it contents to this node
     /// TODO:
     /// arrays and non empty leaves will simply overwrite the current
@@ -7661,7 +9265,7 @@ Node::update(const Node &n_src)
             std::string ent_name = *itr;
             // note: this (add_child) will add or access existing child
             // ness b/c of keys with embedded slashes
-            add_child(ent_name).update(n_src.child(ent_name));
+            add_child(ent_name).update(n_src.child(ent_name),copies);
         }
     }
     else if( dtype_id == DataType::LIST_ID)
@@ -7677,7 +9281,7 @@ Node::update(const Node &n_src)
                 (idx < num_children && idx < src_num_children); 
                 idx++)
             {
-                child(idx).update(n_src.child(idx));
+                child(idx).update(n_src.child(idx),copies);
                 src_idx++;
             }
         }
@@ -7685,7 +9289,7 @@ Node::update(const Node &n_src)
         // than the current node, use append to capture the nodes
         for(index_t idx = src_idx; idx < src_num_children;idx++)
         {
-            append().update(n_src.child(idx));
+            append().update(n_src.child(idx),copies);
         }
     }
     else if(dtype_id != DataType::EMPTY_ID) // TODO: Empty nodes not propagated?
@@ -7700,18 +9304,17 @@ Node::update(const Node &n_src)
                  (this->dtype().number_of_elements() >=  
                    n_src.dtype().number_of_elements())) 
         {
-            for(index_t idx = 0;
-                idx < n_src.dtype().number_of_elements();
-                idx++)
-            {
-                memcpy(element_ptr(idx),
-                       n_src.element_ptr(idx), 
-                       (size_t)this->dtype().element_bytes());
-            }
+            unshare_leaf();
+            copies.add(element_ptr(0),
+                       this->dtype().stride(),
+                       n_src.element_ptr(0),
+                       n_src.dtype().stride(),
+                       n_src.dtype().number_of_elements(),
+                       this->dtype().element_bytes());
         }
         else // not compatible
         {
-            n_src.compact_to(*this);
+            n_src.compact_to(*this,copies);
         }
     }
 }
@@ -7764,14 +9367,13 @@ Node::update_compatible(const Node &n_src)
                  (this->dtype().number_of_elements() >=  
                    n_src.dtype().number_of_elements())) 
         {
-            for(index_t idx = 0;
-                idx < n_src.dtype().number_of_elements();
-                idx++)
-            {
-                memcpy(element_ptr(idx),
-                       n_src.element_ptr(idx), 
-                       (size_t)this->dtype().element_bytes());
-            }
+            unshare_leaf();
+            kernels::strided_copy(element_ptr(0),
+                                  this->dtype().stride(),
+                                  n_src.element_ptr(0),
+                                  n_src.dtype().stride(),
+                                  n_src.dtype().number_of_elements(),
+                                  this->dtype().element_bytes());
         }
     }
 }
@@ -7865,27 +9467,38 @@ Node::endian_swap(index_t endianness)
         
         if(src_endian != dest_endian)
         {
-            if(ele_bytes == 2)
-            {
-                for(index_t i=0;i<num_ele;i++)
-                    Endianness::swap16(element_ptr(i));
-            }
-            else if(ele_bytes == 4)
-            {
-                for(index_t i=0;i<num_ele;i++)
-                    Endianness::swap32(element_ptr(i));
-            }
-            else if(ele_bytes == 8)
-            {
-                for(index_t i=0;i<num_ele;i++)
-                    Endianness::swap64(element_ptr(i));
-            }
+            unshare_leaf();
+            kernels::byte_swap(element_ptr(0),
+                               dtype().stride(),
+                               num_ele,
+                               ele_bytes);
         }
 
         m_schema->dtype().set_endianness(dest_endian);
     }
 }
 
+//---------------------------------------------------------------------------//
+void
+Node::endian_swap_to(Node &n_dest,
+                     index_t endianness) const
+{
+    n_dest.reset();
+    index_t c_size = total_bytes_compact();
+
+    // avoid allocation for zero-bytes cases
+    if(c_size > 0)
+    {
+        n_dest.allocate(c_size);
+    }
+
+    m_schema->compact_to(*n_dest.schema_ptr());
+    uint8 *n_dest_data = (uint8*)n_dest.m_data;
+    endian_swap_to(n_dest_data,0,endianness,*n_dest.schema_ptr());
+    // need node structure
+    walk_schema(&n_dest,n_dest.m_schema,n_dest_data);
+}
+
 //-----------------------------------------------------------------------------
 // -- leaf coercion methods ---
 //-----------------------------------------------------------------------------
@@ -10393,6 +12006,141 @@ Node::to_data_type(index_t dtype_id, Node &res) const
     }
 }
 
+//---------------------------------------------------------------------------//
+bool
+Node::to_data_type_if_needed(index_t dtype_id, Node &res) const
+{
+    if(dtype().id() == dtype_id && dtype().is_number())
+    {
+        res.set_external(dtype(), m_data);
+        return false;
+    }
+
+    to_data_type(dtype_id, res);
+    return true;
+}
+
+//-----------------------------------------------------------------------------
+// -- reductions --
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+template <typename T>
+static void
+summarize_array(const DataArray<T> &values,
+                Node &res)
+{
+    res["count"]     = values.number_of_elements();
+    res["min"]       = values.min();
+    res["max"]       = values.max();
+    res["sum"]       = values.sum();
+    res["mean"]      = values.mean();
+    res["argmin"]    = values.argmin();
+    res["argmax"]    = values.argmax();
+    res["nonfinite"] = values.count_nonfinite();
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::summarize(Node &res) const
+{
+    res.reset();
+
+    index_t dtype_id = dtype().id();
+    if(dtype_id == DataType::OBJECT_ID)
+    {
+        index_t num_children = number_of_children();
+        for(index_t i=0; i < num_children; i++)
+        {
+            const Node &chld = child(i);
+            if(chld.dtype().is_number() ||
+               chld.dtype().is_object() ||
+               chld.dtype().is_list())
+            {
+                chld.summarize(res.add_child(child_names()[(size_t)i]));
+            }
+        }
+    }
+    else if(dtype_id == DataType::LIST_ID)
+    {
+        index_t num_children = number_of_children();
+        for(index_t i=0; i < num_children; i++)
+        {
+            const Node &chld = child(i);
+            if(chld.dtype().is_number() ||
+               chld.dtype().is_object() ||
+               chld.dtype().is_list())
+            {
+                chld.summarize(res.append());
+            }
+        }
+    }
+    else
+    {
+        switch(dtype_id)
+        {
+            /* ints */
+            case DataType::INT8_ID:
+            {
+                summarize_array(as_int8_array(),res);
+                break;
+            }
+            case DataType::INT16_ID: 
+            {
+                summarize_array(as_int16_array(),res);
+                break;
+            }
+            case DataType::INT32_ID:
+            {
+                summarize_array(as_int32_array(),res);
+                break;
+            }
+            case DataType::INT64_ID:
+            {
+                summarize_array(as_int64_array(),res);
+                break;
+            }
+            /* uints */
+            case DataType::UINT8_ID:
+            {
+                summarize_array(as_uint8_array(),res);
+                break;
+            }
+            case DataType::UINT16_ID: 
+            {
+                summarize_array(as_uint16_array(),res);
+                break;
+            }
+            case DataType::UINT32_ID:
+            {
+                summarize_array(as_uint32_array(),res);
+                break;
+            }
+            case DataType::UINT64_ID:
+            {
+                summarize_array(as_uint64_array(),res);
+                break;
+            }
+            /* floats */
+            case DataType::FLOAT32_ID:
+            {
+                summarize_array(as_float32_array(),res);
+                break;
+            }
+            case DataType::FLOAT64_ID: 
+            {
+                summarize_array(as_float64_array(),res);
+                break;
+            }
+            default:
+            {
+                // non-numeric leaves have no summary
+                break;
+            }
+        }
+    }
+}
+
 //-----------------------------------------------------------------------------
 // -- Value Helper class ---
 //-----------------------------------------------------------------------------
@@ -11515,54 +13263,69 @@ Node::to_json_generic(std::ostream &os,
                       const std::string &pad,
                       const std::string &eoe) const
 {
-    std::ios_base::fmtflags prev_stream_flags(os.flags());
-    os.precision(15);
+    utils::TextWriter w(os);
+    to_json_generic(w,detailed,indent,depth,pad,eoe);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::to_json_generic(utils::TextWriter &w,
+                      bool detailed, 
+                      index_t indent, 
+                      index_t depth,
+                      const std::string &pad,
+                      const std::string &eoe) const
+{
     if(dtype().id() == DataType::OBJECT_ID)
     {
-        os << eoe;
-        utils::indent(os,indent,depth,pad);
-        os << "{" << eoe;
+        w.write(eoe);
+        w.write_indent(indent,depth,pad);
+        w.write('{');
+        w.write(eoe);
     
         size_t nchildren = m_children.size();
         for(size_t i=0; i <  nchildren;i++)
         {
-            utils::indent(os,indent,depth+1,pad);
-            os << "\""<< m_schema->object_order()[i] << "\": ";
-            m_children[i]->to_json_generic(os,
+            w.write_indent(indent,depth+1,pad);
+            w.write('"');
+            w.write(m_schema->object_order()[i]);
+            w.write("\": ",3);
+            m_children[i]->to_json_generic(w,
                                            detailed,
                                            indent,
                                            depth+1,
                                            pad,
                                            eoe);
             if(i < nchildren-1)
-                os << ",";
-            os << eoe;
+                w.write(',');
+            w.write(eoe);
         }
-        utils::indent(os,indent,depth,pad);
-        os << "}";
+        w.write_indent(indent,depth,pad);
+        w.write('}');
     }
     else if(dtype().id() == DataType::LIST_ID)
     {
-        os << eoe;
-        utils::indent(os,indent,depth,pad);
-        os << "[" << eoe;
+        w.write(eoe);
+        w.write_indent(indent,depth,pad);
+        w.write('[');
+        w.write(eoe);
         
         size_t nchildren = m_children.size();
         for(size_t i=0; i < nchildren;i++)
         {
-            utils::indent(os,indent,depth+1,pad);
-            m_children[i]->to_json_generic(os,
+            w.write_indent(indent,depth+1,pad);
+            m_children[i]->to_json_generic(w,
                                            detailed,
                                            indent,
                                            depth+1,
                                            pad,
                                            eoe);
             if(i < nchildren-1)
-                os << ",";
-            os << eoe;
+                w.write(',');
+            w.write(eoe);
         }
-        utils::indent(os,indent,depth,pad);
-        os << "]";
+        w.write_indent(indent,depth,pad);
+        w.write(']');
     }
     else // assume leaf data type
     {
@@ -11577,54 +13340,54 @@ Node::to_json_generic(std::ostream &os,
                                 "}",
                                 dtype_open,
                                 dtype_rest);
-            os<< dtype_open;
-            os << ", \"value\": ";
+            w.write(dtype_open);
+            w.write(", \"value\": ");
         }
 
         switch(dtype().id())
         {
             // ints 
             case DataType::INT8_ID:
-                as_int8_array().to_json_stream(os);
+                as_int8_array().to_json_stream(w);
                 break;
             case DataType::INT16_ID:
-                as_int16_array().to_json_stream(os);
+                as_int16_array().to_json_stream(w);
                 break;
             case DataType::INT32_ID:
-                as_int32_array().to_json_stream(os);
+                as_int32_array().to_json_stream(w);
                 break;
             case DataType::INT64_ID:
-                as_int64_array().to_json_stream(os);
+                as_int64_array().to_json_stream(w);
                 break;
             // uints 
             case DataType::UINT8_ID:
-                as_uint8_array().to_json_stream(os);
+                as_uint8_array().to_json_stream(w);
                 break;
             case DataType::UINT16_ID: 
-                as_uint16_array().to_json_stream(os);
+                as_uint16_array().to_json_stream(w);
                 break;
             case DataType::UINT32_ID:
-                as_uint32_array().to_json_stream(os);
+                as_uint32_array().to_json_stream(w);
                 break;
             case DataType::UINT64_ID:
-                as_uint64_array().to_json_stream(os);
+                as_uint64_array().to_json_stream(w);
                 break;
             // floats 
             case DataType::FLOAT32_ID:
-                as_float32_array().to_json_stream(os);
+                as_float32_array().to_json_stream(w);
                 break;
             case DataType::FLOAT64_ID:
-                as_float64_array().to_json_stream(os);
+                as_float64_array().to_json_stream(w);
                 break;
             // char8_str
             case DataType::CHAR8_STR_ID: 
-                os << "\"" 
-                   << utils::escape_special_chars(as_string())
-                   << "\""; 
+                w.write('"');
+                w.write(utils::escape_special_chars(as_string()));
+                w.write('"');
                 break;
             // empty
             case DataType::EMPTY_ID: 
-                os << "null";
+                w.write("null");
                 break;
 
         }
@@ -11632,11 +13395,9 @@ Node::to_json_generic(std::ostream &os,
         if(detailed)
         {
             // complete json entry 
-            os << "}";
+            w.write('}');
         }
     }  
-    
-    os.flags(prev_stream_flags);
 }
 
 //---------------------------------------------------------------------------//
@@ -11760,26 +13521,11 @@ Node::to_base64_json(std::ostream &os,
                      const std::string &pad,
                      const std::string &eoe) const
 {
-    std::ios_base::fmtflags prev_stream_flags(os.flags());
-    os.precision(15);
-        
-    // we need compact data
-    // TODO check if already compact + contig
-    Node n;
-    compact_to(n);
-    
-    // use libb64 to encode the data
-    index_t nbytes = n.schema().spanned_bytes();
-    index_t enc_buff_size =  utils::base64_encode_buffer_size(nbytes);
-    Node bb64_data;
-    bb64_data.set(DataType::char8_str(enc_buff_size));
-    
-    const char *src_ptr = (const char*)n.data_ptr();
-    char *dest_ptr       = (char*)bb64_data.data_ptr();
-    memset(dest_ptr,0,(size_t)enc_buff_size);
+    // the data is streamed in compact order, only the schema
+    // needs to be compacted up front
+    Schema s_compact;
+    m_schema->compact_to(s_compact);
 
-    utils::base64_encode(src_ptr,nbytes,dest_ptr);
-    
     // create the resulting json
     
     os << eoe;
@@ -11788,7 +13534,7 @@ Node::to_base64_json(std::ostream &os,
     utils::indent(os,indent,depth+1,pad);
     os << "\"schema\": ";
 
-    n.schema().to_json_stream(os,indent,depth+1,pad,eoe);
+    s_compact.to_json_stream(os,indent,depth+1,pad,eoe);
 
     os  << "," << eoe;
     
@@ -11797,15 +13543,15 @@ Node::to_base64_json(std::ostream &os,
     utils::indent(os,indent,depth+1,pad);
     os << "{" << eoe;
     utils::indent(os,indent,depth+2,pad);
-    os << "\"base64\": ";
-    bb64_data.to_pure_json(os,0,0,"","");
-    os << eoe;
+    os << "\"base64\": \"";
+    utils::Base64Encoder enc(os);
+    base64_encode_to(enc);
+    enc.finish();
+    os << "\"" << eoe;
     utils::indent(os,indent,depth+1,pad);
     os << "}" << eoe;
     utils::indent(os,indent,depth,pad);
     os << "}";
-    
-    os.flags(prev_stream_flags);
 }
 
 //---------------------------------------------------------------------------//
@@ -11857,17 +13603,29 @@ Node::to_yaml_generic(std::ostream &os,
                       const std::string &pad,
                       const std::string &eoe) const
 {
-    std::ios_base::fmtflags prev_stream_flags(os.flags());
-    os.precision(15);
+    utils::TextWriter w(os);
+    to_yaml_generic(w,detailed,indent,depth,pad,eoe);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::to_yaml_generic(utils::TextWriter &w,
+                      bool  detailed,
+                      index_t indent,
+                      index_t depth,
+                      const std::string &pad,
+                      const std::string &eoe) const
+{
     if(dtype().id() == DataType::OBJECT_ID)
     {
-        os << eoe;
+        w.write(eoe);
         size_t nchildren = m_children.size();
         for(size_t i=0; i <  nchildren;i++)
         {
-            utils::indent(os,indent,depth,pad);
-            os << m_schema->object_order()[i] << ": ";
-            m_children[i]->to_yaml_generic(os,
+            w.write_indent(indent,depth,pad);
+            w.write(m_schema->object_order()[i]);
+            w.write(": ",2);
+            m_children[i]->to_yaml_generic(w,
                                            detailed,
                                            indent,
                                            depth+1,
@@ -11876,18 +13634,18 @@ Node::to_yaml_generic(std::ostream &os,
 
             // if the child is a leaf, we need eoe
             if(m_children[i]->number_of_children() == 0)
-                os << eoe;
+                w.write(eoe);
         }
     }
     else if(dtype().id() == DataType::LIST_ID)
     {
-        os << eoe;
+        w.write(eoe);
         size_t nchildren = m_children.size();
         for(size_t i=0; i < nchildren;i++)
         {
-            utils::indent(os,indent,depth,pad);
-            os << "- ";
-            m_children[i]->to_yaml_generic(os,
+            w.write_indent(indent,depth,pad);
+            w.write("- ",2);
+            m_children[i]->to_yaml_generic(w,
                                            detailed,
                                            indent,
                                            depth+1,
@@ -11896,7 +13654,7 @@ Node::to_yaml_generic(std::ostream &os,
 
             // if the child is a leaf, we need eoe
             if(m_children[i]->number_of_children() == 0)
-                os << eoe;
+                w.write(eoe);
         }
     }
     else // assume leaf data type
@@ -11905,50 +13663,49 @@ Node::to_yaml_generic(std::ostream &os,
         {
             // ints 
             case DataType::INT8_ID:
-                as_int8_array().to_json_stream(os);
+                as_int8_array().to_json_stream(w);
                 break;
             case DataType::INT16_ID:
-                as_int16_array().to_json_stream(os);
+                as_int16_array().to_json_stream(w);
                 break;
             case DataType::INT32_ID:
-                as_int32_array().to_json_stream(os);
+                as_int32_array().to_json_stream(w);
                 break;
             case DataType::INT64_ID:
-                as_int64_array().to_json_stream(os);
+                as_int64_array().to_json_stream(w);
                 break;
             // uints 
             case DataType::UINT8_ID:
-                as_uint8_array().to_json_stream(os);
+                as_uint8_array().to_json_stream(w);
                 break;
             case DataType::UINT16_ID: 
-                as_uint16_array().to_json_stream(os);
+                as_uint16_array().to_json_stream(w);
                 break;
             case DataType::UINT32_ID:
-                as_uint32_array().to_json_stream(os);
+                as_uint32_array().to_json_stream(w);
                 break;
             case DataType::UINT64_ID:
-                as_uint64_array().to_json_stream(os);
+                as_uint64_array().to_json_stream(w);
                 break;
             // floats 
             case DataType::FLOAT32_ID:
-                as_float32_array().to_json_stream(os);
+                as_float32_array().to_json_stream(w);
                 break;
             case DataType::FLOAT64_ID:
-                as_float64_array().to_json_stream(os);
+                as_float64_array().to_json_stream(w);
                 break;
             // char8_str
             case DataType::CHAR8_STR_ID: 
-                os << "\"" 
-                   << utils::escape_special_chars(as_string())
-                   << "\""; 
+                w.write('"');
+                w.write(utils::escape_special_chars(as_string()));
+                w.write('"');
                 break;
             // empty
             case DataType::EMPTY_ID: 
                 break;
+
         }
     }
-
-    os.flags(prev_stream_flags);
 }
 
 //---------------------------------------------------------------------------//
@@ -12022,6 +13779,32 @@ Node::info(Node &res) const
     res["total_strided_bytes"]   = total_strided_bytes();
 }
 
+//---------------------------------------------------------------------------//
+index_t
+Node::shared_use_count() const
+{
+    if(SharedBuffer::num_live() == 0)
+    {
+        return 0;
+    }
+
+    uint8  *start  = NULL;
+    index_t nbytes = 0;
+    data_extent(start,nbytes);
+    if(start == NULL)
+    {
+        return 0;
+    }
+
+    const Node *owner = data_owner(start,nbytes);
+    if(owner == NULL || owner->m_shared == NULL)
+    {
+        return 0;
+    }
+
+    return owner->m_shared->use_count();
+}
+
 //---------------------------------------------------------------------------//
 Node
 Node::info()const
@@ -12032,6 +13815,82 @@ Node::info()const
     return res;
 }
 
+//---------------------------------------------------------------------------//
+uint64
+Node::hash() const
+{
+    return hash(Node());
+}
+
+//---------------------------------------------------------------------------//
+uint64
+Node::hash(const Node &options) const
+{
+    LeafHashes hashes(options,"hash");
+    hashes.add(*this);
+    hashes.execute();
+    return hashes.tree_hash(*this);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::leaf_hashes(Node &res) const
+{
+    leaf_hashes(res,Node());
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::leaf_hashes(Node &res,
+                  const Node &options) const
+{
+    LeafHashes hashes(options,"leaf_hashes");
+    hashes.add(*this);
+    hashes.execute();
+    hashes.leaf_hashes(*this,res);
+}
+
+//---------------------------------------------------------------------------//
+std::string
+Node::checksum(const std::string &algorithm) const
+{
+    Node opts;
+    opts["algorithm"] = algorithm;
+    opts["schema"] = "false";
+
+    std::ostringstream oss;
+    oss << algorithm << ":" << std::hex << hash(opts);
+    return oss.str();
+}
+
+//---------------------------------------------------------------------------//
+bool
+Node::verify_checksum(const std::string &checksum) const
+{
+    size_t sep = checksum.find(':');
+    uint64 expected = 0;
+    bool ok = (sep != std::string::npos);
+
+    if(ok)
+    {
+        std::istringstream iss(checksum.substr(sep+1));
+        iss >> std::hex >> expected;
+        ok = !iss.fail() && iss.eof();
+    }
+
+    if(!ok)
+    {
+        CONDUIT_ERROR("<Node::verify_checksum> invalid checksum: \""
+                      << checksum << "\""
+                      << " (expected \"<algorithm>:<hex value>\")");
+    }
+
+    Node opts;
+    opts["algorithm"] = checksum.substr(0,sep);
+    opts["schema"] = "false";
+    return hash(opts) == expected;
+}
+
 //-----------------------------------------------------------------------------
 // -- stdout print methods ---
 //-----------------------------------------------------------------------------
@@ -12091,6 +13950,7 @@ Node::add_child(const std::string &name)
     Schema &child_schema = m_schema->add_child(name);
     Schema *child_ptr = &child_schema; 
     Node *child_node = new Node();
+    child_node->set_allocator(m_allocator_id);
     child_node->set_schema_ptr(child_ptr);
     child_node->m_parent = this;
     m_children.push_back(child_node);
@@ -12123,114 +13983,102 @@ Node::child(const std::string &name)
                       << this->path()
                       << ")");
     }
-    size_t idx = (size_t)m_schema->child_index(name);
-    return *m_children[idx];
-}
-
-
-//---------------------------------------------------------------------------//
-const Node&
-Node::fetch_existing(const std::string &path) const
-{
-    // const fetch_existing w/ path requires object role
-    if(!dtype().is_object())
-    {
-        CONDUIT_ERROR("Cannot fetch_existing, Node(" << this->path()
-                      << ") is not an object");
-    }
-    
-    std::string p_curr;
-    std::string p_next;
-    utils::split_path(path,p_curr,p_next);
-    
-    // cull empty paths
-    if(p_curr == "")
-    {
-        return this->fetch_existing(p_next);
-    }
-
-    // check for parent
-    if(p_curr == "..")
-    {
-        if(m_parent == NULL)
-        {
-            CONDUIT_ERROR("Cannot fetch_existing from NULL parent" << path);
-        }
-        else
-        {
-            return m_parent->fetch_existing(p_next);
-        }
-    }
-
-    // check if descendant
-    if(m_schema->has_child(p_curr) && !p_next.empty())
-    {
-        // `child_index` will error if p_curr is invalid
-        size_t idx = (size_t)m_schema->child_index(p_curr);
-        return m_children[idx]->fetch_existing(p_next);
-    }
-    // is direct child
-    else
-    {
-        // `child` will error if p_curr is invalid
-        return this->child(p_curr);
-    }
+    size_t idx = (size_t)m_schema->child_index(name);
+    return *m_children[idx];
+}
+
+
+//---------------------------------------------------------------------------//
+const Node&
+Node::fetch_existing(const std::string &path) const
+{
+    return *walk_existing_path(path);
 }
 
 //---------------------------------------------------------------------------//
 Node&
 Node::fetch_existing(const std::string &path)
 {
-    // fetch_existing w/ path requires object role
-    if(!dtype().is_object())
-    {
-        CONDUIT_ERROR("Cannot fetch_existing, Node(" << this->path()
-                      << ") is not an object");
-    }
-    
-    std::string p_curr;
-    std::string p_next;
-    utils::split_path(path,p_curr,p_next);
+    return *walk_existing_path(path);
+}
 
-    // cull empty paths
-    if(p_curr == "")
-    {
-        return this->fetch_existing(p_next);
-    }
+//---------------------------------------------------------------------------//
+Node *
+Node::walk_existing_path(const std::string &path) const
+{
+    // path components are looked up in place, without creating strings
+    Node *curr = const_cast<Node*>(this);
+    const char *p_curr = path.c_str();
+    const char *p_end  = p_curr + path.size();
 
-    // check for parent
-    if(p_curr == "..")
+    while(true)
     {
-        if(m_parent == NULL)
+        // fetch_existing w/ path requires object role
+        if(!curr->dtype().is_object())
+        {
+            CONDUIT_ERROR("Cannot fetch_existing, Node(" << curr->path()
+                          << ") is not an object");
+        }
+
+        size_t p_curr_len = 0;
+        const char *p_next = utils::split_path(p_curr,p_end,p_curr_len);
+
+        // cull empty paths
+        if(p_curr_len == 0)
+        {
+            if(p_next == NULL)
+            {
+                CONDUIT_ERROR("Cannot fetch_existing empty path string");
+            }
+        }
+        // check for parent
+        else if(p_curr_len == 2 && p_curr[0] == '.' && p_curr[1] == '.')
         {
-            CONDUIT_ERROR("Cannot fetch_existing from NULL parent" << path);
+            if(curr->m_parent == NULL)
+            {
+                CONDUIT_ERROR("Cannot fetch_existing from NULL parent" 
+                              << path);
+            }
+            curr = curr->m_parent;
         }
         else
         {
-            return m_parent->fetch_existing(p_next);
+            index_t idx = curr->m_schema->object_hierarchy()->find(p_curr,
+                                                                p_curr_len);
+            if(idx < 0)
+            {
+                CONDUIT_ERROR("Cannot fetch non-existent "
+                              << "child \"" << std::string(p_curr,p_curr_len)
+                              << "\" from Node("
+                              << curr->path()
+                              << ")");
+            }
+            curr = curr->m_children[(size_t)idx];
+        }
+
+        if(p_next == NULL)
+        {
+            return curr;
         }
-    }
 
-    if(!m_schema->has_child(p_curr))
-    {
-        CONDUIT_ERROR("Cannot fetch non-existent "
-                      << "child \"" << p_curr << "\" from Node("
-                      << this->path()
-                      << ")");
+        p_curr = p_next;
     }
-    
-    size_t idx = (size_t)m_schema->child_index(p_curr);
+}
 
-    if(p_next.empty())
-    {
-        return *m_children[idx];
-    }
-    else
-    {
-        return m_children[idx]->fetch_existing(p_next);
-    }
+
+//---------------------------------------------------------------------------//
+Node&
+Node::fetch_existing(const NodePath &path)
+{
+    return path.fetch_existing(*this);
 }
 
+//---------------------------------------------------------------------------//
+const Node&
+Node::fetch_existing(const NodePath &path) const
+{
+    return path.fetch_existing(*this);
+}
 
 //---------------------------------------------------------------------------//
 Node&
@@ -12249,67 +14097,73 @@ Node::fetch_child(const std::string &path) const
 Node&
 Node::fetch(const std::string &path)
 {
-    // fetch w/ path forces OBJECT_ID
-    if(dtype().is_object())
-    {
-        init(DataType::object());
-    }
+    // path components are looked up in place, std::strings are only 
+    // created for new children
+    Node *curr = this;
+    const char *p_curr = path.c_str();
+    const char *p_end  = p_curr + path.size();
 
-    if(path.empty())
+    while(true)
     {
-        CONDUIT_ERROR("Cannot fetch empty path string");
-    }
-    
-    std::string p_curr;
-    std::string p_next;
-    utils::split_path(path,p_curr,p_next);
+        // fetch w/ path forces OBJECT_ID
+        if(curr->dtype().is_object())
+        {
+            curr->init(DataType::object());
+        }
 
-    // cull empty paths
-    if(p_curr == "")
-    {
-        return this->fetch(p_next);
-    }
+        size_t p_curr_len = 0;
+        const char *p_next = utils::split_path(p_curr,p_end,p_curr_len);
 
-    // check for parent
-    if(p_curr == "..")
-    {
-        if(m_parent == NULL)
+        // cull empty paths
+        if(p_curr_len == 0)
+        {
+            if(p_next == NULL)
+            {
+                CONDUIT_ERROR("Cannot fetch empty path string");
+            }
+        }
+        // check for parent
+        else if(p_curr_len == 2 && p_curr[0] == '.' && p_curr[1] == '.')
         {
-            CONDUIT_ERROR("Cannot fetch from NULL parent" << path);
+            if(curr->m_parent == NULL)
+            {
+                CONDUIT_ERROR("Cannot fetch from NULL parent" << path);
+            }
+            curr = curr->m_parent;
         }
         else
         {
-            return m_parent->fetch(p_next);
+            index_t idx = -1;
+            if(curr->dtype().is_object())
+            {
+                idx = curr->m_schema->object_hierarchy()->find(p_curr,
+                                                               p_curr_len);
+            }
+
+            // if this node doesn't exist yet, we need to create it and
+            // link it to a schema
+            if(idx < 0)
+            {
+                Schema *schema_ptr = &curr->m_schema->add_child(
+                                            std::string(p_curr,p_curr_len));
+                Node *curr_node = new Node();
+                curr_node->set_allocator(curr->m_allocator_id);
+                curr_node->set_schema_ptr(schema_ptr);
+                curr_node->m_parent = curr;
+                curr->m_children.push_back(curr_node);
+                idx = (index_t) curr->m_children.size() - 1;
+            }
+
+            curr = curr->m_children[(size_t)idx];
         }
-    }
 
-    // if this node doesn't exist yet, we need to create it and
-    // link it to a schema
-        
-    size_t idx;
-    if(!m_schema->has_child(p_curr))
-    {
-        Schema *schema_ptr = m_schema->fetch_ptr(p_curr);
-        Node *curr_node = new Node();
-        curr_node->set_schema_ptr(schema_ptr);
-        curr_node->m_parent = this;
-        m_children.push_back(curr_node);
-        idx = m_children.size() - 1;
-    }
-    else
-    {
-        idx = (size_t) m_schema->child_index(p_curr);
-    }
+        if(p_next == NULL)
+        {
+            return *curr;
+        }
 
-    if(p_next.empty())
-    {
-        return  *m_children[idx];
-    }
-    else
-    {
-        return m_children[idx]->fetch(p_next);
+        p_curr = p_next;
     }
-
 }
 
 //---------------------------------------------------------------------------//
@@ -12445,6 +14299,13 @@ Node::has_path(const std::string &path) const
     return m_schema->has_path(path);
 }
 
+//---------------------------------------------------------------------------//
+bool
+Node::has_path(const NodePath &path) const
+{
+    return path.exists(*this);
+}
+
 //---------------------------------------------------------------------------//
 const std::vector<std::string>&
 Node::child_names() const
@@ -12465,6 +14326,7 @@ Node::append()
     Schema *schema_ptr = m_schema->child_ptr(idx);
 
     Node *res_node = new Node();
+    res_node->set_allocator(m_allocator_id);
     res_node->set_schema_ptr(schema_ptr);
     res_node->m_parent=this;
     m_children.push_back(res_node);
@@ -12480,7 +14342,7 @@ Node::remove(index_t idx)
     // to cleanup
     
     // remove the proper list entry
-    delete m_children[(size_t)idx];
+    destroy_child(m_children[(size_t)idx]);
     m_schema->remove(idx);
     m_children.erase(m_children.begin() + (size_t)idx);
 }
@@ -12512,7 +14374,7 @@ Node::remove_child(const std::string &name)
    // note: we must remove the child pointer before the
    // schema. b/c the child pointer uses the schema
    // to cleanup
-   delete m_children[idx];
+   destroy_child(m_children[idx]);
    m_schema->remove_child(name);
    m_children.erase(m_children.begin() + idx);
 }
@@ -14512,6 +16374,22 @@ Node::set_schema_ptr(Schema *schema_ptr)
     m_schema = schema_ptr;
 }
 
+//---------------------------------------------------------------------------//
+void
+Node::replace_data_ptr(const void *curr_ptr,
+                       void *new_ptr)
+{
+    if(m_data == curr_ptr)
+    {
+        m_data = new_ptr;
+    }
+
+    for(size_t i=0; i < m_children.size(); i++)
+    {
+        m_children[i]->replace_data_ptr(curr_ptr,new_ptr);
+    }
+}
+
 //---------------------------------------------------------------------------//
 void
 Node::set_data_ptr(void *data)
@@ -14561,8 +16439,11 @@ class Node::MMap
       ~MMap();
 
       //----------------------------------------------------------------------
+      // maps data_size bytes of the file, see Node::mmap() for the 
+      // supported options
       void  open(const std::string &path,
-                 index_t data_size);
+                 index_t data_size,
+                 const Node &opts);
 
       //----------------------------------------------------------------------
       void  close();
@@ -14571,9 +16452,33 @@ class Node::MMap
       void *data_ptr() const
           { return m_data; }
 
+      //----------------------------------------------------------------------
+      // reads the pages that hold [ptr, ptr + nbytes)
+      void  prefetch(const void *ptr,
+                     index_t nbytes);
+
+      //----------------------------------------------------------------------
+      // drops the pages that have been read
+      void  evict();
+
+      //----------------------------------------------------------------------
+      void  info(Node &res) const;
+
   private:
+      // start and size of the mapping, the mapping starts at the page
+      // (or allocation granularity) boundary at or before m_offset
+      void      *m_map;
+      index_t    m_map_size;
+
+      // start and size of the data, m_offset bytes into the file
       void      *m_data;
-      int        m_data_size;
+      index_t    m_data_size;
+      index_t    m_offset;
+      std::string m_mode;
+
+      // read counters
+      index_t    m_bytes_prefetched;
+      index_t    m_num_evicts;
 
 #if !defined(CONDUIT_PLATFORM_WINDOWS)
       // memory-map file descriptor
@@ -14588,8 +16493,14 @@ class Node::MMap
 
 //-----------------------------------------------------------------------------
 Node::MMap::MMap()
-: m_data(NULL),
+: m_map(NULL),
+  m_map_size(0),
+  m_data(NULL),
   m_data_size(0),
+  m_offset(0),
+  m_mode("rw"),
+  m_bytes_prefetched(0),
+  m_num_evicts(0),
 #if !defined(CONDUIT_PLATFORM_WINDOWS)
   m_mmap_fd(-1)
 #else
@@ -14607,46 +16518,193 @@ Node::MMap::~MMap()
     close();
 }
 
+//-----------------------------------------------------------------------------
+// page size used to align mappings, prefetch and residency checks
+static index_t
+mmap_page_size()
+{
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    return (index_t)sysconf(_SC_PAGESIZE);
+#else
+    SYSTEM_INFO sys_info;
+    GetSystemInfo(&sys_info);
+    return (index_t)sys_info.dwPageSize;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+// mapping offsets must be a multiple of this
+static index_t
+mmap_offset_alignment()
+{
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    return mmap_page_size();
+#else
+    SYSTEM_INFO sys_info;
+    GetSystemInfo(&sys_info);
+    return (index_t)sys_info.dwAllocationGranularity;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+// string valued mmap option, or the given default if not present
+static std::string
+mmap_option(const Node &opts,
+            const std::string &name,
+            const std::string &default_value)
+{
+    if(opts.dtype().is_object() && opts.has_child(name))
+    {
+        return opts[name].as_string();
+    }
+    return default_value;
+}
+
 //-----------------------------------------------------------------------------
 void
 Node::MMap::open(const std::string &path,
-                 index_t data_size)
+                 index_t data_size,
+                 const Node &opts)
 {
     if(m_data != NULL)
     {
         CONDUIT_ERROR("<Node::mmap> mmap already open");
     }
 
-#if !defined(CONDUIT_PLATFORM_WINDOWS)
-    m_mmap_fd   = ::open(path.c_str(),
-                         (O_RDWR | O_CREAT),
-                         (S_IRUSR | S_IWUSR));
+    std::string mode       = mmap_option(opts,"mode","rw");
+    std::string advice     = mmap_option(opts,"advice","normal");
+    bool        populate   = mmap_option(opts,"populate","false") == "true";
+    bool        huge_pages = mmap_option(opts,"huge_pages","false") == "true";
+    index_t     offset     = 0;
+    if(opts.dtype().is_object() && opts.has_child("offset"))
+    {
+        offset = opts["offset"].to_index_t();
+    }
+
+    if(mode != "rw" && mode != "ro" && mode != "private")
+    {
+        CONDUIT_ERROR("<Node::mmap> unsupported mode: "
+                      << "\"" << mode << "\""
+                      << " (expected \"rw\", \"ro\", or \"private\")");
+    }
+
+    if(advice != "normal" && advice != "sequential" &&
+       advice != "random" && advice != "willneed")
+    {
+        CONDUIT_ERROR("<Node::mmap> unsupported advice: "
+                      << "\"" << advice << "\""
+                      << " (expected \"normal\", \"sequential\", "
+                      << "\"random\", or \"willneed\")");
+    }
+
+    if(offset < 0)
+    {
+        CONDUIT_ERROR("<Node::mmap> invalid offset: " << offset);
+    }
 
+    m_mode      = mode;
+    m_offset    = offset;
     m_data_size = data_size;
 
+    // the mapping starts at an aligned offset at or before the data
+    index_t align      = mmap_offset_alignment();
+    index_t map_offset = (offset / align) * align;
+    m_map_size = data_size + (offset - map_offset);
+
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    m_mmap_fd = ::open(path.c_str(), mode == "rw" ? O_RDWR : O_RDONLY);
+
     if (m_mmap_fd == -1) 
-    {
     {
         CONDUIT_ERROR("<Node::mmap> failed to open file: "
                      << "\"" << path << "\"");
     }
+
+    // pages past the end of the file can't be accessed
+    struct stat file_stat;
+    if(fstat(m_mmap_fd,&file_stat) != 0 ||
+       (index_t)file_stat.st_size < offset + data_size)
+    {
+        close();
+        CONDUIT_ERROR("<Node::mmap> file " 
+                      << "\"" << path << "\""
+                      << " is smaller than the "
+                      << data_size << " bytes spanned by its schema"
+                      << " (at offset " << offset << ")");
+    }
+
+    // nothing to map for empty trees
+    if(data_size == 0)
+    {
+        m_map_size = 0;
+        return;
+    }
+
+    int prot  = (mode == "ro") ? PROT_READ : (PROT_READ | PROT_WRITE);
+    int flags = (mode == "rw") ? MAP_SHARED : MAP_PRIVATE;
+#if defined(MAP_POPULATE)
+    if(populate)
+    {
+        flags |= MAP_POPULATE;
     }
+#endif
 
-    m_data = ::mmap(0,
-                    m_data_size,
-                    (PROT_READ | PROT_WRITE),
-                    MAP_SHARED,
-                    m_mmap_fd, 0);
+    void *map = ::mmap(0,
+                       (size_t)m_map_size,
+                       prot,
+                       flags,
+                       m_mmap_fd,
+                       (off_t)map_offset);
 
-    if (m_data == MAP_FAILED) 
+    if (map == MAP_FAILED) 
+    {
+        close();
         CONDUIT_ERROR("<Node::mmap> mmap data = MAP_FAILED" << path);
+    }
+
+    m_map  = map;
+    m_data = (uint8*)m_map + (offset - map_offset);
+
+    // hints are best effort, errors are ignored
+    if(advice == "sequential")
+    {
+        madvise(m_map,(size_t)m_map_size,MADV_SEQUENTIAL);
+    }
+    else if(advice == "random")
+    {
+        // only read the pages that are accessed (no read ahead)
+        madvise(m_map,(size_t)m_map_size,MADV_RANDOM);
+    }
+    else if(advice == "willneed")
+    {
+        madvise(m_map,(size_t)m_map_size,MADV_WILLNEED);
+    }
+
+#if defined(MADV_HUGEPAGE)
+    if(huge_pages)
+    {
+        madvise(m_map,(size_t)m_map_size,MADV_HUGEPAGE);
+    }
+#endif
+
+#if defined(MAP_POPULATE)
+    // already faulted in by MAP_POPULATE
+    populate = false;
+#endif
+
 #else
+    // windows has no equivalent of the advice and huge page hints
+    (void)huge_pages;
+
     m_file_hnd = CreateFile(path.c_str(),
-                            (GENERIC_READ | GENERIC_WRITE),
-                            0,
+                            mode == "rw" ? (GENERIC_READ | GENERIC_WRITE) :
+                                           GENERIC_READ,
+                            mode == "rw" ? 0 : FILE_SHARE_READ,
                             NULL,
                             OPEN_EXISTING,
-                            FILE_FLAG_RANDOM_ACCESS,
+                            advice == "sequential" ? 
+                                    FILE_FLAG_SEQUENTIAL_SCAN :
+                                    FILE_FLAG_RANDOM_ACCESS,
                             NULL);
 
     if (m_file_hnd == INVALID_HANDLE_VALUE)
@@ -14654,68 +16712,274 @@ Node::MMap::open(const std::string &path,
         CONDUIT_ERROR("<Node::mmap> CreateFile() Failed ");
     }
 
+    LARGE_INTEGER file_size;
+    if(!GetFileSizeEx(m_file_hnd,&file_size) ||
+       (index_t)file_size.QuadPart < offset + data_size)
+    {
+        close();
+        CONDUIT_ERROR("<Node::mmap> file " 
+                      << "\"" << path << "\""
+                      << " is smaller than the "
+                      << data_size << " bytes spanned by its schema"
+                      << " (at offset " << offset << ")");
+    }
+
+    // nothing to map for empty trees
+    if(data_size == 0)
+    {
+        m_map_size = 0;
+        return;
+    }
+
+    DWORD protect = PAGE_READWRITE;
+    DWORD access  = FILE_MAP_ALL_ACCESS;
+    if(mode == "ro")
+    {
+        protect = PAGE_READONLY;
+        access  = FILE_MAP_READ;
+    }
+    else if(mode == "private")
+    {
+        protect = PAGE_WRITECOPY;
+        access  = FILE_MAP_COPY;
+    }
+
     m_map_hnd = CreateFileMapping(m_file_hnd,
                                   NULL,
-                                  PAGE_READWRITE,
+                                  protect,
                                   0, 0, 0);
 
-    if (m_map_hnd == NULL)
+    if (m_map_hnd == NULL)
+    {
+        m_map_hnd = INVALID_HANDLE_VALUE;
+        close();
+        CONDUIT_ERROR("<Node::mmap> CreateFileMapping() failed with error" << GetLastError());
+    }
+
+    m_map = MapViewOfFile(m_map_hnd,
+                          access,
+                          (DWORD)((uint64)map_offset >> 32),
+                          (DWORD)((uint64)map_offset & 0xFFFFFFFF),
+                          (SIZE_T)m_map_size);
+
+    if (m_map == NULL)
+    {
+        close();
+        CONDUIT_ERROR("<Node::mmap> MapViewOfFile() failed with error" << GetLastError());
+    }
+
+    m_data = (uint8*)m_map + (offset - map_offset);
+#endif
+
+    if(populate)
+    {
+        // fault in every page of the map
+        index_t page_size = mmap_page_size();
+        volatile uint8 sink = 0;
+        for(index_t i = 0; i < m_map_size; i += page_size)
+        {
+            sink ^= ((const uint8*)m_map)[i];
+        }
+        (void)sink;
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::MMap::close()
+{
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    
+    if(m_map != NULL && munmap(m_map, (size_t)m_map_size) == -1) 
+    {
+        CONDUIT_ERROR("<Node::mmap> failed to unmap mmap.");
+    }
+    
+    if(m_mmap_fd != -1 && ::close(m_mmap_fd) == -1)
+    {
+        CONDUIT_ERROR("<Node::mmap> failed close mmap filed descriptor.");
+    }
+
+    m_mmap_fd   = -1;
+
+#else
+    if(m_map != NULL)
+    {
+        UnmapViewOfFile(m_map);
+    }
+    if(m_map_hnd != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(m_map_hnd);
+    }
+    if(m_file_hnd != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(m_file_hnd);
+    }
+    m_file_hnd = INVALID_HANDLE_VALUE;
+    m_map_hnd  = INVALID_HANDLE_VALUE;
+#endif
+
+    // clear data pointers and size members
+    m_map       = NULL;
+    m_map_size  = 0;
+    m_data      = NULL;
+    m_data_size = 0;
+
+}
+
+//-----------------------------------------------------------------------------
+void
+Node::MMap::prefetch(const void *ptr,
+                     index_t nbytes)
+{
+    if(m_map == NULL || ptr == NULL || nbytes <= 0)
+    {
+        return;
+    }
+
+    // page aligned range, clamped to the map
+    index_t page_size = mmap_page_size();
+    index_t map_start = (index_t)((const uint8*)ptr - (const uint8*)m_map);
+    index_t map_end   = map_start + nbytes;
+    map_start = std::max(map_start,(index_t)0);
+    map_end   = std::min(map_end,m_map_size);
+    if(map_start >= map_end)
+    {
+        return;
+    }
+    map_start = (map_start / page_size) * page_size;
+    map_end   = std::min(((map_end + page_size - 1) / page_size) * page_size,
+                         m_map_size);
+
+    uint8 *start = (uint8*)m_map + map_start;
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    // start reading all of the pages, then wait for them page by page
+    madvise(start,(size_t)(map_end - map_start),MADV_WILLNEED);
+#endif
+    volatile uint8 sink = 0;
+    for(index_t i = 0; i < map_end - map_start; i += page_size)
     {
-        CloseHandle(m_file_hnd);
-        CONDUIT_ERROR("<Node::mmap> CreateFileMapping() failed with error" << GetLastError());
+        sink ^= start[i];
     }
+    (void)sink;
 
-    m_data = MapViewOfFile(m_map_hnd,
-                           FILE_MAP_ALL_ACCESS,
-                           0, 0, 0);
-
-    m_data_size = (int)data_size;
+    m_bytes_prefetched += map_end - map_start;
+}
 
-    if (m_data == NULL)
+//-----------------------------------------------------------------------------
+void
+Node::MMap::evict()
+{
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    if(m_map != NULL)
     {
-        CloseHandle(m_map_hnd);
-        CloseHandle(m_file_hnd);
-        CONDUIT_ERROR("<Node::mmap> MapViewOfFile() failed with error" << GetLastError());
+        // unmap the pages from this process, and ask the os to drop 
+        // the cached (clean) pages of the file
+        if(m_mode == "rw")
+        {
+            // write back modifications first, DONTNEED keeps dirty
+            // shared pages but the os can't drop them from its cache
+            msync(m_map,(size_t)m_map_size,MS_SYNC);
+        }
+        madvise(m_map,(size_t)m_map_size,MADV_DONTNEED);
+    #if defined(POSIX_FADV_DONTNEED)
+        posix_fadvise(m_mmap_fd,
+                      (off_t)(m_offset - 
+                              ((uint8*)m_data - (uint8*)m_map)),
+                      (off_t)m_map_size,
+                      POSIX_FADV_DONTNEED);
+    #endif
     }
 #endif
+    m_num_evicts++;
 }
 
 //-----------------------------------------------------------------------------
 void
-Node::MMap::close()
+Node::MMap::info(Node &res) const
 {
-    // simple return if the mmap isn't active
-    if(m_data == NULL)
-        return;
-    
+    res.reset();
+    res["mode"]        = m_mode;
+    res["offset"]      = m_offset;
+    res["bytes_total"] = m_data_size;
+
+    index_t bytes_resident = 0;
 #if !defined(CONDUIT_PLATFORM_WINDOWS)
-    
-    if(munmap(m_data, m_data_size) == -1) 
-    {
-        CONDUIT_ERROR("<Node::mmap> failed to unmap mmap.");
-    }
-    
-    if(::close(m_mmap_fd) == -1)
+    if(m_map != NULL)
     {
-        CONDUIT_ERROR("<Node::mmap> failed close mmap filed descriptor.");
+        index_t page_size = mmap_page_size();
+        index_t num_pages = (m_map_size + page_size - 1) / page_size;
+    #if defined(__APPLE__)
+        std::vector<char> pages((size_t)num_pages);
+    #else
+        std::vector<unsigned char> pages((size_t)num_pages);
+    #endif
+        if(mincore(m_map,(size_t)m_map_size,&pages[0]) == 0)
+        {
+            // count the data part of each resident page
+            index_t data_start = (index_t)((uint8*)m_data - (uint8*)m_map);
+            for(index_t i = 0; i < num_pages; i++)
+            {
+                if(pages[(size_t)i] & 1)
+                {
+                    index_t page_start = std::max(i * page_size,data_start);
+                    index_t page_end   = std::min((i + 1) * page_size,
+                                                  m_map_size);
+                    bytes_resident += page_end - page_start;
+                }
+            }
+        }
     }
-
-    m_mmap_fd   = -1;
-
 #else
-    UnmapViewOfFile(m_data);
-    CloseHandle(m_map_hnd);
-    CloseHandle(m_file_hnd);
-    m_file_hnd = INVALID_HANDLE_VALUE;
-    m_map_hnd  = INVALID_HANDLE_VALUE;
+    bytes_resident = -1;
 #endif
+    res["bytes_resident"]   = bytes_resident;
+    res["bytes_prefetched"] = m_bytes_prefetched;
+    res["num_evicts"]       = m_num_evicts;
+}
 
-    // clear data pointer and size member
-    m_data      = NULL;
-    m_data_size = 0;
 
+
+
+//-----------------------------------------------------------------------------
+// Node methods for lazily loaded and mmaped trees (these use the 
+// Node::MMap definition above)
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+void
+Node::prefetch(const std::string &path)
+{
+    MMap &mmap = mapped_source("prefetch");
+    uint8  *start  = NULL;
+    index_t nbytes = 0;
+    fetch_existing(path).data_extent(start,nbytes);
+    mmap.prefetch(start,nbytes);
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::prefetch(const std::vector<std::string> &paths)
+{
+    for(size_t i=0; i < paths.size(); i++)
+    {
+        prefetch(paths[i]);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::evict()
+{
+    mapped_source("evict").evict();
 }
 
+//---------------------------------------------------------------------------//
+void
+Node::lazy_load_info(Node &info) const
+{
+    mapped_source("lazy_load_info").info(info);
+}
 
 
 
@@ -14730,7 +16994,11 @@ void
 Node::init(const DataType& dtype)
 {
     if(this->dtype().compatible(dtype))
+    {
+        // the caller will write to the existing data
+        unshare_leaf();
         return;
+    }
 
     if(m_data != NULL ||
        this->dtype().id() == DataType::OBJECT_ID ||
@@ -14762,25 +17030,226 @@ Node::allocate(const DataType &dtype)
 void
 Node::allocate(index_t dsize)
 {
-    m_data      = calloc((size_t)dsize,(size_t)1);
+    m_data      = utils::allocate_memory(m_allocator_id,dsize);
     m_data_size = dsize;
     m_alloced   = true;
     m_mmaped    = false;
+    m_data_tag  = utils::memory_stats_allocate(dsize);
 }
 
 
 //---------------------------------------------------------------------------//
 void
-Node::mmap(const std::string &stream_path, index_t data_size)
+Node::mmap(const std::string &stream_path,
+           index_t data_size,
+           const Node &options)
 {
-    m_mmap = new MMap();
-    m_mmap->open(stream_path,data_size);
+    MMap *mmap = new MMap();
+    try
+    {
+        mmap->open(stream_path,data_size,options);
+    }
+    catch(conduit::Error &)
+    {
+        delete mmap;
+        throw;
+    }
+    m_mmap = mmap;
     m_data = m_mmap->data_ptr();
     m_data_size = data_size;
     m_alloced = false;
     m_mmaped  = true;
+    utils::memory_stats_map(data_size);
+}
+
+
+//---------------------------------------------------------------------------//
+Node::MMap &
+Node::mapped_source(const std::string &caller) const
+{
+    // the map is held by the root of the mapped tree
+    const Node *n = this;
+    while(n != NULL && n->m_mmap == NULL)
+    {
+        n = n->m_parent;
+    }
+
+    if(n == NULL)
+    {
+        CONDUIT_ERROR("<Node::" << caller << "> "
+                      << "node is not part of a lazily loaded or mmaped tree");
+    }
+
+    return *n->m_mmap;
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::data_extent(uint8 *&start,
+                  index_t &nbytes) const
+{
+    index_t dtype_id = dtype().id();
+    if(dtype_id == DataType::OBJECT_ID ||
+       dtype_id == DataType::LIST_ID)
+    {
+        std::vector<Node*>::const_iterator itr;
+        for(itr = m_children.begin(); itr < m_children.end(); ++itr)
+        {
+            uint8  *cld_start  = NULL;
+            index_t cld_nbytes = 0;
+            (*itr)->data_extent(cld_start,cld_nbytes);
+            if(cld_start == NULL)
+            {
+                continue;
+            }
+
+            if(start == NULL)
+            {
+                start  = cld_start;
+                nbytes = cld_nbytes;
+            }
+            else
+            {
+                uint8 *end = std::max(start + nbytes, cld_start + cld_nbytes);
+                start  = std::min(start,cld_start);
+                nbytes = (index_t)(end - start);
+            }
+        }
+    }
+    else if(dtype_id != DataType::EMPTY_ID &&
+            m_data != NULL &&
+            dtype().number_of_elements() > 0)
+    {
+        start  = (uint8*)element_ptr(0);
+        nbytes = dtype().strided_bytes();
+    }
+}
+
+//---------------------------------------------------------------------------//
+const Node *
+Node::data_owner(const uint8 *start,
+                 index_t nbytes) const
+{
+    const Node *n = this;
+    while(n != NULL)
+    {
+        if(n->m_shared != NULL)
+        {
+            if(n->m_shared->contains(start,nbytes))
+            {
+                return n;
+            }
+        }
+        else if( (n->m_alloced || n->m_mmaped) &&
+                 n->m_data != NULL &&
+                 start >= (const uint8*)n->m_data &&
+                 start + nbytes <= (const uint8*)n->m_data + n->m_data_size)
+        {
+            return n;
+        }
+        n = n->m_parent;
+    }
+    return NULL;
+}
+
+//---------------------------------------------------------------------------//
+Node::SharedBuffer *
+Node::share_data() const
+{
+    uint8  *start  = NULL;
+    index_t nbytes = 0;
+    data_extent(start,nbytes);
+    if(start == NULL)
+    {
+        return NULL;
+    }
+
+    Node *owner = const_cast<Node*>(data_owner(start,nbytes));
+    if(owner == NULL)
+    {
+        return NULL;
+    }
+
+    if(owner->m_shared == NULL)
+    {
+        // mmaped data can't be handed off
+        if(!owner->m_alloced)
+        {
+            return NULL;
+        }
+
+        // the owner keeps the first reference
+        owner->m_shared = new SharedBuffer(owner->m_data,
+                                           owner->m_data_size,
+                                           owner->m_allocator_id,
+                                           owner->m_data_tag);
+        owner->m_alloced   = false;
+        owner->m_data_size = 0;
+    }
+
+    return owner->m_shared;
+}
+
+//---------------------------------------------------------------------------//
+bool
+Node::in_used_shared_buffer(const uint8 *start,
+                            index_t nbytes) const
+{
+    if(SharedBuffer::num_live() == 0)
+    {
+        return false;
+    }
+
+    const Node *owner = data_owner(start,nbytes);
+    return owner != NULL &&
+           owner->m_shared != NULL &&
+           owner->m_shared->use_count() > 1;
 }
 
+//---------------------------------------------------------------------------//
+void
+Node::unshare_leaf()
+{
+    if(m_alloced || m_data == NULL || SharedBuffer::num_live() == 0)
+    {
+        return;
+    }
+
+    index_t dtype_id = dtype().id();
+    if(dtype_id == DataType::EMPTY_ID ||
+       dtype_id == DataType::OBJECT_ID ||
+       dtype_id == DataType::LIST_ID ||
+       dtype().number_of_elements() <= 0)
+    {
+        return;
+    }
+
+    uint8  *start  = (uint8*)element_ptr(0);
+    index_t nbytes = dtype().strided_bytes();
+    if(!in_used_shared_buffer(start,nbytes))
+    {
+        return;
+    }
+
+    DataType dt_compact;
+    dtype().compact_to(dt_compact);
+    index_t c_size = dt_compact.spanned_bytes();
+    void *data = utils::allocate_memory(m_allocator_id,c_size);
+    compact_elements_to((uint8*)data);
+
+    // drop the reference if this leaf holds it
+    if(m_shared != NULL)
+    {
+        m_shared->release();
+        m_shared = NULL;
+    }
+
+    m_schema->set(dt_compact);
+    m_data      = data;
+    m_data_size = c_size;
+    m_alloced   = true;
+    m_data_tag  = utils::memory_stats_allocate(c_size);
+}
 
 //---------------------------------------------------------------------------//
 void
@@ -14789,8 +17258,7 @@ Node::release()
     // delete all children
     for (size_t i = 0; i < m_children.size(); i++)
     {
-        Node* node = m_children[i];
-        delete node;
+        destroy_child(m_children[i]);
     }
     m_children.clear();
 
@@ -14803,7 +17271,8 @@ Node::release()
         if(dtype().id() != DataType::EMPTY_ID)
         {   
             // clean up our storage
-            free(m_data);
+            utils::free_memory(m_allocator_id,m_data);
+            utils::memory_stats_free(m_data_size,m_data_tag);
             m_data = NULL;
             m_data_size = 0;
             m_alloced   = false;
@@ -14812,11 +17281,18 @@ Node::release()
     else if(m_mmaped && m_mmap)
     {
         delete m_mmap;
+        utils::memory_stats_unmap(m_data_size);
         m_data = NULL;
         m_data_size = 0;
         m_mmaped    = false;
         m_mmap      = NULL;
     }
+    else if(m_shared != NULL)
+    {
+        m_shared->release();
+        m_data   = NULL;
+        m_shared = NULL;
+    }
 }
 
 //---------------------------------------------------------------------------//
@@ -14860,14 +17336,18 @@ Node::init_defaults()
     m_data = NULL;
     m_data_size = 0;
     m_alloced = false;
+    m_allocator_id = utils::default_allocator();
+    m_data_tag = 0;
 
     m_mmaped    = false;
     m_mmap      = NULL;
+    m_shared    = NULL;
 
     m_schema = new Schema(DataType::EMPTY_ID);
     m_owns_schema = true;
     
     m_parent = NULL;
+    m_block  = NULL;
 }
 
 //-----------------------------------------------------------------------------
@@ -14876,6 +17356,22 @@ Node::init_defaults()
 //
 //-----------------------------------------------------------------------------
 
+//---------------------------------------------------------------------------//
+void
+Node::load_conduit_bin_schema(const std::string &stream_path,
+                              Schema &schema)
+{
+    std::string ifschema_bin = stream_path + "_schema_bin";
+    if(utils::is_file(ifschema_bin))
+    {
+        schema.load_binary(ifschema_bin);
+    }
+    else
+    {
+        schema.load(stream_path + "_json");
+    }
+}
+
 //-------------------------------------------------------------------------
 // This method is for Node::load() and Node::save() 
 // Since conudit does not link to relay, only basic (non-tpl dependent)
@@ -14914,59 +17410,210 @@ Node::identify_protocol(const std::string &path,
     }
     else if(file_name_ext == "conduit_base64_json")
     {
-        io_type = "conduit_base64_json";
+        io_type = "conduit_base64_json";
+    }
+    else if(file_name_ext == "yaml")
+    {
+        io_type = "yaml";
+    }
+}
+
+
+//-----------------------------------------------------------------------------
+//
+// -- private methods that help with hierarchical construction --
+//
+//-----------------------------------------------------------------------------
+
+
+//-----------------------------------------------------------------------------
+// Node::NodeBlock helper class
+//-----------------------------------------------------------------------------
+// This private class is the header of a block of Node objects, the objects
+// follow the header in the same allocation. 
+//
+// Blocks are filled by the thread that builds the tree, but the nodes in
+// a block may be destroyed from any thread, so the live count is atomic.
+//-----------------------------------------------------------------------------
+class Node::NodeBlock
+{
+public:
+    //-----------------------------------------------------------------------//
+    static NodeBlock *create(index_t capacity)
+    {
+        void *mem = malloc(header_bytes() + sizeof(Node) * (size_t)capacity);
+        if(mem == NULL)
+        {
+            CONDUIT_ERROR("Failed to allocate block for " 
+                          << capacity << " Nodes");
+        }
+        return new (mem) NodeBlock(capacity);
+    }
+
+    //-----------------------------------------------------------------------//
+    // returns storage for the next node, or NULL if the block is full
+    void *take()
+    {
+        if(m_used >= m_capacity)
+        {
+            return NULL;
+        }
+        uint8 *start = ((uint8*)this) + header_bytes();
+        void *res = start + sizeof(Node) * (size_t)m_used;
+        m_used++;
+#ifdef CONDUIT_USE_CXX11
+        m_live++;
+#else
+        atomic_add(&m_live,1);
+#endif
+        return res;
+    }
+
+    //-----------------------------------------------------------------------//
+    // called when a node in the block is destroyed, the block is freed 
+    // with its last node
+    void release_one()
+    {
+#ifdef CONDUIT_USE_CXX11
+        long count = --m_live;
+#else
+        long count = atomic_add(&m_live,-1);
+#endif
+        if(count == 0)
+        {
+            this->~NodeBlock();
+            free(this);
+        }
+    }
+
+private:
+    //-----------------------------------------------------------------------//
+    NodeBlock(index_t capacity)
+    : m_capacity(capacity),
+      m_used(0),
+      m_live(0)
+    {}
+
+#ifndef CONDUIT_USE_CXX11
+    //-----------------------------------------------------------------------//
+    // adds delta to value atomically, returns the new value
+    static long atomic_add(volatile long *value, long delta)
+    {
+  #if defined(CONDUIT_PLATFORM_WINDOWS)
+        return InterlockedExchangeAdd(value,delta) + delta;
+  #else
+        return __sync_add_and_fetch(value,delta);
+  #endif
+    }
+#endif
+
+    //-----------------------------------------------------------------------//
+    static size_t header_bytes()
+    {
+        // keep the nodes 16-byte aligned
+        return (sizeof(NodeBlock) + 15) & ~((size_t)15);
+    }
+
+    index_t m_capacity;
+    index_t m_used;
+    // number of nodes created in the block that are not yet destroyed
+#ifdef CONDUIT_USE_CXX11
+    std::atomic<long> m_live;
+#else
+    volatile long     m_live;
+#endif
+};
+
+//---------------------------------------------------------------------------//
+Node::NodeBlock *
+Node::create_block(const Schema *schema)
+{
+    index_t threshold = utils::tree_block_threshold();
+    if(threshold == 0)
+    {
+        return NULL;
+    }
+
+    index_t num_desc = schema->number_of_descendants();
+    if(num_desc < threshold)
+    {
+        return NULL;
+    }
+
+    return NodeBlock::create(num_desc);
+}
+
+//---------------------------------------------------------------------------//
+Node *
+Node::create_child(NodeBlock *block)
+{
+    void *mem = NULL;
+    if(block != NULL)
+    {
+        mem = block->take();
+    }
+
+    if(mem == NULL)
+    {
+        return new Node();
+    }
+
+    Node *res = new (mem) Node();
+    res->m_block = block;
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::destroy_child(Node *node)
+{
+    NodeBlock *block = node->m_block;
+    if(block == NULL)
+    {
+        delete node;
     }
-    else if(file_name_ext == "yaml")
+    else
     {
-        io_type = "yaml";
+        node->~Node();
+        block->release_one();
     }
 }
 
-
-//-----------------------------------------------------------------------------
-//
-// -- private methods that help with hierarchical construction --
-//
-//-----------------------------------------------------------------------------
-
-
 //---------------------------------------------------------------------------//
 void 
 Node::walk_schema(Node   *node, 
                   Schema *schema,
                   void   *data)
+{
+    walk_schema(node,schema,data,create_block(schema));
+}
+
+//---------------------------------------------------------------------------//
+void 
+Node::walk_schema(Node   *node, 
+                  Schema *schema,
+                  void   *data,
+                  NodeBlock *block)
 {
     // we can have an object, list, or leaf
     node->set_data_ptr(data);
-    if(schema->dtype().id() == DataType::OBJECT_ID)
-    {
-        for(size_t i=0;i< schema->children().size(); i++)
-        {
-    
-            std::string curr_name = schema->object_order()[i];
-            Schema *curr_schema   = &schema->add_child(curr_name);
-            Node *curr_node = new Node();
-            curr_node->set_schema_ptr(curr_schema);
-            curr_node->set_parent(node);
-            walk_schema(curr_node,curr_schema,data);
-            node->append_node_ptr(curr_node);
-        }                   
-    }
-    else if(schema->dtype().id() == DataType::LIST_ID)
+    // (const access, so the schema's cached fingerprint stays valid)
+    index_t dtype_id = ((const Schema*)schema)->dtype().id();
+    if(dtype_id == DataType::OBJECT_ID ||
+       dtype_id == DataType::LIST_ID)
     {
         index_t num_entries = schema->number_of_children();
         for(index_t i=0;i<num_entries;i++)
         {
             Schema *curr_schema = schema->child_ptr(i);
-            Node *curr_node = new Node();
+            Node *curr_node = create_child(block);
+            curr_node->set_allocator(node->allocator());
             curr_node->set_schema_ptr(curr_schema);
             curr_node->set_parent(node);
-            walk_schema(curr_node,curr_schema,data);
+            walk_schema(curr_node,curr_schema,data,block);
             node->append_node_ptr(curr_node);
         }
     }
-
-  
 }
 
 //---------------------------------------------------------------------------//
@@ -14974,41 +17621,38 @@ void
 Node::mirror_node(Node   *node,
                   Schema *schema,
                   const Node *src)
+{
+    mirror_node(node,schema,src,create_block(schema));
+}
+
+//---------------------------------------------------------------------------//
+void 
+Node::mirror_node(Node   *node,
+                  Schema *schema,
+                  const Node *src,
+                  NodeBlock *block)
 {
     // we can have an object, list, or leaf
     node->set_data_ptr(src->m_data);
     
-    if(schema->dtype().id() == DataType::OBJECT_ID)
-    {
-        for(size_t i=0;i< schema->children().size(); i++)
-        {
-    
-            std::string curr_name = schema->object_order()[i];
-            Schema *curr_schema   = &schema->add_child(curr_name);
-            Node *curr_node = new Node();
-            const Node *curr_src = src->child_ptr(i);
-            curr_node->set_schema_ptr(curr_schema);
-            curr_node->set_parent(node);
-            mirror_node(curr_node,curr_schema,curr_src);
-            node->append_node_ptr(curr_node);
-        }                   
-    }
-    else if(schema->dtype().id() == DataType::LIST_ID)
+    // (const access, so the schema's cached fingerprint stays valid)
+    index_t dtype_id = ((const Schema*)schema)->dtype().id();
+    if(dtype_id == DataType::OBJECT_ID ||
+       dtype_id == DataType::LIST_ID)
     {
         index_t num_entries = schema->number_of_children();
         for(index_t i=0;i<num_entries;i++)
         {
             Schema *curr_schema = schema->child_ptr(i);
-            Node *curr_node = new Node();
+            Node *curr_node = create_child(block);
             const Node *curr_src = src->child_ptr(i);
+            curr_node->set_allocator(node->allocator());
             curr_node->set_schema_ptr(curr_schema);
             curr_node->set_parent(node);
-            mirror_node(curr_node,curr_schema,curr_src);
+            mirror_node(curr_node,curr_schema,curr_src,block);
             node->append_node_ptr(curr_node);
         }
     }
-
-    
 }
 
 //-----------------------------------------------------------------------------
@@ -15019,7 +17663,9 @@ Node::mirror_node(Node   *node,
 
 //---------------------------------------------------------------------------//
 void
-Node::compact_to(uint8 *data, index_t curr_offset) const
+Node::compact_to(uint8 *data,
+                 index_t curr_offset,
+                 StridedCopies &copies) const
 {
     CONDUIT_ASSERT( (m_schema != NULL) , "Corrupt schema found in compact_to call");
     
@@ -15030,17 +17676,82 @@ Node::compact_to(uint8 *data, index_t curr_offset) const
             std::vector<Node*>::const_iterator itr;
             for(itr = m_children.begin(); itr < m_children.end(); ++itr)
             {
-                (*itr)->compact_to(data,curr_offset);
+                (*itr)->compact_to(data,curr_offset,copies);
                 curr_offset +=  (*itr)->total_bytes_compact();
             }
     }
-    else
+    else if(dtype_id != DataType::EMPTY_ID)
     {
-        compact_elements_to(&data[curr_offset]);
+        index_t ele_bytes = DataType::default_bytes(dtype_id);
+        copies.add(&data[curr_offset],
+                   ele_bytes,
+                   element_ptr(0),
+                   dtype().stride(),
+                   dtype().number_of_elements(),
+                   ele_bytes);
     }
 }
 
 
+//---------------------------------------------------------------------------//
+void
+Node::endian_swap_to(uint8 *data,
+                     index_t curr_offset,
+                     index_t endianness,
+                     Schema &dest_schema) const
+{
+    index_t dtype_id = dtype().id();
+    if(dtype_id == DataType::OBJECT_ID ||
+       dtype_id == DataType::LIST_ID)
+    {
+        // the compact dest schema has the same children, in the same order
+        index_t num_children = number_of_children();
+        for(index_t i=0; i < num_children; i++)
+        {
+            const Node *chld = m_children[(size_t)i];
+            chld->endian_swap_to(data,
+                                 curr_offset,
+                                 endianness,
+                                 dest_schema.child(i));
+            curr_offset += chld->total_bytes_compact();
+        }
+    }
+    else if(dtype_id != DataType::EMPTY_ID)
+    {
+        index_t src_endian  = dtype().endianness();
+        index_t dest_endian = endianness;
+
+        if(src_endian == Endianness::DEFAULT_ID)
+        {
+            src_endian = Endianness::machine_default();
+        }
+
+        if(dest_endian == Endianness::DEFAULT_ID)
+        {
+            dest_endian = Endianness::machine_default();
+        }
+
+        index_t num_ele   = dtype().number_of_elements();
+        index_t ele_bytes = DataType::default_bytes(dtype_id);
+
+        if(src_endian != dest_endian)
+        {
+            kernels::byte_swap_copy(&data[curr_offset],
+                                    ele_bytes,
+                                    element_ptr(0),
+                                    dtype().stride(),
+                                    num_ele,
+                                    ele_bytes);
+        }
+        else
+        {
+            compact_elements_to(&data[curr_offset]);
+        }
+
+        dest_schema.dtype().set_endianness(dest_endian);
+    }
+}
+
 //---------------------------------------------------------------------------//
 void
 Node::compact_elements_to(uint8 *data) const
@@ -15057,17 +17768,109 @@ Node::compact_elements_to(uint8 *data) const
         // copy all elements 
         index_t num_ele   = dtype().number_of_elements();
         index_t ele_bytes = DataType::default_bytes(dtype_id);
-        uint8 *data_ptr = data;
-        for(index_t i=0;i<num_ele;i++)
+        kernels::gather(data,
+                        element_ptr(0),
+                        dtype().stride(),
+                        num_ele,
+                        ele_bytes);
+    }
+}
+
+
+//---------------------------------------------------------------------------//
+void
+Node::base64_encode_to(utils::Base64Encoder &enc) const
+{
+    index_t dtype_id = dtype().id();
+    if(dtype_id == DataType::OBJECT_ID ||
+       dtype_id == DataType::LIST_ID)
+    {
+        std::vector<Node*>::const_iterator itr;
+        for(itr = m_children.begin(); itr < m_children.end(); ++itr)
+        {
+            (*itr)->base64_encode_to(enc);
+        }
+    }
+    else if(dtype_id != DataType::EMPTY_ID)
+    {
+        index_t num_ele   = dtype().number_of_elements();
+        index_t ele_bytes = DataType::default_bytes(dtype_id);
+        if(dtype().stride() == ele_bytes)
         {
-            memcpy(data_ptr,
-                   element_ptr(i),
-                   (size_t)ele_bytes);
-            data_ptr+=ele_bytes;
+            enc.write(element_ptr(0),num_ele * ele_bytes);
+        }
+        else
+        {
+            // gather strided elements in small blocks
+            uint8 buffer[4096];
+            index_t blk_ele = 4096 / ele_bytes;
+            for(index_t i = 0; i < num_ele; i += blk_ele)
+            {
+                index_t n = std::min(blk_ele, num_ele - i);
+                kernels::gather(buffer,
+                                element_ptr(i),
+                                dtype().stride(),
+                                n,
+                                ele_bytes);
+                enc.write(buffer, n * ele_bytes);
+            }
         }
     }
 }
 
+//---------------------------------------------------------------------------//
+void
+Node::serialize_iovecs_to(std::vector<IOVec> &iovecs) const
+{
+    index_t dtype_id = dtype().id();
+    if(dtype_id == DataType::OBJECT_ID ||
+       dtype_id == DataType::LIST_ID)
+    {
+        std::vector<Node*>::const_iterator itr;
+        for(itr = m_children.begin(); itr < m_children.end(); ++itr)
+        {
+            (*itr)->serialize_iovecs_to(iovecs);
+        }
+    }
+    else if(dtype_id != DataType::EMPTY_ID)
+    {
+        IOVec iov;
+        iov.data          = element_ptr(0);
+        iov.element_bytes = DataType::default_bytes(dtype_id);
+        iov.stride        = dtype().stride();
+        iov.num_elements  = dtype().number_of_elements();
+
+        if(iov.num_elements == 0)
+        {
+            return;
+        }
+
+        if(iov.is_contiguous())
+        {
+            // contiguous blocks are a single element
+            iov.element_bytes = iov.number_of_bytes();
+            iov.stride        = iov.element_bytes;
+            iov.num_elements  = 1;
+
+            // merge with the previous block if this one directly follows
+            if(!iovecs.empty())
+            {
+                IOVec &prev = iovecs.back();
+                if(prev.is_contiguous() &&
+                   (const uint8*)prev.data + prev.number_of_bytes() ==
+                   (const uint8*)iov.data)
+                {
+                    prev.element_bytes += iov.element_bytes;
+                    prev.stride         = prev.element_bytes;
+                    prev.num_elements   = 1;
+                    return;
+                }
+            }
+        }
+
+        iovecs.push_back(iov);
+    }
+}
 
 //---------------------------------------------------------------------------//
 void
@@ -15080,7 +17883,8 @@ Node::serialize(uint8 *data,index_t curr_offset) const
         for(itr = m_children.begin(); itr < m_children.end(); ++itr)
         {
             (*itr)->serialize(&data[0],curr_offset);
-            curr_offset+=(*itr)->total_strided_bytes();
+            // children are written compactly
+            curr_offset+=(*itr)->total_bytes_compact();
         }
     }
     else
@@ -15300,9 +18104,21 @@ Node::find_first_data_ptr() const
 //---------------------------------------------------------------------------//
 bool
 Node::diff(const Node &n, Node &info, const float64 epsilon) const
+{
+    // compare the structure, then the leaves
+    LeafDiffs diffs(epsilon);
+    diff_structure(n,info,-1,diffs);
+    return diffs.execute();
+}
+
+//---------------------------------------------------------------------------//
+void
+Node::diff_structure(const Node &n,
+                     Node &info,
+                     index_t parent,
+                     LeafDiffs &diffs) const
 {
     const std::string protocol = "node::diff";
-    bool res = false;
     info.reset();
 
     index_t t_dtid  = dtype().id();
@@ -15317,14 +18133,16 @@ Node::diff(const Node &n, Node &info, const float64 epsilon) const
             << n.dtype().name() 
             << ")";
         log::error(info, protocol, oss.str());
-        res = true;
+        diffs.add(&info,parent,true);
     }
     else if(t_dtid == DataType::EMPTY_ID)
     {
         // no-op; empty nodes cannot have differences
+        diffs.add(&info,parent,false);
     }
     else if(t_dtid == DataType::OBJECT_ID)
     {
+        index_t id = diffs.add(&info,parent,false);
         Node &info_children = info["children"];
 
         NodeConstIterator child_itr;
@@ -15337,35 +18155,35 @@ Node::diff(const Node &n, Node &info, const float64 epsilon) const
             if(!n.has_child(child_path))
             {
                 info_children["extra"].append().set(child_path);
-                res = true;
+                diffs.set_different(id);
             }
             else
             {
                 Node &info_child = info_children["diff"].add_child(child_path);
-                res |= t_child.diff(n.child(child_path), info_child, epsilon);
+                t_child.diff_structure(n.child(child_path),
+                                       info_child,
+                                       id,
+                                       diffs);
             }
         }
 
+        // children in both trees were compared above
         child_itr = n.children();
         while(child_itr.has_next())
         {
-            const conduit::Node &n_child = child_itr.next();
+            child_itr.next();
             const std::string child_path = child_itr.name();
 
             if(!has_child(child_path))
             {
                 info_children["missing"].append().set(child_path);
-                res = true;
-            }
-            else
-            {
-                Node &info_child = info_children["diff"].add_child(child_path);
-                res |= child(child_path).diff(n_child, info_child, epsilon);
+                diffs.set_different(id);
             }
         }
     }
     else if(t_dtid == DataType::LIST_ID)
     {
+        index_t id = diffs.add(&info,parent,false);
         Node &info_children = info["children"];
 
         index_t t_nchild = number_of_children();
@@ -15376,93 +18194,102 @@ Node::diff(const Node &n, Node &info, const float64 epsilon) const
         {
             const Node &t_child = child(i);
             const Node &n_child = n.child(i);
-            res |= t_child.diff(n_child, info_children["diff"].append(), epsilon);
+            t_child.diff_structure(n_child,
+                                   info_children["diff"].append(),
+                                   id,
+                                   diffs);
         }
         for(; i < std::max(t_nchild, n_nchild); i++)
         {
             const std::string diff_type = (i >= t_nchild) ? "missing" : "extra";
             info_children[diff_type].append().set(i);
-            res = true;
+            diffs.set_different(id);
         }
     }
     else // leaf node
     {
-        if(dtype().is_int8())
-        {
-            int8_array t_array = value();
-            int8_array n_array = n.value();
-            res |= t_array.diff(n_array, info, epsilon);
-        }
-        else if(dtype().is_int16())
-        {
-            int16_array t_array = value();
-            int16_array n_array = n.value();
-            res |= t_array.diff(n_array, info, epsilon);
-        }
-        else if(dtype().is_int32())
-        {
-            int32_array t_array = value();
-            int32_array n_array = n.value();
-            res |= t_array.diff(n_array, info, epsilon);
-        }
-        else if(dtype().is_int64())
-        {
-            int64_array t_array = value();
-            int64_array n_array = n.value();
-            res |= t_array.diff(n_array, info, epsilon);
-        }
-        else if(dtype().is_uint8())
-        {
-            uint8_array t_array = value();
-            uint8_array n_array = n.value();
-            res |= t_array.diff(n_array, info, epsilon);
-        }
-        else if(dtype().is_uint16())
-        {
-            uint16_array t_array = value();
-            uint16_array n_array = n.value();
-            res |= t_array.diff(n_array, info, epsilon);
-        }
-        else if(dtype().is_uint32())
-        {
-            uint32_array t_array = value();
-            uint32_array n_array = n.value();
-            res |= t_array.diff(n_array, info, epsilon);
-        }
-        else if(dtype().is_uint64())
-        {
-            uint64_array t_array = value();
-            uint64_array n_array = n.value();
-            res |= t_array.diff(n_array, info, epsilon);
-        }
-        else if(dtype().is_float32())
-        {
-            float32_array t_array = value();
-            float32_array n_array = n.value();
-            res |= t_array.diff(n_array, info, epsilon);
-        }
-        else if(dtype().is_float64())
-        {
-            float64_array t_array = value();
-            float64_array n_array = n.value();
-            res |= t_array.diff(n_array, info, epsilon);
-        }
-        else if(dtype().is_char8_str())
-        {
-            // NOTE: Can't use 'value' for characters since type aliasing can
-            // confuse the 'char' type on various platforms.
-            char_array t_array((const void*)m_data, dtype());
-            char_array n_array((const void*)n.m_data, n.dtype());
-            res |= t_array.diff(n_array, info, epsilon);
-        }
-        else
-        {
-            CONDUIT_ERROR("<Node::diff> unrecognized data type");
-            res = true;
-        }
+        diffs.add_leaf(this,&n,&info,parent);
     }
+}
 
-    log::validation(info, !res);
+//---------------------------------------------------------------------------//
+bool
+Node::diff_leaf(const Node &n, Node &info, const float64 epsilon) const
+{
+    bool res = false;
+    if(dtype().is_int8())
+    {
+        int8_array t_array = value();
+        int8_array n_array = n.value();
+        res |= t_array.diff(n_array, info, epsilon);
+    }
+    else if(dtype().is_int16())
+    {
+        int16_array t_array = value();
+        int16_array n_array = n.value();
+        res |= t_array.diff(n_array, info, epsilon);
+    }
+    else if(dtype().is_int32())
+    {
+        int32_array t_array = value();
+        int32_array n_array = n.value();
+        res |= t_array.diff(n_array, info, epsilon);
+    }
+    else if(dtype().is_int64())
+    {
+        int64_array t_array = value();
+        int64_array n_array = n.value();
+        res |= t_array.diff(n_array, info, epsilon);
+    }
+    else if(dtype().is_uint8())
+    {
+        uint8_array t_array = value();
+        uint8_array n_array = n.value();
+        res |= t_array.diff(n_array, info, epsilon);
+    }
+    else if(dtype().is_uint16())
+    {
+        uint16_array t_array = value();
+        uint16_array n_array = n.value();
+        res |= t_array.diff(n_array, info, epsilon);
+    }
+    else if(dtype().is_uint32())
+    {
+        uint32_array t_array = value();
+        uint32_array n_array = n.value();
+        res |= t_array.diff(n_array, info, epsilon);
+    }
+    else if(dtype().is_uint64())
+    {
+        uint64_array t_array = value();
+        uint64_array n_array = n.value();
+        res |= t_array.diff(n_array, info, epsilon);
+    }
+    else if(dtype().is_float32())
+    {
+        float32_array t_array = value();
+        float32_array n_array = n.value();
+        res |= t_array.diff(n_array, info, epsilon);
+    }
+    else if(dtype().is_float64())
+    {
+        float64_array t_array = value();
+        float64_array n_array = n.value();
+        res |= t_array.diff(n_array, info, epsilon);
+    }
+    else if(dtype().is_char8_str())
+    {
+        // NOTE: Can't use 'value' for characters since type aliasing can
+        // confuse the 'char' type on various platforms.
+        char_array t_array((const void*)m_data, dtype());
+        char_array n_array((const void*)n.m_data, n.dtype());
+        res |= t_array.diff(n_array, info, epsilon);
+    }
+    else
+    {
+        CONDUIT_ERROR("<Node::diff> unrecognized data type");
+        res = true;
+    }
 
     return res;
 }
@@ -15637,12 +18464,19 @@ Node::info(Node &res, const std::string &curr_path) const
             {
                 ptr_ref["type"]  = "allocated";
                 ptr_ref["bytes"] = m_data_size;
+                ptr_ref["allocator_id"] = m_allocator_id;
             }
             else if(m_mmaped)
             {
                 ptr_ref["type"]  = "mmaped";
                 ptr_ref["bytes"] = m_data_size;
             }
+            else if(m_shared != NULL)
+            {
+                ptr_ref["type"]  = "shared";
+                ptr_ref["bytes"] = m_shared->data_size();
+                ptr_ref["use_count"] = m_shared->use_count();
+            }
             else
             {
                 ptr_ref["type"]  = "external";
@@ -85,6 +85,7 @@ namespace conduit
 class Generator;
 class NodeIterator;
 class NodeConstIterator;
+class NodePath;
 
 //-----------------------------------------------------------------------------
 // -- begin conduit::Node --
@@ -139,10 +140,31 @@ public:
 //-----------------------------------------------------------------------------
     Node();
     Node(const Node &node);
+#ifdef CONDUIT_HAS_MOVE_SEMANTICS
+    // move constructor, takes over node's data, schema and children
+    // (node is left empty). noexcept lets std::vector<Node> move
+    // elements when it grows.
+    Node(Node &&node) noexcept
+    {
+        init_defaults();
+        swap(node);
+    }
+#endif
     ~Node();
 
     // returns any node to the empty state
     void reset();
+
+    // exchanges the data, schema and children of two nodes without 
+    // copying any data. Each node keeps its place (parent) in its own tree, 
+    // so this can be used to move a finished subtree into a child slot:
+    //   n["fields/pressure"].swap(pressure_node);
+    // Neither node can be a descendant of the other.
+    void swap(Node &node);
+
+    // moves node's data, schema and children into this node without 
+    // copying any data (this node is reset first, node is left empty)
+    void move(Node &node);
     
 //-----------------------------------------------------------------------------
 // -- constructors for generic types --
@@ -249,17 +271,109 @@ public:
     void load(const std::string &stream_path,
               const std::string &protocol="");
 
+    /// load variant with options, supported options:
+    ///
+    ///  endianness:
+    ///     "default", "little" or "big": converts the data to the given
+    ///     endianness ("default" is the machine's) while loading. For 
+    ///     conduit_bin the data file is mapped and swapped into this 
+    ///     node in one pass. Without this option data keeps the 
+    ///     endianness it was saved with.
+    void load(const std::string &stream_path,
+              const std::string &protocol,
+              const Node &options);
+
     void load(const std::string &stream_path,
               const Schema &schema);
 
     void save(const std::string &stream_path,
               const std::string &protocol="") const;
 
+    /// save variant with options, supported options:
+    ///
+    ///  schema_protocol: (conduit_bin only) 
+    ///     "json" (default): writes the schema as json text to 
+    ///                       "{stream_path}_json"
+    ///     "binary": writes the schema with Schema::serialize_binary to
+    ///               "{stream_path}_schema_bin"
+    ///
+    ///  load() and mmap() use whichever schema file exists.
+    ///
+    ///  checksum: (conduit_bin only)
+    ///     "none" (default), "crc32c", or "xxhash64": writes the 
+    ///     checksum() of the data to "{stream_path}_checksum". load() 
+    ///     verifies it when the file exists (mmap() and load_lazy() 
+    ///     don't, since they read the data on demand).
+    void save(const std::string &stream_path,
+              const std::string &protocol,
+              const Node &options) const;
+
     void mmap(const std::string &stream_path);
 
     void mmap(const std::string &stream_path,
               const Schema &schema);
 
+    /// mmap variants with options, supported options:
+    ///
+    ///  mode:
+    ///     "rw" (default): read / write, changes are written to the file
+    ///     "ro":           read only, writing to the data is an error
+    ///                     (it faults)
+    ///     "private":      copy-on-write, changes stay in memory
+    ///
+    ///  offset: byte offset of the data in the file, to map a tree 
+    ///          stored inside a larger container file (default 0)
+    ///
+    ///  populate: "true" reads all of the data while mapping,
+    ///            "false" (default) reads pages on first access
+    ///
+    ///  advice: access pattern hint (ignored on windows except 
+    ///          "sequential")
+    ///     "normal" (default), "sequential", "random", or "willneed"
+    ///
+    ///  huge_pages: "true" asks for transparent huge pages where 
+    ///              supported (a hint, default "false")
+    void mmap(const std::string &stream_path,
+              const Node &options);
+
+    void mmap(const std::string &stream_path,
+              const Schema &schema,
+              const Node &options);
+
+    /// lazy variants of load for the conduit_bin protocol: only the schema
+    /// is read up front. The data file is mapped copy-on-write and its pages
+    /// are read from the file on first access, so only the parts of the 
+    /// tree that are used are read. (Modifications stay in memory, they 
+    /// are never written to the file.)
+    void load_lazy(const std::string &stream_path);
+
+    void load_lazy(const std::string &stream_path,
+                   const Schema &schema);
+
+    /// reads the data of the given paths (leaves or subtrees) of a lazily
+    /// loaded or mmaped tree ahead of access. Can be called on the 
+    /// root or any descendant of the tree.
+    void prefetch(const std::string &path);
+    void prefetch(const std::vector<std::string> &paths);
+
+    /// releases the pages of a lazily loaded or mmaped tree that have been
+    /// read, they are read from the file again on next access. 
+    /// For lazily loaded and "private" mode trees this discards any 
+    /// modifications.
+    void evict();
+
+    /// provides data read counters for a lazily loaded or mmaped tree:
+    ///
+    ///  mode:             mmap mode ("private" for lazily loaded trees)
+    ///  offset:           offset of the data in the file
+    ///  bytes_total:      size of the data
+    ///  bytes_resident:   bytes of the data file currently in memory
+    ///                    (page granular, includes pages the OS cached 
+    ///                     for earlier reads of the file, -1 on windows)
+    ///  bytes_prefetched: bytes read with prefetch()
+    ///  num_evicts:       number of evict() calls
+    void lazy_load_info(Node &info) const;
+
 //-----------------------------------------------------------------------------
 ///@}
 //-----------------------------------------------------------------------------
@@ -298,6 +412,17 @@ public:
     void set_data_using_dtype(const DataType &dtype, void *data);
     void set(const DataType &dtype, void *data);
 
+//-----------------------------------------------------------------------------
+// -- allocator selection --
+//-----------------------------------------------------------------------------
+    /// Selects the allocator (see utils::register_allocator) used for
+    /// data owned by this node and its existing descendants. Children
+    /// created later inherit their parent's allocator.
+    ///
+    /// Any data this hierarchy already owns is moved into memory from the
+    /// new allocator.
+    void set_allocator(index_t allocator_id);
+
 //-----------------------------------------------------------------------------
 // -- set for bitwidth style scalar types ---
 //-----------------------------------------------------------------------------
@@ -2688,6 +2813,52 @@ public:
 //
 //-----------------------------------------------------------------------------
 
+//-----------------------------------------------------------------------------
+//
+// -- begin declaration of Node set_shared methods --
+//
+//-----------------------------------------------------------------------------
+///@name Node::set_shared(...)
+///@{
+//-----------------------------------------------------------------------------
+/// description:
+///   set_shared(...) methods share the data of the passed node instead of 
+///   copying it. The buffer that holds the data becomes a reference counted
+///   shared buffer, which is freed when the last node that uses it releases 
+///   it (reference counts are updated atomically, so nodes that share a
+///   buffer can be released from different threads).
+///
+///   Data in shared buffers is copy-on-write: when a leaf is changed 
+///   through set(), update(), update_compatible() or endian_swap() while 
+///   other nodes use its buffer, the leaf first gets its own compact copy
+///   of its data. Writes through pointers (data_ptr(), DataArrays, ...) 
+///   are not tracked, call unshare() before using them to change data.
+///
+///   If no single allocated buffer holds the data of the passed node 
+///   (external or mmaped data, or leaves allocated one by one), the data
+///   is copied into a new shared buffer.
+///
+///   Only set_shared() shares data: set_node() (and set(), the copy
+///   constructor and assignment) always copy it, also when the passed
+///   node's data is in a shared buffer.
+//-----------------------------------------------------------------------------
+    //-------------------------------------------------------------------------
+    void set_shared_node(const Node &n);
+    void set_shared(const Node &n);
+
+    //-------------------------------------------------------------------------
+    /// gives the leaves of this node that use a shared buffer with other 
+    /// nodes their own copies of their data
+    void unshare();
+
+//-----------------------------------------------------------------------------
+///@}                      
+//-----------------------------------------------------------------------------
+//
+// -- end declaration of Node set_shared methods --
+//
+//-----------------------------------------------------------------------------
+
 
 //-----------------------------------------------------------------------------
 //
@@ -2705,6 +2876,13 @@ public:
 // -- assignment operators for generic types --
 //-----------------------------------------------------------------------------
     Node &operator=(const Node &node);
+#ifdef CONDUIT_HAS_MOVE_SEMANTICS
+    Node &operator=(Node &&node)
+    {
+        move(node);
+        return *this;
+    }
+#endif
     Node &operator=(const DataType &dtype);
     Node &operator=(const Schema &schema);
 
@@ -2921,6 +3099,31 @@ public:
     /// serialize to an output stream
     void        serialize(std::ofstream &ofs) const;
 
+    /// describes a block of this node's data, in serialized order:
+    /// num_elements elements of element_bytes bytes each, stride bytes
+    /// apart starting at data. Contiguous blocks can be sent or written
+    /// as is, strided blocks need to be gathered (see kernels::gather).
+    struct IOVec
+    {
+        const void *data;
+        index_t     element_bytes;
+        index_t     stride;
+        index_t     num_elements;
+
+        bool        is_contiguous() const
+                        {return num_elements <= 1 ||
+                                stride == element_bytes;}
+        index_t     number_of_bytes() const
+                        {return num_elements * element_bytes;}
+    };
+
+    /// lists the blocks of data that make up the serialized form of this
+    /// node, without copying any data. Leaves that are contiguous in 
+    /// memory are merged into a single block (a compact tree is one 
+    /// block). serialize() writes files from this list using writev(),
+    /// gathering strided leaves through a small fixed size buffer.
+    void        serialize_iovecs(std::vector<IOVec> &iovecs) const;
+
 //-----------------------------------------------------------------------------
 // -- compaction methods ---
 //-----------------------------------------------------------------------------
@@ -2949,6 +3152,11 @@ public:
 //-----------------------------------------------------------------------------
     void endian_swap(index_t endianness);
 
+    /// compacts this node into n_dest with the given endianness, swapping 
+    /// bytes while copying (in one pass)
+    void endian_swap_to(Node &n_dest,
+                        index_t endianness) const;
+
     void endian_swap_to_machine_default()
         {endian_swap(Endianness::DEFAULT_ID);}
     
@@ -3080,6 +3288,24 @@ public:
 
     void    to_data_type(index_t dtype_id, Node &res) const;
 
+    /// If this node already holds numeric data of the given type, res is 
+    /// set as an external (zero-copy) view of this node's data and this 
+    /// method returns false. Otherwise the data is converted into res 
+    /// (as in to_data_type) and this method returns true.
+    ///
+    /// Note: A view shares data with this node, writes to res change it.
+    bool    to_data_type_if_needed(index_t dtype_id, Node &res) const;
+
+//-----------------------------------------------------------------------------
+// -- reductions --
+//-----------------------------------------------------------------------------
+    /// summarizes the numeric leaves in this tree (see the DataArray 
+    /// reduction methods). res mirrors the tree, for each numeric leaf it
+    /// holds: count, min, max, sum, mean, argmin, argmax, and nonfinite.
+    /// sum is an int64, uint64 or float64 (see DataArray::sum_type).
+    /// Non-numeric leaves are skipped.
+    void    summarize(Node &res) const;
+
 //-----------------------------------------------------------------------------
 // -- Node::Value Helper class --
 //
@@ -3464,7 +3690,7 @@ public:
                         { return *m_schema;}
 
     const DataType   &dtype() const
-                        { return m_schema->dtype();}
+                        { return schema().dtype();}
 
     Schema          *schema_ptr() 
                         {return m_schema;}
@@ -3472,7 +3698,21 @@ public:
     // check if data owned by this node is externally
     // allocated.
     bool             is_data_external() const
-                        {return !m_alloced;}
+                        {return !m_alloced && m_shared == NULL;}
+
+    /// number of nodes that hold a reference to the shared buffer that
+    /// holds this node's data (0 if the data is not in a shared buffer,
+    /// see set_shared)
+    index_t          shared_use_count() const;
+
+    // check if this node's data is in a shared buffer
+    bool             is_data_shared() const
+                        {return shared_use_count() > 0;}
+
+    /// id of the allocator (see utils::register_allocator) used for
+    /// data owned by this node
+    index_t          allocator() const
+                        {return m_allocator_id;}
 
     // check if this node is the root of a tree nodes.
     bool             is_root() const
@@ -3559,6 +3799,39 @@ public:
                                      Node &info,
                                      const float64 epsilon = CONDUIT_EPSILON) const;
 
+    /// hash of this node's data and (optionally) its schema. Leaves are
+    /// hashed in place (strided leaves aren't compacted), so equal trees 
+    /// have equal hashes regardless of their memory layout. Large trees 
+    /// are hashed in parallel when threads are enabled (see 
+    /// conduit::set_num_threads). Supported options:
+    ///
+    ///  algorithm:
+    ///     "xxhash64" (default): 64 bit xxHash
+    ///     "crc32c":  CRC-32C of the data in compact order (the checksum 
+    ///                of a "conduit_bin" data file), in the low 32 bits.
+    ///                the schema is never included.
+    ///
+    ///  schema: (xxhash64 only) "true" (default) also hashes the names, 
+    ///          dtypes and shapes of the tree, "false" only the data
+    ///
+    ///  seed: (xxhash64 only) hash seed (default 0)
+    uint64           hash() const;
+    uint64           hash(const Node &options) const;
+
+    /// sets hashes to a tree with the same structure as this node, with 
+    /// the hash of each leaf (as a uint64) in place of its data. options 
+    /// are the same as hash(), with "schema" covering the leaf's dtype.
+    void             leaf_hashes(Node &hashes) const;
+    void             leaf_hashes(Node &hashes,
+                                 const Node &options) const;
+
+    /// checksum of this node's data as a string: "<algorithm>:<hex value>"
+    /// (e.g. "crc32c:e3069283"), algorithm is "crc32c" or "xxhash64".
+    /// save() and relay's hdf5 i/o store these to verify data on load.
+    std::string      checksum(const std::string &algorithm = "crc32c") const;
+    /// true if this node's data matches a checksum string
+    bool             verify_checksum(const std::string &checksum) const;
+
     ///
     /// info() creates a node that contains metadata about the current
     /// node's memory properties
@@ -3617,6 +3890,11 @@ public:
     Node             &fetch_existing(const std::string &path);
     const Node       &fetch_existing(const std::string &path) const;
 
+    /// `fetch_existing' variants that use a precompiled path
+    /// (see conduit::NodePath), for repeated lookups of the same path
+    Node             &fetch_existing(const NodePath &path);
+    const Node       &fetch_existing(const NodePath &path) const;
+
     /// DEPRECATED: `fetch_child` is deprecated in favor of `fetch_existing`
     ///
     /// the `fetch_child' methods don't modify map structure, if a path
@@ -3668,6 +3946,8 @@ public:
     bool        has_child(const std::string &name) const;
     /// checks if given path exists in the Node hierarchy 
     bool        has_path(const std::string &path) const;
+    /// checks if given precompiled path exists in the Node hierarchy 
+    bool        has_path(const NodePath &path) const;
     /// returns the direct child names for this node
     const std::vector<std::string> &child_names() const;
 
@@ -4053,6 +4333,10 @@ private:
 /// these methods are used for construction by the Node & Generator classes.
 //-----------------------------------------------------------------------------
     void             set_data_ptr(void *data_ptr);
+    /// replaces m_data in this node and its descendants that point to
+    /// curr_ptr (used when an owned buffer moves)
+    void             replace_data_ptr(const void *curr_ptr,
+                                      void *new_ptr);
     ///
     /// Note: set_schema_ptr is *only* used in the case were we have 
     /// a schema pointer that is owned by a parent schema. Using it to set a 
@@ -4101,17 +4385,53 @@ private:
 // -- private methods that help with init, memory allocation, and cleanup --
 //
 //-----------------------------------------------------------------------------
+    // private class that implements a cross platform memory map interface
+    class MMap;
+    // private class that holds a reference counted buffer (see set_shared)
+    class SharedBuffer;
+    // private class that writes the blocks listed by serialize_iovecs()
+    class IOVecWriter;
+    // private classes that run the leaf copies, hashes and comparisons 
+    // of tree operations (in parallel for large trees, see 
+    // conduit::parallel_for)
+    class StridedCopies;
+    class LeafHashes;
+    class LeafDiffs;
+
     // setup a node to at as a given type
     void             init(const DataType &dtype);
     // memory allocation and mapping routines
     void             allocate(index_t dsize);
     void             allocate(const DataType &dtype);
     void             mmap(const std::string &stream_path,
-                          index_t dsize);
+                          index_t dsize,
+                          const Node &options);
+    // finds the memory map that holds this node's data (or errors)
+    MMap            &mapped_source(const std::string &caller) const;
+    // first address and number of bytes spanned by this node's leaves
+    void             data_extent(uint8 *&start,
+                                 index_t &nbytes) const;
+    // finds this node or the nearest ancestor that owns or shares the
+    // buffer that holds [start, start + nbytes) (NULL if there is none)
+    const Node      *data_owner(const uint8 *start,
+                                index_t nbytes) const;
+    // returns the shared buffer that holds all of this node's data, the 
+    // buffer of the node that owns the data becomes shared if needed.
+    // returns NULL if no single allocated buffer holds the data.
+    SharedBuffer    *share_data() const;
+    // copy-on-write: gives this leaf its own copy of its data if it is in
+    // a shared buffer that other nodes use
+    void             unshare_leaf();
+    // check if [start, start + nbytes) is in a shared buffer other nodes use
+    bool             in_used_shared_buffer(const uint8 *start,
+                                           index_t nbytes) const;
     // release any alloced or memory mapped data
     void             release();
     // clean up everything (used by destructor)
     void             cleanup();
+    // resolves an existing path without copying its components,
+    // errors if the path does not exist
+    Node            *walk_existing_path(const std::string &path) const;
 
     // set defaults (used by constructors)
     void              init_defaults();
@@ -4130,31 +4450,97 @@ private:
     static void  identify_protocol(const std::string &path,
                                    std::string &io_type);
 
+    //-------------------------------------------------------------------------
+    // reads the schema of a conduit_bin file set, from 
+    // "{stream_path}_schema_bin" if it exists, or "{stream_path}_json"
+    static void  load_conduit_bin_schema(const std::string &stream_path,
+                                         Schema &schema);
+
 //-----------------------------------------------------------------------------
 //
 // -- private methods that help with hierarchical construction --
 //
 //-----------------------------------------------------------------------------
+    // private class that holds a block of child Node objects for trees
+    // built from a known schema (see utils::set_tree_block_threshold)
+    class NodeBlock;
+
     // work horse for complex node hierarchical setup
     static void      walk_schema(Node   *node,
                                  Schema *schema,
                                  void   *data);
 
+    static void      walk_schema(Node   *node,
+                                 Schema *schema,
+                                 void   *data,
+                                 NodeBlock *block);
+
     static void      mirror_node(Node *node,
                                  Schema *schema,
                                  const Node *src);
 
+    static void      mirror_node(Node *node,
+                                 Schema *schema,
+                                 const Node *src,
+                                 NodeBlock *block);
+
+    // creates a block for the descendants of schema, returns NULL if the
+    // tree is below the tree block threshold
+    static NodeBlock *create_block(const Schema *schema);
+    // creates a child node, in `block` when it is not NULL
+    static Node      *create_child(NodeBlock *block);
+    // destroys a child node created with create_child
+    static void       destroy_child(Node *node);
+
 //-----------------------------------------------------------------------------
 //
 // -- private methods that help with compaction, serialization, and info  --
 //
 //-----------------------------------------------------------------------------
+    /// queues the copies that compact this node into data
     void              compact_to(uint8 *data,
-                                 index_t curr_offset) const;
+                                 index_t curr_offset,
+                                 StridedCopies &copies) const;
+    /// sets up n_dest as the compact form of this node, and queues 
+    /// the data copies
+    void              compact_to(Node &n_dest,
+                                 StridedCopies &copies) const;
+    /// set_node() and update() helpers that set up the structure of this
+    /// node and queue the data copies
+    void              set_node(const Node &node,
+                               StridedCopies &copies);
+    void              update(const Node &n_src,
+                             StridedCopies &copies);
     /// compact helper for leaf types
     void              compact_elements_to(uint8 *data) const;
-
-
+    /// streams the data of this node's leaves (in compact order) 
+    /// through a base64 encoder
+    void              base64_encode_to(utils::Base64Encoder &enc) const;
+    /// fast path for update() and set_node(): when this node and n_src
+    /// have matching schema fingerprints and contiguous compact layouts,
+    /// queues a single copy of all of n_src's data.
+    /// returns false (and doesn't modify this node) if it doesn't apply
+    bool              update_contiguous(const Node &n_src,
+                                        StridedCopies &copies);
+    /// diff() helpers: diff_structure compares the tree structure and 
+    /// queues the leaf comparisons, which are done by diff_leaf
+    void              diff_structure(const Node &n,
+                                     Node &info,
+                                     index_t parent,
+                                     LeafDiffs &diffs) const;
+    bool              diff_leaf(const Node &n,
+                                Node &info,
+                                const float64 epsilon) const;
+    /// compact + endian swap helper, updates the dest schema's endianness
+    void              endian_swap_to(uint8 *data,
+                                     index_t curr_offset,
+                                     index_t endianness,
+                                     Schema &dest_schema) const;
+
+
+    /// appends this node's data blocks to iovecs (recursive helper for
+    /// serialize_iovecs)
+    void              serialize_iovecs_to(std::vector<IOVec> &iovecs) const;
     void              serialize(uint8 *data,
                                 index_t curr_offset) const;
 
@@ -4214,6 +4600,13 @@ private:
                                         index_t depth=0,
                                         const std::string &pad=" ",
                                         const std::string &eoe="\n") const;
+
+    void                to_json_generic(utils::TextWriter &w,
+                                        bool detailed, 
+                                        index_t indent, 
+                                        index_t depth,
+                                        const std::string &pad,
+                                        const std::string &eoe) const;
    
     //-------------------------------------------------------------------------
     // transforms the node to json without any conduit schema constructs
@@ -4303,6 +4696,13 @@ private:
                                         index_t depth=0,
                                         const std::string &pad=" ",
                                         const std::string &eoe="\n") const;
+
+    void                to_yaml_generic(utils::TextWriter &w,
+                                        bool detailed, 
+                                        index_t indent, 
+                                        index_t depth,
+                                        const std::string &pad,
+                                        const std::string &eoe) const;
     //-------------------------------------------------------------------------
     // transforms the node to yaml without any conduit schema constructs
     //-------------------------------------------------------------------------
@@ -4346,11 +4746,13 @@ private:
 
     // flag that indicates this node allocated m_data
     bool      m_alloced;
+    // id of the allocator used for owned data
+    index_t   m_allocator_id;
+    // id of the memory stats tag owned data is counted under
+    // (see utils::MemoryTag)
+    index_t   m_data_tag;
     // flag that indicates if m_data is memory-mapped
     bool      m_mmaped;
-    
-    // private class that implements a cross platform memory map interface
-    class MMap;
 
     // memory-map helper instance
     // This is only allocated if a memory map is active (m_mmaped is true)
@@ -4358,6 +4760,14 @@ private:
     // initializing nodes using memory maps, so it is still needed apart from 
     // simply knowing if this pointer is valid.
     MMap     *m_mmap;
+
+    // the shared buffer this node holds a reference to (NULL if none)
+    // Note: like owned data, the descendants of this node point into the
+    // buffer without holding references of their own.
+    SharedBuffer *m_shared;
+
+    // the block this node was created in (NULL if it was created with new)
+    NodeBlock *m_block;
 };
 //-----------------------------------------------------------------------------
 // -- end conduit::Node --
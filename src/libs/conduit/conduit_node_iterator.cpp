@@ -138,7 +138,7 @@ NodeIterator::name() const
     std::ostringstream oss;
 
     index_t index = m_index-1;
-    if(m_node->m_schema->dtype().is_list())
+    if(m_node->dtype().is_list())
     {
         oss << index;
     }
@@ -388,7 +388,7 @@ NodeConstIterator::name() const
     std::ostringstream oss;
 
     index_t index = m_index-1;
-    if(m_node->m_schema->dtype().is_list())
+    if(m_node->dtype().is_list())
     {
         oss << index;
     }
@@ -0,0 +1,540 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2019, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_node_leaf_index.cpp
+///
+//-----------------------------------------------------------------------------
+#include <sstream>
+
+#include "conduit_node_leaf_index.hpp"
+#include "conduit_error.hpp"
+#include "conduit_utils.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+// NodeLeafIndex
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// NodeLeafIndex Construction and Destruction
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+NodeLeafIndex::NodeLeafIndex()
+: m_root(NULL),
+  m_fingerprint(0),
+  m_total_bytes(0)
+{
+    m_path_offsets.push_back(0);
+}
+
+//---------------------------------------------------------------------------//
+NodeLeafIndex::NodeLeafIndex(Node &node)
+: m_root(NULL),
+  m_fingerprint(0),
+  m_total_bytes(0)
+{
+    build(node);
+}
+
+//---------------------------------------------------------------------------//
+NodeLeafIndex::~NodeLeafIndex()
+{
+    
+}
+
+//---------------------------------------------------------------------------//
+void
+NodeLeafIndex::reset()
+{
+    m_root = NULL;
+    m_fingerprint = 0;
+    m_leaves.clear();
+    m_total_bytes = 0;
+    m_paths.clear();
+    m_path_offsets.clear();
+    m_path_offsets.push_back(0);
+}
+
+//---------------------------------------------------------------------------//
+void
+NodeLeafIndex::build(Node &node)
+{
+    reset();
+    m_root = &node;
+    m_fingerprint = node.schema().fingerprint();
+
+    std::string path;
+    add_leaves(&node,path);
+    update_leaves();
+}
+
+//---------------------------------------------------------------------------//
+bool
+NodeLeafIndex::refresh()
+{
+    if(m_root == NULL)
+    {
+        return false;
+    }
+
+    bool same = (m_root->schema().fingerprint() == m_fingerprint);
+
+    if(same)
+    {
+        // equal fingerprints don't rule out a child that was removed and
+        // added back, so also check the leaf nodes themselves
+        index_t leaf_idx = 0;
+        same = same_leaves(m_root,leaf_idx) &&
+               leaf_idx == (index_t)m_leaves.size();
+    }
+
+    if(same)
+    {
+        update_leaves();
+    }
+    else
+    {
+        build(*m_root);
+    }
+
+    return !same;
+}
+
+//---------------------------------------------------------------------------//
+void
+NodeLeafIndex::add_leaves(Node *node,
+                          std::string &path)
+{
+    const DataType &dt = node->dtype();
+
+    if(dt.is_object() || dt.is_list())
+    {
+        const std::vector<std::string> &names = node->child_names();
+        bool is_obj = dt.is_object();
+        size_t path_len = path.size();
+        index_t nchld = node->number_of_children();
+        for(index_t i=0; i < nchld; i++)
+        {
+            if(path_len > 0)
+            {
+                path += "/";
+            }
+
+            if(is_obj)
+            {
+                // same escaping as Schema::name()
+                const std::string &name = names[(size_t)i];
+                if(name.find('/') != std::string::npos)
+                {
+                    path += "{" + name + "}";
+                }
+                else
+                {
+                    path += name;
+                }
+            }
+            else
+            {
+                std::ostringstream oss;
+                oss << "[" << i << "]";
+                path += oss.str();
+            }
+
+            add_leaves(node->child_ptr(i),path);
+            path.resize(path_len);
+        }
+    }
+    else if(!dt.is_empty())
+    {
+        Leaf leaf;
+        leaf.node    = node;
+        leaf.path_id = (index_t)m_leaves.size();
+        leaf.data    = NULL;
+        leaf.offset  = 0;
+        m_leaves.push_back(leaf);
+
+        m_paths += path;
+        m_path_offsets.push_back((index_t)m_paths.size());
+    }
+}
+
+//---------------------------------------------------------------------------//
+bool
+NodeLeafIndex::same_leaves(Node *node,
+                           index_t &leaf_idx) const
+{
+    const DataType &dt = node->dtype();
+
+    if(dt.is_object() || dt.is_list())
+    {
+        index_t nchld = node->number_of_children();
+        for(index_t i=0; i < nchld; i++)
+        {
+            if(!same_leaves(node->child_ptr(i),leaf_idx))
+            {
+                return false;
+            }
+        }
+    }
+    else if(!dt.is_empty())
+    {
+        if(leaf_idx >= (index_t)m_leaves.size() ||
+           m_leaves[(size_t)leaf_idx].node != node)
+        {
+            return false;
+        }
+        leaf_idx++;
+    }
+
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+void
+NodeLeafIndex::update_leaves()
+{
+    index_t offset = 0;
+    for(size_t i=0; i < m_leaves.size(); i++)
+    {
+        Leaf &leaf = m_leaves[i];
+        leaf.dtype  = leaf.node->dtype();
+        leaf.data   = leaf.node->element_ptr(0);
+        leaf.offset = offset;
+        offset += leaf.dtype.bytes_compact();
+    }
+    m_total_bytes = offset;
+}
+
+//-----------------------------------------------------------------------------
+// NodeLeafIndex property access.
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+Node *
+NodeLeafIndex::root() const
+{
+    return m_root;
+}
+
+//---------------------------------------------------------------------------//
+index_t
+NodeLeafIndex::number_of_leaves() const
+{
+    return (index_t)m_leaves.size();
+}
+
+//---------------------------------------------------------------------------//
+const NodeLeafIndex::Leaf &
+NodeLeafIndex::leaf(index_t idx) const
+{
+    if(idx < 0 || idx >= (index_t)m_leaves.size())
+    {
+        CONDUIT_ERROR("<NodeLeafIndex::leaf> leaf index " << idx
+                      << " out of range (number of leaves: "
+                      << m_leaves.size() << ")");
+    }
+    return m_leaves[(size_t)idx];
+}
+
+//---------------------------------------------------------------------------//
+const NodeLeafIndex::Leaf *
+NodeLeafIndex::leaves() const
+{
+    if(m_leaves.empty())
+    {
+        return NULL;
+    }
+    return &m_leaves[0];
+}
+
+//---------------------------------------------------------------------------//
+std::string
+NodeLeafIndex::path(index_t path_id) const
+{
+    if(path_id < 0 || path_id >= (index_t)m_leaves.size())
+    {
+        CONDUIT_ERROR("<NodeLeafIndex::path> path id " << path_id
+                      << " out of range (number of leaves: "
+                      << m_leaves.size() << ")");
+    }
+
+    index_t start = m_path_offsets[(size_t)path_id];
+    index_t end   = m_path_offsets[(size_t)path_id+1];
+    return m_paths.substr((size_t)start,(size_t)(end-start));
+}
+
+//---------------------------------------------------------------------------//
+index_t
+NodeLeafIndex::total_bytes_compact() const
+{
+    return m_total_bytes;
+}
+
+//---------------------------------------------------------------------------//
+void
+NodeLeafIndex::partition(index_t num_parts,
+                         std::vector<index_t> &starts) const
+{
+    if(num_parts < 1)
+    {
+        CONDUIT_ERROR("<NodeLeafIndex::partition> number of parts must be "
+                      "at least 1 (given: " << num_parts << ")");
+    }
+
+    index_t nleaves = (index_t)m_leaves.size();
+
+    starts.resize((size_t)num_parts+1);
+    starts[0] = 0;
+
+    // part p ends at the first leaf that starts at or past p/num_parts
+    // of the bytes. leaves are never split, so a large leaf can leave
+    // the parts after it empty.
+    index_t lidx = 0;
+    for(index_t p=1; p < num_parts; p++)
+    {
+        index_t target = (index_t)((m_total_bytes * (float64)p) / num_parts);
+        while(lidx < nleaves && m_leaves[(size_t)lidx].offset < target)
+        {
+            lidx++;
+        }
+        starts[(size_t)p] = lidx;
+    }
+    starts[(size_t)num_parts] = nleaves;
+}
+
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+// NodeLeafIterator
+//-----------------------------------------------------------------------------
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// NodeLeafIterator Construction and Destruction
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+NodeLeafIterator::NodeLeafIterator()
+: m_index(NULL),
+  m_leaf_idx(0),
+  m_num_leaves(0)
+{
+    
+}
+
+//---------------------------------------------------------------------------//
+NodeLeafIterator::NodeLeafIterator(const NodeLeafIndex &index,
+                                   index_t idx)
+: m_index(&index),
+  m_leaf_idx(idx),
+  m_num_leaves(index.number_of_leaves())
+{
+    
+}
+
+//---------------------------------------------------------------------------//
+NodeLeafIterator::NodeLeafIterator(const NodeLeafIterator &itr)
+: m_index(itr.m_index),
+  m_leaf_idx(itr.m_leaf_idx),
+  m_num_leaves(itr.m_num_leaves)
+{
+    
+}
+
+//---------------------------------------------------------------------------//
+NodeLeafIterator::~NodeLeafIterator()
+{
+    
+}
+
+//---------------------------------------------------------------------------//
+NodeLeafIterator &
+NodeLeafIterator::operator=(const NodeLeafIterator &itr)
+{
+    if(this != &itr)
+    {
+        m_index      = itr.m_index;
+        m_leaf_idx   = itr.m_leaf_idx;
+        m_num_leaves = itr.m_num_leaves;
+    }
+    return *this;
+}
+
+//-----------------------------------------------------------------------------
+// Iterator value and property access.
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+std::string
+NodeLeafIterator::path() const
+{
+    return m_index->path(leaf().path_id);
+}
+
+//---------------------------------------------------------------------------//
+index_t
+NodeLeafIterator::index() const
+{
+    return m_leaf_idx-1;
+}
+
+//---------------------------------------------------------------------------//
+Node &
+NodeLeafIterator::node()
+{
+    return *leaf().node;
+}
+
+//---------------------------------------------------------------------------//
+const NodeLeafIndex::Leaf &
+NodeLeafIterator::leaf() const
+{
+    if(m_index == NULL)
+    {
+        CONDUIT_ERROR("<NodeLeafIterator::leaf> iterator is not bound "
+                      "to an index");
+    }
+    return m_index->leaf(m_leaf_idx-1);
+}
+
+//-----------------------------------------------------------------------------
+// Iterator forward control.
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+bool
+NodeLeafIterator::has_next() const
+{
+    return m_leaf_idx < m_num_leaves;
+}
+
+//---------------------------------------------------------------------------//
+Node &
+NodeLeafIterator::next()
+{
+    if(has_next())
+    {
+        m_leaf_idx++;
+    }
+    else
+    {
+        CONDUIT_ERROR("next() when has_next() == false");
+    }
+    return node();
+}
+
+//---------------------------------------------------------------------------//
+Node &
+NodeLeafIterator::peek_next()
+{
+    if(!has_next())
+    {
+        CONDUIT_ERROR("peek_next() when has_next() == false");
+    }
+    return *m_index->leaf(m_leaf_idx).node;
+}
+
+//---------------------------------------------------------------------------//
+void
+NodeLeafIterator::to_front()
+{
+    m_leaf_idx = 0;
+}
+
+//-----------------------------------------------------------------------------
+// Iterator reverse control.
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+bool
+NodeLeafIterator::has_previous() const
+{
+    return m_leaf_idx > 1;
+}
+
+//---------------------------------------------------------------------------//
+Node &
+NodeLeafIterator::previous()
+{
+    if(has_previous())
+    {
+        m_leaf_idx--;
+    }
+    else
+    {
+        CONDUIT_ERROR("previous() when has_previous() == false");
+    }
+    return node();
+}
+
+//---------------------------------------------------------------------------//
+Node &
+NodeLeafIterator::peek_previous()
+{
+    if(!has_previous())
+    {
+        CONDUIT_ERROR("peek_previous() when has_previous() == false");
+    }
+    return *m_index->leaf(m_leaf_idx-2).node;
+}
+
+//---------------------------------------------------------------------------//
+void
+NodeLeafIterator::to_back()
+{
+    m_leaf_idx = m_num_leaves+1;
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
@@ -0,0 +1,257 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2019, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_node_leaf_index.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef CONDUIT_NODE_LEAF_INDEX_HPP
+#define CONDUIT_NODE_LEAF_INDEX_HPP
+
+//-----------------------------------------------------------------------------
+// -- standard lib includes -- 
+//-----------------------------------------------------------------------------
+#include <string>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// -- conduit includes -- 
+//-----------------------------------------------------------------------------
+#include "conduit_node.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::NodeLeafIndex --
+//-----------------------------------------------------------------------------
+///
+/// class: conduit::NodeLeafIndex
+///
+/// description:
+///  A flat array of the leaves of a Node tree, in depth-first order, built
+///  with a single walk of the tree. Bulk operations can loop over the 
+///  leaves instead of walking the tree, and split the tree into parts 
+///  of similar byte counts (see partition()).
+///
+///  Each leaf holds its Node, the id of its path, its dtype, a pointer to
+///  its first element, and its byte offset in the compact (serialized) 
+///  form of the tree.
+///
+///  The index doesn't track changes to the tree. refresh() updates it:
+///  if the tree still has the same structure (same schema fingerprint and
+///  leaf Nodes), only the dtypes, data pointers and offsets are re-read,
+///  otherwise the index is rebuilt. Either way refresh() walks the tree,
+///  so call it after changes, not before every loop over the leaves.
+///  The index must not outlive the tree.
+///
+//-----------------------------------------------------------------------------
+class CONDUIT_API NodeLeafIndex
+{
+public:
+    /// an entry of the index
+    struct Leaf
+    {
+        Node       *node;
+        /// id of the path of this leaf, see path()
+        index_t     path_id;
+        DataType    dtype;
+        /// address of the first element
+        void       *data;
+        /// offset of this leaf in the compact form of the tree
+        index_t     offset;
+    };
+
+//-----------------------------------------------------------------------------
+/// NodeLeafIndex Construction and Destruction
+//-----------------------------------------------------------------------------
+    /// Default constructor (empty index).
+    NodeLeafIndex();
+    /// Builds the index for the given tree.
+    explicit NodeLeafIndex(Node &node);
+    /// Destructor 
+    ~NodeLeafIndex();
+
+    /// (re)builds the index for the given tree
+    void                build(Node &node);
+    /// updates the index after changes to the tree, returns true if 
+    /// the index had to be rebuilt
+    bool                refresh();
+    /// clears the index
+    void                reset();
+
+//-----------------------------------------------------------------------------
+/// NodeLeafIndex property access.
+//-----------------------------------------------------------------------------
+    /// root of the indexed tree (NULL for an empty index)
+    Node               *root() const;
+
+    index_t             number_of_leaves() const;
+    const Leaf         &leaf(index_t idx) const;
+    /// pointer to the contiguous array of leaves (NULL if there are none)
+    const Leaf         *leaves() const;
+
+    /// path of the leaf with the given path id, relative to the root
+    std::string         path(index_t path_id) const;
+
+    /// total size of the leaves in compact form
+    index_t             total_bytes_compact() const;
+
+    /// splits the leaves into num_parts ranges of consecutive leaves with
+    /// similar byte counts. Part i is leaves [starts[i], starts[i+1]),
+    /// starts has num_parts + 1 entries.
+    void                partition(index_t num_parts,
+                                  std::vector<index_t> &starts) const;
+
+private:
+//-----------------------------------------------------------------------------
+//
+// -- conduit::NodeLeafIndex private members --
+//
+//-----------------------------------------------------------------------------
+    /// adds the leaves under node, path is the path of node
+    void                add_leaves(Node *node,
+                                   std::string &path);
+    /// checks that the leaves under node are the indexed leaves, 
+    /// starting at leaf_idx (used to check for changes)
+    bool                same_leaves(Node *node,
+                                    index_t &leaf_idx) const;
+    /// re-reads dtypes and data pointers, and recomputes offsets
+    void                update_leaves();
+
+    Node                    *m_root;
+    uint64                   m_fingerprint;
+    std::vector<Leaf>        m_leaves;
+    index_t                  m_total_bytes;
+
+    /// leaf paths are stored back to back in one string, path i is
+    /// [m_path_offsets[i], m_path_offsets[i+1])
+    std::string              m_paths;
+    std::vector<index_t>     m_path_offsets;
+};
+//-----------------------------------------------------------------------------
+// -- end conduit::NodeLeafIndex --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::NodeLeafIterator --
+//-----------------------------------------------------------------------------
+///
+/// class: conduit::NodeLeafIterator
+///
+/// description:
+///  Depth-first iterator over the leaves of a NodeLeafIndex.
+///
+//-----------------------------------------------------------------------------
+class CONDUIT_API NodeLeafIterator
+{
+public:
+//-----------------------------------------------------------------------------
+/// NodeLeafIterator Construction and Destruction
+//-----------------------------------------------------------------------------
+    /// Default constructor.
+    NodeLeafIterator();
+    /// Copy constructor.
+    NodeLeafIterator(const NodeLeafIterator &itr);
+    /// Primary iterator constructor.
+    NodeLeafIterator(const NodeLeafIndex &index,
+                     index_t idx=0);
+    /// Destructor 
+    ~NodeLeafIterator();
+
+    /// Assignment operator.
+    NodeLeafIterator &operator=(const NodeLeafIterator &itr);
+
+//-----------------------------------------------------------------------------
+/// Iterator value and property access.
+//-----------------------------------------------------------------------------
+    /// path of the current leaf, relative to the root of the index
+    std::string                  path()  const;
+    index_t                      index() const;
+    Node                        &node();
+    const NodeLeafIndex::Leaf   &leaf() const;
+
+//-----------------------------------------------------------------------------
+/// Iterator forward control.
+//-----------------------------------------------------------------------------
+    bool                         has_next() const;
+    Node                        &next();
+    Node                        &peek_next();
+    void                         to_front();
+
+//-----------------------------------------------------------------------------
+/// Iterator reverse control.
+//-----------------------------------------------------------------------------
+    bool                         has_previous() const;
+    Node                        &previous();
+    Node                        &peek_previous();
+    void                         to_back();
+
+private:
+//-----------------------------------------------------------------------------
+//
+// -- conduit::NodeLeafIterator private data members --
+//
+//-----------------------------------------------------------------------------
+    /// index wrapped by this iterator
+    const NodeLeafIndex *m_index;
+    /// current leaf index
+    index_t              m_leaf_idx;
+    /// total number of leaves
+    index_t              m_num_leaves;
+};
+//-----------------------------------------------------------------------------
+// -- end conduit::NodeLeafIterator --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
+
+#endif
@@ -0,0 +1,245 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2019, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_node_path.cpp
+///
+//-----------------------------------------------------------------------------
+#include "conduit_node_path.hpp"
+#include "conduit_error.hpp"
+#include "conduit_utils.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// NodePath Construction and Destruction
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+NodePath::NodePath()
+: m_path(),
+  m_components()
+{
+
+}
+
+//---------------------------------------------------------------------------//
+NodePath::NodePath(const std::string &path)
+: m_path(),
+  m_components()
+{
+    set(path);
+}
+
+//---------------------------------------------------------------------------//
+NodePath::~NodePath()
+{
+
+}
+
+//---------------------------------------------------------------------------//
+void
+NodePath::set(const std::string &path)
+{
+    m_path = path;
+    m_components.clear();
+
+    const char *p_curr = m_path.c_str();
+    const char *p_end  = p_curr + m_path.size();
+
+    while(p_curr != NULL && p_curr != p_end)
+    {
+        size_t p_curr_len = 0;
+        const char *p_next = utils::split_path(p_curr,p_end,p_curr_len);
+
+        // cull empty paths
+        if(p_curr_len > 0)
+        {
+            Component comp;
+            comp.name   = std::string(p_curr,p_curr_len);
+            comp.hash   = utils::hash(comp.name);
+            comp.parent = (comp.name == "..");
+            comp.cached_index = -1;
+            m_components.push_back(comp);
+        }
+
+        p_curr = p_next;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// NodePath property access
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+const std::string &
+NodePath::path() const
+{
+    return m_path;
+}
+
+//---------------------------------------------------------------------------//
+index_t
+NodePath::number_of_components() const
+{
+    return (index_t) m_components.size();
+}
+
+//-----------------------------------------------------------------------------
+// Lookups
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+Node *
+NodePath::find(Node &node) const
+{
+    return const_cast<Node*>(walk(node,false));
+}
+
+//---------------------------------------------------------------------------//
+const Node *
+NodePath::find(const Node &node) const
+{
+    return walk(node,false);
+}
+
+//---------------------------------------------------------------------------//
+Node &
+NodePath::fetch_existing(Node &node) const
+{
+    return *const_cast<Node*>(walk(node,true));
+}
+
+//---------------------------------------------------------------------------//
+const Node &
+NodePath::fetch_existing(const Node &node) const
+{
+    return *walk(node,true);
+}
+
+//---------------------------------------------------------------------------//
+bool
+NodePath::exists(const Node &node) const
+{
+    return walk(node,false) != NULL;
+}
+
+//---------------------------------------------------------------------------//
+const Node *
+NodePath::walk(const Node &node, bool error) const
+{
+    if(m_components.empty() && error)
+    {
+        CONDUIT_ERROR("Cannot fetch_existing empty path string");
+    }
+
+    const Node *curr = &node;
+
+    for(size_t i=0; i < m_components.size(); i++)
+    {
+        Component &comp = m_components[i];
+
+        if(comp.parent)
+        {
+            if(curr->parent() == NULL)
+            {
+                if(error)
+                {
+                    CONDUIT_ERROR("Cannot fetch_existing from NULL parent" 
+                                  << m_path);
+                }
+                return NULL;
+            }
+            curr = curr->parent();
+            continue;
+        }
+
+        const Schema &curr_schema = curr->schema();
+
+        if(!curr_schema.dtype().is_object())
+        {
+            if(error)
+            {
+                CONDUIT_ERROR("Cannot fetch_existing, Node(" << curr->path()
+                              << ") is not an object");
+            }
+            return NULL;
+        }
+
+        const Schema::Schema_Object_Hierarchy *obj_hier 
+                                            = curr_schema.object_hierarchy();
+
+        // try the cached index first
+        if(!obj_hier->matches(comp.cached_index,comp.name,comp.hash))
+        {
+            comp.cached_index = obj_hier->find(comp.name);
+
+            if(comp.cached_index < 0)
+            {
+                if(error)
+                {
+                    CONDUIT_ERROR("Cannot fetch non-existent "
+                                  << "child \"" << comp.name << "\" from Node("
+                                  << curr->path()
+                                  << ")");
+                }
+                return NULL;
+            }
+        }
+
+        curr = curr->child_ptr(comp.cached_index);
+    }
+
+    return curr;
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
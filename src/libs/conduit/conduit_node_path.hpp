@@ -0,0 +1,162 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2019, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: conduit_node_path.hpp
+///
+//-----------------------------------------------------------------------------
+
+#ifndef CONDUIT_NODE_PATH_HPP
+#define CONDUIT_NODE_PATH_HPP
+
+//-----------------------------------------------------------------------------
+// -- standard lib includes -- 
+//-----------------------------------------------------------------------------
+#include <string>
+#include <vector>
+
+//-----------------------------------------------------------------------------
+// -- conduit includes -- 
+//-----------------------------------------------------------------------------
+#include "conduit_node.hpp"
+
+//-----------------------------------------------------------------------------
+// -- begin conduit:: --
+//-----------------------------------------------------------------------------
+namespace conduit
+{
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::NodePath --
+//-----------------------------------------------------------------------------
+///
+/// class: conduit::NodePath
+///
+/// description:
+///  A path that is split and hashed once, for repeated lookups.
+///
+///  Each lookup caches the child index resolved for each path component. 
+///  Later lookups (in the same Node or in Nodes with the same layout) 
+///  only check the cached index against the child name before following
+///  it, and fall back to a full name lookup if it no longer matches.
+///
+///  Path rules match Node::fetch_existing: empty path components are 
+///  ignored and ".." refers to the parent.
+///
+///  The index cache is not synchronized, don't share a NodePath
+///  instance between threads.
+///
+//-----------------------------------------------------------------------------
+class CONDUIT_API NodePath
+{
+public:
+//-----------------------------------------------------------------------------
+/// NodePath Construction and Destruction
+//-----------------------------------------------------------------------------
+    /// Default constructor (empty path).
+    NodePath();
+    /// Primary constructor.
+    explicit NodePath(const std::string &path);
+    /// Destructor 
+    ~NodePath();
+
+    /// Changes the path and clears the index cache.
+    void                set(const std::string &path);
+
+//-----------------------------------------------------------------------------
+/// NodePath property access.
+//-----------------------------------------------------------------------------
+    /// the path string this NodePath was created from
+    const std::string  &path() const;
+    /// number of path components (empty components are not counted)
+    index_t             number_of_components() const;
+
+//-----------------------------------------------------------------------------
+/// Lookups
+//-----------------------------------------------------------------------------
+    /// returns the Node at this path relative to `node`, 
+    /// or NULL if the path does not exist
+    Node               *find(Node &node) const;
+    const Node         *find(const Node &node) const;
+
+    /// returns the Node at this path relative to `node`,
+    /// errors if the path does not exist
+    Node               &fetch_existing(Node &node) const;
+    const Node         &fetch_existing(const Node &node) const;
+
+    /// checks if this path exists relative to `node`
+    bool                exists(const Node &node) const;
+
+private:
+//-----------------------------------------------------------------------------
+//
+// -- conduit::NodePath private members --
+//
+//-----------------------------------------------------------------------------
+    /// walks the path, errors or returns NULL for missing paths
+    const Node         *walk(const Node &node, bool error) const;
+
+    struct Component
+    {
+        std::string     name;
+        unsigned int    hash;
+        bool            parent;
+        /// last child index resolved for this component
+        index_t         cached_index;
+    };
+
+    std::string             m_path;
+    mutable std::vector<Component>  m_components;
+};
+//-----------------------------------------------------------------------------
+// -- end conduit::NodePath --
+//-----------------------------------------------------------------------------
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit:: --
+//-----------------------------------------------------------------------------
+
+#endif
@@ -53,6 +53,21 @@
 // -- standard lib includes -- 
 //-----------------------------------------------------------------------------
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <new>
+
+#ifdef CONDUIT_USE_CXX11
+#include <atomic>
+#elif defined(CONDUIT_PLATFORM_WINDOWS)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <Windows.h>
+#endif
 
 //-----------------------------------------------------------------------------
 // -- conduit includes -- 
@@ -70,6 +85,49 @@ namespace conduit
 
 std::vector<std::string> Schema::m_empty_child_names;
 
+//-----------------------------------------------------------------------------
+//
+// -- helpers for Schema::fingerprint() --
+//
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+// finalizer from splitmix64, spreads the bits of v over the whole result
+static uint64
+fingerprint_mix(uint64 v)
+{
+    v ^= v >> 30;
+    v *= 0xbf58476d1ce4e5b9ULL;
+    v ^= v >> 27;
+    v *= 0x94d049bb133111ebULL;
+    v ^= v >> 31;
+    return v;
+}
+
+//---------------------------------------------------------------------------//
+static uint64
+fingerprint_combine(uint64 seed,
+                    uint64 v)
+{
+    return fingerprint_mix(seed ^ (v + 0x9e3779b97f4a7c15ULL + 
+                                   (seed << 6) + (seed >> 2)));
+}
+
+//---------------------------------------------------------------------------//
+// 64-bit FNV-1a, (the 32-bit name hashes cached for lookups are too
+// narrow to identify a schema)
+static uint64
+fingerprint_name(const std::string &name)
+{
+    uint64 res = 0xcbf29ce484222325ULL;
+    for(size_t i=0; i < name.size(); i++)
+    {
+        res ^= (uint64)(unsigned char)name[i];
+        res *= 0x100000001b3ULL;
+    }
+    return res;
+}
+
 //=============================================================================
 //-----------------------------------------------------------------------------
 //
@@ -146,9 +204,107 @@ Schema::reset()
 //
 //-----------------------------------------------------------------------------
 
+//---------------------------------------------------------------------------//
+// Header of a block of Schema objects, the objects follow the header
+// in the same allocation.
+//
+// Blocks are filled by the thread that builds the tree, but the objects in
+// a block may be destroyed from any thread, so the live count is atomic.
+//---------------------------------------------------------------------------//
+struct Schema::SchemaBlock
+{
+    index_t capacity;
+    index_t used;
+    /// number of objects created in the block that are not yet destroyed
+#ifdef CONDUIT_USE_CXX11
+    std::atomic<long> live;
+#else
+    volatile long     live;
+#endif
+
+    //-----------------------------------------------------------------------//
+    SchemaBlock(index_t capacity_)
+    : capacity(capacity_),
+      used(0),
+      live(0)
+    {}
+
+    //-----------------------------------------------------------------------//
+    static size_t header_bytes()
+    {
+        // keep the objects 16-byte aligned
+        return (sizeof(SchemaBlock) + 15) & ~((size_t)15);
+    }
+
+    //-----------------------------------------------------------------------//
+    static SchemaBlock *create(index_t capacity)
+    {
+        void *mem = malloc(header_bytes() + 
+                           sizeof(Schema) * (size_t)capacity);
+        if(mem == NULL)
+        {
+            CONDUIT_ERROR("Failed to allocate block for " 
+                          << capacity << " Schemas");
+        }
+        return new (mem) SchemaBlock(capacity);
+    }
+
+    //-----------------------------------------------------------------------//
+    void *take()
+    {
+        if(used >= capacity)
+        {
+            return NULL;
+        }
+        uint8 *start = ((uint8*)this) + header_bytes();
+        void *res = start + sizeof(Schema) * (size_t)used;
+        used++;
+        add_live(1);
+        return res;
+    }
+
+    //-----------------------------------------------------------------------//
+    void release_one()
+    {
+        // the block is freed when the last object in it is destroyed
+        if(add_live(-1) == 0)
+        {
+            this->~SchemaBlock();
+            free(this);
+        }
+    }
+
+    //-----------------------------------------------------------------------//
+    // adds delta to the live count atomically, returns the new count
+    long add_live(long delta)
+    {
+#if defined(CONDUIT_USE_CXX11)
+        return live.fetch_add(delta) + delta;
+#elif defined(CONDUIT_PLATFORM_WINDOWS)
+        return InterlockedExchangeAdd(&live,delta) + delta;
+#else
+        return __sync_add_and_fetch(&live,delta);
+#endif
+    }
+};
+
 //---------------------------------------------------------------------------//
 void 
 Schema::set(const Schema &schema)
+{
+    SchemaBlock *block = NULL;
+    index_t num_desc = schema.number_of_descendants();
+    if(utils::tree_block_threshold() > 0 && 
+       num_desc >= utils::tree_block_threshold())
+    {
+        block = SchemaBlock::create(num_desc);
+    }
+    set(schema,block);
+}
+
+//---------------------------------------------------------------------------//
+void 
+Schema::set(const Schema &schema, SchemaBlock *block)
 {
     reset();
     bool init_children = false;
@@ -158,8 +314,12 @@ Schema::set(const Schema &schema)
        init_object();
        init_children = true;
 
-       object_map()   = schema.object_map();
-       object_order() = schema.object_order();
+       Schema_Object_Hierarchy *obj_hier = object_hierarchy();
+       const Schema_Object_Hierarchy *src_hier = schema.object_hierarchy();
+       obj_hier->object_order  = src_hier->object_order;
+       obj_hier->object_hashes = src_hier->object_hashes;
+       obj_hier->object_index  = src_hier->object_index;
+       obj_hier->object_removed = src_hier->object_removed;
     } 
     else if (dt_id == DataType::LIST_ID)
     {
@@ -178,11 +338,19 @@ Schema::set(const Schema &schema)
        const std::vector<Schema*> &their_children = schema.children();
        for (size_t i = 0; i < their_children.size(); i++) 
        {
-           Schema *child_schema = new Schema(*their_children[i]);
+           Schema *child_schema = create_child(block);
+           child_schema->set(*their_children[i],block);
            child_schema->m_parent = this;
            my_children.push_back(child_schema);
        }
     }
+
+    // the copy has the same fingerprint
+    if(schema.m_fingerprint_valid)
+    {
+        m_fingerprint = schema.m_fingerprint;
+        m_fingerprint_valid = true;
+    }
 }
 
 
@@ -224,6 +392,43 @@ Schema::set(const std::string &json_schema)
 //
 //-----------------------------------------------------------------------------
 
+//---------------------------------------------------------------------------//
+void
+Schema::swap(Schema &schema)
+{
+    if(this == &schema)
+    {
+        return;
+    }
+
+    std::swap(m_dtype,schema.m_dtype);
+    std::swap(m_hierarchy_data,schema.m_hierarchy_data);
+    // cached fingerprints follow the contents, but the parents change
+    std::swap(m_fingerprint,schema.m_fingerprint);
+    std::swap(m_fingerprint_valid,schema.m_fingerprint_valid);
+
+    if(m_parent != NULL)
+    {
+        m_parent->invalidate_fingerprint();
+    }
+
+    if(schema.m_parent != NULL)
+    {
+        schema.m_parent->invalidate_fingerprint();
+    }
+
+    // children now belong to the other schema
+    for(index_t i=0; i < number_of_children(); i++)
+    {
+        children()[(size_t)i]->m_parent = this;
+    }
+
+    for(index_t i=0; i < schema.number_of_children(); i++)
+    {
+        schema.children()[(size_t)i]->m_parent = &schema;
+    }
+}
+
 //---------------------------------------------------------------------------//
 Schema &
 Schema::operator=(const Schema &schema)
@@ -339,6 +544,87 @@ Schema::spanned_bytes() const
 }
 
 
+//---------------------------------------------------------------------------//
+bool
+Schema::is_compact_layout(index_t &curr_offset) const
+{
+    index_t dt_id = m_dtype.id();
+    if(dt_id == DataType::OBJECT_ID || dt_id == DataType::LIST_ID)
+    {
+        const std::vector<Schema*> &lst = children();
+        for (std::vector<Schema*>::const_iterator itr = lst.begin();
+             itr < lst.end(); ++itr)
+        {
+            if(!(*itr)->is_compact_layout(curr_offset))
+            {
+                return false;
+            }
+        }
+    }
+    else if (dt_id != DataType::EMPTY_ID)
+    {
+        index_t ele_bytes = DataType::default_bytes(dt_id);
+        if(m_dtype.offset() != curr_offset ||
+           m_dtype.element_bytes() != ele_bytes ||
+           m_dtype.stride() != ele_bytes)
+        {
+            return false;
+        }
+        curr_offset += m_dtype.bytes_compact();
+    }
+    return true;
+}
+
+//---------------------------------------------------------------------------//
+uint64
+Schema::fingerprint() const
+{
+    if(m_fingerprint_valid)
+    {
+        return m_fingerprint;
+    }
+
+    index_t dt_id = m_dtype.id();
+    uint64 res = fingerprint_mix((uint64)dt_id + 1);
+
+    if(dt_id == DataType::OBJECT_ID)
+    {
+        // children are summed, so the result doesn't depend on their 
+        // order (equals doesn't either)
+        const std::vector<std::string> &names = object_order();
+        const std::vector<Schema*> &lst = children();
+        uint64 chld_sum = 0;
+        for(size_t i = 0; i < lst.size(); i++)
+        {
+            chld_sum += fingerprint_combine(fingerprint_name(names[i]),
+                                            lst[i]->fingerprint());
+        }
+        res = fingerprint_combine(res,(uint64)lst.size());
+        res = fingerprint_combine(res,chld_sum);
+    }
+    else if(dt_id == DataType::LIST_ID)
+    {
+        const std::vector<Schema*> &lst = children();
+        for(size_t i = 0; i < lst.size(); i++)
+        {
+            res = fingerprint_combine(res,lst[i]->fingerprint());
+        }
+        res = fingerprint_combine(res,(uint64)lst.size());
+    }
+    else
+    {
+        // the same fields DataType::equals compares
+        res = fingerprint_combine(res,(uint64)m_dtype.number_of_elements());
+        res = fingerprint_combine(res,(uint64)m_dtype.offset());
+        res = fingerprint_combine(res,(uint64)m_dtype.element_bytes());
+        res = fingerprint_combine(res,(uint64)m_dtype.endianness());
+    }
+
+    m_fingerprint = res;
+    m_fingerprint_valid = true;
+    return res;
+}
+
 //---------------------------------------------------------------------------//
 bool
 Schema::compatible(const Schema &s) const
@@ -350,26 +636,28 @@ Schema::compatible(const Schema &s) const
         return false;
     
     bool res = true;
+
+    if(this == &s)
+    {
+        return true;
+    }
     
     if(dt_id == DataType::OBJECT_ID)
     {
-        // each of s's entries that match paths must have dtypes that match
-        
-        std::map<std::string, index_t>::const_iterator itr;
-        
-        for(itr  = s.object_map().begin(); 
-            itr != s.object_map().end() && res;
-            itr++)
+        // each of s's entries that match names must have dtypes that match
+        const Schema_Object_Hierarchy *obj_hier = object_hierarchy();
+        const std::vector<std::string> &s_names = s.object_order();
+        const std::vector<Schema*> &s_lst = s.children();
+        const std::vector<Schema*> &lst   = children();
+
+        for(size_t i = 0; i < s_names.size() && res; i++)
         {
-            // make sure we actually have the path
-            if(has_path(itr->first))
+            // make sure we actually have the child
+            index_t idx = obj_hier->find(s_names[i]);
+            if(idx >= 0)
             {
-                // use index to fetch the child from the other schema
-                const Schema &s_chld = s.child(itr->second);
-                // fetch our child by name
-                const Schema &chld = child(itr->first);
                 // do compat check
-                res = chld.compatible(s_chld);
+                res = lst[(size_t)idx]->compatible(*s_lst[i]);
             }
         }
     }
@@ -406,45 +694,47 @@ Schema::equals(const Schema &s) const
 
     if(dt_id != s_dt_id)
         return false;
-    
+
+    if(this == &s)
+        return true;
+
     bool res = true;
-    
+
+    if(dt_id == DataType::OBJECT_ID || dt_id == DataType::LIST_ID)
+    {
+        // equal schemas have equal fingerprints, so (cached) fingerprints
+        // quickly reject most unequal schemas. matching fingerprints can
+        // still collide, so they are followed by the full comparison.
+        if(fingerprint() != s.fingerprint())
+            return false;
+    }
+
     if(dt_id == DataType::OBJECT_ID)
     {
         // all entries must be equal
-        
-        std::map<std::string, index_t>::const_iterator itr;
-        
-        for(itr  = s.object_map().begin(); 
-            itr != s.object_map().end() && res;
-            itr++)
-        {
-            if(has_path(itr->first))
-            {
-                size_t s_idx = (size_t) itr->second;
-                res = s.children()[s_idx]->equals(child(itr->first));
-            }
-            else
-            {
-                res = false;
-            }
-        }
-        
-        for(itr  = object_map().begin(); 
-            itr != object_map().end() && res;
-            itr++)
+        // (names are unique, so with matching counts it's enough to 
+        //  check that each of s's entries exists here)
+        if(number_of_children() != s.number_of_children())
+            return false;
+
+        const Schema_Object_Hierarchy *obj_hier = object_hierarchy();
+        const std::vector<std::string> &s_names = s.object_order();
+        const std::vector<Schema*> &s_lst = s.children();
+        const std::vector<Schema*> &lst   = children();
+
+        for(size_t i = 0; i < s_names.size() && res; i++)
         {
-            if(s.has_path(itr->first))
+            index_t idx = obj_hier->find(s_names[i]);
+            if(idx >= 0)
             {
-                size_t idx = (size_t) itr->second;
-                res = children()[idx]->equals(s.child(itr->first));
+                res = s_lst[i]->equals(*lst[(size_t)idx]);
             }
             else
             {
                 res = false;
             }
         }
-        
+
     }
     else if(dt_id == DataType::LIST_ID) 
     {
@@ -613,47 +903,63 @@ Schema::to_json_stream(std::ostream &os,
                        index_t depth,
                        const std::string &pad,
                        const std::string &eoe) const
+{
+    utils::TextWriter w(os);
+    to_json_stream(w,indent,depth,pad,eoe);
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::to_json_stream(utils::TextWriter &w,
+                       index_t indent,
+                       index_t depth,
+                       const std::string &pad,
+                       const std::string &eoe) const
 {
     if(m_dtype.id() == DataType::OBJECT_ID)
     {
-        os << eoe;
-        utils::indent(os,indent,depth,pad);
-        os << "{" << eoe;
+        w.write(eoe);
+        w.write_indent(indent,depth,pad);
+        w.write('{');
+        w.write(eoe);
 
         size_t nchildren = children().size();
         for(size_t i=0; i < nchildren;i++)
         {
-            utils::indent(os,indent,depth+1,pad);
-            os << "\""<< object_order()[i] << "\": ";
-            children()[i]->to_json_stream(os,indent,depth+1,pad,eoe);
+            w.write_indent(indent,depth+1,pad);
+            w.write('"');
+            w.write(object_order()[i]);
+            w.write("\": ",3);
+            children()[i]->to_json_stream(w,indent,depth+1,pad,eoe);
             if(i < nchildren-1)
-                os << ",";
-            os << eoe;
+                w.write(',');
+            w.write(eoe);
         }
-        utils::indent(os,indent,depth,pad);
-        os << "}";
+        w.write_indent(indent,depth,pad);
+        w.write('}');
     }
     else if(m_dtype.id() == DataType::LIST_ID)
     {
-        os << eoe;
-        utils::indent(os,indent,depth,pad);
-        os << "[" << eoe;
+        w.write(eoe);
+        w.write_indent(indent,depth,pad);
+        w.write('[');
+        w.write(eoe);
         
         size_t nchildren = children().size();
         for(size_t i=0; i < nchildren;i++)
         {
-            utils::indent(os,indent,depth+1,pad);
-            children()[i]->to_json_stream(os,indent,depth+1,pad,eoe);
+            w.write_indent(indent,depth+1,pad);
+            children()[i]->to_json_stream(w,indent,depth+1,pad,eoe);
             if(i < nchildren-1)
-                os << ",";
-            os << eoe;
+                w.write(',');
+            w.write(eoe);
         }
-        utils::indent(os,indent,depth,pad);
-        os << "]";
+        w.write_indent(indent,depth,pad);
+        w.write(']');
     }
     else // assume leaf data type
     {
-        m_dtype.to_json_stream(os,0,0,"","");
+        m_dtype.to_json_stream(w,0,0,"","");
     }
 }
 
@@ -702,35 +1008,46 @@ Schema::to_yaml_stream(std::ostream &os,
                        index_t depth,
                        const std::string &pad,
                        const std::string &eoe) const
+{
+    utils::TextWriter w(os);
+    to_yaml_stream(w,indent,depth,pad,eoe);
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::to_yaml_stream(utils::TextWriter &w,
+                       index_t indent,
+                       index_t depth,
+                       const std::string &pad,
+                       const std::string &eoe) const
 {
     if(m_dtype.id() == DataType::OBJECT_ID)
     {
-        os << eoe;
+        w.write(eoe);
         size_t nchildren = children().size();
         for(size_t i=0; i <  nchildren;i++)
         {
-            utils::indent(os,indent,depth,pad);
+            w.write_indent(indent,depth,pad);
             // we always need eoe
-            os << object_order()[i] << ": " << eoe;
-            children()[i]->to_yaml_stream(os,
+            w.write(object_order()[i]);
+            w.write(": ",2);
+            w.write(eoe);
+            children()[i]->to_yaml_stream(w,
                                           indent,
                                           depth+1,
                                           pad,
                                           eoe);
-
-
-
         }
     }
     else if(m_dtype.id() == DataType::LIST_ID)
     {
-        os << eoe;
+        w.write(eoe);
         size_t nchildren = children().size();
         for(size_t i=0; i < nchildren;i++)
         {
-            utils::indent(os,indent,depth,pad);
-            os << "- ";
-            children()[i]->to_yaml_stream(os,
+            w.write_indent(indent,depth,pad);
+            w.write("- ",2);
+            children()[i]->to_yaml_stream(w,
                                           indent,
                                           depth+1,
                                           pad,
@@ -739,7 +1056,7 @@ Schema::to_yaml_stream(std::ostream &os,
     }
     else // assume leaf data type
     {
-        m_dtype.to_yaml_stream(os,
+        m_dtype.to_yaml_stream(w,
                                indent,
                                depth+1,
                                pad,
@@ -835,91 +1152,539 @@ Schema::load(const std::string &ifname)
 }
 
 
-
 //-----------------------------------------------------------------------------
 //
-/// Access to children (object and list interface)
+/// Binary encoding methods
+//
+//-----------------------------------------------------------------------------
+//
+// Layout of the encoding (version 1):
+//
+//  header:   4 magic bytes (0x89 'C' 'S' 'B'), 1 version byte
+//  names:    varint number of names, then for each name:
+//            varint length, followed by the name's bytes
+//  tree:     the schema's entries, depth first:
+//            varint dtype id
+//             object: varint number of children, then for each child:
+//                     varint index into the names table, child entry
+//             list:   varint number of children, then the child entries
+//             leaf:   flags byte, varint number of elements, then the
+//                     varint offset, element bytes and stride, when the
+//                     flags say they are present
+//
+//  leaf flags:
+//   bit 0: offset present (otherwise it is the end of the compact 
+//          bytes of the previous leaf)
+//   bit 1: element bytes present (otherwise the default for the id)
+//   bit 2: stride present (otherwise the element bytes)
+//   bits 3-4: endianness id
+//
+//  varints are unsigned LEB128, index_t values are zigzag encoded first.
 //
 //-----------------------------------------------------------------------------
 
 //---------------------------------------------------------------------------//
-index_t 
-Schema::number_of_children() const 
-{
-    if(m_dtype.id() != DataType::LIST_ID  &&
-       m_dtype.id() != DataType::OBJECT_ID)
-        return 0;
-    return (index_t)children().size();
-}
-
-
-
+// helpers for the binary encoding
 //---------------------------------------------------------------------------//
-Schema &
-Schema::child(index_t idx)
-{
-    return *children()[(size_t)idx];
-}
+static const uint8 binary_schema_magic[4]   = {0x89, 'C', 'S', 'B'};
+static const uint8 binary_schema_version    = 1;
+
+static const uint8 binary_leaf_has_offset     = 0x01;
+static const uint8 binary_leaf_has_ele_bytes  = 0x02;
+static const uint8 binary_leaf_has_stride     = 0x04;
+static const int   binary_leaf_endian_shift   = 3;
 
 //---------------------------------------------------------------------------//
-const Schema &
-Schema::child(index_t idx) const
+static void
+binary_write_varint(std::vector<uint8> &data,
+                    uint64 value)
 {
-    return *children()[(size_t)idx];
+    while(value >= 0x80)
+    {
+        data.push_back((uint8)(value | 0x80));
+        value >>= 7;
+    }
+    data.push_back((uint8)value);
 }
 
-
 //---------------------------------------------------------------------------//
-Schema *
-Schema::child_ptr(index_t idx)
+static void
+binary_write_index(std::vector<uint8> &data,
+                   index_t value)
 {
-    return &child(idx);
+    // zigzag, so small negative values stay small
+    uint64 uvalue = (uint64)value;
+    binary_write_varint(data, (uvalue << 1) ^ (value < 0 ? ~(uint64)0 : 0));
 }
 
 //---------------------------------------------------------------------------//
-const Schema *
-Schema::child_ptr(index_t idx) const
+// names are interned as they are found, the tree refers to them by index
+struct BinarySchemaWriter
 {
-    return &child(idx);
-}
+    std::vector<uint8>              tree;
+    std::vector<const std::string*> names;
+    std::map<std::string,index_t>   name_index;
+    index_t                         next_offset;
 
+    BinarySchemaWriter()
+    : next_offset(0)
+    {}
 
-//---------------------------------------------------------------------------//
-void    
-Schema::remove(index_t idx)
-{
-    index_t dtype_id = m_dtype.id();
-    if(! (dtype_id == DataType::LIST_ID || dtype_id == DataType::OBJECT_ID))
-    {
-        CONDUIT_ERROR("<Schema::remove> Error: Cannot remove child by index. "
-                      "Schema(" << this->path() << ") "
-                      "instance is not an Object or List, "
-                      "and therefore "
-                      "does not have children.");
-    }
-    
-    std::vector<Schema*>  &chldrn = children();
-    if( (size_t)idx >= chldrn.size())
+    //-----------------------------------------------------------------------//
+    index_t intern(const std::string &name)
     {
-        CONDUIT_ERROR("<Schema::remove> Invalid index:" 
-                    << idx << ">=" << chldrn.size() <<  "(number_of_children)");
+        std::map<std::string,index_t>::iterator itr = name_index.find(name);
+        if(itr != name_index.end())
+        {
+            return itr->second;
+        }
+        index_t idx = (index_t)names.size();
+        name_index[name] = idx;
+        names.push_back(&name);
+        return idx;
     }
 
-    if(dtype_id == DataType::OBJECT_ID)
+    //-----------------------------------------------------------------------//
+    void write(const Schema &schema)
     {
-        // any index above the current needs to shift down by one
-        for (size_t i = (size_t)idx; i < object_order().size(); i++)
+        const DataType &dtype = schema.dtype();
+        index_t dt_id = dtype.id();
+        binary_write_varint(tree,(uint64)dt_id);
+
+        if(dt_id == DataType::OBJECT_ID)
         {
-            object_map()[object_order()[i]]--;
+            const std::vector<std::string> &cld_names = schema.child_names();
+            binary_write_varint(tree,(uint64)cld_names.size());
+            for(size_t i=0; i < cld_names.size(); i++)
+            {
+                binary_write_varint(tree,(uint64)intern(cld_names[i]));
+                write(*schema.child_ptr((index_t)i));
+            }
         }
-        
-        object_map().erase(object_order()[(size_t)idx]);
-        object_order().erase(object_order().begin() + (size_t)idx);
-    }
+        else if(dt_id == DataType::LIST_ID)
+        {
+            index_t num_children = schema.number_of_children();
+            binary_write_varint(tree,(uint64)num_children);
+            for(index_t i=0; i < num_children; i++)
+            {
+                write(*schema.child_ptr(i));
+            }
+        }
+        else
+        {
+            index_t endianness = dtype.endianness();
+            if(endianness < 0 || endianness > 3)
+            {
+                CONDUIT_ERROR("<Schema::serialize_binary> "
+                              "Unsupported endianness: " << endianness);
+            }
 
-    Schema* child = chldrn[(size_t)idx];
-    delete child;
+            uint8 flags = (uint8)(endianness << binary_leaf_endian_shift);
+            if(dtype.offset() != next_offset)
+            {
+                flags |= binary_leaf_has_offset;
+            }
+            if(dtype.element_bytes() != DataType::default_bytes(dt_id))
+            {
+                flags |= binary_leaf_has_ele_bytes;
+            }
+            if(dtype.stride() != dtype.element_bytes())
+            {
+                flags |= binary_leaf_has_stride;
+            }
+
+            tree.push_back(flags);
+            binary_write_index(tree,dtype.number_of_elements());
+
+            if(flags & binary_leaf_has_offset)
+            {
+                binary_write_index(tree,dtype.offset());
+            }
+            if(flags & binary_leaf_has_ele_bytes)
+            {
+                binary_write_index(tree,dtype.element_bytes());
+            }
+            if(flags & binary_leaf_has_stride)
+            {
+                binary_write_index(tree,dtype.stride());
+            }
+
+            next_offset = dtype.offset() + dtype.bytes_compact();
+        }
+    }
+};
+
+//---------------------------------------------------------------------------//
+// reads an encoding, checking bounds as it goes
+struct BinarySchemaReader
+{
+    const uint8              *curr;
+    const uint8              *end;
+    std::vector<std::string>  names;
+    index_t                   next_offset;
+
+    BinarySchemaReader(const uint8 *data,
+                       index_t num_bytes)
+    : curr(data),
+      end(data + num_bytes),
+      next_offset(0)
+    {}
+
+    //-----------------------------------------------------------------------//
+    index_t remaining() const
+    {
+        return (index_t)(end - curr);
+    }
+
+    //-----------------------------------------------------------------------//
+    uint8 read_byte()
+    {
+        if(curr >= end)
+        {
+            CONDUIT_ERROR("<Schema::parse_binary> "
+                          "Unexpected end of binary schema data");
+        }
+        return *curr++;
+    }
+
+    //-----------------------------------------------------------------------//
+    uint64 read_varint()
+    {
+        uint64 res = 0;
+        for(int shift = 0; shift < 64; shift += 7)
+        {
+            uint8 b = read_byte();
+            res |= ((uint64)(b & 0x7f)) << shift;
+            if( (b & 0x80) == 0)
+            {
+                return res;
+            }
+        }
+        CONDUIT_ERROR("<Schema::parse_binary> Invalid varint");
+        return 0;
+    }
+
+    //-----------------------------------------------------------------------//
+    index_t read_index()
+    {
+        uint64 uvalue = read_varint();
+        return (index_t)((uvalue >> 1) ^ (~(uvalue & 1) + 1));
+    }
+
+    //-----------------------------------------------------------------------//
+    // counts are bounded by the remaining bytes (each entry takes at 
+    // least one byte), which keeps corrupt data from causing huge 
+    // allocations
+    index_t read_count()
+    {
+        uint64 res = read_varint();
+        if(res > (uint64)remaining())
+        {
+            CONDUIT_ERROR("<Schema::parse_binary> "
+                          "Invalid count in binary schema data: " << res);
+        }
+        return (index_t)res;
+    }
+
+    //-----------------------------------------------------------------------//
+    void read_header()
+    {
+        for(int i=0; i < 4; i++)
+        {
+            if(read_byte() != binary_schema_magic[i])
+            {
+                CONDUIT_ERROR("<Schema::parse_binary> "
+                              "Data is not a binary schema encoding");
+            }
+        }
+
+        uint8 version = read_byte();
+        if(version != binary_schema_version)
+        {
+            CONDUIT_ERROR("<Schema::parse_binary> "
+                          "Unsupported binary schema version: "
+                          << (int)version);
+        }
+
+        index_t num_names = read_count();
+        names.resize((size_t)num_names);
+        for(index_t i=0; i < num_names; i++)
+        {
+            index_t len = read_count();
+            names[(size_t)i].assign((const char*)curr,(size_t)len);
+            curr += len;
+        }
+    }
+
+    //-----------------------------------------------------------------------//
+    void read(Schema &schema)
+    {
+        uint64 dt_id = read_varint();
+
+        if(dt_id == DataType::OBJECT_ID)
+        {
+            schema.set(DataType::object());
+            index_t num_children = read_count();
+            for(index_t i=0; i < num_children; i++)
+            {
+                uint64 name_idx = read_varint();
+                if(name_idx >= (uint64)names.size())
+                {
+                    CONDUIT_ERROR("<Schema::parse_binary> "
+                                  "Invalid name index: " << name_idx);
+                }
+                Schema &cld = schema.add_child(names[(size_t)name_idx]);
+                if(schema.number_of_children() != i + 1)
+                {
+                    CONDUIT_ERROR("<Schema::parse_binary> "
+                                  "Duplicate child name: "
+                                  << names[(size_t)name_idx]);
+                }
+                read(cld);
+            }
+        }
+        else if(dt_id == DataType::LIST_ID)
+        {
+            schema.set(DataType::list());
+            index_t num_children = read_count();
+            for(index_t i=0; i < num_children; i++)
+            {
+                read(schema.append());
+            }
+        }
+        else if(dt_id <= (uint64)DataType::CHAR8_STR_ID)
+        {
+            uint8 flags = read_byte();
+            index_t num_ele   = read_index();
+            index_t offset    = next_offset;
+            index_t ele_bytes = DataType::default_bytes((index_t)dt_id);
+
+            if(flags & binary_leaf_has_offset)
+            {
+                offset = read_index();
+            }
+            if(flags & binary_leaf_has_ele_bytes)
+            {
+                ele_bytes = read_index();
+            }
+            index_t stride = ele_bytes;
+            if(flags & binary_leaf_has_stride)
+            {
+                stride = read_index();
+            }
+
+            index_t endianness = (flags >> binary_leaf_endian_shift) & 0x3;
+            if(endianness > Endianness::LITTLE_ID)
+            {
+                CONDUIT_ERROR("<Schema::parse_binary> "
+                              "Invalid endianness: " << endianness);
+            }
+
+            schema.set(DataType((index_t)dt_id,
+                                num_ele,
+                                offset,
+                                stride,
+                                ele_bytes,
+                                endianness));
+            next_offset = offset + schema.dtype().bytes_compact();
+        }
+        else
+        {
+            CONDUIT_ERROR("<Schema::parse_binary> "
+                          "Invalid dtype id: " << dt_id);
+        }
+    }
+};
+
+//---------------------------------------------------------------------------//
+void
+Schema::serialize_binary(std::vector<uint8> &data) const
+{
+    BinarySchemaWriter writer;
+    writer.write(*this);
+
+    data.clear();
+    data.reserve(writer.tree.size() + 16 * writer.names.size() + 16);
+    data.insert(data.end(),binary_schema_magic,binary_schema_magic + 4);
+    data.push_back(binary_schema_version);
+
+    binary_write_varint(data,(uint64)writer.names.size());
+    for(size_t i=0; i < writer.names.size(); i++)
+    {
+        const std::string &name = *writer.names[i];
+        binary_write_varint(data,(uint64)name.size());
+        data.insert(data.end(),name.begin(),name.end());
+    }
+
+    data.insert(data.end(),writer.tree.begin(),writer.tree.end());
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::serialize_binary(const std::string &stream_path) const
+{
+    std::vector<uint8> data;
+    serialize_binary(data);
+
+    std::ofstream ofile;
+    ofile.open(stream_path.c_str(), std::ios::out | std::ios::binary);
+    if(!ofile.is_open())
+    {
+        CONDUIT_ERROR("<Schema::serialize_binary> failed to open file: "
+                      << "\"" << stream_path << "\"");
+    }
+    if(!data.empty())
+    {
+        ofile.write((const char*)&data[0],(std::streamsize)data.size());
+    }
+    ofile.close();
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::parse_binary(const uint8 *data,
+                     index_t num_bytes)
+{
+    if(data == NULL || num_bytes < 0)
+    {
+        CONDUIT_ERROR("<Schema::parse_binary> Invalid data");
+    }
+
+    BinarySchemaReader reader(data,num_bytes);
+    reader.read_header();
+
+    // parse into a temp, so this schema isn't left half built on error
+    Schema res;
+    reader.read(res);
+
+    if(reader.remaining() != 0)
+    {
+        CONDUIT_ERROR("<Schema::parse_binary> " << reader.remaining()
+                      << " unexpected trailing bytes in binary schema data");
+    }
+
+    reset();
+    swap(res);
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::parse_binary(const std::vector<uint8> &data)
+{
+    if(data.empty())
+    {
+        CONDUIT_ERROR("<Schema::parse_binary> Invalid data (empty)");
+    }
+    parse_binary(&data[0],(index_t)data.size());
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::load_binary(const std::string &stream_path)
+{
+    std::ifstream ifile;
+    ifile.open(stream_path.c_str(), std::ios::in | std::ios::binary);
+    if(!ifile.is_open())
+    {
+        CONDUIT_ERROR("<Schema::load_binary> failed to open file: "
+                      << "\"" << stream_path << "\"");
+    }
+    std::vector<uint8> data((std::istreambuf_iterator<char>(ifile)),
+                            std::istreambuf_iterator<char>());
+    ifile.close();
+    parse_binary(data);
+}
+
+//---------------------------------------------------------------------------//
+bool
+Schema::is_binary(const uint8 *data,
+                  index_t num_bytes)
+{
+    return data != NULL && num_bytes >= 5 &&
+           memcmp(data,binary_schema_magic,4) == 0;
+}
+
+
+
+//-----------------------------------------------------------------------------
+//
+/// Access to children (object and list interface)
+//
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+index_t 
+Schema::number_of_children() const 
+{
+    if(m_dtype.id() != DataType::LIST_ID  &&
+       m_dtype.id() != DataType::OBJECT_ID)
+        return 0;
+    return (index_t)children().size();
+}
+
+
+
+//---------------------------------------------------------------------------//
+Schema &
+Schema::child(index_t idx)
+{
+    return *children()[(size_t)idx];
+}
+
+//---------------------------------------------------------------------------//
+const Schema &
+Schema::child(index_t idx) const
+{
+    return *children()[(size_t)idx];
+}
+
+
+//---------------------------------------------------------------------------//
+Schema *
+Schema::child_ptr(index_t idx)
+{
+    return &child(idx);
+}
+
+//---------------------------------------------------------------------------//
+const Schema *
+Schema::child_ptr(index_t idx) const
+{
+    return &child(idx);
+}
+
+
+//---------------------------------------------------------------------------//
+void    
+Schema::remove(index_t idx)
+{
+    index_t dtype_id = m_dtype.id();
+    if(! (dtype_id == DataType::LIST_ID || dtype_id == DataType::OBJECT_ID))
+    {
+        CONDUIT_ERROR("<Schema::remove> Error: Cannot remove child by index. "
+                      "Schema(" << this->path() << ") "
+                      "instance is not an Object or List, "
+                      "and therefore "
+                      "does not have children.");
+    }
+    
+    std::vector<Schema*>  &chldrn = children();
+    if( (size_t)idx >= chldrn.size())
+    {
+        CONDUIT_ERROR("<Schema::remove> Invalid index:" 
+                    << idx << ">=" << chldrn.size() <<  "(number_of_children)");
+    }
+
+    if(dtype_id == DataType::OBJECT_ID)
+    {
+        // any index above the current shifts down by one
+        object_hierarchy()->remove(idx);
+    }
+
+    Schema* child = chldrn[(size_t)idx];
+    destroy_child(child);
     chldrn.erase(chldrn.begin() + (size_t)idx);
+    invalidate_fingerprint();
 }
 
 //---------------------------------------------------------------------------//
@@ -946,19 +1711,23 @@ Schema::operator[](index_t idx) const
 Schema&
 Schema::add_child(const std::string &name)
 {
-    if(has_child(name))
+    if(m_dtype.id() == DataType::OBJECT_ID)
     {
-        return child(name);
+        index_t idx = object_hierarchy()->find(name);
+        if(idx >= 0)
+        {
+            return *children()[(size_t)idx];
+        }
     }
 
     init_object();
+    invalidate_fingerprint();
 
     Schema* child = new Schema();
     child->m_parent = this;
     children().push_back(child);
-    object_map()[name] = children().size()-1;
-    object_order().push_back(name);
-    return *children()[child_index(name)];
+    object_hierarchy()->insert(name);
+    return *child;
 }
 
 
@@ -1005,33 +1774,7 @@ Schema::fetch_existing(const std::string &path)
                       "instance is not an Object, and therefore "
                       "does not have named children.");
     }
-    std::string p_curr;
-    std::string p_next;
-    utils::split_path(path,p_curr,p_next);
-
-    size_t idx = (size_t) child_index(p_curr);
-    
-    // check for parent
-    if(p_curr == "..")
-    {
-        if(m_parent == NULL)
-        {
-            CONDUIT_ERROR("Tried to fetch non-existent parent Schema.")
-        }
-        else
-        {
-            return m_parent->fetch_existing(p_next);
-        }
-    }
-    
-    if(p_next.empty())
-    {
-        return *children()[idx];
-    }
-    else
-    {
-        return children()[idx]->fetch_existing(p_next);
-    }
+    return *walk_existing_path(path);
 }
 
 
@@ -1049,27 +1792,7 @@ Schema::fetch_existing(const std::string &path) const
                       "does not have named children.");
     }
 
-    std::string p_curr;
-    std::string p_next;
-    utils::split_path(path,p_curr,p_next);
-
-    // check for parent
-    if(p_curr == "..")
-    {
-        if(m_parent != NULL) // TODO: check for erro (no parent)
-           return m_parent->fetch_existing(p_next);
-    }
-
-    size_t idx = (size_t) child_index(p_curr);
-    
-    if(p_next.empty())
-    {
-        return *children()[idx];
-    }
-    else
-    {
-        return children()[idx]->fetch_existing(p_next);
-    }
+    return *walk_existing_path(path);
 }
 
 //---------------------------------------------------------------------------//
@@ -1090,22 +1813,15 @@ Schema::fetch_child(const std::string &path) const
 index_t
 Schema::child_index(const std::string &name) const
 {
-    index_t res=0;
-
-    // find p_curr with an iterator
-    std::map<std::string, index_t>::const_iterator itr;
-    itr = object_map().find(name);
+    index_t res = object_hierarchy()->find(name);
 
     // error if child does not exist. 
-    if(itr == object_map().end())
+    if(res < 0)
     {
         CONDUIT_ERROR("<Schema::child_index> Error: "
                       << "Schema(" << this->path() << ") "
                       << "attempt to access invalid child named:" << name);
-    }
-    else
-    {
-        res = itr->second;
+        res = 0;
     }
 
     return res;
@@ -1161,18 +1877,12 @@ Schema::rename_child(const std::string &current_name,
                       " already exists.");
     }
 
-    std::map<std::string,index_t> &obj_map = object_map();
-    index_t idx = obj_map[current_name];
-
-    // update string to index map
+    Schema_Object_Hierarchy *obj_hier = object_hierarchy();
+    index_t idx = obj_hier->find(current_name);
 
-    // remove current_name
-    obj_map.erase(current_name);
-    // link new_name to the idx
-    obj_map[new_name] = idx;
-
-    // update index to string lookup
-    object_order()[(size_t)idx] = new_name;
+    // update both the index to string and string to index lookups
+    obj_hier->rename(idx,new_name);
+    invalidate_fingerprint();
 
     // we don't need to modify children(), we are not changing the
     // child schema 
@@ -1182,41 +1892,51 @@ Schema::rename_child(const std::string &current_name,
 //---------------------------------------------------------------------------//
 Schema &
 Schema::fetch(const std::string &path)
-{
-    // fetch w/ path forces OBJECT_ID
-    init_object();
-        
-    std::string p_curr;
-    std::string p_next;
-    utils::split_path(path,p_curr,p_next);
-
-    // handle parent 
-    // check for parent
-    if(p_curr == "..")
-    {
-        if(m_parent != NULL) // TODO: check for error (no parent)
-           return m_parent->fetch(p_next);
-    }
-    
-    if (!has_path(p_curr)) 
-    {
-        Schema* my_schema = new Schema();
-        my_schema->m_parent = this;
-        children().push_back(my_schema);
-        object_map()[p_curr] = children().size() - 1;
-        object_order().push_back(p_curr);
-    }
+{
+    // path components are looked up in place, std::strings are only 
+    // created for new children
+    Schema *curr = this;
+    const char *p_curr = path.c_str();
+    const char *p_end  = p_curr + path.size();
 
-    size_t idx = (size_t) child_index(p_curr);
-    if(p_next.empty())
-    {
-        return *children()[idx];
-    }
-    else
+    while(true)
     {
-        return children()[idx]->fetch(p_next);
-    }
+        // fetch w/ path forces OBJECT_ID
+        curr->init_object();
+
+        size_t p_curr_len = 0;
+        const char *p_next = utils::split_path(p_curr,p_end,p_curr_len);
+
+        // handle parent 
+        // check for parent
+        if(p_curr_len == 2 && p_curr[0] == '.' && p_curr[1] == '.' &&
+           curr->m_parent != NULL) // TODO: check for error (no parent)
+        {
+            curr = curr->m_parent;
+        }
+        else
+        {
+            Schema_Object_Hierarchy *obj_hier = curr->object_hierarchy();
+            index_t child_idx = obj_hier->find(p_curr,p_curr_len);
+            if (child_idx < 0) 
+            {
+                curr->invalidate_fingerprint();
+                Schema* my_schema = new Schema();
+                my_schema->m_parent = curr;
+                curr->children().push_back(my_schema);
+                obj_hier->insert(std::string(p_curr,p_curr_len));
+                child_idx = (index_t) curr->children().size() - 1;
+            }
+            curr = curr->children()[(size_t)child_idx];
+        }
+
+        if(p_next == NULL)
+        {
+            return *curr;
+        }
 
+        p_curr = p_next;
+    }
 }
 
 
@@ -1347,16 +2067,7 @@ Schema::has_child(const std::string &name) const
     if(m_dtype.id() != DataType::OBJECT_ID)
         return false;
 
-    const std::map<std::string,index_t> &ents = object_map();
-
-    if(ents.find(name) == ents.end())
-    {
-        return false;
-    }
-    else
-    {
-        return true;
-    }
+    return object_hierarchy()->find(name) >= 0;
 }
 
 
@@ -1364,31 +2075,35 @@ Schema::has_child(const std::string &name) const
 bool           
 Schema::has_path(const std::string &path) const
 {
-    // for the non-object case, has_path simply returns false
-    if(m_dtype.id() != DataType::OBJECT_ID)
-        return false;
-
-    std::string p_curr;
-    std::string p_next;
-    utils::split_path(path,p_curr,p_next);
-    
-    // handle parent case (..)
-    
-    const std::map<std::string,index_t> &ents = object_map();
+    const Schema *curr = this;
+    const char *p_curr = path.c_str();
+    const char *p_end  = p_curr + path.size();
 
-    if(ents.find(p_curr) == ents.end())
+    while(true)
     {
-        return false;
-    }
+        // for the non-object case, has_path simply returns false
+        if(curr->m_dtype.id() != DataType::OBJECT_ID)
+            return false;
 
-    if(!p_next.empty())
-    {
-        size_t idx = (size_t) ents.find(p_curr)->second;
-        return children()[idx]->has_path(p_next);
-    }
-    else
-    {
-        return true;
+        size_t p_curr_len = 0;
+        const char *p_next = utils::split_path(p_curr,p_end,p_curr_len);
+
+        // handle parent case (..)
+
+        index_t idx = curr->object_hierarchy()->find(p_curr,p_curr_len);
+
+        if(idx < 0)
+        {
+            return false;
+        }
+
+        if(p_next == NULL)
+        {
+            return true;
+        }
+
+        curr = curr->children()[(size_t)idx];
+        p_curr = p_next;
     }
 }
 
@@ -1450,15 +2165,11 @@ Schema::remove_child(const std::string &name)
 
     size_t idx = (size_t)child_index(name);
     Schema *child = children()[idx];
-    // any index above the current needs to shift down by one
-    for (size_t i = idx; i < object_order().size(); i++)
-    {
-        object_map()[object_order()[i]]--;
-    }
-    object_map().erase(name);
-    object_order().erase(object_order().begin() + idx);
+    // any index above the current shifts down by one
+    object_hierarchy()->remove((index_t)idx);
     children().erase(children().begin() + idx);
-    delete child;
+    destroy_child(child);
+    invalidate_fingerprint();
 }
 
 //---------------------------------------------------------------------------//
@@ -1466,6 +2177,7 @@ Schema &
 Schema::append()
 {
     init_list();
+    invalidate_fingerprint();
     Schema *sch = new Schema();
     sch->m_parent = this;
     children().push_back(sch);
@@ -1497,13 +2209,16 @@ Schema::init_defaults()
     m_dtype  = DataType::empty();
     m_hierarchy_data = NULL;
     m_parent = NULL;
+    m_block  = NULL;
+    m_fingerprint = 0;
+    m_fingerprint_valid = false;
 }
 
 //---------------------------------------------------------------------------//
 void
 Schema::init_object()
 {
-    if(dtype().id() != DataType::OBJECT_ID)
+    if(m_dtype.id() != DataType::OBJECT_ID)
     {
         reset();
         m_dtype  = DataType::object();
@@ -1515,7 +2230,7 @@ Schema::init_object()
 void
 Schema::init_list()
 {
-    if(dtype().id() != DataType::LIST_ID)
+    if(m_dtype.id() != DataType::LIST_ID)
     {
         reset();
         m_dtype  = DataType::list();
@@ -1528,21 +2243,24 @@ Schema::init_list()
 void
 Schema::release()
 {
-    if(dtype().id() == DataType::OBJECT_ID ||
-       dtype().id() == DataType::LIST_ID)
+    // (done first, so children stop at this schema when they invalidate)
+    invalidate_fingerprint();
+
+    if(m_dtype.id() == DataType::OBJECT_ID ||
+       m_dtype.id() == DataType::LIST_ID)
     {
         std::vector<Schema*> &chld = children();
         for(size_t i=0; i< chld.size(); i++)
         {
-            delete chld[i];
+            destroy_child(chld[i]);
         }
     }
     
-    if(dtype().id() == DataType::OBJECT_ID)
+    if(m_dtype.id() == DataType::OBJECT_ID)
     { 
         delete object_hierarchy();
     }
-    else if(dtype().id() == DataType::LIST_ID)
+    else if(m_dtype.id() == DataType::LIST_ID)
     { 
         delete list_hierarchy();
     }
@@ -1551,6 +2269,19 @@ Schema::release()
     m_hierarchy_data = NULL;
 }
 
+//---------------------------------------------------------------------------//
+void
+Schema::invalidate_fingerprint()
+{
+    // a stale schema has stale ancestors, so we can stop at the first one
+    Schema *curr = this;
+    while(curr != NULL && curr->m_fingerprint_valid)
+    {
+        curr->m_fingerprint_valid = false;
+        curr = curr->m_parent;
+    }
+}
+
 
 
 //-----------------------------------------------------------------------------
@@ -1594,6 +2325,7 @@ Schema::compact_to(Schema &s_dest, index_t curr_offset) const
     else if (dtype_id != DataType::EMPTY_ID)
     {
         // create a compact data type
+        s_dest.invalidate_fingerprint();
         m_dtype.compact_to(s_dest.m_dtype);
         s_dest.m_dtype.set_offset(curr_offset);
     }
@@ -1611,6 +2343,353 @@ Schema::walk_schema(const std::string &json_schema)
 }
 
 
+//---------------------------------------------------------------------------//
+Schema *
+Schema::walk_existing_path(const std::string &path) const
+{
+    // path components are looked up in place, without creating strings
+    Schema *curr = const_cast<Schema*>(this);
+    const char *p_curr = path.c_str();
+    const char *p_end  = p_curr + path.size();
+
+    while(true)
+    {
+        size_t p_curr_len = 0;
+        const char *p_next = utils::split_path(p_curr,p_end,p_curr_len);
+
+        // check for parent
+        if(p_curr_len == 2 && p_curr[0] == '.' && p_curr[1] == '.' &&
+           curr->m_parent != NULL)
+        {
+            curr = curr->m_parent;
+        }
+        else
+        {
+            index_t idx = -1;
+            if(curr->m_dtype.id() == DataType::OBJECT_ID)
+            {
+                idx = curr->object_hierarchy()->find(p_curr,p_curr_len);
+            }
+
+            if(idx < 0)
+            {
+                CONDUIT_ERROR("<Schema::fetch_existing> Error: "
+                              << "Schema(" << curr->path() << ") "
+                              << "attempt to access invalid child named:"
+                              << std::string(p_curr,p_curr_len));
+            }
+            curr = curr->children()[(size_t)idx];
+        }
+
+        if(p_next == NULL)
+        {
+            return curr;
+        }
+
+        p_curr = p_next;
+    }
+}
+
+//-----------------------------------------------------------------------------
+//
+/// -- Schema block allocation helpers --
+//
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+index_t
+Schema::number_of_descendants() const
+{
+    index_t res = number_of_children();
+    for(index_t i=0; i < number_of_children(); i++)
+    {
+        res += children()[(size_t)i]->number_of_descendants();
+    }
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+Schema *
+Schema::create_child(SchemaBlock *block)
+{
+    void *mem = NULL;
+    if(block != NULL)
+    {
+        mem = block->take();
+    }
+
+    if(mem == NULL)
+    {
+        return new Schema();
+    }
+
+    Schema *res = new (mem) Schema();
+    res->m_block = block;
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::destroy_child(Schema *schema)
+{
+    SchemaBlock *block = schema->m_block;
+    if(block == NULL)
+    {
+        delete schema;
+    }
+    else
+    {
+        schema->~Schema();
+        block->release_one();
+    }
+}
+
+//-----------------------------------------------------------------------------
+//
+/// -- Schema_Object_Hierarchy name lookup helpers --
+//
+//-----------------------------------------------------------------------------
+
+//---------------------------------------------------------------------------//
+index_t
+Schema::Schema_Object_Hierarchy::find(const std::string &name) const
+{
+    return find(name.c_str(),name.size());
+}
+
+//---------------------------------------------------------------------------//
+index_t
+Schema::Schema_Object_Hierarchy::find(const char *name,
+                                      size_t name_len) const
+{
+    if(object_index.empty())
+    {
+        // small object case: linear scan
+        for(size_t i=0; i < object_order.size(); i++)
+        {
+            const std::string &curr = object_order[i];
+            if(curr.size() == name_len &&
+               curr.compare(0,name_len,name,name_len) == 0)
+            {
+                return (index_t)i;
+            }
+        }
+        return -1;
+    }
+
+    unsigned int h = utils::hash(name,(unsigned int)name_len,0);
+    size_t mask = object_index.size() - 1;
+    size_t slot = h & mask;
+    while(true)
+    {
+        index_t idx = object_index[slot];
+        if(idx < 0)
+        {
+            return -1;
+        }
+        idx = current_index(idx);
+        if(object_hashes[(size_t)idx] == h &&
+           object_order[(size_t)idx].size() == name_len &&
+           object_order[(size_t)idx].compare(0,name_len,
+                                             name,name_len) == 0)
+        {
+            return idx;
+        }
+        slot = (slot + 1) & mask;
+    }
+}
+
+//---------------------------------------------------------------------------//
+bool
+Schema::Schema_Object_Hierarchy::matches(index_t idx,
+                                         const std::string &name,
+                                         unsigned int name_hash) const
+{
+    return idx >= 0 &&
+           (size_t)idx < object_order.size() &&
+           object_hashes[(size_t)idx] == name_hash &&
+           object_order[(size_t)idx] == name;
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::Schema_Object_Hierarchy::insert(const std::string &name)
+{
+    object_order.push_back(name);
+    object_hashes.push_back(utils::hash(name));
+
+    index_t num_names = (index_t)object_order.size();
+    if(num_names <= linear_scan_max)
+    {
+        return;
+    }
+
+    // keep the load factor at or below 1/2
+    if( (size_t)num_names * 2 > object_index.size() )
+    {
+        rebuild_index();
+    }
+    else
+    {
+        link(table_index(num_names - 1));
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::Schema_Object_Hierarchy::remove(index_t idx)
+{
+    if(!object_index.empty())
+    {
+        // unlink the entry, but defer renumbering the entries above it:
+        // record the removed table index instead
+        index_t table_idx = table_index(idx);
+        unlink(table_idx);
+        object_removed.insert(std::lower_bound(object_removed.begin(),
+                                               object_removed.end(),
+                                               table_idx),
+                              table_idx);
+    }
+
+    object_order.erase(object_order.begin() + (size_t)idx);
+    object_hashes.erase(object_hashes.begin() + (size_t)idx);
+
+    if(object_index.empty())
+    {
+        return;
+    }
+
+    size_t num_names = object_order.size();
+    if(num_names <= (size_t)linear_scan_max)
+    {
+        // back to the small object case
+        object_index.clear();
+        object_removed.clear();
+    }
+    else if(object_removed.size() * 8 > num_names)
+    {
+        // compact once enough removals have accumulated
+        rebuild_index();
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::Schema_Object_Hierarchy::rename(index_t idx,
+                                        const std::string &name)
+{
+    index_t table_idx = -1;
+    if(!object_index.empty())
+    {
+        table_idx = table_index(idx);
+        unlink(table_idx);
+    }
+
+    object_order[(size_t)idx]  = name;
+    object_hashes[(size_t)idx] = utils::hash(name);
+
+    if(!object_index.empty())
+    {
+        link(table_idx);
+    }
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::Schema_Object_Hierarchy::rebuild_index()
+{
+    size_t num_names = object_order.size();
+    size_t num_slots = 16;
+    while(num_slots < num_names * 2)
+    {
+        num_slots *= 2;
+    }
+
+    object_index.assign(num_slots,-1);
+    object_removed.clear();
+    for(size_t i=0; i < num_names; i++)
+    {
+        link((index_t)i);
+    }
+}
+
+//---------------------------------------------------------------------------//
+index_t
+Schema::Schema_Object_Hierarchy::current_index(index_t table_idx) const
+{
+    if(object_removed.empty())
+    {
+        return table_idx;
+    }
+    // shift down by the number of removed entries below
+    return table_idx - (index_t)(std::lower_bound(object_removed.begin(),
+                                                  object_removed.end(),
+                                                  table_idx)
+                                 - object_removed.begin());
+}
+
+//---------------------------------------------------------------------------//
+index_t
+Schema::Schema_Object_Hierarchy::table_index(index_t idx) const
+{
+    index_t res = idx;
+    for(size_t i=0; i < object_removed.size() && object_removed[i] <= res; i++)
+    {
+        res++;
+    }
+    return res;
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::Schema_Object_Hierarchy::link(index_t table_idx)
+{
+    size_t mask = object_index.size() - 1;
+    size_t slot = object_hashes[(size_t)current_index(table_idx)] & mask;
+    while(object_index[slot] >= 0)
+    {
+        slot = (slot + 1) & mask;
+    }
+    object_index[slot] = table_idx;
+}
+
+//---------------------------------------------------------------------------//
+void
+Schema::Schema_Object_Hierarchy::unlink(index_t table_idx)
+{
+    size_t mask = object_index.size() - 1;
+    size_t slot = object_hashes[(size_t)current_index(table_idx)] & mask;
+    while(object_index[slot] != table_idx)
+    {
+        slot = (slot + 1) & mask;
+    }
+
+    // backward shift deletion: move later entries of the probe run into
+    // the hole, so lookups never need tombstones
+    size_t hole = slot;
+    size_t curr = slot;
+    while(true)
+    {
+        curr = (curr + 1) & mask;
+        index_t curr_idx = object_index[curr];
+        if(curr_idx < 0)
+        {
+            break;
+        }
+
+        size_t home = object_hashes[(size_t)current_index(curr_idx)] & mask;
+        // entry can move if its home slot is not cyclically in (hole, curr]
+        bool in_range = (hole <= curr) ? (hole < home && home <= curr)
+                                       : (hole < home || home <= curr);
+        if(!in_range)
+        {
+            object_index[hole] = curr_idx;
+            hole = curr;
+        }
+    }
+    object_index[hole] = -1;
+}
+
 //-----------------------------------------------------------------------------
 //
 /// -- Private methods that help with access book keeping data structures. --
@@ -1702,13 +2781,6 @@ Schema::children()
 
 }
 
-//---------------------------------------------------------------------------//
-std::map<std::string, index_t> &
-Schema::object_map()
-{
-    return object_hierarchy()->object_map;
-}
-
 
 //---------------------------------------------------------------------------//
 std::vector<std::string> &
@@ -1731,13 +2803,6 @@ Schema::children() const
     }
 }
 
-//---------------------------------------------------------------------------//
-const std::map<std::string, index_t> &
-Schema::object_map() const
-{
-    return object_hierarchy()->object_map;
-}
-
 
 //---------------------------------------------------------------------------//
 const std::vector<std::string> &
@@ -1763,11 +2828,10 @@ Schema::object_map_print() const
 void
 Schema::object_order_print() const
 {
-    std::map<std::string, index_t>::const_iterator itr; 
-        
-    for(itr = object_map().begin(); itr != object_map().end();itr++)
+    const std::vector<std::string> &obj_order = object_order();
+    for(size_t i=0;i<obj_order.size();i++)
     {
-       std::cout << itr->first << ":" << itr->second << " ";
+       std::cout << obj_order[i] << ":" << object_hierarchy()->find(obj_order[i]) << " ";
     }
     std::cout << std::endl;
 }
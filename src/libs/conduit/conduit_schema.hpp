@@ -92,6 +92,7 @@ public:
     friend class Node;
     friend class NodeIterator;
     friend class NodeConstIterator;
+    friend class NodePath;
 
 //----------------------------------------------------------------------------
 //
@@ -118,11 +119,24 @@ public:
     /// create a schema from a json description (c string case)
     explicit Schema(const char *json_schema);
 
+#ifdef CONDUIT_HAS_MOVE_SEMANTICS
+    /// schema move constructor (the source is left empty)
+    Schema(Schema &&schema) noexcept
+    {
+        init_defaults();
+        swap(schema);
+    }
+#endif
+
     /// Schema Destructor
     ~Schema();
     /// return a schema to the default (empty) state
     void  reset();
 
+    /// exchanges the contents of two schemas without copying, each schema 
+    /// keeps its place (parent) in its own hierarchy
+    void  swap(Schema &schema);
+
 //-----------------------------------------------------------------------------
 //
 // Schema set methods
@@ -141,6 +155,17 @@ public:
 //
 //-----------------------------------------------------------------------------
     Schema &operator=(const Schema &schema);
+#ifdef CONDUIT_HAS_MOVE_SEMANTICS
+    Schema &operator=(Schema &&schema)
+    {
+        if(this != &schema)
+        {
+            reset();
+            swap(schema);
+        }
+        return *this;
+    }
+#endif
     Schema &operator=(index_t dtype_id);
     Schema &operator=(const DataType &dtype);
     Schema &operator=(const std::string &json_schema);
@@ -154,8 +179,11 @@ public:
     const DataType &dtype() const 
                         {return m_dtype;}
 
+    /// note: the non-const variant marks the cached fingerprint stale,
+    /// so don't hold onto the returned reference across fingerprint(),
+    /// equals() or compatible() calls
     DataType       &dtype() 
-                        {return m_dtype;}
+                        {invalidate_fingerprint(); return m_dtype;}
 
     index_t         element_index(index_t idx) const 
                         {return m_dtype.element_index(idx);}
@@ -170,8 +198,16 @@ public:
     bool            compatible(const Schema &s) const;
 
     /// is this schema equal to given schema
+    /// (objects and lists with different fingerprints are rejected without
+    /// walking their children)
     bool            equals(const Schema &s) const;
 
+    /// 64-bit structural hash of this schema, covering the data types,
+    /// child names and hierarchy (but not the order of object children).
+    /// It is computed lazily and cached until the schema is modified.
+    /// Equal schemas have equal fingerprints.
+    uint64          fingerprint() const;
+
     /// sum of the strided bytes of all leaves
     index_t         total_strided_bytes() const;
     /// sum of the bytes of the compact form of all leaves
@@ -345,6 +381,37 @@ public:
 
     void            load(const std::string &stream_path);
 
+//-----------------------------------------------------------------------------
+//
+/// Binary encoding methods
+//
+//-----------------------------------------------------------------------------
+/// description:
+///  A compact, versioned binary alternative to json schema text. Child names
+///  are interned in a table, dtype ids, offsets and strides are written as 
+///  varints, and offsets and strides that follow a compact layout are 
+///  implied. Large schemas encode to a fraction of their json size and 
+///  parse without a text parser.
+///
+//-----------------------------------------------------------------------------
+    /// encodes this schema into data (replacing its contents)
+    void            serialize_binary(std::vector<uint8> &data) const;
+    /// encodes this schema into a file
+    void            serialize_binary(const std::string &stream_path) const;
+
+    /// sets this schema from data created by serialize_binary,
+    /// errors if the data is not a valid encoding
+    void            parse_binary(const uint8 *data,
+                                 index_t num_bytes);
+    void            parse_binary(const std::vector<uint8> &data);
+    /// sets this schema from a file created by serialize_binary
+    void            load_binary(const std::string &stream_path);
+
+    /// checks if data starts with the binary encoding's header
+    /// (used to tell binary encodings from json text)
+    static bool     is_binary(const uint8 *data,
+                              index_t num_bytes);
+
 
 //-----------------------------------------------------------------------------
 //
@@ -456,6 +523,8 @@ private:
     void        init_object();
     // cleanup any allocated memory.
     void        release();
+    // marks the cached fingerprint of this schema and its ancestors stale
+    void        invalidate_fingerprint();
 
     /// helps with proper alloc size for:
     /// Node::set_using_schema()and Node::set_data_using_schema
@@ -467,6 +536,12 @@ private:
     /// still be confusion, so we are just using it internally.
     index_t     spanned_bytes() const;
 
+    /// checks if the leaves of this schema are packed in order starting 
+    /// at `curr_offset`, the same way compact_to lays them out.
+    /// `curr_offset` is advanced past each leaf that is checked.
+    /// (used by the Node::update and Node::set_node memcpy fast path)
+    bool        is_compact_layout(index_t &curr_offset) const;
+
 //-----------------------------------------------------------------------------
 //
 /// -- Private transform helpers -- 
@@ -474,6 +549,39 @@ private:
 //-----------------------------------------------------------------------------
     void        compact_to(Schema &s_dest, index_t curr_offset) const ;
     void        walk_schema(const std::string &json_schema);
+    /// resolves an existing path without copying its components,
+    /// errors if the path does not exist
+    Schema     *walk_existing_path(const std::string &path) const;
+    /// json and yaml emitters, used by the std::ostream variants
+    void        to_json_stream(utils::TextWriter &w,
+                               index_t indent,
+                               index_t depth,
+                               const std::string &pad,
+                               const std::string &eoe) const;
+    void        to_yaml_stream(utils::TextWriter &w,
+                               index_t indent,
+                               index_t depth,
+                               const std::string &pad,
+                               const std::string &eoe) const;
+
+//-----------------------------------------------------------------------------
+//
+/// -- Private helpers for block allocation of child schemas --
+//
+//-----------------------------------------------------------------------------
+    /// block of Schema objects shared by a copied tree
+    /// (defined in conduit_schema.cpp)
+    struct SchemaBlock;
+
+    /// deep copy work horse, children are created in `block` 
+    /// when it is not NULL
+    void        set(const Schema &schema, SchemaBlock *block);
+    /// total number of children, grand children, etc
+    index_t     number_of_descendants() const;
+    /// creates a child schema, in `block` when it is not NULL
+    static Schema *create_child(SchemaBlock *block);
+    /// destroys a child schema created with create_child
+    static void    destroy_child(Schema *schema);
 //-----------------------------------------------------------------------------
 //
 // -- conduit::Schema::Schema_Object_Hierarchy --
@@ -481,13 +589,58 @@ private:
 //-----------------------------------------------------------------------------
 //-----------------------------------------------------------------------------
 /// Holds hierarchy data for schemas that describe an object.
+///
+/// Child names are kept in insertion order in `object_order`. Name lookups
+/// use a linear scan for small objects, once an object grows past
+/// `linear_scan_max` children an open addressing (linear probing) hash
+/// table of child indices is built over the cached name hashes.
+///
+/// Removing a child does not renumber the table. The indices stored in the
+/// table are as of the last rebuild, removed indices are kept (sorted) in
+/// `object_removed` and stored indices are mapped to current ones on
+/// lookup. The table is rebuilt once enough removals pile up, so removing
+/// many children from a wide object stays amortized linear.
 //-----------------------------------------------------------------------------
 
     struct Schema_Object_Hierarchy 
     {
         std::vector<Schema*>            children;
         std::vector<std::string>        object_order;
-        std::map<std::string, index_t>  object_map;
+        /// hash of each name in object_order
+        std::vector<unsigned int>       object_hashes;
+        /// hash table slots, hold a child index or -1 for an empty slot
+        /// (empty while the object is small)
+        std::vector<index_t>            object_index;
+        /// sorted table indices removed since the last rebuild
+        std::vector<index_t>            object_removed;
+
+        static const index_t            linear_scan_max = 8;
+
+        /// returns the index of the named child, or -1 if it doesn't exist
+        index_t     find(const std::string &name) const;
+        /// find variant for names that are not null terminated
+        /// (used to look up path components in place)
+        index_t     find(const char *name, size_t name_len) const;
+        /// checks if the name at the given index matches, 
+        /// comparing cached hashes first
+        bool        matches(index_t idx,
+                            const std::string &name,
+                            unsigned int name_hash) const;
+        /// appends a name (the caller is responsible for children)
+        void        insert(const std::string &name);
+        /// removes the name at the given index, names above shift down
+        void        remove(index_t idx);
+        /// changes the name at the given index
+        void        rename(index_t idx, const std::string &name);
+
+      private:
+        void        rebuild_index();
+        /// maps a table index to the current child index
+        index_t     current_index(index_t table_idx) const;
+        /// maps a current child index to its table index
+        index_t     table_index(index_t idx) const;
+        void        link(index_t table_idx);
+        void        unlink(index_t table_idx);
     };
 
     // this is used to return a ref to an empty list of strings as 
@@ -514,11 +667,9 @@ private:
 //-----------------------------------------------------------------------------
     // for obj and list interfaces
     std::vector<Schema*>                   &children();
-    std::map<std::string, index_t>         &object_map();
     std::vector<std::string>               &object_order();
 
     const std::vector<Schema*>             &children()  const;    
-    const std::map<std::string, index_t>   &object_map()   const;
     const std::vector<std::string>         &object_order() const;
 
     void                                   object_map_print()   const;
@@ -541,7 +692,7 @@ private:
     DataType    m_dtype;
     /// holds the schema hierarchy data.
     /// Instead of accessing this directly, use the private methods:
-    ///   children(), object_map(), object_order
+    ///   children(), object_hierarchy(), object_order
     /// concretely, this will be:
     /// - NULL for leaf type
     /// - A Schema_Object_Hierarchy instance for schemas describing an object
@@ -550,6 +701,14 @@ private:
     /// if this schema instance has a parent, this holds the pointer to that
     /// parent
     Schema     *m_parent;
+    /// the block this schema was created in (NULL if it was created with
+    /// new, see utils::set_tree_block_threshold)
+    SchemaBlock *m_block;
+    /// cached result of fingerprint()
+    mutable uint64 m_fingerprint;
+    /// true while m_fingerprint is up to date (if a schema's fingerprint
+    /// is stale, so are the fingerprints of all of its ancestors)
+    mutable bool   m_fingerprint_valid;
 
 
 };
@@ -49,6 +49,7 @@
 //-----------------------------------------------------------------------------
 #include "conduit_utils.hpp"
 #include "conduit_error.hpp"
+#include "conduit_node.hpp"
 
 //-----------------------------------------------------------------------------
 // -- standard lib includes -- 
@@ -79,6 +80,17 @@
 #include <algorithm>
 #include <limits>
 #include <fstream>
+#include <map>
+
+#ifdef CONDUIT_USE_CXX11
+// for memory stats and tracing
+#include <atomic>
+#include <mutex>
+#include <chrono>
+#elif !defined(CONDUIT_PLATFORM_WINDOWS)
+// for the trace clock
+#include <sys/time.h>
+#endif
 
 
 // define proper path sep
@@ -92,12 +104,18 @@ static const std::string file_path_sep_string(CONDUIT_UTILS_FILE_PATH_SEPARATOR)
 
 
 //-----------------------------------------------------------------------------
-// -- libb64 includes -- 
+// -- simd includes (for base64) -- 
+//-----------------------------------------------------------------------------
+#if defined(__SSSE3__)
+#include <immintrin.h>
+#endif
+
+//-----------------------------------------------------------------------------
+// -- rapidjson includes -- 
 //-----------------------------------------------------------------------------
-#define BUFFERSIZE 65536
-#include "b64/encode.h"
-#include "b64/decode.h"
-using namespace base64;
+// grisu2 digit generation and integer formatting
+#include "rapidjson/internal/dtoa.h"
+#include "rapidjson/internal/itoa.h"
 
 
 //-----------------------------------------------------------------------------
@@ -312,6 +330,31 @@ split_path(const std::string &path,
                  next);
 }
 
+//-----------------------------------------------------------------------------
+const char *
+split_path(const char *path,
+           const char *path_end,
+           size_t &curr_len)
+{
+    const char *sep = (const char*) memchr(path, '/', path_end - path);
+
+    if(sep == NULL)
+    {
+        curr_len = path_end - path;
+        return NULL;
+    }
+
+    curr_len = sep - path;
+    sep++;
+
+    if(sep == path_end)
+    {
+        return NULL;
+    }
+
+    return sep;
+}
+
 //-----------------------------------------------------------------------------
 void     
 rsplit_path(const std::string &path,
@@ -890,29 +933,353 @@ unescape_special_chars(const std::string &input)
 }
 
 
+//-----------------------------------------------------------------------------
+// base64 helpers
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+static const char base64_alphabet[] = 
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+//-----------------------------------------------------------------------------
+// values of each char in the base64 alphabet, -1 for other chars
+static const signed char base64_values[256] = {
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 62, -1, -1, -1, 63,
+    52, 53, 54, 55, 56, 57, 58, 59, 60, 61, -1, -1, -1, -1, -1, -1,
+    -1,  0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14,
+    15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, -1, -1, -1, -1, -1,
+    -1, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38, 39, 40,
+    41, 42, 43, 44, 45, 46, 47, 48, 49, 50, 51, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+};
+
+#if defined(__SSSE3__)
+//-----------------------------------------------------------------------------
+// splits 12 bytes (in the low bytes of each 4 byte lane, as 3 byte groups)
+// into 16 6-bit values, then maps the values to the base64 alphabet
+static inline __m128i
+base64_encode_sse(__m128i in)
+{
+    in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11,  9, 10,
+                                            7,  8,  6,  7,
+                                            4,  5,  3,  4,
+                                            1,  2,  0,  1));
+    const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+    const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+    const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+    const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+    const __m128i indices = _mm_or_si128(t1, t3);
+
+    // offsets from each value to its char, selected by value range
+    const __m128i offsets = _mm_setr_epi8('a' - 26, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '0' - 52,
+                                          '0' - 52, '0' - 52, '+' - 62,
+                                          '/' - 63, 'A', 0, 0);
+    __m128i res = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    const __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+    res = _mm_or_si128(res, _mm_and_si128(less, _mm_set1_epi8(13)));
+    res = _mm_shuffle_epi8(offsets, res);
+    return _mm_add_epi8(res, indices);
+}
+
+//-----------------------------------------------------------------------------
+// maps 16 chars to 6-bit values and packs them into 12 bytes 
+// (the low 12 bytes of the result), returns false for chars outside
+// of the alphabet
+static inline bool
+base64_decode_sse(__m128i in, __m128i &out)
+{
+    const __m128i lut_lo = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11,
+                                         0x11, 0x11, 0x11, 0x11,
+                                         0x11, 0x11, 0x13, 0x1A,
+                                         0x1B, 0x1B, 0x1B, 0x1A);
+    const __m128i lut_hi = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02,
+                                         0x04, 0x08, 0x04, 0x08,
+                                         0x10, 0x10, 0x10, 0x10,
+                                         0x10, 0x10, 0x10, 0x10);
+    const __m128i lut_roll = _mm_setr_epi8(0,   16,  19,   4,
+                                           -65, -65, -71, -71,
+                                           0,   0,   0,   0,
+                                           0,   0,   0,   0);
+    const __m128i mask_0f = _mm_set1_epi8(0x0f);
+
+    const __m128i hi_nibbles = _mm_and_si128(_mm_srli_epi32(in, 4), mask_0f);
+    const __m128i lo_nibbles = _mm_and_si128(in, mask_0f);
+    const __m128i lo = _mm_shuffle_epi8(lut_lo, lo_nibbles);
+    const __m128i hi = _mm_shuffle_epi8(lut_hi, hi_nibbles);
+
+    const __m128i invalid = _mm_and_si128(lo, hi);
+    if(_mm_movemask_epi8(_mm_cmpeq_epi8(invalid, _mm_setzero_si128())) 
+       != 0xFFFF)
+    {
+        return false;
+    }
+
+    const __m128i eq_2f = _mm_cmpeq_epi8(in, _mm_set1_epi8(0x2f));
+    const __m128i roll = _mm_shuffle_epi8(lut_roll,
+                                          _mm_add_epi8(eq_2f, hi_nibbles));
+    const __m128i vals = _mm_add_epi8(in, roll);
+
+    const __m128i merged = _mm_maddubs_epi16(vals, _mm_set1_epi32(0x01400140));
+    out = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+    out = _mm_shuffle_epi8(out, _mm_setr_epi8( 2,  1,  0,
+                                               6,  5,  4,
+                                              10,  9,  8,
+                                              14, 13, 12,
+                                              -1, -1, -1, -1));
+    return true;
+}
+#endif
+
+#if defined(__AVX2__)
+//-----------------------------------------------------------------------------
+// AVX2 version of base64_encode_sse, each 128-bit lane holds 12 bytes
+static inline __m256i
+base64_encode_avx2(__m256i in)
+{
+    in = _mm256_shuffle_epi8(in, _mm256_set_epi8(10, 11,  9, 10,
+                                                  7,  8,  6,  7,
+                                                  4,  5,  3,  4,
+                                                  1,  2,  0,  1,
+                                                 10, 11,  9, 10,
+                                                  7,  8,  6,  7,
+                                                  4,  5,  3,  4,
+                                                  1,  2,  0,  1));
+    const __m256i t0 = _mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00));
+    const __m256i t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+    const __m256i t2 = _mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0));
+    const __m256i t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+    const __m256i indices = _mm256_or_si256(t1, t3);
+
+    const __m256i offsets = _mm256_setr_epi8('a' - 26, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '+' - 62,
+                                             '/' - 63, 'A', 0, 0,
+                                             'a' - 26, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '0' - 52,
+                                             '0' - 52, '0' - 52, '+' - 62,
+                                             '/' - 63, 'A', 0, 0);
+    __m256i res = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+    const __m256i less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+    res = _mm256_or_si256(res, _mm256_and_si256(less, _mm256_set1_epi8(13)));
+    res = _mm256_shuffle_epi8(offsets, res);
+    return _mm256_add_epi8(res, indices);
+}
+
+//-----------------------------------------------------------------------------
+// AVX2 version of base64_decode_sse, packs 32 chars into the low 24 bytes
+static inline bool
+base64_decode_avx2(__m256i in, __m256i &out)
+{
+    const __m256i lut_lo = _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11,
+                                            0x11, 0x11, 0x11, 0x11,
+                                            0x11, 0x11, 0x13, 0x1A,
+                                            0x1B, 0x1B, 0x1B, 0x1A,
+                                            0x15, 0x11, 0x11, 0x11,
+                                            0x11, 0x11, 0x11, 0x11,
+                                            0x11, 0x11, 0x13, 0x1A,
+                                            0x1B, 0x1B, 0x1B, 0x1A);
+    const __m256i lut_hi = _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02,
+                                            0x04, 0x08, 0x04, 0x08,
+                                            0x10, 0x10, 0x10, 0x10,
+                                            0x10, 0x10, 0x10, 0x10,
+                                            0x10, 0x10, 0x01, 0x02,
+                                            0x04, 0x08, 0x04, 0x08,
+                                            0x10, 0x10, 0x10, 0x10,
+                                            0x10, 0x10, 0x10, 0x10);
+    const __m256i lut_roll = _mm256_setr_epi8(0,   16,  19,   4,
+                                              -65, -65, -71, -71,
+                                              0,   0,   0,   0,
+                                              0,   0,   0,   0,
+                                              0,   16,  19,   4,
+                                              -65, -65, -71, -71,
+                                              0,   0,   0,   0,
+                                              0,   0,   0,   0);
+    const __m256i mask_0f = _mm256_set1_epi8(0x0f);
+
+    const __m256i hi_nibbles = _mm256_and_si256(_mm256_srli_epi32(in, 4),
+                                                mask_0f);
+    const __m256i lo_nibbles = _mm256_and_si256(in, mask_0f);
+    const __m256i lo = _mm256_shuffle_epi8(lut_lo, lo_nibbles);
+    const __m256i hi = _mm256_shuffle_epi8(lut_hi, hi_nibbles);
+
+    if(!_mm256_testz_si256(lo, hi))
+    {
+        return false;
+    }
+
+    const __m256i eq_2f = _mm256_cmpeq_epi8(in, _mm256_set1_epi8(0x2f));
+    const __m256i roll = _mm256_shuffle_epi8(lut_roll,
+                                             _mm256_add_epi8(eq_2f, hi_nibbles));
+    const __m256i vals = _mm256_add_epi8(in, roll);
+
+    const __m256i merged = _mm256_maddubs_epi16(vals,
+                                                _mm256_set1_epi32(0x01400140));
+    out = _mm256_madd_epi16(merged, _mm256_set1_epi32(0x00011000));
+    out = _mm256_shuffle_epi8(out, _mm256_setr_epi8( 2,  1,  0,
+                                                     6,  5,  4,
+                                                    10,  9,  8,
+                                                    14, 13, 12,
+                                                    -1, -1, -1, -1,
+                                                     2,  1,  0,
+                                                     6,  5,  4,
+                                                    10,  9,  8,
+                                                    14, 13, 12,
+                                                    -1, -1, -1, -1));
+    out = _mm256_permutevar8x32_epi32(out, _mm256_setr_epi32(0, 1, 2,
+                                                             4, 5, 6,
+                                                             -1, -1));
+    return true;
+}
+#endif
+
+//-----------------------------------------------------------------------------
+// encodes the complete 3 byte groups of src, returns the number of chars
+// written
+static index_t
+base64_encode_groups(const unsigned char *src,
+                     index_t src_nbytes,
+                     char *dest)
+{
+    index_t i = 0;
+    char *out = dest;
+
+#if defined(__AVX2__)
+    // each step reads 28 bytes (encodes 24)
+    for(; src_nbytes - i >= 28; i += 24, out += 32)
+    {
+        __m256i in = _mm256_castsi128_si256(
+                        _mm_loadu_si128((const __m128i*)(src + i)));
+        in = _mm256_inserti128_si256(in,
+                        _mm_loadu_si128((const __m128i*)(src + i + 12)),1);
+        _mm256_storeu_si256((__m256i*)out, base64_encode_avx2(in));
+    }
+#endif
+
+#if defined(__SSSE3__)
+    // each step reads 16 bytes (encodes 12)
+    for(; src_nbytes - i >= 16; i += 12, out += 16)
+    {
+        __m128i in = _mm_loadu_si128((const __m128i*)(src + i));
+        _mm_storeu_si128((__m128i*)out, base64_encode_sse(in));
+    }
+#endif
+
+    for(; src_nbytes - i >= 3; i += 3, out += 4)
+    {
+        unsigned int v = ((unsigned int)src[i]   << 16) |
+                         ((unsigned int)src[i+1] << 8)  |
+                          (unsigned int)src[i+2];
+        out[0] = base64_alphabet[(v >> 18) & 0x3f];
+        out[1] = base64_alphabet[(v >> 12) & 0x3f];
+        out[2] = base64_alphabet[(v >> 6)  & 0x3f];
+        out[3] = base64_alphabet[v & 0x3f];
+    }
+
+    return (index_t)(out - dest);
+}
+
+//-----------------------------------------------------------------------------
+// encodes a final group of 1 or 2 bytes with padding
+static void
+base64_encode_tail(const unsigned char *src,
+                   index_t src_nbytes,
+                   char *dest)
+{
+    unsigned int v = (unsigned int)src[0] << 16;
+    if(src_nbytes > 1)
+    {
+        v |= (unsigned int)src[1] << 8;
+    }
+    dest[0] = base64_alphabet[(v >> 18) & 0x3f];
+    dest[1] = base64_alphabet[(v >> 12) & 0x3f];
+    dest[2] = src_nbytes > 1 ? base64_alphabet[(v >> 6) & 0x3f] : '=';
+    dest[3] = '=';
+}
+
+//-----------------------------------------------------------------------------
+// decodes complete 16 or 32 char blocks until a block holds chars outside 
+// of the alphabet. returns the number of chars consumed and advances dest. 
+// only called when at least 24 chars remain, so the 16 / 32 byte stores 
+// stay within (src_nbytes / 4) * 3 bytes of dest.
+static index_t
+base64_decode_blocks(const unsigned char *src,
+                     index_t src_nbytes,
+                     unsigned char *&dest)
+{
+    index_t i = 0;
+#if defined(__AVX2__)
+    for(; src_nbytes - i >= 48; i += 32, dest += 24)
+    {
+        __m256i out;
+        if(!base64_decode_avx2(_mm256_loadu_si256((const __m256i*)(src + i)),
+                               out))
+        {
+            return i;
+        }
+        _mm256_storeu_si256((__m256i*)dest, out);
+    }
+#endif
+
+#if defined(__SSSE3__)
+    for(; src_nbytes - i >= 24; i += 16, dest += 12)
+    {
+        __m128i out;
+        if(!base64_decode_sse(_mm_loadu_si128((const __m128i*)(src + i)),
+                              out))
+        {
+            return i;
+        }
+        _mm_storeu_si128((__m128i*)dest, out);
+    }
+#endif
+    (void)src; (void)src_nbytes; (void)dest;
+    return i;
+}
+
+//-----------------------------------------------------------------------------
+// writes the bytes of 4 6-bit values
+static inline void
+base64_write_group(const unsigned char *vals,
+                   unsigned char *dest)
+{
+    dest[0] = (unsigned char)((vals[0] << 2) | (vals[1] >> 4));
+    dest[1] = (unsigned char)((vals[1] << 4) | (vals[2] >> 2));
+    dest[2] = (unsigned char)((vals[2] << 6) |  vals[3]);
+}
+
 //-----------------------------------------------------------------------------
 void
 base64_encode(const void *src,
               index_t src_nbytes,
               void *dest)
 {
-    int nbytes = (int)src_nbytes;
-    base64_encodestate enc_state;
-    base64_init_encodestate(&enc_state);
-    const char *src_ptr = (const char*)src;
-    char *des_ptr       = (char*)dest;
-    memset(des_ptr,0,(size_t)base64_encode_buffer_size(src_nbytes));
-    
-    int code_len = base64_encode_block(src_ptr,
-                                       nbytes,
-                                       des_ptr,
-                                       &enc_state);
-    des_ptr += code_len;
-    code_len = base64_encode_blockend(des_ptr, &enc_state);
-    des_ptr += code_len;
+    const unsigned char *src_ptr = (const unsigned char*)src;
+    char *des_ptr = (char*)dest;
+
+    index_t nchars = base64_encode_groups(src_ptr,src_nbytes,des_ptr);
+    index_t ntail  = src_nbytes % 3;
+    if(ntail > 0)
+    {
+        base64_encode_tail(src_ptr + src_nbytes - ntail,
+                           ntail,
+                           des_ptr + nchars);
+        nchars += 4;
+    }
 
-    // for some reason libb64 adds a newline
-    des_ptr[-1] = 0;
+    des_ptr[nchars] = 0;
 }
 
 //-----------------------------------------------------------------------------
@@ -926,7 +1293,7 @@ base64_encode_buffer_size(index_t src_nbytes)
 index_t
 base64_decode_buffer_size(index_t encoded_nbytes)
 {
-    return (encoded_nbytes / 4) * 3 + 1;
+    return ((encoded_nbytes + 3) / 4) * 3 + 1;
 }
 
 
@@ -936,170 +1303,2130 @@ base64_decode(const void *src,
               index_t src_nbytes,
               void *dest)
 {
-    base64_decodestate dec_state;
-    int src_len = (int)src_nbytes;
-    base64_init_decodestate(&dec_state);
-    const char *src_ptr = (const char*)src;
-    char *des_ptr = (char*)dest;
-    base64_decode_block(src_ptr,
-                        src_len,
-                        des_ptr,
-                        &dec_state);
+    Base64Decoder decoder;
+    unsigned char *des_ptr = (unsigned char*)dest;
+    des_ptr += decoder.decode(src,src_nbytes,des_ptr);
+    decoder.finish(des_ptr);
 }
 
 //-----------------------------------------------------------------------------
-bool
-string_is_integer(const std::string &s)
-{
-    int v = -1;
-    std::istringstream iss(s);
-    iss >> v;
+// -- begin conduit::utils::Base64Encoder --
+//-----------------------------------------------------------------------------
 
-    return !iss.fail();
+// size of the encoded text buffer
+static const index_t BASE64_ENCODER_BUFFER_SIZE = 65536;
+
+//-----------------------------------------------------------------------------
+Base64Encoder::Base64Encoder(std::ostream &os)
+: m_os(os),
+  m_num_pending(0),
+  m_buffer(NULL),
+  m_size(0)
+{
+    m_buffer = new char[BASE64_ENCODER_BUFFER_SIZE];
 }
 
+//-----------------------------------------------------------------------------
+Base64Encoder::~Base64Encoder()
+{
+    flush();
+    delete [] m_buffer;
+}
 
 //-----------------------------------------------------------------------------
-std::string
-float64_to_string(float64 value)
+void
+Base64Encoder::write(const void *src,
+                     index_t src_nbytes)
 {
-    char buffer[64] = {0};
-    snprintf(buffer,64,"%.15g",value);
+    const unsigned char *src_ptr = (const unsigned char*)src;
 
-    std::string res(buffer);
-    
-    // we check for inf or nan in string form.
-    // std::isnan, isn't portable until c++11
-    // http://stackoverflow.com/questions/570669/checking-if-a-double-or-float-is-nan-in-c
+    // complete a pending group
+    while(m_num_pending > 0 && m_num_pending < 3 && src_nbytes > 0)
+    {
+        m_pending[m_num_pending++] = *src_ptr++;
+        src_nbytes--;
+    }
 
-    // searching for 'n' covers inf and nan
-    if(res.find('n') == std::string::npos &&
-       res.find('.') == std::string::npos &&
-       res.find('e') == std::string::npos )
+    if(m_num_pending == 3)
     {
-        res += ".0";
+        if(BASE64_ENCODER_BUFFER_SIZE - m_size < 4)
+        {
+            flush();
+        }
+        m_size += base64_encode_groups(m_pending,3,m_buffer + m_size);
+        m_num_pending = 0;
     }
 
-    return res;
+    while(src_nbytes >= 3)
+    {
+        index_t room = ((BASE64_ENCODER_BUFFER_SIZE - m_size) / 4) * 3;
+        if(room == 0)
+        {
+            flush();
+            continue;
+        }
+
+        index_t nbytes = (src_nbytes / 3) * 3;
+        if(nbytes > room)
+        {
+            nbytes = room;
+        }
+
+        m_size += base64_encode_groups(src_ptr,nbytes,m_buffer + m_size);
+        src_ptr    += nbytes;
+        src_nbytes -= nbytes;
+    }
+
+    while(src_nbytes > 0)
+    {
+        m_pending[m_num_pending++] = *src_ptr++;
+        src_nbytes--;
+    }
 }
 
-//----------------------------------------------------------------------------- 
-// String hash functions
 //-----------------------------------------------------------------------------
-namespace hashing
+void
+Base64Encoder::finish()
 {
-// NOTE: Borrowed from VisIt.
-
-// ****************************************************************************
-//  Function: Hash 
-//
-//  Purpose:
-//      Hash a variable length stream of bytes into a 32-bit value.
-//
-//      Can also be used effectively as a checksum.
-//
-//      The best hash table sizes are powers of 2.  There is no need to do
-//      mod a prime (mod is sooo slow!).  If you need less than 32 bits,
-//      use a bitmask.  For example, if you need only 10 bits, do
-//        h = (h & BJHashmask(10));
-//        In which case, the hash table should have hashsize(10) elements.
-//      
-//        If you are hashing n strings (unsigned char **)k, do it like this:
-//          for (i=0, h=0; i<n; ++i) h = hash( k[i], len[i], h);
-//
-//  Arguments:
-//    k:       the key ((the unaligned variable-length array of bytes)
-//    length:  the length of the key, in bytes
-//    initval: can be any 4-byte value
-//
-//  Returns:  A 32-bit value.  Every bit of the key affects every bit of
-//  the return value.  Every 1-bit and 2-bit delta achieves avalanche.
-//
-//  Programmer: By Bob Jenkins, 1996.  bob_jenkins@burtleburtle.net.
-//
-//  You may use this code any way you wish, private, educational, or
-//  commercial.  It's free. However, do NOT use for cryptographic purposes.
-//
-//  See http://burtleburtle.net/bob/hash/evahash.html
-// ****************************************************************************
-
-#define bjhash_mix(a,b,c) \
-{ \
-  a -= b; a -= c; a ^= (c>>13); \
-  b -= c; b -= a; b ^= (a<<8); \
-  c -= a; c -= b; c ^= (b>>13); \
-  a -= b; a -= c; a ^= (c>>12);  \
-  b -= c; b -= a; b ^= (a<<16); \
-  c -= a; c -= b; c ^= (b>>5); \
-  a -= b; a -= c; a ^= (c>>3);  \
-  b -= c; b -= a; b ^= (a<<10); \
-  c -= a; c -= b; c ^= (b>>15); \
+    if(m_num_pending > 0)
+    {
+        if(BASE64_ENCODER_BUFFER_SIZE - m_size < 4)
+        {
+            flush();
+        }
+        base64_encode_tail(m_pending,m_num_pending,m_buffer + m_size);
+        m_size += 4;
+        m_num_pending = 0;
+    }
+    flush();
 }
 
-inline unsigned int Hash(const unsigned char *k, unsigned int length, unsigned int initval)
+//-----------------------------------------------------------------------------
+void
+Base64Encoder::flush()
 {
-   unsigned int a,b,c,len;
+    if(m_size > 0)
+    {
+        m_os.write(m_buffer,(std::streamsize)m_size);
+        m_size = 0;
+    }
+}
 
-   len = length;
-   a = b = 0x9e3779b9;
-   c = initval;
+//-----------------------------------------------------------------------------
+// -- end conduit::utils::Base64Encoder --
+//-----------------------------------------------------------------------------
 
-   while (len >= 12)
-   {
-      a += (k[0] +((unsigned int)k[1]<<8) +((unsigned int)k[2]<<16) +((unsigned int)k[3]<<24));
-      b += (k[4] +((unsigned int)k[5]<<8) +((unsigned int)k[6]<<16) +((unsigned int)k[7]<<24));
-      c += (k[8] +((unsigned int)k[9]<<8) +((unsigned int)k[10]<<16)+((unsigned int)k[11]<<24));
-      bjhash_mix(a,b,c);
-      k += 12; len -= 12;
-   }
+//-----------------------------------------------------------------------------
+// -- begin conduit::utils::Base64Decoder --
+//-----------------------------------------------------------------------------
 
-   c += length;
+//-----------------------------------------------------------------------------
+Base64Decoder::Base64Decoder()
+: m_num_pending(0)
+{}
 
-   switch(len)
-   {
-      case 11: c+=((unsigned int)k[10]<<24);
-      case 10: c+=((unsigned int)k[9]<<16);
-      case 9 : c+=((unsigned int)k[8]<<8);
-      case 8 : b+=((unsigned int)k[7]<<24);
-      case 7 : b+=((unsigned int)k[6]<<16);
-      case 6 : b+=((unsigned int)k[5]<<8);
-      case 5 : b+=k[4];
-      case 4 : a+=((unsigned int)k[3]<<24);
-      case 3 : a+=((unsigned int)k[2]<<16);
-      case 2 : a+=((unsigned int)k[1]<<8);
-      case 1 : a+=k[0];
-   }
+//-----------------------------------------------------------------------------
+index_t
+Base64Decoder::decode(const void *src,
+                      index_t src_nbytes,
+                      void *dest)
+{
+    const unsigned char *src_ptr = (const unsigned char*)src;
+    unsigned char *des_ptr = (unsigned char*)dest;
+    index_t i = 0;
 
-   bjhash_mix(a,b,c);
+    while(i < src_nbytes)
+    {
+        if(m_num_pending == 0)
+        {
+            // vectorized blocks
+            if(src_nbytes - i >= 24)
+            {
+                i += base64_decode_blocks(src_ptr + i,
+                                          src_nbytes - i,
+                                          des_ptr);
+            }
 
-   return c;
-}
+            // complete groups
+            for(; src_nbytes - i >= 4; i += 4, des_ptr += 3)
+            {
+                signed char v0 = base64_values[src_ptr[i]];
+                signed char v1 = base64_values[src_ptr[i+1]];
+                signed char v2 = base64_values[src_ptr[i+2]];
+                signed char v3 = base64_values[src_ptr[i+3]];
+                if((v0 | v1 | v2 | v3) < 0)
+                {
+                    break;
+                }
+                des_ptr[0] = (unsigned char)((v0 << 2) | (v1 >> 4));
+                des_ptr[1] = (unsigned char)((v1 << 4) | (v2 >> 2));
+                des_ptr[2] = (unsigned char)((v2 << 6) |  v3);
+            }
 
-// Just to keep this macro from leaking out and polluting the global namespace
-#undef bjhash_mix
+            if(i == src_nbytes)
+            {
+                break;
+            }
+        }
 
-}
-//-----------------------------------------------------------------------------
-// -- end conduit::utils::hashing --
-//-----------------------------------------------------------------------------
+        // one char at a time, skipping chars outside of the alphabet
+        signed char v = base64_values[src_ptr[i++]];
+        if(v >= 0)
+        {
+            m_pending[m_num_pending++] = (unsigned char)v;
+            if(m_num_pending == 4)
+            {
+                base64_write_group(m_pending,des_ptr);
+                des_ptr += 3;
+                m_num_pending = 0;
+            }
+        }
+    }
 
-unsigned int
-hash(const char *k, unsigned int length, unsigned int initval)
-{
-    return hashing::Hash((unsigned char const*)k, length, initval);
+    return (index_t)(des_ptr - (unsigned char*)dest);
 }
 
-unsigned int
-hash(const char *k, unsigned int initval)
+//-----------------------------------------------------------------------------
+index_t
+Base64Decoder::finish(void *dest)
+{
+    unsigned char *des_ptr = (unsigned char*)dest;
+    index_t res = 0;
+    if(m_num_pending > 1)
+    {
+        des_ptr[0] = (unsigned char)((m_pending[0] << 2) | (m_pending[1] >> 4));
+        res = 1;
+    }
+    if(m_num_pending > 2)
+    {
+        des_ptr[1] = (unsigned char)((m_pending[1] << 4) | (m_pending[2] >> 2));
+        res = 2;
+    }
+    m_num_pending = 0;
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+// -- end conduit::utils::Base64Decoder --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+bool
+string_is_integer(const std::string &s)
+{
+    int v = -1;
+    std::istringstream iss(s);
+    iss >> v;
+
+    return !iss.fail();
+}
+
+
+//-----------------------------------------------------------------------------
+// number formatting helpers
+//-----------------------------------------------------------------------------
+namespace detail
+{
+
+//-----------------------------------------------------------------------------
+// grisu2 for float32 values, uses the float32 neighbors to find the 
+// boundaries of the rounding interval (rapidjson's Grisu2 only supports 
+// doubles). Digits are generated for a positive, finite value:
+//   value == digits * 10^K
+//-----------------------------------------------------------------------------
+static void
+float32_grisu2(float32 value,
+               char *digits,
+               int *length,
+               int *K)
+{
+    using rapidjson::internal::DiyFp;
+
+    uint32 bits = 0;
+    memcpy(&bits,&value,sizeof(uint32));
+
+    int biased_e = (int)((bits >> 23) & 0xFF);
+    uint64 f = bits & 0x7FFFFF;
+    int e = 0;
+    if(biased_e != 0)
+    {
+        f += 0x800000;
+        e  = biased_e - 150;
+    }
+    else
+    {
+        e = 1 - 150;
+    }
+
+    const DiyFp v(f,e);
+    const DiyFp w_p = DiyFp((f << 1) + 1, e - 1).Normalize();
+    // the lower neighbor is closer at powers of two
+    DiyFp w_m = (f == 0x800000 && biased_e > 1) ?
+                    DiyFp((f << 2) - 1, e - 2) : DiyFp((f << 1) - 1, e - 1);
+    w_m.f <<= w_m.e - w_p.e;
+    w_m.e = w_p.e;
+
+    const DiyFp c_mk = rapidjson::internal::GetCachedPower(w_p.e, K);
+    const DiyFp W = v.Normalize() * c_mk;
+    DiyFp Wp = w_p * c_mk;
+    DiyFp Wm = w_m * c_mk;
+    Wm.f++;
+    Wp.f--;
+    rapidjson::internal::DigitGen(W, Wp, Wp.f - Wm.f, digits, length, K);
+}
+
+//-----------------------------------------------------------------------------
+// lays out generated digits like printf's %g, without trailing zeros and 
+// with a ".0" suffix for integral values 
+//-----------------------------------------------------------------------------
+static index_t
+format_float_digits(bool negative,
+                    const char *digits,
+                    int length,
+                    int K,
+                    char *buffer)
+{
+    char *ptr = buffer;
+    if(negative)
+    {
+        *ptr++ = '-';
+    }
+
+    // value == d.ddd * 10^exp10
+    int exp10 = length + K - 1;
+
+    if(exp10 < -4 || exp10 >= 15)
+    {
+        *ptr++ = digits[0];
+        if(length > 1)
+        {
+            *ptr++ = '.';
+            memcpy(ptr,digits + 1,length - 1);
+            ptr += length - 1;
+        }
+        *ptr++ = 'e';
+        if(exp10 < 0)
+        {
+            *ptr++ = '-';
+            exp10 = -exp10;
+        }
+        else
+        {
+            *ptr++ = '+';
+        }
+        // at least two exponent digits, as printf does
+        if(exp10 >= 100)
+        {
+            *ptr++ = (char)('0' + exp10 / 100);
+            exp10 %= 100;
+        }
+        *ptr++ = (char)('0' + exp10 / 10);
+        *ptr++ = (char)('0' + exp10 % 10);
+    }
+    else if(K >= 0)
+    {
+        // integral value
+        memcpy(ptr,digits,length);
+        ptr += length;
+        for(int i=0; i < K; i++)
+        {
+            *ptr++ = '0';
+        }
+        *ptr++ = '.';
+        *ptr++ = '0';
+    }
+    else if(exp10 >= 0)
+    {
+        memcpy(ptr,digits,exp10 + 1);
+        ptr += exp10 + 1;
+        *ptr++ = '.';
+        memcpy(ptr,digits + exp10 + 1,length - exp10 - 1);
+        ptr += length - exp10 - 1;
+    }
+    else
+    {
+        *ptr++ = '0';
+        *ptr++ = '.';
+        for(int i=0; i < -exp10 - 1; i++)
+        {
+            *ptr++ = '0';
+        }
+        memcpy(ptr,digits,length);
+        ptr += length;
+    }
+
+    return (index_t)(ptr - buffer);
+}
+
+//-----------------------------------------------------------------------------
+// handles zero, inf and nan, returns 0 for values that need digits
+//-----------------------------------------------------------------------------
+template <typename T>
+static index_t
+format_special_float(T value,
+                     char *buffer)
+{
+    if(value != value)
+    {
+        memcpy(buffer,"nan",3);
+        return 3;
+    }
+    // inf - inf produces nan
+    if( (value - value) != (value - value) )
+    {
+        if(value < 0)
+        {
+            memcpy(buffer,"-inf",4);
+            return 4;
+        }
+        memcpy(buffer,"inf",3);
+        return 3;
+    }
+    if(value == 0)
+    {
+        // keep the sign of negative zero
+        T one = 1;
+        if( one / value < 0)
+        {
+            memcpy(buffer,"-0.0",4);
+            return 4;
+        }
+        memcpy(buffer,"0.0",3);
+        return 3;
+    }
+    return 0;
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::utils::detail --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+index_t
+float64_to_chars(float64 value, char *buffer)
+{
+    index_t res = detail::format_special_float(value,buffer);
+    if(res > 0)
+    {
+        return res;
+    }
+
+    bool negative = value < 0;
+    char digits[32];
+    int length = 0;
+    int K = 0;
+    rapidjson::internal::Grisu2(negative ? -value : value,
+                                digits,
+                                &length,
+                                &K);
+    return detail::format_float_digits(negative,digits,length,K,buffer);
+}
+
+//-----------------------------------------------------------------------------
+index_t
+float32_to_chars(float32 value, char *buffer)
+{
+    index_t res = detail::format_special_float(value,buffer);
+    if(res > 0)
+    {
+        return res;
+    }
+
+    bool negative = value < 0;
+    char digits[32];
+    int length = 0;
+    int K = 0;
+    detail::float32_grisu2(negative ? -value : value,
+                           digits,
+                           &length,
+                           &K);
+    return detail::format_float_digits(negative,digits,length,K,buffer);
+}
+
+//-----------------------------------------------------------------------------
+index_t
+int64_to_chars(int64 value, char *buffer)
+{
+    return (index_t)(rapidjson::internal::i64toa(value,buffer) - buffer);
+}
+
+//-----------------------------------------------------------------------------
+index_t
+uint64_to_chars(uint64 value, char *buffer)
+{
+    return (index_t)(rapidjson::internal::u64toa(value,buffer) - buffer);
+}
+
+//-----------------------------------------------------------------------------
+std::string
+float64_to_string(float64 value)
+{
+    char buffer[32];
+    index_t len = float64_to_chars(value,buffer);
+    return std::string(buffer,(size_t)len);
+}
+
+//-----------------------------------------------------------------------------
+std::string
+float32_to_string(float32 value)
+{
+    char buffer[32];
+    index_t len = float32_to_chars(value,buffer);
+    return std::string(buffer,(size_t)len);
+}
+
+//-----------------------------------------------------------------------------
+// TextWriter
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+TextWriter::TextWriter(std::ostream &os)
+: m_os(os),
+  m_buffer(NULL),
+  m_size(0),
+  m_capacity(65536)
+{
+    m_buffer = new char[(size_t)m_capacity];
+}
+
+//-----------------------------------------------------------------------------
+TextWriter::~TextWriter()
+{
+    flush();
+    delete [] m_buffer;
+}
+
+//-----------------------------------------------------------------------------
+void
+TextWriter::write(const char *data, index_t num_bytes)
+{
+    if(m_capacity - m_size < num_bytes)
+    {
+        flush();
+        // large writes skip the buffer
+        if(num_bytes > m_capacity)
+        {
+            m_os.write(data,(std::streamsize)num_bytes);
+            return;
+        }
+    }
+    memcpy(m_buffer + m_size,data,(size_t)num_bytes);
+    m_size += num_bytes;
+}
+
+//-----------------------------------------------------------------------------
+void
+TextWriter::write(const char *str)
+{
+    write(str,(index_t)strlen(str));
+}
+
+//-----------------------------------------------------------------------------
+void
+TextWriter::write_int64(int64 value)
+{
+    m_size += int64_to_chars(value,reserve_number());
+}
+
+//-----------------------------------------------------------------------------
+void
+TextWriter::write_uint64(uint64 value)
+{
+    m_size += uint64_to_chars(value,reserve_number());
+}
+
+//-----------------------------------------------------------------------------
+void
+TextWriter::write_float32(float32 value)
+{
+    m_size += float32_to_chars(value,reserve_number());
+}
+
+//-----------------------------------------------------------------------------
+void
+TextWriter::write_float64(float64 value)
+{
+    m_size += float64_to_chars(value,reserve_number());
+}
+
+//-----------------------------------------------------------------------------
+void
+TextWriter::write_indent(index_t indent,
+                         index_t depth,
+                         const std::string &pad)
+{
+    for(index_t i=0;i<depth;i++)
+    {
+        for(index_t j=0;j<indent;j++)
+        {
+            write(pad);
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+TextWriter::flush()
+{
+    if(m_size > 0)
+    {
+        m_os.write(m_buffer,(std::streamsize)m_size);
+        m_size = 0;
+    }
+}
+
+//----------------------------------------------------------------------------- 
+// String hash functions
+//-----------------------------------------------------------------------------
+namespace hashing
+{
+// NOTE: Borrowed from VisIt.
+
+// ****************************************************************************
+//  Function: Hash 
+//
+//  Purpose:
+//      Hash a variable length stream of bytes into a 32-bit value.
+//
+//      Can also be used effectively as a checksum.
+//
+//      The best hash table sizes are powers of 2.  There is no need to do
+//      mod a prime (mod is sooo slow!).  If you need less than 32 bits,
+//      use a bitmask.  For example, if you need only 10 bits, do
+//        h = (h & BJHashmask(10));
+//        In which case, the hash table should have hashsize(10) elements.
+//      
+//        If you are hashing n strings (unsigned char **)k, do it like this:
+//          for (i=0, h=0; i<n; ++i) h = hash( k[i], len[i], h);
+//
+//  Arguments:
+//    k:       the key ((the unaligned variable-length array of bytes)
+//    length:  the length of the key, in bytes
+//    initval: can be any 4-byte value
+//
+//  Returns:  A 32-bit value.  Every bit of the key affects every bit of
+//  the return value.  Every 1-bit and 2-bit delta achieves avalanche.
+//
+//  Programmer: By Bob Jenkins, 1996.  bob_jenkins@burtleburtle.net.
+//
+//  You may use this code any way you wish, private, educational, or
+//  commercial.  It's free. However, do NOT use for cryptographic purposes.
+//
+//  See http://burtleburtle.net/bob/hash/evahash.html
+// ****************************************************************************
+
+#define bjhash_mix(a,b,c) \
+{ \
+  a -= b; a -= c; a ^= (c>>13); \
+  b -= c; b -= a; b ^= (a<<8); \
+  c -= a; c -= b; c ^= (b>>13); \
+  a -= b; a -= c; a ^= (c>>12);  \
+  b -= c; b -= a; b ^= (a<<16); \
+  c -= a; c -= b; c ^= (b>>5); \
+  a -= b; a -= c; a ^= (c>>3);  \
+  b -= c; b -= a; b ^= (a<<10); \
+  c -= a; c -= b; c ^= (b>>15); \
+}
+
+inline unsigned int Hash(const unsigned char *k, unsigned int length, unsigned int initval)
+{
+   unsigned int a,b,c,len;
+
+   len = length;
+   a = b = 0x9e3779b9;
+   c = initval;
+
+   while (len >= 12)
+   {
+      a += (k[0] +((unsigned int)k[1]<<8) +((unsigned int)k[2]<<16) +((unsigned int)k[3]<<24));
+      b += (k[4] +((unsigned int)k[5]<<8) +((unsigned int)k[6]<<16) +((unsigned int)k[7]<<24));
+      c += (k[8] +((unsigned int)k[9]<<8) +((unsigned int)k[10]<<16)+((unsigned int)k[11]<<24));
+      bjhash_mix(a,b,c);
+      k += 12; len -= 12;
+   }
+
+   c += length;
+
+   switch(len)
+   {
+      case 11: c+=((unsigned int)k[10]<<24);
+      case 10: c+=((unsigned int)k[9]<<16);
+      case 9 : c+=((unsigned int)k[8]<<8);
+      case 8 : b+=((unsigned int)k[7]<<24);
+      case 7 : b+=((unsigned int)k[6]<<16);
+      case 6 : b+=((unsigned int)k[5]<<8);
+      case 5 : b+=k[4];
+      case 4 : a+=((unsigned int)k[3]<<24);
+      case 3 : a+=((unsigned int)k[2]<<16);
+      case 2 : a+=((unsigned int)k[1]<<8);
+      case 1 : a+=k[0];
+   }
+
+   bjhash_mix(a,b,c);
+
+   return c;
+}
+
+// Just to keep this macro from leaking out and polluting the global namespace
+#undef bjhash_mix
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::utils::hashing --
+//-----------------------------------------------------------------------------
+
+unsigned int
+hash(const char *k, unsigned int length, unsigned int initval)
+{
+    return hashing::Hash((unsigned char const*)k, length, initval);
+}
+
+unsigned int
+hash(const char *k, unsigned int initval)
+{
+    return hashing::Hash((unsigned char const*)k, strlen(k), initval);
+}
+
+unsigned int
+hash(const std::string &k, unsigned int initval)
+{
+    return hashing::Hash((unsigned char const*)k.c_str(), 
+                         k.size(), initval);
+}
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::utils::allocation --
+//-----------------------------------------------------------------------------
+namespace allocation
+{
+
+//-----------------------------------------------------------------------------
+// Bump arena used by the built-in arena allocators.
+//-----------------------------------------------------------------------------
+class BumpArena
+{
+public:
+    BumpArena(size_t block_bytes)
+    : m_block_bytes(block_bytes),
+      m_curr(NULL),
+      m_curr_avail(0),
+      m_bytes(0)
+    {}
+
+    ~BumpArena()
+    {
+        reset();
+    }
+
+    //-------------------------------------------------------------------------
+    void *allocate(size_t nbytes)
+    {
+        // keep all buffers aligned to 64 bytes (cache line + simd friendly)
+        size_t req_bytes = (nbytes + 63) & ~((size_t)63);
+        if(req_bytes == 0)
+        {
+            req_bytes = 64;
+        }
+
+        if(req_bytes > m_curr_avail)
+        {
+            // large requests get a dedicated block, so the current
+            // block can continue to be used
+            if(req_bytes > m_block_bytes / 2)
+            {
+                return new_block(req_bytes);
+            }
+
+            m_curr = (uint8*)new_block(m_block_bytes);
+            m_curr_avail = m_block_bytes;
+        }
+
+        void *res = m_curr;
+        m_curr       += req_bytes;
+        m_curr_avail -= req_bytes;
+        return res;
+    }
+
+    //-------------------------------------------------------------------------
+    void reset()
+    {
+        for(size_t i=0; i < m_blocks.size(); i++)
+        {
+            ::free(m_blocks[i]);
+        }
+        m_blocks.clear();
+        m_curr = NULL;
+        m_curr_avail = 0;
+        m_bytes = 0;
+    }
+
+    //-------------------------------------------------------------------------
+    index_t bytes() const
+    {
+        return (index_t) m_bytes;
+    }
+
+private:
+    //-------------------------------------------------------------------------
+    void *new_block(size_t nbytes)
+    {
+        // calloc gives us the zero init semantics that Node expects,
+        // over allocate so we can align the start of the block
+        void *block = calloc(nbytes + 63, 1);
+        if(block == NULL)
+        {
+            CONDUIT_ERROR("<utils::BumpArena> failed to allocate block of "
+                          << nbytes << " bytes");
+        }
+        m_blocks.push_back(block);
+        m_bytes += nbytes + 63;
+        size_t addr = (size_t)block;
+        return (void*)((addr + 63) & ~((size_t)63));
+    }
+
+    size_t              m_block_bytes;
+    std::vector<void*>  m_blocks;
+    uint8              *m_curr;
+    size_t              m_curr_avail;
+    size_t              m_bytes;
+};
+
+//-----------------------------------------------------------------------------
+// Registry entry, holds either context free or context callbacks.
+//-----------------------------------------------------------------------------
+struct Allocator
+{
+    void *(*allocate)(size_t, size_t);
+    void  (*free)(void*);
+
+    void *(*allocate_ctx)(size_t, size_t, void*);
+    void  (*free_ctx)(void*, void*);
+    void  *context;
+
+    // non-null for built-in arenas
+    BumpArena *arena;
+    // set when an arena is destroyed, its id is not reused
+    bool       destroyed;
+};
+
+//-----------------------------------------------------------------------------
+void *
+default_allocate(size_t num_items, size_t item_size)
+{
+    return calloc(num_items, item_size);
+}
+
+//-----------------------------------------------------------------------------
+void
+default_free(void *data_ptr)
+{
+    ::free(data_ptr);
+}
+
+//-----------------------------------------------------------------------------
+void *
+arena_allocate(size_t num_items, size_t item_size, void *context)
+{
+    return static_cast<BumpArena*>(context)->allocate(num_items * item_size);
+}
+
+//-----------------------------------------------------------------------------
+void
+arena_free(void *, void *)
+{
+    // individual frees are a no-op, see reset_arena_allocator()
+}
+
+//-----------------------------------------------------------------------------
+// Entries live in a fixed size table, so they never move and allocate and
+// free calls can read them without locking. Adding and destroying entries
+// and changing the default id are guarded by a mutex.
+//-----------------------------------------------------------------------------
+class Registry
+{
+public:
+    static const index_t max_allocators = 256;
+
+    Registry()
+    : m_size(0),
+      m_default_id(0)
+    {
+        // id 0 is always the calloc / free allocator
+        Allocator a = entry();
+        a.allocate = default_allocate;
+        a.free     = default_free;
+        add(a);
+    }
+
+    //-------------------------------------------------------------------------
+    static Allocator entry()
+    {
+        Allocator a;
+        a.allocate = NULL;
+        a.free = NULL;
+        a.allocate_ctx = NULL;
+        a.free_ctx = NULL;
+        a.context = NULL;
+        a.arena = NULL;
+        a.destroyed = false;
+        return a;
+    }
+
+    //-------------------------------------------------------------------------
+    index_t add(const Allocator &a)
+    {
+#ifdef CONDUIT_USE_CXX11
+        std::lock_guard<std::mutex> lock(m_mutex);
+#endif
+        index_t res = m_size;
+        if(res >= max_allocators)
+        {
+            CONDUIT_ERROR("Cannot register allocator (the maximum number of "
+                          "allocators is " << max_allocators << ")");
+        }
+        m_allocators[res] = a;
+        // publish the entry after it is written
+        m_size = res + 1;
+        return res;
+    }
+
+    //-------------------------------------------------------------------------
+    bool valid(index_t allocator_id) const
+    {
+        return allocator_id >= 0 &&
+               allocator_id < (index_t)m_size &&
+               !m_allocators[allocator_id].destroyed;
+    }
+
+    //-------------------------------------------------------------------------
+    Allocator &get(index_t allocator_id)
+    {
+        if(!valid(allocator_id))
+        {
+            CONDUIT_ERROR("Invalid allocator id: " << allocator_id
+                          << " (number of registered allocators: "
+                          << (index_t)m_size << ")");
+        }
+        return m_allocators[allocator_id];
+    }
+
+    //-------------------------------------------------------------------------
+    // frees are allowed after an arena is destroyed (they are no-ops)
+    Allocator &get_for_free(index_t allocator_id)
+    {
+        if(allocator_id < 0 || allocator_id >= (index_t)m_size)
+        {
+            return get(allocator_id);
+        }
+        return m_allocators[allocator_id];
+    }
+
+    //-------------------------------------------------------------------------
+    BumpArena *arena(index_t allocator_id)
+    {
+        BumpArena *res = get(allocator_id).arena;
+        if(res == NULL)
+        {
+            CONDUIT_ERROR("Allocator id: " << allocator_id
+                          << " is not an arena allocator");
+        }
+        return res;
+    }
+
+    //-------------------------------------------------------------------------
+    void destroy_arena(index_t allocator_id)
+    {
+#ifdef CONDUIT_USE_CXX11
+        std::lock_guard<std::mutex> lock(m_mutex);
+#endif
+        BumpArena *a = arena(allocator_id);
+        if(allocator_id == (index_t)m_default_id)
+        {
+            CONDUIT_ERROR("Cannot destroy allocator id: " << allocator_id
+                          << ", it is the default allocator");
+        }
+        m_allocators[allocator_id].destroyed = true;
+        m_allocators[allocator_id].arena     = NULL;
+        m_allocators[allocator_id].context   = NULL;
+        delete a;
+    }
+
+    //-------------------------------------------------------------------------
+    void set_default(index_t allocator_id)
+    {
+#ifdef CONDUIT_USE_CXX11
+        std::lock_guard<std::mutex> lock(m_mutex);
+#endif
+        // check id
+        get(allocator_id);
+        m_default_id = allocator_id;
+    }
+
+    //-------------------------------------------------------------------------
+    index_t default_id() const
+    {
+        return m_default_id;
+    }
+
+    //-------------------------------------------------------------------------
+    index_t size() const
+    {
+        return m_size;
+    }
+
+private:
+    Allocator               m_allocators[max_allocators];
+#ifdef CONDUIT_USE_CXX11
+    std::atomic<index_t>    m_size;
+    std::atomic<index_t>    m_default_id;
+    std::mutex              m_mutex;
+#else
+    volatile index_t        m_size;
+    volatile index_t        m_default_id;
+#endif
+};
+
+//-----------------------------------------------------------------------------
+// function scoped static avoids init order issues with Nodes that are
+// constructed during static init. The registry is never destroyed, so
+// static Nodes can still release their data during static destruction.
+// Arenas are released with destroy_arena_allocator().
+Registry &
+registry()
+{
+    static Registry *reg = new Registry();
+    return *reg;
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::utils::allocation --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+index_t
+register_allocator(void*(*allocate)(size_t, size_t),
+                   void (*free)(void*))
+{
+    allocation::Allocator a = allocation::Registry::entry();
+    a.allocate = allocate;
+    a.free     = free;
+    return allocation::registry().add(a);
+}
+
+//-----------------------------------------------------------------------------
+index_t
+register_allocator(void*(*allocate)(size_t, size_t, void*),
+                   void (*free)(void*, void*),
+                   void *context)
+{
+    allocation::Allocator a = allocation::Registry::entry();
+    a.allocate_ctx = allocate;
+    a.free_ctx     = free;
+    a.context      = context;
+    return allocation::registry().add(a);
+}
+
+//-----------------------------------------------------------------------------
+void
+set_default_allocator(index_t allocator_id)
+{
+    allocation::registry().set_default(allocator_id);
+}
+
+//-----------------------------------------------------------------------------
+index_t
+default_allocator()
+{
+    return allocation::registry().default_id();
+}
+
+//-----------------------------------------------------------------------------
+bool
+is_valid_allocator(index_t allocator_id)
+{
+    return allocation::registry().valid(allocator_id);
+}
+
+//-----------------------------------------------------------------------------
+index_t
+number_of_allocators()
+{
+    return allocation::registry().size();
+}
+
+//-----------------------------------------------------------------------------
+void *
+allocate_memory(index_t allocator_id,
+                index_t nbytes)
+{
+    allocation::Allocator &a = allocation::registry().get(allocator_id);
+    void *res = NULL;
+    if(a.allocate != NULL)
+    {
+        res = a.allocate((size_t)nbytes,1);
+    }
+    else
+    {
+        res = a.allocate_ctx((size_t)nbytes,1,a.context);
+    }
+
+    if(res == NULL && nbytes > 0)
+    {
+        CONDUIT_ERROR("Allocator " << allocator_id
+                      << " failed to allocate " << nbytes << " bytes");
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+void
+free_memory(index_t allocator_id,
+            void *data_ptr)
+{
+    allocation::Allocator &a = allocation::registry().get_for_free(allocator_id);
+    if(a.free != NULL)
+    {
+        a.free(data_ptr);
+    }
+    else
+    {
+        a.free_ctx(data_ptr,a.context);
+    }
+}
+
+//-----------------------------------------------------------------------------
+index_t
+create_arena_allocator(index_t block_bytes)
+{
+    if(block_bytes <= 0)
+    {
+        CONDUIT_ERROR("<utils::create_arena_allocator> invalid block size: "
+                      << block_bytes);
+    }
+
+    allocation::Allocator a = allocation::Registry::entry();
+    a.arena        = new allocation::BumpArena((size_t)block_bytes);
+    a.allocate_ctx = allocation::arena_allocate;
+    a.free_ctx     = allocation::arena_free;
+    a.context      = a.arena;
+
+    index_t res = -1;
+    try
+    {
+        res = allocation::registry().add(a);
+    }
+    catch(conduit::Error &)
+    {
+        delete a.arena;
+        throw;
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+void
+reset_arena_allocator(index_t allocator_id)
+{
+    allocation::registry().arena(allocator_id)->reset();
+}
+
+//-----------------------------------------------------------------------------
+index_t
+arena_allocator_bytes(index_t allocator_id)
+{
+    return allocation::registry().arena(allocator_id)->bytes();
+}
+
+//-----------------------------------------------------------------------------
+void
+destroy_arena_allocator(index_t allocator_id)
+{
+    allocation::registry().destroy_arena(allocator_id);
+}
+
+//-----------------------------------------------------------------------------
+// Private namespace member that holds the tree block threshold,
+// it is read by any thread that builds a tree.
+#ifdef CONDUIT_USE_CXX11
+static std::atomic<index_t> tree_block_min_descendants(16);
+#else
+static volatile index_t     tree_block_min_descendants = 16;
+#endif
+
+//-----------------------------------------------------------------------------
+void
+set_tree_block_threshold(index_t num_descendants)
+{
+    if(num_descendants < 0)
+    {
+        CONDUIT_ERROR("Invalid tree block threshold: " << num_descendants);
+    }
+    tree_block_min_descendants = num_descendants;
+}
+
+//-----------------------------------------------------------------------------
+index_t
+tree_block_threshold()
+{
+    return tree_block_min_descendants;
+}
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::utils::memory --
+//-----------------------------------------------------------------------------
+namespace memory
+{
+
+//-----------------------------------------------------------------------------
+// 64-bit counter with atomic updates
+class Counter
+{
+public:
+    Counter()
+    : m_value(0)
+    {}
+
+    //-------------------------------------------------------------------------
+    // returns the new value
+    int64 add(int64 delta)
+    {
+#if defined(CONDUIT_USE_CXX11)
+        return m_value.fetch_add(delta) + delta;
+#elif defined(CONDUIT_PLATFORM_WINDOWS)
+        return InterlockedExchangeAdd64(&m_value,delta) + delta;
+#else
+        return __sync_add_and_fetch(&m_value,delta);
+#endif
+    }
+
+    //-------------------------------------------------------------------------
+    int64 load() const
+    {
+        return const_cast<Counter*>(this)->add(0);
+    }
+
+    //-------------------------------------------------------------------------
+    void store(int64 value)
+    {
+#if defined(CONDUIT_USE_CXX11)
+        m_value.store(value);
+#elif defined(CONDUIT_PLATFORM_WINDOWS)
+        InterlockedExchange64(&m_value,value);
+#else
+        __sync_lock_test_and_set(&m_value,value);
+#endif
+    }
+
+    //-------------------------------------------------------------------------
+    // raises the value to at least `value`
+    void raise_to(int64 value)
+    {
+        int64 curr = load();
+        while(curr < value)
+        {
+#if defined(CONDUIT_USE_CXX11)
+            if(m_value.compare_exchange_weak(curr,value))
+            {
+                return;
+            }
+#else
+    #if defined(CONDUIT_PLATFORM_WINDOWS)
+            int64 prev = InterlockedCompareExchange64(&m_value,value,curr);
+    #else
+            int64 prev = __sync_val_compare_and_swap(&m_value,curr,value);
+    #endif
+            if(prev == curr)
+            {
+                return;
+            }
+            curr = prev;
+#endif
+        }
+    }
+
+private:
+#if defined(CONDUIT_USE_CXX11)
+    std::atomic<int64>  m_value;
+#else
+    volatile int64      m_value;
+#endif
+};
+
+//-----------------------------------------------------------------------------
+// counters for one tag
+struct TagStats
+{
+    std::string  name;
+    Counter      live_bytes;
+    Counter      peak_bytes;
+    Counter      num_allocations;
+};
+
+// tag id 0 counts untagged buffers
+static const index_t max_tags = 64;
+// number of power of two histogram buckets
+static const index_t num_buckets = 64;
+
+//-----------------------------------------------------------------------------
+struct Stats
+{
+    Counter  alloc_live_bytes;
+    Counter  alloc_peak_bytes;
+    Counter  num_allocations;
+    Counter  num_frees;
+
+    Counter  mmap_live_bytes;
+    Counter  mmap_peak_bytes;
+    Counter  num_maps;
+    Counter  num_unmaps;
+
+    Counter  histogram[num_buckets];
+
+    TagStats tags[max_tags];
+    Counter  num_tags;
+#ifdef CONDUIT_USE_CXX11
+    // guards adding tags
+    std::mutex tags_mutex;
+#endif
+};
+
+//-----------------------------------------------------------------------------
+// never destroyed, like the allocator registry
+Stats &
+stats()
+{
+    static Stats *res = new Stats();
+    return *res;
+}
+
+//-----------------------------------------------------------------------------
+// tag id used by allocations on this thread
+#ifdef CONDUIT_USE_CXX11
+static thread_local index_t current_tag_id = 0;
+#else
+static index_t current_tag_id = 0;
+#endif
+
+//-----------------------------------------------------------------------------
+index_t
+tag_id(const std::string &name)
+{
+    Stats &s = stats();
+#ifdef CONDUIT_USE_CXX11
+    std::lock_guard<std::mutex> lock(s.tags_mutex);
+#endif
+    index_t num_tags = (index_t)s.num_tags.load();
+    for(index_t i=1; i <= num_tags; i++)
+    {
+        if(s.tags[i].name == name)
+        {
+            return i;
+        }
+    }
+
+    if(num_tags + 1 >= max_tags)
+    {
+        CONDUIT_ERROR("<utils::MemoryTag> cannot add tag \"" << name
+                      << "\" (the maximum number of tags is "
+                      << (max_tags - 1) << ")");
+    }
+
+    s.tags[num_tags + 1].name = name;
+    s.num_tags.add(1);
+    return num_tags + 1;
+}
+
+//-----------------------------------------------------------------------------
+// floor(log2(nbytes)), 0 for 0 bytes
+index_t
+bucket(index_t nbytes)
+{
+    index_t res = 0;
+    uint64 val = (uint64)nbytes;
+    while(val > 1 && res < num_buckets - 1)
+    {
+        val >>= 1;
+        res++;
+    }
+    return res;
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::utils::memory --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+MemoryTag::MemoryTag(const std::string &name)
+: m_prev_tag_id(memory::current_tag_id)
+{
+    memory::current_tag_id = memory::tag_id(name);
+}
+
+//-----------------------------------------------------------------------------
+MemoryTag::~MemoryTag()
+{
+    memory::current_tag_id = m_prev_tag_id;
+}
+
+//-----------------------------------------------------------------------------
+index_t
+memory_stats_allocate(index_t nbytes)
+{
+    memory::Stats &s = memory::stats();
+    s.alloc_peak_bytes.raise_to(s.alloc_live_bytes.add(nbytes));
+    s.num_allocations.add(1);
+    s.histogram[memory::bucket(nbytes)].add(1);
+
+    index_t tag_id = memory::current_tag_id;
+    if(tag_id != 0)
+    {
+        memory::TagStats &t = s.tags[tag_id];
+        t.peak_bytes.raise_to(t.live_bytes.add(nbytes));
+        t.num_allocations.add(1);
+    }
+    return tag_id;
+}
+
+//-----------------------------------------------------------------------------
+void
+memory_stats_free(index_t nbytes,
+                  index_t tag_id)
+{
+    memory::Stats &s = memory::stats();
+    s.alloc_live_bytes.add(-nbytes);
+    s.num_frees.add(1);
+
+    if(tag_id != 0)
+    {
+        s.tags[tag_id].live_bytes.add(-nbytes);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+memory_stats_map(index_t nbytes)
 {
-    return hashing::Hash((unsigned char const*)k, strlen(k), initval);
+    memory::Stats &s = memory::stats();
+    s.mmap_peak_bytes.raise_to(s.mmap_live_bytes.add(nbytes));
+    s.num_maps.add(1);
 }
 
-unsigned int
-hash(const std::string &k, unsigned int initval)
+//-----------------------------------------------------------------------------
+void
+memory_stats_unmap(index_t nbytes)
 {
-    return hashing::Hash((unsigned char const*)k.c_str(), 
-                         k.size(), initval);
+    memory::Stats &s = memory::stats();
+    s.mmap_live_bytes.add(-nbytes);
+    s.num_unmaps.add(1);
+}
+
+//-----------------------------------------------------------------------------
+void
+memory_stats(Node &res)
+{
+    // read all counters before building res, which allocates
+    memory::Stats &s = memory::stats();
+    int64 alloc_live_bytes = s.alloc_live_bytes.load();
+    int64 alloc_peak_bytes = s.alloc_peak_bytes.load();
+    int64 num_allocations  = s.num_allocations.load();
+    int64 num_frees        = s.num_frees.load();
+
+    int64 mmap_live_bytes = s.mmap_live_bytes.load();
+    int64 mmap_peak_bytes = s.mmap_peak_bytes.load();
+    int64 num_maps        = s.num_maps.load();
+    int64 num_unmaps      = s.num_unmaps.load();
+
+    // buckets up to the largest one used, bucket i counts allocations
+    // of [2^i, 2^(i+1)) bytes (bucket 0 includes 0 byte allocations)
+    std::vector<int64> histogram;
+    for(index_t i=0; i < memory::num_buckets; i++)
+    {
+        histogram.push_back(s.histogram[i].load());
+    }
+    while(!histogram.empty() && histogram.back() == 0)
+    {
+        histogram.pop_back();
+    }
+
+    index_t num_tags = (index_t)s.num_tags.load();
+    std::vector<int64> tag_stats;
+    for(index_t i=1; i <= num_tags; i++)
+    {
+        memory::TagStats &t = s.tags[i];
+        tag_stats.push_back(t.live_bytes.load());
+        tag_stats.push_back(t.peak_bytes.load());
+        tag_stats.push_back(t.num_allocations.load());
+    }
+
+    res.reset();
+
+    Node &n_alloc = res["allocated"];
+    n_alloc["live_bytes"]      = alloc_live_bytes;
+    n_alloc["peak_bytes"]      = alloc_peak_bytes;
+    n_alloc["num_allocations"] = num_allocations;
+    n_alloc["num_frees"]       = num_frees;
+
+    Node &n_mmap = res["mmaped"];
+    n_mmap["live_bytes"] = mmap_live_bytes;
+    n_mmap["peak_bytes"] = mmap_peak_bytes;
+    n_mmap["num_maps"]   = num_maps;
+    n_mmap["num_unmaps"] = num_unmaps;
+
+    index_t num_used = (index_t)histogram.size();
+    Node &n_hist = res["histogram"];
+    n_hist["min_bytes"].set(DataType::int64(num_used));
+    n_hist["num_allocations"].set(DataType::int64(num_used));
+    int64 *min_bytes = n_hist["min_bytes"].as_int64_ptr();
+    int64 *counts    = n_hist["num_allocations"].as_int64_ptr();
+    for(index_t i=0; i < num_used; i++)
+    {
+        min_bytes[i] = i == 0 ? 0 : ((int64)1) << i;
+        counts[i]    = histogram[(size_t)i];
+    }
+
+    Node &n_tags = res["tags"];
+    n_tags.set(DataType::object());
+    for(index_t i=0; i < num_tags; i++)
+    {
+        Node &n_tag = n_tags.add_child(s.tags[i+1].name);
+        n_tag["live_bytes"]      = tag_stats[(size_t)(3 * i)];
+        n_tag["peak_bytes"]      = tag_stats[(size_t)(3 * i + 1)];
+        n_tag["num_allocations"] = tag_stats[(size_t)(3 * i + 2)];
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+reset_memory_stats()
+{
+    memory::Stats &s = memory::stats();
+    s.alloc_peak_bytes.store(s.alloc_live_bytes.load());
+    s.num_allocations.store(0);
+    s.num_frees.store(0);
+
+    s.mmap_peak_bytes.store(s.mmap_live_bytes.load());
+    s.num_maps.store(0);
+    s.num_unmaps.store(0);
+
+    for(index_t i=0; i < memory::num_buckets; i++)
+    {
+        s.histogram[i].store(0);
+    }
+
+    index_t num_tags = (index_t)s.num_tags.load();
+    for(index_t i=1; i <= num_tags; i++)
+    {
+        memory::TagStats &t = s.tags[i];
+        t.peak_bytes.store(t.live_bytes.load());
+        t.num_allocations.store(0);
+    }
+}
+
+//-----------------------------------------------------------------------------
+// -- begin conduit::utils::trace --
+//-----------------------------------------------------------------------------
+namespace trace
+{
+
+//-----------------------------------------------------------------------------
+struct Event
+{
+    index_t name_id;
+    index_t thread;
+    index_t depth;
+    double  start;
+    double  duration;
+    index_t bytes;
+};
+
+//-----------------------------------------------------------------------------
+struct SpanStats
+{
+    SpanStats()
+    : count(0),
+      total_time(0.0),
+      min_time(0.0),
+      max_time(0.0),
+      bytes(0)
+    {}
+
+    void add(double time, index_t nbytes)
+    {
+        min_time = (count == 0 || time < min_time) ? time : min_time;
+        max_time = (count == 0 || time > max_time) ? time : max_time;
+        total_time += time;
+        bytes      += nbytes;
+        count++;
+    }
+
+    index_t count;
+    double  total_time;
+    double  min_time;
+    double  max_time;
+    index_t bytes;
+};
+
+//-----------------------------------------------------------------------------
+struct State
+{
+    State()
+    : epoch(-1.0),
+      max_events(1048576),
+      num_dropped_events(0),
+      num_threads(0)
+    {}
+
+#ifdef CONDUIT_USE_CXX11
+    // guards everything below
+    std::mutex                     mutex;
+#endif
+    // trace clock value when tracing was first enabled or last reset
+    double                         epoch;
+    index_t                        max_events;
+    index_t                        num_dropped_events;
+    index_t                        num_threads;
+    // span names are usually string literals, look up by pointer first
+    std::map<const char*,index_t>  name_ptr_ids;
+    std::map<std::string,index_t>  name_ids;
+    std::vector<std::string>       names;
+    std::vector<SpanStats>         stats;
+    std::vector<Event>             events;
+};
+
+//-----------------------------------------------------------------------------
+// never destroyed, like the memory stats
+State &
+state()
+{
+    static State *res = new State();
+    return *res;
+}
+
+//-----------------------------------------------------------------------------
+// checked by every span, kept outside of State to avoid the guarded
+// static init
+#ifdef CONDUIT_USE_CXX11
+static std::atomic<bool> enabled(false);
+static thread_local index_t thread_id = -1;
+static thread_local index_t depth = 0;
+#else
+static volatile bool enabled = false;
+static index_t thread_id = -1;
+static index_t depth = 0;
+#endif
+
+//-----------------------------------------------------------------------------
+// monotonic clock in seconds
+double
+now()
+{
+#if defined(CONDUIT_USE_CXX11)
+    return std::chrono::duration<double>(
+                std::chrono::steady_clock::now().time_since_epoch()).count();
+#elif defined(CONDUIT_PLATFORM_WINDOWS)
+    LARGE_INTEGER freq;
+    LARGE_INTEGER count;
+    QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&count);
+    return (double)count.QuadPart / (double)freq.QuadPart;
+#else
+    timeval tv;
+    gettimeofday(&tv,NULL);
+    return (double)tv.tv_sec + 1e-6 * (double)tv.tv_usec;
+#endif
+}
+
+//-----------------------------------------------------------------------------
+// expects the lock to be held
+index_t
+name_id(State &s,
+        const char *name)
+{
+    std::map<const char*,index_t>::const_iterator itr;
+    itr = s.name_ptr_ids.find(name);
+    if(itr != s.name_ptr_ids.end())
+    {
+        return itr->second;
+    }
+
+    index_t res = 0;
+    std::string name_str(name);
+    std::map<std::string,index_t>::const_iterator str_itr;
+    str_itr = s.name_ids.find(name_str);
+    if(str_itr != s.name_ids.end())
+    {
+        res = str_itr->second;
+    }
+    else
+    {
+        res = (index_t)s.names.size();
+        s.name_ids[name_str] = res;
+        s.names.push_back(name_str);
+        s.stats.push_back(SpanStats());
+    }
+    s.name_ptr_ids[name] = res;
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+void
+record(const char *name,
+       double start,
+       double end,
+       index_t nbytes,
+       index_t span_depth)
+{
+    State &s = state();
+#ifdef CONDUIT_USE_CXX11
+    std::lock_guard<std::mutex> lock(s.mutex);
+#endif
+    // skip spans that started before the last reset
+    if(start < s.epoch)
+    {
+        return;
+    }
+
+    if(thread_id < 0)
+    {
+        thread_id = s.num_threads++;
+    }
+
+    Event e;
+    e.name_id  = name_id(s,name);
+    e.thread   = thread_id;
+    e.depth    = span_depth;
+    e.start    = start - s.epoch;
+    e.duration = end - start;
+    e.bytes    = nbytes;
+
+    s.stats[(size_t)e.name_id].add(e.duration,nbytes);
+
+    if((index_t)s.events.size() < s.max_events)
+    {
+        s.events.push_back(e);
+    }
+    else
+    {
+        s.num_dropped_events++;
+    }
+}
+
+//-----------------------------------------------------------------------------
+// writes the summary and events of a trace result
+void
+to_node(const std::vector<std::string> &names,
+        const std::vector<SpanStats> &stats,
+        const std::vector<Event> &events,
+        const std::vector<index_t> &ranks,
+        index_t num_dropped_events,
+        Node &res)
+{
+    res.reset();
+    res["num_dropped_events"] = (int64)num_dropped_events;
+
+    Node &n_summary = res["summary"];
+    n_summary.set(DataType::object());
+    for(size_t i=0; i < names.size(); i++)
+    {
+        Node &n_span = n_summary.add_child(names[i]);
+        n_span["count"]      = (int64)stats[i].count;
+        n_span["total_time"] = stats[i].total_time;
+        n_span["min_time"]   = stats[i].min_time;
+        n_span["max_time"]   = stats[i].max_time;
+        n_span["bytes"]      = (int64)stats[i].bytes;
+    }
+
+    index_t num_events = (index_t)events.size();
+    Node &n_events = res["events"];
+    n_events["name_id"].set(DataType::int64(num_events));
+    n_events["thread"].set(DataType::int64(num_events));
+    n_events["depth"].set(DataType::int64(num_events));
+    n_events["start"].set(DataType::float64(num_events));
+    n_events["duration"].set(DataType::float64(num_events));
+    n_events["bytes"].set(DataType::int64(num_events));
+
+    int64   *name_ids  = n_events["name_id"].value();
+    int64   *threads   = n_events["thread"].value();
+    int64   *depths    = n_events["depth"].value();
+    float64 *starts    = n_events["start"].value();
+    float64 *durations = n_events["duration"].value();
+    int64   *bytes     = n_events["bytes"].value();
+
+    for(size_t i=0; i < events.size(); i++)
+    {
+        const Event &e = events[i];
+        name_ids[i]  = e.name_id;
+        threads[i]   = e.thread;
+        depths[i]    = e.depth;
+        starts[i]    = e.start;
+        durations[i] = e.duration;
+        bytes[i]     = e.bytes;
+    }
+
+    if(!ranks.empty())
+    {
+        n_events["rank"].set(DataType::int64(num_events));
+        int64 *rank_vals = n_events["rank"].value();
+        for(size_t i=0; i < ranks.size(); i++)
+        {
+            rank_vals[i] = ranks[i];
+        }
+    }
+}
+
+}
+//-----------------------------------------------------------------------------
+// -- end conduit::utils::trace --
+//-----------------------------------------------------------------------------
+
+//-----------------------------------------------------------------------------
+TraceSpan::TraceSpan(const char *name)
+: m_name(name),
+  m_start(-1.0),
+  m_bytes(0)
+{
+    if(trace::enabled)
+    {
+        trace::depth++;
+        m_start = trace::now();
+    }
+}
+
+//-----------------------------------------------------------------------------
+TraceSpan::~TraceSpan()
+{
+    if(m_start < 0.0)
+    {
+        return;
+    }
+
+    double end = trace::now();
+    trace::depth--;
+    trace::record(m_name,m_start,end,m_bytes,trace::depth);
+}
+
+//-----------------------------------------------------------------------------
+void
+set_trace_enabled(bool value)
+{
+    trace::State &s = trace::state();
+    {
+#ifdef CONDUIT_USE_CXX11
+        std::lock_guard<std::mutex> lock(s.mutex);
+#endif
+        if(value && s.epoch < 0.0)
+        {
+            s.epoch = trace::now();
+        }
+    }
+    trace::enabled = value;
+}
+
+//-----------------------------------------------------------------------------
+bool
+trace_enabled()
+{
+    return trace::enabled;
+}
+
+//-----------------------------------------------------------------------------
+void
+reset_trace()
+{
+    trace::State &s = trace::state();
+#ifdef CONDUIT_USE_CXX11
+    std::lock_guard<std::mutex> lock(s.mutex);
+#endif
+    s.epoch = trace::now();
+    s.num_dropped_events = 0;
+    s.name_ptr_ids.clear();
+    s.name_ids.clear();
+    s.names.clear();
+    s.stats.clear();
+    s.events.clear();
+}
+
+//-----------------------------------------------------------------------------
+void
+set_trace_max_events(index_t max_events)
+{
+    trace::State &s = trace::state();
+#ifdef CONDUIT_USE_CXX11
+    std::lock_guard<std::mutex> lock(s.mutex);
+#endif
+    s.max_events = max_events;
+}
+
+//-----------------------------------------------------------------------------
+index_t
+trace_max_events()
+{
+    trace::State &s = trace::state();
+#ifdef CONDUIT_USE_CXX11
+    std::lock_guard<std::mutex> lock(s.mutex);
+#endif
+    return s.max_events;
+}
+
+//-----------------------------------------------------------------------------
+void
+trace_results(Node &res)
+{
+    // copy out while holding the lock, building res may record spans
+    std::vector<std::string>      names;
+    std::vector<trace::SpanStats> stats;
+    std::vector<trace::Event>     events;
+    index_t num_dropped_events = 0;
+    {
+        trace::State &s = trace::state();
+#ifdef CONDUIT_USE_CXX11
+        std::lock_guard<std::mutex> lock(s.mutex);
+#endif
+        names  = s.names;
+        stats  = s.stats;
+        events = s.events;
+        num_dropped_events = s.num_dropped_events;
+    }
+
+    trace::to_node(names,
+                   stats,
+                   events,
+                   std::vector<index_t>(),
+                   num_dropped_events,
+                   res);
+}
+
+//-----------------------------------------------------------------------------
+void
+merge_trace_results(const Node &traces,
+                    Node &res)
+{
+    std::map<std::string,index_t> name_ids;
+    std::vector<std::string>      names;
+    std::vector<trace::SpanStats> stats;
+    std::vector<trace::Event>     events;
+    std::vector<index_t>          ranks;
+    index_t num_dropped_events = 0;
+
+    for(index_t rank=0; rank < traces.number_of_children(); rank++)
+    {
+        const Node &n_trace = traces.child(rank);
+        if(n_trace.has_child("num_dropped_events"))
+        {
+            num_dropped_events += n_trace["num_dropped_events"].to_index_t();
+        }
+
+        // maps this trace's name ids to the merged name ids
+        std::vector<index_t> ids;
+        if(n_trace.has_child("summary"))
+        {
+            const Node &n_summary = n_trace["summary"];
+            for(index_t i=0; i < n_summary.number_of_children(); i++)
+            {
+                const Node &n_span = n_summary.child(i);
+                const std::string &name = n_summary.child_names()[(size_t)i];
+
+                index_t id = (index_t)names.size();
+                std::map<std::string,index_t>::const_iterator itr;
+                itr = name_ids.find(name);
+                if(itr != name_ids.end())
+                {
+                    id = itr->second;
+                }
+                else
+                {
+                    name_ids[name] = id;
+                    names.push_back(name);
+                    stats.push_back(trace::SpanStats());
+                }
+                ids.push_back(id);
+
+                trace::SpanStats &st = stats[(size_t)id];
+                index_t count      = n_span["count"].to_index_t();
+                float64 min_time   = n_span["min_time"].to_float64();
+                float64 max_time   = n_span["max_time"].to_float64();
+                if(count > 0)
+                {
+                    st.min_time = (st.count == 0 || min_time < st.min_time)
+                                  ? min_time : st.min_time;
+                    st.max_time = (st.count == 0 || max_time > st.max_time)
+                                  ? max_time : st.max_time;
+                }
+                st.count      += count;
+                st.total_time += n_span["total_time"].to_float64();
+                st.bytes      += n_span["bytes"].to_index_t();
+            }
+        }
+
+        if(!n_trace.has_child("events"))
+        {
+            continue;
+        }
+
+        // copies handle any numeric types (for example, traces read
+        // back from json)
+        const Node &n_events = n_trace["events"];
+        Node n_name_ids, n_threads, n_depths, n_starts, n_durations, n_bytes;
+        n_events["name_id"].to_int64_array(n_name_ids);
+        n_events["thread"].to_int64_array(n_threads);
+        n_events["depth"].to_int64_array(n_depths);
+        n_events["start"].to_float64_array(n_starts);
+        n_events["duration"].to_float64_array(n_durations);
+        n_events["bytes"].to_int64_array(n_bytes);
+
+        int64_array   name_id_vals  = n_name_ids.value();
+        int64_array   thread_vals   = n_threads.value();
+        int64_array   depth_vals    = n_depths.value();
+        float64_array start_vals    = n_starts.value();
+        float64_array duration_vals = n_durations.value();
+        int64_array   bytes_vals    = n_bytes.value();
+
+        index_t num_events = name_id_vals.number_of_elements();
+        for(index_t i=0; i < num_events; i++)
+        {
+            index_t id = (index_t)name_id_vals[i];
+            if(id < 0 || id >= (index_t)ids.size())
+            {
+                CONDUIT_ERROR("<utils::merge_trace_results> trace " << rank
+                              << " event " << i << " has invalid name_id "
+                              << id);
+            }
+
+            trace::Event e;
+            e.name_id  = ids[(size_t)id];
+            e.thread   = (index_t)thread_vals[i];
+            e.depth    = (index_t)depth_vals[i];
+            e.start    = start_vals[i];
+            e.duration = duration_vals[i];
+            e.bytes    = (index_t)bytes_vals[i];
+            events.push_back(e);
+            ranks.push_back(rank);
+        }
+    }
+
+    trace::to_node(names,
+                   stats,
+                   events,
+                   ranks,
+                   num_dropped_events,
+                   res);
+
+    // keep the rank column even if there are no events
+    if(ranks.empty())
+    {
+        res["events/rank"].set(DataType::int64(0));
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+trace_to_chrome_json(const Node &trace,
+                     std::ostream &os)
+{
+    const Node &n_summary = trace["summary"];
+    const Node &n_events  = trace["events"];
+
+    Node n_name_ids, n_threads, n_starts, n_durations, n_bytes, n_ranks;
+    n_events["name_id"].to_int64_array(n_name_ids);
+    n_events["thread"].to_int64_array(n_threads);
+    n_events["start"].to_float64_array(n_starts);
+    n_events["duration"].to_float64_array(n_durations);
+    n_events["bytes"].to_int64_array(n_bytes);
+
+    index_t num_events = n_name_ids.dtype().number_of_elements();
+    if(n_events.has_child("rank"))
+    {
+        n_events["rank"].to_int64_array(n_ranks);
+    }
+    else
+    {
+        n_ranks.set(DataType::int64(num_events));
+    }
+
+    int64_array   name_id_vals  = n_name_ids.value();
+    int64_array   thread_vals   = n_threads.value();
+    float64_array start_vals    = n_starts.value();
+    float64_array duration_vals = n_durations.value();
+    int64_array   bytes_vals    = n_bytes.value();
+    int64_array   rank_vals     = n_ranks.value();
+
+    std::vector<std::string> names;
+    for(index_t i=0; i < n_summary.number_of_children(); i++)
+    {
+        const std::string &name = n_summary.child_names()[(size_t)i];
+        names.push_back(escape_special_chars(name));
+    }
+
+    for(index_t i=0; i < num_events; i++)
+    {
+        index_t id = (index_t)name_id_vals[i];
+        if(id < 0 || id >= (index_t)names.size())
+        {
+            CONDUIT_ERROR("<utils::trace_to_chrome_json> event " << i
+                          << " has invalid name_id " << id);
+        }
+    }
+
+    std::ios_base::fmtflags flags = os.flags();
+    std::streamsize precision = os.precision();
+    os << std::fixed << std::setprecision(3);
+
+    os << "{\"traceEvents\":[";
+
+    // name each process after its rank
+    std::vector<int64> seen_ranks;
+    for(index_t i=0; i < num_events; i++)
+    {
+        if(std::find(seen_ranks.begin(),
+                     seen_ranks.end(),
+                     rank_vals[i]) == seen_ranks.end())
+        {
+            seen_ranks.push_back(rank_vals[i]);
+        }
+    }
+
+    bool first = true;
+    for(size_t i=0; i < seen_ranks.size(); i++)
+    {
+        os << (first ? "\n" : ",\n");
+        os << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":"
+           << seen_ranks[i]
+           << ",\"args\":{\"name\":\"rank " << seen_ranks[i] << "\"}}";
+        first = false;
+    }
+
+    for(index_t i=0; i < num_events; i++)
+    {
+        index_t id = (index_t)name_id_vals[i];
+
+        // chrome trace times are in microseconds
+        os << (first ? "\n" : ",\n");
+        os << "{\"name\":\"" << names[(size_t)id] << "\""
+           << ",\"cat\":\"conduit\",\"ph\":\"X\""
+           << ",\"ts\":"  << (start_vals[i] * 1e6)
+           << ",\"dur\":" << (duration_vals[i] * 1e6)
+           << ",\"pid\":" << rank_vals[i]
+           << ",\"tid\":" << thread_vals[i]
+           << ",\"args\":{\"bytes\":" << bytes_vals[i] << "}}";
+        first = false;
+    }
+
+    os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    os.flags(flags);
+    os.precision(precision);
+}
+
+//-----------------------------------------------------------------------------
+std::string
+trace_to_chrome_json(const Node &trace)
+{
+    std::ostringstream oss;
+    trace_to_chrome_json(trace,oss);
+    return oss.str();
 }
 
 }
@@ -191,6 +191,31 @@
 //-----------------------------------------------------------------------------
 #define CONDUIT_UNUSED( var ) (void)(var)
 
+//-----------------------------------------------------------------------------
+//
+/// The CONDUIT_TRACE_SCOPE macro records the enclosing scope as a
+/// conduit::utils::TraceSpan with the given name, CONDUIT_TRACE_BYTES adds
+/// to the byte count of the current scope's span (nbytes is only 
+/// evaluated while the span is recorded). Both compile to nothing unless
+/// CONDUIT_ENABLE_TRACING is defined. Use at most one CONDUIT_TRACE_SCOPE
+/// per scope.
+///
+//-----------------------------------------------------------------------------
+#ifdef CONDUIT_ENABLE_TRACING
+#define CONDUIT_TRACE_SCOPE( name )                                  \
+    conduit::utils::TraceSpan conduit_trace_span__(name)
+#define CONDUIT_TRACE_BYTES( nbytes )                                \
+{                                                                    \
+    if(conduit_trace_span__.active())                                \
+    {                                                                \
+        conduit_trace_span__.add_bytes(nbytes);                      \
+    }                                                                \
+}
+#else
+#define CONDUIT_TRACE_SCOPE( name )
+#define CONDUIT_TRACE_BYTES( nbytes )
+#endif
+
 //-----------------------------------------------------------------------------
 // -- begin conduit:: --
 //-----------------------------------------------------------------------------
@@ -307,6 +332,15 @@ namespace utils
     std::string CONDUIT_API join_path(const std::string &left,
                                       const std::string &right);
 
+    /// Allocation free path tokenizer.
+    /// The first component of the path [path,path_end) starts at `path`,
+    /// its length is returned in `curr_len`. Returns a pointer to the
+    /// rest of the path, or NULL if there is no remainder (matches the 
+    /// empty `next` case of split_path).
+    const char CONDUIT_API *split_path(const char *path,
+                                       const char *path_end,
+                                       size_t &curr_len);
+
 //-----------------------------------------------------------------------------
 /// Helpers for splitting and joining file system paths.
 /// These use the proper platform specific separator (/ or \).
@@ -400,6 +434,13 @@ namespace utils
 
 //-----------------------------------------------------------------------------
 /// Base64 Encoding of Buffers 
+///
+/// Uses the standard alphabet with '=' padding and no line breaks. 
+/// Encoded text is null terminated. Chars outside of the alphabet 
+/// (padding, whitespace) are skipped when decoding.
+///
+/// The codec uses SSSE3 or AVX2 when conduit is compiled with them
+/// enabled, with a scalar fallback.
 //-----------------------------------------------------------------------------
     void CONDUIT_API base64_encode(const void *src,
                                    index_t src_nbytes,
@@ -414,6 +455,60 @@ namespace utils
                                    index_t src_nbytes,
                                    void *dest);
 
+//-----------------------------------------------------------------------------
+/// Incremental base64 encoding, writes encoded text to a stream in 
+/// fixed size blocks.
+//-----------------------------------------------------------------------------
+class CONDUIT_API Base64Encoder
+{
+public:
+    explicit Base64Encoder(std::ostream &os);
+            ~Base64Encoder();
+
+    /// encodes the next piece of data
+    void    write(const void *src, index_t src_nbytes);
+
+    /// encodes any remaining bytes (with padding) and flushes the 
+    /// encoded text, call once after the last write
+    void    finish();
+
+private:
+    Base64Encoder(const Base64Encoder &);
+    Base64Encoder &operator=(const Base64Encoder &);
+
+    void    flush();
+
+    std::ostream  &m_os;
+    // bytes that did not fill a 3 byte group yet
+    unsigned char  m_pending[3];
+    index_t        m_num_pending;
+    char          *m_buffer;
+    index_t        m_size;
+};
+
+//-----------------------------------------------------------------------------
+/// Incremental base64 decoding, for encoded text that arrives in pieces.
+//-----------------------------------------------------------------------------
+class CONDUIT_API Base64Decoder
+{
+public:
+    Base64Decoder();
+
+    /// decodes the next piece of encoded text into dest, which must hold 
+    /// at least (src_nbytes / 4) * 3 + 3 bytes. Returns the number of 
+    /// decoded bytes.
+    index_t decode(const void *src, index_t src_nbytes, void *dest);
+
+    /// decodes a trailing partial group (unpadded input), dest must hold 
+    /// at least 2 bytes. Returns the number of decoded bytes.
+    index_t finish(void *dest);
+
+private:
+    // values of chars that did not fill a 4 char group yet
+    unsigned char  m_pending[4];
+    int            m_num_pending;
+};
+
 //-----------------------------------------------------------------------------
      std::string CONDUIT_API json_sanitize(const std::string &json);
      
@@ -454,10 +549,92 @@ namespace utils
 
 
 //-----------------------------------------------------------------------------
-// floating point to string helper, strikes a balance of what we want 
+// floating point to string helpers, strikes a balance of what we want 
 // for format-wise for debug printing and json + yaml.
+//
+// These produce a string that parses back to the same value, using the
+// grisu2 algorithm (the result is the shortest such string in nearly all
+// cases, float32 values use float32 precision). Integral 
+// values get a ".0" suffix, scientific notation is used for exponents 
+// less than -4 or greater than 14, and inf and nan are written as 
+// "inf", "-inf" and "nan".
 //-----------------------------------------------------------------------------
     std::string CONDUIT_API float64_to_string(float64 value);
+    std::string CONDUIT_API float32_to_string(float32 value);
+
+//-----------------------------------------------------------------------------
+// Number formatting into caller provided buffers. 
+// `buffer` must hold at least 32 chars, the result is not null terminated.
+// Each returns the number of chars written.
+//-----------------------------------------------------------------------------
+    index_t CONDUIT_API float64_to_chars(float64 value, char *buffer);
+    index_t CONDUIT_API float32_to_chars(float32 value, char *buffer);
+    index_t CONDUIT_API int64_to_chars(int64 value, char *buffer);
+    index_t CONDUIT_API uint64_to_chars(uint64 value, char *buffer);
+
+//-----------------------------------------------------------------------------
+/// Buffered text output used by the json and yaml emitters.
+///
+/// Text and formatted numbers are collected in an internal buffer, which
+/// is written to the target stream in large blocks (when it fills, on 
+/// flush(), and when the writer is destroyed). Writing directly to the 
+/// target stream while a writer holds unflushed text will reorder the 
+/// output.
+//-----------------------------------------------------------------------------
+class CONDUIT_API TextWriter
+{
+public:
+    explicit TextWriter(std::ostream &os);
+            ~TextWriter();
+
+    void    write(char c)
+            {
+                if(m_size == m_capacity)
+                {
+                    flush();
+                }
+                m_buffer[m_size++] = c;
+            }
+
+    void    write(const char *data, index_t num_bytes);
+    void    write(const char *str);
+    void    write(const std::string &str)
+            {
+                write(str.c_str(),(index_t)str.size());
+            }
+
+    void    write_int64(int64 value);
+    void    write_uint64(uint64 value);
+    void    write_float32(float32 value);
+    void    write_float64(float64 value);
+
+    /// same output as utils::indent()
+    void    write_indent(index_t indent,
+                         index_t depth,
+                         const std::string &pad);
+
+    /// writes buffered text to the target stream
+    void    flush();
+
+private:
+    TextWriter(const TextWriter &);
+    TextWriter &operator=(const TextWriter &);
+
+    /// makes sure there is room for a formatted number
+    char   *reserve_number()
+            {
+                if(m_capacity - m_size < 32)
+                {
+                    flush();
+                }
+                return m_buffer + m_size;
+            }
+
+    std::ostream &m_os;
+    char         *m_buffer;
+    index_t       m_size;
+    index_t       m_capacity;
+};
 
 //-----------------------------------------------------------------------------
      void CONDUIT_API indent(std::ostream &os,
@@ -479,6 +656,204 @@ namespace utils
      unsigned int CONDUIT_API hash(const std::string &k, 
                                    unsigned int initval = 0);
 
+//-----------------------------------------------------------------------------
+/// Memory allocators for Node data.
+///
+/// Node data buffers are obtained from registered allocators, selected by
+/// id per Node (see Node::set_allocator). Allocator 0 is the built-in
+/// calloc / free allocator, it is the initial default allocator.
+///
+/// Allocate callbacks are passed (number of items, item size) and must
+/// return zero-initialized memory (the same semantics as calloc).
+///
+/// Registration and changes to the default allocator are thread safe.
+/// Up to 256 allocators can be registered.
+//-----------------------------------------------------------------------------
+    index_t CONDUIT_API register_allocator(void*(*allocate)(size_t, size_t),
+                                           void (*free)(void*));
+
+    /// variant that passes a user provided context pointer to the
+    /// callbacks
+    index_t CONDUIT_API register_allocator(void*(*allocate)(size_t,
+                                                            size_t,
+                                                            void*),
+                                           void (*free)(void*, void*),
+                                           void *context);
+
+    /// the allocator used by newly constructed Nodes
+    void    CONDUIT_API set_default_allocator(index_t allocator_id);
+    index_t CONDUIT_API default_allocator();
+
+    bool    CONDUIT_API is_valid_allocator(index_t allocator_id);
+    index_t CONDUIT_API number_of_allocators();
+
+    /// allocate and free using a registered allocator
+    CONDUIT_API void *allocate_memory(index_t allocator_id,
+                                      index_t nbytes);
+    void    CONDUIT_API free_memory(index_t allocator_id,
+                                    void *data_ptr);
+
+//-----------------------------------------------------------------------------
+/// Built-in bump arena allocators.
+///
+/// An arena hands out memory from large blocks by bumping a pointer.
+/// Freeing individual buffers is a no-op, all blocks are released at once
+/// with reset_arena_allocator(). After a reset, the memory of any Node
+/// that used the arena is invalid (the Nodes themselves can still be safely
+/// reset or destroyed).
+///
+/// Arenas are not thread safe, a Node tree using an arena should only be
+/// built or changed by one thread at a time.
+//-----------------------------------------------------------------------------
+    /// creates a new arena and returns its allocator id
+    index_t CONDUIT_API create_arena_allocator(index_t block_bytes = 1048576);
+
+    /// releases all blocks held by the arena with the given allocator id
+    void    CONDUIT_API reset_arena_allocator(index_t allocator_id);
+
+    /// total bytes currently reserved by the arena's blocks
+    index_t CONDUIT_API arena_allocator_bytes(index_t allocator_id);
+
+    /// releases the arena's blocks and removes the allocator, its id is no
+    /// longer valid (Nodes that used the arena can still be reset or
+    /// destroyed). The default allocator cannot be destroyed.
+    void    CONDUIT_API destroy_arena_allocator(index_t allocator_id);
+
+//-----------------------------------------------------------------------------
+/// Block allocation of Node and Schema trees.
+///
+/// Trees built from a known schema (Schema copies, Node::set_external,
+/// Node::set_data_using_schema, Node::load and Node::mmap) with at least 
+/// `num_descendants` children, grand children, etc create all of their 
+/// child Node or Schema objects in one block, instead of allocating 
+/// each one separately. The block is released when its last object is 
+/// destroyed. Setting the threshold to 0 disables block allocation.
+///
+/// The threshold may be changed while other threads build trees, a change
+/// applies to trees built after it.
+//-----------------------------------------------------------------------------
+    void    CONDUIT_API set_tree_block_threshold(index_t num_descendants);
+    index_t CONDUIT_API tree_block_threshold();
+
+//-----------------------------------------------------------------------------
+/// Memory statistics for Node data.
+///
+/// Nodes count the data buffers they allocate and memory map in process 
+/// wide counters, which are updated atomically: live and peak bytes, the
+/// number of allocations and frees, and a histogram of allocation sizes 
+/// (power of two buckets). memory_stats() reports them without walking 
+/// any trees (they are also included in conduit::about).
+///
+/// For a breakdown by subsystem, allocations can be tagged. While a 
+/// MemoryTag object is in scope, the buffers allocated by its thread are
+/// also counted under the tag's name, until they are freed.
+//-----------------------------------------------------------------------------
+    /// writes the current counters to res
+    void    CONDUIT_API memory_stats(Node &res);
+
+    /// resets the peaks to the current live bytes, and clears the 
+    /// allocation counts and the histogram
+    void    CONDUIT_API reset_memory_stats();
+
+    /// counts buffers allocated on this thread under `name` while in 
+    /// scope (tags can be nested, the innermost tag is used)
+    class CONDUIT_API MemoryTag
+    {
+    public:
+        MemoryTag(const std::string &name);
+        ~MemoryTag();
+
+    private:
+        index_t m_prev_tag_id;
+    };
+
+    /// called by Node for each data buffer it allocates, returns the id
+    /// of the tag the buffer is counted under (pass it to the free call)
+    index_t CONDUIT_API memory_stats_allocate(index_t nbytes);
+    void    CONDUIT_API memory_stats_free(index_t nbytes,
+                                          index_t tag_id);
+    /// called by Node for each memory map it opens or closes
+    void    CONDUIT_API memory_stats_map(index_t nbytes);
+    void    CONDUIT_API memory_stats_unmap(index_t nbytes);
+
+//-----------------------------------------------------------------------------
+/// Tracing.
+///
+/// A TraceSpan records the wall clock time of the scope it lives in, and
+/// optionally the number of bytes the scope processed. Spans are only
+/// recorded while tracing is enabled (it is disabled by default),
+/// otherwise a span costs a single check.
+///
+/// The major entry points of conduit, relay and blueprint (Node save,
+/// load and mmap, relay io save and load, the hdf5 reads and writes,
+/// blueprint verify and the relay mpi exchanges) are instrumented with
+/// the CONDUIT_TRACE_SCOPE and CONDUIT_TRACE_BYTES macros, which compile
+/// to nothing unless conduit is configured with ENABLE_TRACING=ON.
+///
+/// Results are provided as a Node:
+///
+///   num_dropped_events: events not recorded due to the event limit
+///   summary/<span name>/{count, total_time, min_time, max_time, bytes}
+///   events/{name_id, thread, depth, start, duration, bytes}
+///
+/// Times are in seconds, event start times are relative to the time
+/// tracing was enabled (or last reset). An event's name_id is the index of
+/// its span name in summary. The summary includes all spans, even after
+/// the event limit was reached.
+///
+/// See relay::mpi::trace_results for results aggregated across MPI ranks.
+//-----------------------------------------------------------------------------
+    void    CONDUIT_API set_trace_enabled(bool value);
+    bool    CONDUIT_API trace_enabled();
+
+    /// clears all recorded spans and restarts the trace clock
+    void    CONDUIT_API reset_trace();
+
+    /// the maximum number of events kept (default: 1048576)
+    void    CONDUIT_API set_trace_max_events(index_t max_events);
+    index_t CONDUIT_API trace_max_events();
+
+    /// writes the recorded spans to res
+    void    CONDUIT_API trace_results(Node &res);
+
+    /// combines a list of trace results (for example from several MPI
+    /// ranks) into one, entry i's events are marked with events/rank = i
+    void    CONDUIT_API merge_trace_results(const Node &traces,
+                                            Node &res);
+
+    /// writes trace results as Chrome trace event json (which can be
+    /// viewed with chrome://tracing or Perfetto), events use their rank
+    /// as the process id and their thread as the thread id
+    void        CONDUIT_API trace_to_chrome_json(const Node &trace,
+                                                 std::ostream &os);
+    std::string CONDUIT_API trace_to_chrome_json(const Node &trace);
+
+    /// records the enclosing scope while tracing is enabled
+    /// (the name must outlive the span, string literals are expected)
+    class CONDUIT_API TraceSpan
+    {
+    public:
+        TraceSpan(const char *name);
+        ~TraceSpan();
+
+        /// true if tracing was enabled when the span started
+        bool active() const
+            { return m_start >= 0.0; }
+
+        void add_bytes(index_t nbytes)
+            { m_bytes += nbytes; }
+
+    private:
+        // not copyable
+        TraceSpan(const TraceSpan &);
+        TraceSpan &operator=(const TraceSpan &);
+
+        const char *m_name;
+        // negative when the span is not recorded
+        double      m_start;
+        index_t     m_bytes;
+    };
+
 }
 //-----------------------------------------------------------------------------
 // -- end conduit::utils --
@@ -302,9 +302,8 @@ save(const Node &node,
      const std::string &protocol_,
      const Node &options)
 {
-    // we expect options to unused if all 3rd party i/o options are disabled
-    // avoid warning using CONDUIT_UNUSED macro.
-    CONDUIT_UNUSED(options);
+    CONDUIT_TRACE_SCOPE("relay::io::save");
+    CONDUIT_TRACE_BYTES(node.total_bytes_compact());
 
     std::string protocol = protocol_;
     // allow empty protocol to be used for auto detect
@@ -320,12 +319,18 @@ save(const Node &node,
        protocol == "conduit_base64_json" ||
        protocol == "yaml" )
     {
-        node.save(path,protocol);
+        // conduit_bin options (see Node::save)
+        Node bin_options;
+        if(options.has_child("conduit_bin"))
+        {
+            bin_options.set(options["conduit_bin"]);
+        }
+        node.save(path,protocol,bin_options);
     }
     else if( protocol == "hdf5")
     {
 #ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
-        // hdf5 is the only protocol that currently takes "options"
+        // hdf5 options are passed using "options/hdf5"
         Node prev_options;
         if(options.has_child("hdf5"))
         {
@@ -407,9 +412,8 @@ save_merged(const Node &node,
             const std::string &protocol_,
             const Node &options)
 {
-    // we expect options to unused if all 3rd party i/o options are disabled
-    // avoid warning using CONDUIT_UNUSED macro.
-    CONDUIT_UNUSED(options);
+    CONDUIT_TRACE_SCOPE("relay::io::save_merged");
+    CONDUIT_TRACE_BYTES(node.total_bytes_compact());
 
     std::string protocol = protocol_;
     // allow empty protocol to be used for auto detect
@@ -432,12 +436,19 @@ save_merged(const Node &node,
             n.load(path,protocol);
         }
         n.update(node);
-        n.save(path,protocol);
+
+        // conduit_bin options (see Node::save)
+        Node bin_options;
+        if(options.has_child("conduit_bin"))
+        {
+            bin_options.set(options["conduit_bin"]);
+        }
+        n.save(path,protocol,bin_options);
     }
     else if( protocol == "hdf5")
     {
 #ifdef CONDUIT_RELAY_IO_HDF5_ENABLED
-        // hdf5 is the only protocol that currently takes "options"
+        // hdf5 options are passed using "options/hdf5"
         Node prev_options;
         if(options.has_child("hdf5"))
         {
@@ -519,6 +530,8 @@ load(const std::string &path,
      const Node &options,
      Node &node)
 {
+    CONDUIT_TRACE_SCOPE("relay::io::load");
+
     node.reset();
     std::string protocol = protocol_;
     // allow empty protocol to be used for auto detect
@@ -589,6 +602,8 @@ load(const std::string &path,
         CONDUIT_ERROR("unknown conduit_relay protocol: " << protocol);
         
     }
+
+    CONDUIT_TRACE_BYTES(node.total_bytes_compact());
 }
 
 //---------------------------------------------------------------------------//
@@ -629,6 +644,8 @@ load_merged(const std::string &path,
             const std::string &protocol_,
             Node &node)
 {
+    CONDUIT_TRACE_SCOPE("relay::io::load_merged");
+
     std::string protocol = protocol_;
     // allow empty protocol to be used for auto detect
     if(protocol.empty())
@@ -691,6 +708,7 @@ load_merged(const std::string &path,
         
     }
 
+    CONDUIT_TRACE_BYTES(node.total_bytes_compact());
 }
 
 //---------------------------------------------------------------------------//
@@ -163,6 +163,7 @@ namespace io
 
 
 static std::string conduit_hdf5_list_attr_name = "__conduit_list";
+static std::string conduit_hdf5_checksum_attr_name = "__conduit_checksum";
 
     
 //-----------------------------------------------------------------------------
@@ -186,6 +187,8 @@ public:
     static std::string compression_method;
     static int         compression_level;
 
+    static std::string checksum_method;
+
 public:
     
     //------------------------------------------------------------------------
@@ -257,6 +260,21 @@ public:
                 }
             }
         }
+
+        if(opts.has_child("checksum"))
+        {
+            std::string method = opts["checksum"].as_string();
+            if(method != "none" &&
+               method != "crc32c" &&
+               method != "xxhash64")
+            {
+                CONDUIT_ERROR("Unsupported HDF5 checksum option: \""
+                              << method << "\""
+                              << " (expected \"none\", \"crc32c\", or"
+                              << " \"xxhash64\")");
+            }
+            checksum_method = method;
+        }
     }
 
     //------------------------------------------------------------------------
@@ -292,6 +310,8 @@ public:
         {
             opts["chunking/compression/level"] = compression_level;
         }
+
+        opts["checksum"] = checksum_method;
     }
 };
 
@@ -307,6 +327,8 @@ int         HDF5Options::chunk_threshold    = 2000000; // 2 mb
 std::string HDF5Options::compression_method = "gzip";
 int         HDF5Options::compression_level  = 5;
 
+std::string HDF5Options::checksum_method    = "none";
+
 
 //-----------------------------------------------------------------------------
 void
@@ -467,6 +489,11 @@ void write_conduit_hdf5_list_attribute(hid_t hdf5_group_id,
 void remove_conduit_hdf5_list_attribute(hid_t hdf5_group_id,
                                         const std::string &ref_path);
 
+//-----------------------------------------------------------------------------
+void write_conduit_hdf5_checksum_attribute(const Node &node,
+                                           const std::string &ref_path,
+                                           hid_t hdf5_dset_id);
+
 //-----------------------------------------------------------------------------
 // helpers for reading
 //-----------------------------------------------------------------------------
@@ -476,6 +503,11 @@ void read_hdf5_dataset_into_conduit_node(hid_t hdf5_dset_id,
                                          const std::string &ref_path,
                                          Node &dest);
 
+//-----------------------------------------------------------------------------
+void verify_conduit_hdf5_checksum_attribute(hid_t hdf5_dset_id,
+                                            const std::string &ref_path,
+                                            const Node &node);
+
 //-----------------------------------------------------------------------------
 void read_hdf5_group_into_conduit_node(hid_t hdf5_group_id,
                                        const std::string &ref_path,
@@ -486,6 +518,10 @@ void read_hdf5_tree_into_conduit_node(hid_t hdf5_id,
                                       const std::string &ref_path,
                                       Node &dest);
 
+//-----------------------------------------------------------------------------
+// closes the objects a failed read left open, then the file
+void close_hdf5_file_after_error(hid_t hdf5_file_id);
+
 
 
 
@@ -1519,6 +1555,10 @@ write_conduit_leaf_to_hdf5_dataset(const Node &node,
                                            << hdf5_dset_id);
 
     conduit_dtype_to_hdf5_dtype_cleanup(h5_dtype_id);
+
+    write_conduit_hdf5_checksum_attribute(node,
+                                          ref_path,
+                                          hdf5_dset_id);
 }
 
 
@@ -1869,10 +1909,198 @@ remove_conduit_hdf5_list_attribute(hid_t hdf5_group_id,
 
 
 
+//---------------------------------------------------------------------------//
+void
+write_conduit_hdf5_checksum_attribute(const Node &node,
+                                      const std::string &ref_path,
+                                      hid_t hdf5_dset_id)
+{
+    // remove the checksum of any previous write, it's stale now
+    htri_t h5_exists = H5Aexists(hdf5_dset_id,
+                                 conduit_hdf5_checksum_attr_name.c_str());
+    if(h5_exists > 0)
+    {
+        CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(
+                                  H5Adelete(hdf5_dset_id,
+                                  conduit_hdf5_checksum_attr_name.c_str()),
+                                  hdf5_dset_id,
+                                  ref_path,
+                                  "Failed to remove HDF5 Attribute "
+                                  << hdf5_dset_id
+                                  << " "
+                                  << conduit_hdf5_checksum_attr_name);
+    }
+
+    if(HDF5Options::checksum_method == "none")
+    {
+        return;
+    }
+
+    // stored as a fixed length string: "<algorithm>:<hex value>".
+    // reads convert the data to the machine's endianness, so that's 
+    // what the checksum covers
+    std::string checksum;
+    if(node.dtype().endianness_matches_machine())
+    {
+        checksum = node.checksum(HDF5Options::checksum_method);
+    }
+    else
+    {
+        Node n_native;
+        node.endian_swap_to(n_native,Endianness::machine_default());
+        checksum = n_native.checksum(HDF5Options::checksum_method);
+    }
+
+    hid_t h5_str_type_id = H5Tcopy(H5T_C_S1);
+    H5Tset_size(h5_str_type_id, checksum.size());
+
+    hid_t h5_dspace_id = H5Screate(H5S_SCALAR);
+
+    hid_t h5_attr_id  = H5Acreate(hdf5_dset_id,
+                                  conduit_hdf5_checksum_attr_name.c_str(),
+                                  h5_str_type_id,
+                                  h5_dspace_id,
+                                  H5P_DEFAULT,
+                                  H5P_DEFAULT);
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_attr_id,
+                                                    hdf5_dset_id,
+                                                    ref_path,
+                                           "Failed to create HDF5 Attribute " 
+                                           << hdf5_dset_id 
+                                           << " "
+                                           << conduit_hdf5_checksum_attr_name);
+
+    herr_t h5_status = H5Awrite(h5_attr_id,
+                                h5_str_type_id,
+                                checksum.c_str());
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                    hdf5_dset_id,
+                                                    ref_path,
+                                           "Failed to write HDF5 Attribute " 
+                                           << hdf5_dset_id 
+                                           << " "
+                                           << conduit_hdf5_checksum_attr_name);
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Sclose(h5_dspace_id),
+                                                    hdf5_dset_id,
+                                                    ref_path,
+                                           "Failed to close HDF5 Dataspace " 
+                                           << h5_dspace_id);
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Aclose(h5_attr_id),
+                                                    hdf5_dset_id,
+                                                    ref_path,
+                                           "Failed to close HDF5 Attribute " 
+                                           << h5_attr_id);
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Tclose(h5_str_type_id),
+                                                    hdf5_dset_id,
+                                                    ref_path,
+                                           "Failed to close HDF5 Datatype " 
+                                           << h5_str_type_id);
+}
+
+//---------------------------------------------------------------------------//
+void
+verify_conduit_hdf5_checksum_attribute(hid_t hdf5_dset_id,
+                                       const std::string &ref_path,
+                                       const Node &node)
+{
+    // datasets written without a checksum are not verified
+    if(H5Aexists(hdf5_dset_id,conduit_hdf5_checksum_attr_name.c_str()) <= 0)
+    {
+        return;
+    }
+
+    hid_t h5_attr_id = H5Aopen(hdf5_dset_id,
+                               conduit_hdf5_checksum_attr_name.c_str(),
+                               H5P_DEFAULT);
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_attr_id,
+                                                    hdf5_dset_id,
+                                                    ref_path,
+                                           "Failed to open HDF5 Attribute " 
+                                           << hdf5_dset_id 
+                                           << " "
+                                           << conduit_hdf5_checksum_attr_name);
+
+    hid_t h5_type_id = H5Aget_type(h5_attr_id);
+    size_t checksum_len = H5Tget_size(h5_type_id);
+
+    std::vector<char> buffer(checksum_len + 1, 0);
+    herr_t h5_status = H5Aread(h5_attr_id, h5_type_id, &buffer[0]);
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(h5_status,
+                                                    hdf5_dset_id,
+                                                    ref_path,
+                                           "Failed to read HDF5 Attribute " 
+                                           << hdf5_dset_id 
+                                           << " "
+                                           << conduit_hdf5_checksum_attr_name);
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Tclose(h5_type_id),
+                                                    hdf5_dset_id,
+                                                    ref_path,
+                                           "Failed to close HDF5 Datatype " 
+                                           << h5_type_id);
+
+    CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Aclose(h5_attr_id),
+                                                    hdf5_dset_id,
+                                                    ref_path,
+                                           "Failed to close HDF5 Attribute " 
+                                           << h5_attr_id);
+
+    std::string expected(&buffer[0]);
+    if(!node.verify_checksum(expected))
+    {
+        std::string algo = expected.substr(0,expected.find(':'));
+        CONDUIT_HDF5_ERROR(ref_path,
+                           "HDF5 Dataset checksum mismatch"
+                           << " (expected: " << expected
+                           << ", found: " << node.checksum(algo) << ")");
+    }
+}
+
 //---------------------------------------------------------------------------//
 // Read Helpers
 //---------------------------------------------------------------------------//
 
+//---------------------------------------------------------------------------//
+void
+close_hdf5_file_after_error(hid_t hdf5_file_id)
+{
+    unsigned int obj_types = H5F_OBJ_DATASET | H5F_OBJ_GROUP |
+                             H5F_OBJ_DATATYPE | H5F_OBJ_ATTR |
+                             H5F_OBJ_LOCAL;
+
+    ssize_t num_objs = H5Fget_obj_count(hdf5_file_id, obj_types);
+    if(num_objs > 0)
+    {
+        std::vector<hid_t> obj_ids((size_t)num_objs);
+        num_objs = H5Fget_obj_ids(hdf5_file_id,
+                                  obj_types,
+                                  (size_t)num_objs,
+                                  &obj_ids[0]);
+
+        for(ssize_t i = 0; i < num_objs; i++)
+        {
+            hid_t obj_id = obj_ids[(size_t)i];
+            switch(H5Iget_type(obj_id))
+            {
+                case H5I_DATASET:  H5Dclose(obj_id); break;
+                case H5I_GROUP:    H5Gclose(obj_id); break;
+                case H5I_DATATYPE: H5Tclose(obj_id); break;
+                case H5I_ATTR:     H5Aclose(obj_id); break;
+                default: break;
+            }
+        }
+    }
+
+    H5Fclose(hdf5_file_id);
+}
+
 
 //---------------------------------------------------------------------------//
 //---------------------------------------------------------------------------//
@@ -2368,6 +2596,7 @@ read_hdf5_dataset_into_conduit_node(hid_t hdf5_dset_id,
                                                         ref_path,
                                                "Error reading HDF5 Dataset: "
                                                 << hdf5_dset_id);
+
     
         CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Tclose(h5_dtype_id),
                                                         hdf5_dset_id,
@@ -2383,6 +2612,10 @@ read_hdf5_dataset_into_conduit_node(hid_t hdf5_dset_id,
                                            "Error closing HDF5 Dataspace: "
                                            << h5_dspace_id);
 
+    // verify after cleanup, a mismatch throws
+    verify_conduit_hdf5_checksum_attribute(hdf5_dset_id,
+                                           ref_path,
+                                           dest);
 }
 
 //---------------------------------------------------------------------------//
@@ -2591,6 +2824,9 @@ hdf5_write(const Node &node,
            hid_t hdf5_id,
            const std::string &hdf5_path)
 {
+    CONDUIT_TRACE_SCOPE("relay::io::hdf5_write");
+    CONDUIT_TRACE_BYTES(node.total_bytes_compact());
+
     // disable hdf5 error stack
     HDF5ErrorStackSupressor supress_hdf5_errors;
 
@@ -2677,6 +2913,9 @@ void
 hdf5_write(const Node &node,
            hid_t hdf5_id)
 {
+    CONDUIT_TRACE_SCOPE("relay::io::hdf5_write");
+    CONDUIT_TRACE_BYTES(node.total_bytes_compact());
+
     // disable hdf5 error stack
     // TODO: we may only need to use this in an outer level variant
     // of check_if_conduit_node_is_compatible_with_hdf5_tree
@@ -2878,6 +3117,8 @@ hdf5_read(hid_t hdf5_id,
           const std::string &hdf5_path,
           Node &dest)
 {
+    CONDUIT_TRACE_SCOPE("relay::io::hdf5_read");
+
     // disable hdf5 error stack
     HDF5ErrorStackSupressor supress_hdf5_errors;
     
@@ -2895,6 +3136,8 @@ hdf5_read(hid_t hdf5_id,
     read_hdf5_tree_into_conduit_node(h5_child_obj,
                                      hdf5_path,
                                      dest);
+
+    CONDUIT_TRACE_BYTES(dest.total_bytes_compact());
     
     CONDUIT_CHECK_HDF5_ERROR_WITH_FILE_AND_REF_PATH(H5Oclose(h5_child_obj),
                                                     hdf5_id,
@@ -2915,9 +3158,19 @@ hdf5_read(const std::string &file_path,
     // open the hdf5 file for reading
     hid_t h5_file_id = hdf5_open_file_for_read(file_path);
 
-    hdf5_read(h5_file_id,
-              hdf5_path,
-              node);
+    try
+    {
+        hdf5_read(h5_file_id,
+                  hdf5_path,
+                  node);
+    }
+    catch(...)
+    {
+        // a failed read (e.g. a checksum mismatch) can leave objects 
+        // open, which would keep the file open after H5Fclose
+        close_hdf5_file_after_error(h5_file_id);
+        throw;
+    }
     
     // close the hdf5 file
     CONDUIT_CHECK_HDF5_ERROR(H5Fclose(h5_file_id),
@@ -2956,12 +3209,16 @@ void
 hdf5_read(hid_t hdf5_id,
           Node &dest)
 {
+    CONDUIT_TRACE_SCOPE("relay::io::hdf5_read");
+
     // disable hdf5 error stack
     HDF5ErrorStackSupressor supress_hdf5_errors;
     
     read_hdf5_tree_into_conduit_node(hdf5_id,
                                      "",
                                      dest);
+
+    CONDUIT_TRACE_BYTES(dest.total_bytes_compact());
     
     // restore hdf5 error stack
 }
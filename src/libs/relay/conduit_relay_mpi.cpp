@@ -50,6 +50,8 @@
 
 #include "conduit_relay_mpi.hpp"
 #include <iostream>
+#include <string.h>
+#include <vector>
 
 //-----------------------------------------------------------------------------
 /// The CONDUIT_CHECK_MPI_ERROR macro is used to check return values for 
@@ -94,6 +96,67 @@ namespace relay
 namespace mpi
 {
 
+// schema encoding used by the *_using_schema methods
+static std::string g_schema_protocol = "binary";
+
+//---------------------------------------------------------------------------//
+// encodes a schema using the selected schema protocol 
+// (json text includes the null terminator)
+static void
+encode_schema(const Schema &schema,
+              std::vector<uint8> &res)
+{
+    if(g_schema_protocol == "binary")
+    {
+        schema.serialize_binary(res);
+    }
+    else
+    {
+        std::string schema_json = schema.to_json();
+        res.assign(schema_json.c_str(),
+                   schema_json.c_str() + schema_json.size() + 1);
+    }
+}
+
+//---------------------------------------------------------------------------//
+// decodes a schema created by encode_schema, with either protocol
+static void
+decode_schema(const void *data,
+              index_t num_bytes,
+              Schema &res)
+{
+    const uint8 *bytes = (const uint8*)data;
+    if(Schema::is_binary(bytes,num_bytes))
+    {
+        res.parse_binary(bytes,num_bytes);
+    }
+    else
+    {
+        Generator gen((const char*)data);
+        gen.walk(res);
+    }
+}
+
+//-----------------------------------------------------------------------------
+void
+set_schema_protocol(const std::string &protocol)
+{
+    if(protocol != "binary" && protocol != "json")
+    {
+        CONDUIT_ERROR("Unsupported schema protocol: "
+                      << "\"" << protocol << "\""
+                      << " (expected \"binary\" or \"json\")");
+    }
+    g_schema_protocol = protocol;
+}
+
+//-----------------------------------------------------------------------------
+std::string
+schema_protocol()
+{
+    return g_schema_protocol;
+}
+
 
 //-----------------------------------------------------------------------------
 int
@@ -301,6 +364,9 @@ mpi_dtype_to_conduit_dtype_id(MPI_Datatype dt)
 int 
 send_using_schema(const Node &node, int dest, int tag, MPI_Comm comm)
 {     
+    CONDUIT_TRACE_SCOPE("relay::mpi::send_using_schema");
+    CONDUIT_TRACE_BYTES(node.total_bytes_compact());
+
     Schema s_data_compact;
     
     // schema will only be valid if compact and contig
@@ -313,11 +379,12 @@ send_using_schema(const Node &node, int dest, int tag, MPI_Comm comm)
         node.schema().compact_to(s_data_compact);
     }
     
-    std::string snd_schema_json = s_data_compact.to_json();
+    std::vector<uint8> snd_schema;
+    encode_schema(s_data_compact,snd_schema);
         
     Schema s_msg;
     s_msg["schema_len"].set(DataType::int64());
-    s_msg["schema"].set(DataType::char8_str(snd_schema_json.size()+1));
+    s_msg["schema"].set(DataType::uint8((index_t)snd_schema.size()));
     s_msg["data"].set(s_data_compact);
     
     // create a compact schema to use
@@ -326,8 +393,10 @@ send_using_schema(const Node &node, int dest, int tag, MPI_Comm comm)
     
     Node n_msg(s_msg_compact);
     // these sets won't realloc since schemas are compatible
-    n_msg["schema_len"].set((int64)snd_schema_json.length());
-    n_msg["schema"].set(snd_schema_json);
+    n_msg["schema_len"].set((int64)snd_schema.size());
+    memcpy(n_msg["schema"].element_ptr(0),
+           &snd_schema[0],
+           snd_schema.size());
     n_msg["data"].update(node);
 
     
@@ -350,6 +419,8 @@ send_using_schema(const Node &node, int dest, int tag, MPI_Comm comm)
 int
 recv_using_schema(Node &node, int src, int tag, MPI_Comm comm)
 {  
+    CONDUIT_TRACE_SCOPE("relay::mpi::recv_using_schema");
+
     MPI_Status status;
     
     int mpi_error = MPI_Probe(src, tag, comm, &status);
@@ -373,24 +444,23 @@ recv_using_schema(Node &node, int src, int tag, MPI_Comm comm)
 
     Node n_msg;
     // length of the schema is sent as a 64-bit signed int
-    // NOTE: we aren't using this value  ... 
-    n_msg["schema_len"].set_external((int64*)n_buff_ptr);
+    int64 schema_len = 0;
+    memcpy(&schema_len,n_buff_ptr,sizeof(int64));
     n_buff_ptr +=8;
-    // wrap the schema string
-    n_msg["schema"].set_external_char8_str((char*)(n_buff_ptr));
     // create the schema
     Schema rcv_schema;
-    Generator gen(n_msg["schema"].as_char8_str());
-    gen.walk(rcv_schema);
+    decode_schema(n_buff_ptr,(index_t)schema_len,rcv_schema);
 
     // advance by the schema length
-    n_buff_ptr += n_msg["schema"].total_bytes_compact();
+    n_buff_ptr += schema_len;
     
     // apply the schema to the data
     n_msg["data"].set_external(rcv_schema,n_buff_ptr);
     
     // copy out to our result node
     node.update(n_msg["data"]);
+
+    CONDUIT_TRACE_BYTES(node.total_bytes_compact());
     
     return mpi_error;
 }
@@ -401,6 +471,9 @@ recv_using_schema(Node &node, int src, int tag, MPI_Comm comm)
 int 
 send(const Node &node, int dest, int tag, MPI_Comm comm)
 { 
+    CONDUIT_TRACE_SCOPE("relay::mpi::send");
+    CONDUIT_TRACE_BYTES(node.total_bytes_compact());
+
     // assumes size and type are known on the other end
     
     Node snd_compact;
@@ -431,6 +504,9 @@ send(const Node &node, int dest, int tag, MPI_Comm comm)
 int
 recv(Node &node, int src, int tag, MPI_Comm comm)
 {  
+    CONDUIT_TRACE_SCOPE("relay::mpi::recv");
+    CONDUIT_TRACE_BYTES(node.total_bytes_compact());
+
 
     MPI_Status status;
     Node rcv_compact;
@@ -478,6 +554,9 @@ reduce(const Node &snd_node,
        int root,
        MPI_Comm mpi_comm) 
 {
+    CONDUIT_TRACE_SCOPE("relay::mpi::reduce");
+    CONDUIT_TRACE_BYTES(snd_node.total_bytes_compact());
+
     MPI_Datatype mpi_dtype = conduit_dtype_to_mpi_dtype(snd_node.dtype());
     
     if(mpi_dtype == MPI_DATATYPE_NULL)
@@ -556,6 +635,9 @@ all_reduce(const Node &snd_node,
            MPI_Op mpi_op,
            MPI_Comm mpi_comm)
 {
+    CONDUIT_TRACE_SCOPE("relay::mpi::all_reduce");
+    CONDUIT_TRACE_BYTES(snd_node.total_bytes_compact());
+
     MPI_Datatype mpi_dtype = conduit_dtype_to_mpi_dtype(snd_node.dtype());
     
     if(mpi_dtype == MPI_DATATYPE_NULL)
@@ -754,6 +836,9 @@ isend(const Node &node,
       MPI_Comm mpi_comm,
       Request *request) 
 {
+    CONDUIT_TRACE_SCOPE("relay::mpi::isend");
+    CONDUIT_TRACE_BYTES(node.total_bytes_compact());
+
     
     const void *data_ptr  = node.contiguous_data_ptr();
     index_t     data_size = node.total_bytes_compact();
@@ -787,6 +872,9 @@ irecv(Node &node,
       MPI_Comm mpi_comm,
       Request *request) 
 {
+    CONDUIT_TRACE_SCOPE("relay::mpi::irecv");
+    CONDUIT_TRACE_BYTES(node.total_bytes_compact());
+
     
     // if rcv is compact, we can write directly into recv
     // if its not compact, we need a recv_buffer
@@ -823,6 +911,8 @@ int
 wait_send(Request *request,
           MPI_Status *status) 
 {
+    CONDUIT_TRACE_SCOPE("relay::mpi::wait_send");
+
     int mpi_error = MPI_Wait(&(request->m_request), status);
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
     
@@ -836,6 +926,8 @@ int
 wait_recv(Request *request,
           MPI_Status *status) 
 {
+    CONDUIT_TRACE_SCOPE("relay::mpi::wait_recv");
+
     int mpi_error = MPI_Wait(&(request->m_request), status);
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
     
@@ -857,6 +949,8 @@ wait_all_send(int count,
               Request requests[],
               MPI_Status statuses[]) 
 {
+    CONDUIT_TRACE_SCOPE("relay::mpi::wait_all_send");
+
      MPI_Request *justrequests = new MPI_Request[count];
      
      for (int i = 0; i < count; ++i) 
@@ -887,6 +981,8 @@ wait_all_recv(int count,
               Request requests[],
               MPI_Status statuses[])
 {
+    CONDUIT_TRACE_SCOPE("relay::mpi::wait_all_recv");
+
      MPI_Request *justrequests = new MPI_Request[count];
      
      for (int i = 0; i < count; ++i)
@@ -923,6 +1019,9 @@ gather(Node &send_node,
        int root,
        MPI_Comm mpi_comm)
 {
+    CONDUIT_TRACE_SCOPE("relay::mpi::gather");
+    CONDUIT_TRACE_BYTES(send_node.total_bytes_compact());
+
     Node   n_snd_compact;
     Schema s_snd_compact;
     
@@ -975,6 +1074,9 @@ all_gather(Node &send_node,
            Node &recv_node,
            MPI_Comm mpi_comm)
 {
+    CONDUIT_TRACE_SCOPE("relay::mpi::all_gather");
+    CONDUIT_TRACE_BYTES(send_node.total_bytes_compact());
+
     Node   n_snd_compact;
     Schema s_snd_compact;
     
@@ -1023,15 +1125,19 @@ gather_using_schema(Node &send_node,
                     int root, 
                     MPI_Comm mpi_comm)
 {
+    CONDUIT_TRACE_SCOPE("relay::mpi::gather_using_schema");
+    CONDUIT_TRACE_BYTES(send_node.total_bytes_compact());
+
     Node n_snd_compact;
     send_node.compact_to(n_snd_compact);
 
     int m_size = mpi::size(mpi_comm);
     int m_rank = mpi::rank(mpi_comm);
 
-    std::string schema_str = n_snd_compact.schema().to_json();
+    std::vector<uint8> snd_schema;
+    encode_schema(n_snd_compact.schema(),snd_schema);
 
-    int schema_len = static_cast<int>(schema_str.length() + 1);
+    int schema_len = static_cast<int>(snd_schema.size());
     int data_len   = static_cast<int>(n_snd_compact.total_bytes_compact());
     
     // to do the conduit gatherv, first need a gather to get the 
@@ -1114,7 +1220,7 @@ gather_using_schema(Node &send_node,
         schema_rcv_buff = n_rcv_tmp["schemas/data"].value();
     }
 
-    mpi_error = MPI_Gatherv( const_cast <char*>(schema_str.c_str()),
+    mpi_error = MPI_Gatherv( &snd_schema[0],
                              schema_len,
                              MPI_BYTE,
                              schema_rcv_buff,
@@ -1126,7 +1232,7 @@ gather_using_schema(Node &send_node,
 
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
 
-    // build all schemas from JSON, compact them.
+    // decode all schemas, compact them.
     Schema rcv_schema;
     if( m_rank == root )
     {
@@ -1137,7 +1243,9 @@ gather_using_schema(Node &send_node,
         for(int i=0;i < m_size; i++)
         {
             Schema &s = s_tmp.append();
-            s.set(&schema_rcv_buff[schema_rcv_displs[i]]);
+            decode_schema(&schema_rcv_buff[schema_rcv_displs[i]],
+                          schema_rcv_counts[i],
+                          s);
         }
         
         s_tmp.compact_to(rcv_schema);
@@ -1173,14 +1281,18 @@ all_gather_using_schema(Node &send_node,
                         Node &recv_node,
                         MPI_Comm mpi_comm)
 {
+    CONDUIT_TRACE_SCOPE("relay::mpi::all_gather_using_schema");
+    CONDUIT_TRACE_BYTES(send_node.total_bytes_compact());
+
     Node n_snd_compact;
     send_node.compact_to(n_snd_compact);
 
     int m_size = mpi::size(mpi_comm);
 
-    std::string schema_str = n_snd_compact.schema().to_json();
+    std::vector<uint8> snd_schema;
+    encode_schema(n_snd_compact.schema(),snd_schema);
 
-    int schema_len = static_cast<int>(schema_str.length() + 1);
+    int schema_len = static_cast<int>(snd_schema.size());
     int data_len   = static_cast<int>(n_snd_compact.total_bytes_compact());
     
     // to do the conduit gatherv, first need a gather to get the 
@@ -1258,7 +1370,7 @@ all_gather_using_schema(Node &send_node,
     n_rcv_tmp["schemas/data"].set(DataType::c_char(schema_curr_displ));
     schema_rcv_buff = n_rcv_tmp["schemas/data"].value();
 
-    mpi_error = MPI_Allgatherv( const_cast <char*>(schema_str.c_str()),
+    mpi_error = MPI_Allgatherv( &snd_schema[0],
                                 schema_len,
                                 MPI_BYTE,
                                 schema_rcv_buff,
@@ -1269,7 +1381,7 @@ all_gather_using_schema(Node &send_node,
 
     CONDUIT_CHECK_MPI_ERROR(mpi_error);
 
-    // build all schemas from JSON, compact them.
+    // decode all schemas, compact them.
     Schema rcv_schema;
     //TODO: should we make it easer to create a compact schema?
     // TODO: Revisit, I think we can do this better
@@ -1277,7 +1389,9 @@ all_gather_using_schema(Node &send_node,
     for(int s_idx=0; s_idx < m_size; s_idx++)
     {
         Schema &s_new = s_tmp.append();
-        s_new.set(&schema_rcv_buff[schema_rcv_displs[s_idx]]);
+        decode_schema(&schema_rcv_buff[schema_rcv_displs[s_idx]],
+                      schema_rcv_counts[s_idx],
+                      s_new);
     }
     
     // TODO can we support copy out w/out realloc
@@ -1308,6 +1422,9 @@ broadcast(Node &node,
           int root,
           MPI_Comm comm)
 {
+    CONDUIT_TRACE_SCOPE("relay::mpi::broadcast");
+    CONDUIT_TRACE_BYTES(node.total_bytes_compact());
+
     int rank = mpi::rank(comm);
 
     Node bcast_buffer;
@@ -1366,6 +1483,8 @@ broadcast_using_schema(Node &node,
                        int root,
                        MPI_Comm comm)
 {
+    CONDUIT_TRACE_SCOPE("relay::mpi::broadcast_using_schema");
+
     int rank = mpi::rank(comm);
 
     Node bcast_buffers;
@@ -1376,6 +1495,9 @@ broadcast_using_schema(Node &node,
     int bcast_schema_size = 0;
     int rcv_bcast_schema_size = 0;
 
+    // encoded schema
+    std::vector<uint8> bcast_schema_buffer;
+
     // setup buffers for send
     if(rank == root)
     {
@@ -1387,7 +1509,7 @@ broadcast_using_schema(Node &node,
            node.is_compact() && 
            node.is_contiguous())
         {
-            bcast_buffers["schema"] = node.schema().to_json();
+            encode_schema(node.schema(),bcast_schema_buffer);
         }
         else
         {
@@ -1395,12 +1517,12 @@ broadcast_using_schema(Node &node,
             node.compact_to(bcast_data_compact);
             
             bcast_data_ptr  = bcast_data_compact.data_ptr();
-            bcast_buffers["schema"] =  bcast_data_compact.schema().to_json();
+            encode_schema(bcast_data_compact.schema(),bcast_schema_buffer);
         }
      
 
         
-        bcast_schema_size = static_cast<int>(bcast_buffers["schema"].dtype().number_of_elements());
+        bcast_schema_size = static_cast<int>(bcast_schema_buffer.size());
     }
 
     int mpi_error = MPI_Allreduce(&bcast_schema_size,
@@ -1417,13 +1539,13 @@ broadcast_using_schema(Node &node,
     // alloc for rcv for schema
     if(rank != root)
     {
-        bcast_buffers["schema"].set(DataType::char8_str(bcast_schema_size));
+        bcast_schema_buffer.resize((size_t)bcast_schema_size);
     }
 
     // broadcast the schema 
-    mpi_error = MPI_Bcast(bcast_buffers["schema"].data_ptr(),
+    mpi_error = MPI_Bcast(&bcast_schema_buffer[0],
                           bcast_schema_size,
-                          MPI_CHAR,
+                          MPI_BYTE,
                           root,
                           comm);
 
@@ -1435,8 +1557,9 @@ broadcast_using_schema(Node &node,
     if(rank != root)
     {
         Schema bcast_schema;
-        Generator gen(bcast_buffers["schema"].as_char8_str());
-        gen.walk(bcast_schema);
+        decode_schema(&bcast_schema_buffer[0],
+                      (index_t)bcast_schema_size,
+                      bcast_schema);
         
         // only check compat for leaves
         // there are more zero copy cases possible here, but
@@ -1488,10 +1611,32 @@ broadcast_using_schema(Node &node,
         node.update(bcast_buffers["data"]);
     }
 
+    CONDUIT_TRACE_BYTES(node.total_bytes_compact());
+
     return mpi_error;
 }
 
 
+//---------------------------------------------------------------------------//
+void
+trace_results(Node &res,
+              int root,
+              MPI_Comm mpi_comm)
+{
+    // gather before building res, so the gather's spans are not included
+    Node n_local;
+    conduit::utils::trace_results(n_local);
+
+    Node n_traces;
+    gather_using_schema(n_local,n_traces,root,mpi_comm);
+
+    res.reset();
+    if(mpi::rank(mpi_comm) == root)
+    {
+        conduit::utils::merge_trace_results(n_traces,res);
+    }
+}
+
 //---------------------------------------------------------------------------//
 std::string
 about()
@@ -96,6 +96,18 @@ namespace mpi
     
     int CONDUIT_RELAY_API rank(MPI_Comm mpi_comm);
 
+//-----------------------------------------------------------------------------
+/// Selects how the *_using_schema methods encode schemas:
+///   "binary" (default): Schema::serialize_binary
+///   "json": json text
+///
+/// Receivers detect the encoding, so this only changes what is sent.
+//-----------------------------------------------------------------------------
+    void        CONDUIT_RELAY_API set_schema_protocol(
+                                            const std::string &protocol);
+
+    std::string CONDUIT_RELAY_API schema_protocol();
+
 //-----------------------------------------------------------------------------
 /// Helpers for converting between MPI data types  and conduit data types
 //-----------------------------------------------------------------------------
@@ -285,6 +297,19 @@ namespace mpi
                                                  int root,
                                                  MPI_Comm comm );
 
+//-----------------------------------------------------------------------------
+/// Tracing (see conduit::utils::set_trace_enabled)
+///
+/// Gathers the trace results of all ranks to root, and merges them with
+/// conduit::utils::merge_trace_results. Each rank's events are marked with
+/// its rank in events/rank, and the summary combines the spans of all
+/// ranks. Event start times are relative to each rank's trace start.
+/// res is empty on the other ranks.
+//-----------------------------------------------------------------------------
+    void CONDUIT_RELAY_API trace_results(Node &res,
+                                         int root,
+                                         MPI_Comm mpi_comm);
+
 //-----------------------------------------------------------------------------
 /// The about methods construct human readable info about how conduit_mpi was
 /// configured.
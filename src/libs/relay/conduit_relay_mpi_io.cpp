@@ -259,7 +259,13 @@ save(const Node &node,
        protocol == "conduit_base64_json" ||
        protocol == "yaml" )
     {
-        node.save(path,protocol);
+        // conduit_bin options (see Node::save)
+        Node bin_options;
+        if(options.has_child("conduit_bin"))
+        {
+            bin_options.set(options["conduit_bin"]);
+        }
+        node.save(path,protocol,bin_options);
     }
     else if( protocol == "hdf5")
     {
@@ -364,7 +370,14 @@ save_merged(const Node &node,
         Node n;
         n.load(path,protocol);
         n.update(node);
-        n.save(path,protocol);
+
+        // conduit_bin options (see Node::save)
+        Node bin_options;
+        if(options.has_child("conduit_bin"))
+        {
+            bin_options.set(options["conduit_bin"]);
+        }
+        n.save(path,protocol,bin_options);
     }
     else if( protocol == "hdf5")
     {
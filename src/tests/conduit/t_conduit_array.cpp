@@ -51,8 +51,17 @@
 #include "conduit.hpp"
 
 #include <iostream>
+#include <algorithm>
+#include <numeric>
+#include <ctime>
+#include <limits>
+#include <cmath>
 #include "gtest/gtest.h"
 
+#ifdef CONDUIT_HAS_MOVE_SEMANTICS
+#include <type_traits>
+#endif
+
 using namespace conduit;
 
 //-----------------------------------------------------------------------------
@@ -645,3 +654,513 @@ TEST(conduit_array, print_bells_and_whistles)
 }
 
 
+
+//-----------------------------------------------------------------------------
+TEST(conduit_array, contiguous_data_ptr)
+{
+    float64 vals[8] = {0, 1, 2, 3, 4, 5, 6, 7};
+
+    float64_array va(vals, DataType::float64(8));
+    EXPECT_TRUE(va.is_contiguous());
+    EXPECT_EQ(va.contiguous_data_ptr(), &vals[0]);
+
+    // offset, but still contiguous
+    float64_array va_off(vals, DataType::float64(4, 2 * sizeof(float64)));
+    EXPECT_TRUE(va_off.is_contiguous());
+    EXPECT_EQ(va_off.contiguous_data_ptr(), &vals[2]);
+    EXPECT_EQ(va_off.contiguous_data_ptr()[0], 2.0);
+
+    // strided
+    float64_array va_str(vals, DataType::float64(4, 0, 2 * sizeof(float64)));
+    EXPECT_FALSE(va_str.is_contiguous());
+    EXPECT_TRUE(va_str.contiguous_data_ptr() == NULL);
+
+    // a single strided value is contiguous
+    float64_array va_one(vals, DataType::float64(1, 0, 2 * sizeof(float64)));
+    EXPECT_TRUE(va_one.is_contiguous());
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_array, iterators)
+{
+    int32 vals[10] = {9, 1, 8, 2, 7, 3, 6, 4, 5, 0};
+
+    // every other value: 9, 8, 7, 6, 5
+    int32_array va(vals, DataType::int32(5, 0, 2 * sizeof(int32)));
+
+    EXPECT_EQ(va.end() - va.begin(), 5);
+    EXPECT_EQ(std::accumulate(va.begin(), va.end(), 0), 35);
+    EXPECT_EQ(*std::max_element(va.begin(), va.end()), 9);
+
+    int32_array::iterator itr = std::find(va.begin(), va.end(), 7);
+    EXPECT_EQ(itr - va.begin(), 2);
+    EXPECT_EQ(itr[1], 6);
+    EXPECT_EQ(*(itr - 2), 9);
+
+    // sorting only touches the strided values
+    std::sort(va.begin(), va.end());
+    EXPECT_EQ(vals[0], 5);
+    EXPECT_EQ(vals[1], 1);
+    EXPECT_EQ(vals[8], 9);
+    EXPECT_EQ(vals[9], 0);
+
+    // const iteration
+    const int32_array &va_const = va;
+    int32 prev = -1;
+    index_t count = 0;
+    for(int32_array::const_iterator citr = va_const.begin();
+        citr != va_const.end();
+        ++citr)
+    {
+        EXPECT_GT(*citr, prev);
+        prev = *citr;
+        count++;
+    }
+    EXPECT_EQ(count, 5);
+
+    int32_array::const_iterator citr = va.begin();
+    EXPECT_TRUE(citr < va_const.end());
+
+#ifdef CONDUIT_HAS_MOVE_SEMANTICS
+    // only iterator to const_iterator conversions are allowed
+    EXPECT_TRUE((std::is_convertible<int32_array::iterator,
+                                     int32_array::const_iterator>::value));
+    EXPECT_FALSE((std::is_convertible<int32_array::const_iterator,
+                                      int32_array::iterator>::value));
+#endif
+
+    std::fill(va.begin(), va.end(), 42);
+    EXPECT_EQ(vals[2], 42);
+    EXPECT_EQ(vals[3], 2);
+
+    // empty arrays
+    int32_array va_empty;
+    EXPECT_TRUE(va_empty.begin() == va_empty.end());
+
+#ifdef CONDUIT_HAS_MOVE_SEMANTICS
+    int32 sum = 0;
+    for(int32 v : va)
+    {
+        sum += v;
+    }
+    EXPECT_EQ(sum, 5 * 42);
+#endif
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_array, benchmark_element_access)
+{
+    index_t num_ele = 1 << 22;
+    int num_reps = 10;
+
+    Node n;
+    n.set(DataType::float64(num_ele));
+    float64_array va = n.value();
+    for(index_t i = 0; i < num_ele; i++)
+    {
+        va[i] = 1.0;
+    }
+
+    float64 sum_idx = 0.0;
+    std::clock_t start = std::clock();
+    for(int r = 0; r < num_reps; r++)
+    {
+        for(index_t i = 0; i < num_ele; i++)
+        {
+            sum_idx += va[i];
+        }
+    }
+    double t_idx = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    float64 sum_itr = 0.0;
+    start = std::clock();
+    for(int r = 0; r < num_reps; r++)
+    {
+        sum_itr += std::accumulate(va.begin(), va.end(), 0.0);
+    }
+    double t_itr = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    float64 sum_ptr = 0.0;
+    start = std::clock();
+    for(int r = 0; r < num_reps; r++)
+    {
+        const float64 *ptr = va.contiguous_data_ptr();
+        for(index_t i = 0; i < num_ele; i++)
+        {
+            sum_ptr += ptr[i];
+        }
+    }
+    double t_ptr = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    float64 sum_raw = 0.0;
+    start = std::clock();
+    for(int r = 0; r < num_reps; r++)
+    {
+        const float64 *ptr = n.as_float64_ptr();
+        for(index_t i = 0; i < num_ele; i++)
+        {
+            sum_raw += ptr[i];
+        }
+    }
+    double t_raw = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    EXPECT_EQ(sum_idx, sum_raw);
+    EXPECT_EQ(sum_itr, sum_raw);
+    EXPECT_EQ(sum_ptr, sum_raw);
+
+    std::cout << "[benchmark] sum " << num_ele << " float64 x " << num_reps
+              << ": operator[] " << t_idx << "s, "
+              << "iterators " << t_itr << "s, "
+              << "contiguous_data_ptr " << t_ptr << "s, "
+              << "raw pointer " << t_raw << "s"
+              << std::endl;
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_array, reductions)
+{
+    // odd count to cover the vectorized paths and their remainders
+    int32 vals[19];
+    for(int i = 0; i < 19; i++)
+    {
+        vals[i] = (i * 7) % 19 - 9;
+    }
+    // min is -9 (at i = 0), max is 9 (at i = 8)
+
+    int32_array va(vals, DataType::int32(19));
+    EXPECT_EQ(va.min(), -9);
+    EXPECT_EQ(va.max(), 9);
+    EXPECT_EQ(va.sum(), 0);
+    EXPECT_EQ(va.mean(), 0.0);
+    EXPECT_EQ(va.argmin(), 0);
+    EXPECT_EQ(va.argmax(), 8);
+    EXPECT_EQ(va.count_nonfinite(), 0);
+
+    // strided: every other value
+    int32_array va_str(vals, DataType::int32(10, 0, 2 * sizeof(int32)));
+    int32 exp_min = vals[0];
+    int32 exp_max = vals[0];
+    int32 exp_sum = 0;
+    for(int i = 0; i < 10; i++)
+    {
+        exp_min = std::min(exp_min, vals[2*i]);
+        exp_max = std::max(exp_max, vals[2*i]);
+        exp_sum += vals[2*i];
+    }
+    EXPECT_EQ(va_str.min(), exp_min);
+    EXPECT_EQ(va_str.max(), exp_max);
+    EXPECT_EQ(va_str.sum(), exp_sum);
+    EXPECT_EQ(va_str.mean(), exp_sum / 10.0);
+    EXPECT_EQ(va_str[va_str.argmax()], exp_max);
+
+    // repeated extremes give the first index
+    uint8 u8_vals[5] = {3, 1, 5, 1, 5};
+    uint8_array va_u8(u8_vals, DataType::uint8(5));
+    EXPECT_EQ(va_u8.argmin(), 1);
+    EXPECT_EQ(va_u8.argmax(), 2);
+    // mean doesn't overflow small types
+    uint8 u8_big[4] = {255, 255, 255, 255};
+    EXPECT_EQ(uint8_array(u8_big, DataType::uint8(4)).mean(), 255.0);
+
+    // empty
+    float64_array va_empty;
+    EXPECT_EQ(va_empty.argmin(), -1);
+    EXPECT_EQ(va_empty.argmax(), -1);
+    EXPECT_EQ(va_empty.sum(), 0.0);
+    EXPECT_EQ(va_empty.min(), std::numeric_limits<float64>::infinity());
+    EXPECT_EQ(va_empty.max(), -std::numeric_limits<float64>::infinity());
+    int32_array va_i32_empty;
+    EXPECT_EQ(va_i32_empty.min(), std::numeric_limits<int32>::max());
+    EXPECT_EQ(va_i32_empty.max(), std::numeric_limits<int32>::min());
+
+    // integer extremes
+    int64 i64_vals[3] = {std::numeric_limits<int64>::max(),
+                         std::numeric_limits<int64>::max(),
+                         std::numeric_limits<int64>::max()};
+    int64_array va_i64(i64_vals, DataType::int64(3));
+    EXPECT_EQ(va_i64.min(), std::numeric_limits<int64>::max());
+    EXPECT_EQ(va_i64.argmin(), 0);
+    EXPECT_EQ(va_i64.argmax(), 0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_array, reductions_sum_type)
+{
+    // sums are accumulated in a wide type, 100 x 100 doesn't fit in int8
+    int8 i8_vals[100];
+    uint8 u8_vals[100];
+    float32 f32_vals[100];
+    for(int i = 0; i < 100; i++)
+    {
+        i8_vals[i]  = 100;
+        u8_vals[i]  = 200;
+        f32_vals[i] = 16777216.0f;
+    }
+
+    int8_array va_i8(i8_vals, DataType::int8(100));
+    int8_array va_i8_str(i8_vals, DataType::int8(50, 0, 2));
+    uint8_array va_u8(u8_vals, DataType::uint8(100));
+    float32_array va_f32(f32_vals, DataType::float32(100));
+
+    int64   i8_sum  = va_i8.sum();
+    uint64  u8_sum  = va_u8.sum();
+    float64 f32_sum = va_f32.sum();
+    EXPECT_EQ(i8_sum, 10000);
+    EXPECT_EQ(va_i8_str.sum(), 5000);
+    EXPECT_EQ(u8_sum, 20000u);
+    // 2^24 + 1.0f is not representable in float32
+    f32_vals[0] = 1.0f;
+    f32_sum = va_f32.sum();
+    EXPECT_EQ(f32_sum, 99.0 * 16777216.0 + 1.0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_array, reductions_parallel)
+{
+    index_t num_ele = 100003;
+    Node n;
+    n.set(DataType::float64(num_ele));
+    float64_array va = n.value();
+    for(index_t i = 0; i < num_ele; i++)
+    {
+        va[i] = (float64)((i * 37) % 1001) - 500.0;
+    }
+    va[77777] = -1000.0;
+    // repeated extremes in a later chunk
+    va[88888] = -1000.0;
+
+    Node n_i32;
+    n.to_int32_array(n_i32);
+    int32_array va_i32 = n_i32.value();
+
+    float64 exp_sum  = va.sum();
+    float64 exp_mean = va.mean();
+    int64 exp_i32_sum = va_i32.sum();
+
+    va[1234]  = std::numeric_limits<float64>::quiet_NaN();
+    va[99998] = std::numeric_limits<float64>::infinity();
+
+    float64 exp_min = va.min();
+    float64 exp_max = va.max();
+    index_t exp_argmin = va.argmin();
+    index_t exp_argmax = va.argmax();
+    index_t exp_nonfinite = va.count_nonfinite();
+    Node exp_hist;
+    va.histogram(-500.0, 500.0, 10, exp_hist);
+    EXPECT_EQ(exp_argmin, 77777);
+    EXPECT_EQ(exp_argmax, 99998);
+    EXPECT_EQ(exp_nonfinite, 2);
+
+    index_t min_bytes = parallel_min_bytes();
+    set_num_threads(4);
+    set_parallel_min_bytes(1024);
+
+    EXPECT_EQ(va.min(), exp_min);
+    EXPECT_EQ(va.max(), exp_max);
+    EXPECT_EQ(va.argmin(), exp_argmin);
+    EXPECT_EQ(va.argmax(), exp_argmax);
+    EXPECT_EQ(va.count_nonfinite(), exp_nonfinite);
+    EXPECT_EQ(va_i32.sum(), exp_i32_sum);
+    EXPECT_EQ(va_i32.min(), -1000);
+    EXPECT_EQ(va_i32.argmin(), 77777);
+    Node hist, info;
+    va.histogram(-500.0, 500.0, 10, hist);
+    EXPECT_FALSE(hist.diff(exp_hist, info));
+
+    // floating point sums only differ by rounding
+    va[1234]  = (float64)((1234 * 37) % 1001) - 500.0;
+    va[99998] = (float64)((99998 * 37) % 1001) - 500.0;
+    EXPECT_NEAR(va.sum(), exp_sum, 1e-6);
+    EXPECT_NEAR(va.mean(), exp_mean, 1e-9);
+
+    set_num_threads(1);
+    set_parallel_min_bytes(min_bytes);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_array, reductions_nonfinite)
+{
+    float64 nan = std::numeric_limits<float64>::quiet_NaN();
+    float64 inf = std::numeric_limits<float64>::infinity();
+
+    float64 vals[11] = {1.0, nan, -2.0, 4.0, inf, 0.5,
+                        nan, 3.0, -inf, 2.0, 1.0};
+    float64_array va(vals, DataType::float64(11));
+
+    EXPECT_EQ(va.count_nonfinite(), 4);
+    EXPECT_EQ(va.min(), -inf);
+    EXPECT_EQ(va.max(), inf);
+    EXPECT_EQ(va.argmin(), 8);
+    EXPECT_EQ(va.argmax(), 4);
+
+    // nans are ignored by min and max
+    float32 f32_vals[3] = {(float32)nan, 2.0f, 1.0f};
+    float32_array va_f32(f32_vals, DataType::float32(3));
+    EXPECT_EQ(va_f32.min(), 1.0f);
+    EXPECT_EQ(va_f32.max(), 2.0f);
+    EXPECT_EQ(va_f32.argmin(), 2);
+    EXPECT_EQ(va_f32.count_nonfinite(), 1);
+
+    // all +inf / all -inf, contiguous (vectorized) and strided
+    float64 pinf_vals[10];
+    float64 ninf_vals[10];
+    float64 nan_vals[10];
+    float32 f32_inf_vals[10];
+    for(int i = 0; i < 10; i++)
+    {
+        pinf_vals[i] = inf;
+        ninf_vals[i] = -inf;
+        nan_vals[i]  = nan;
+        f32_inf_vals[i] = (float32)inf;
+    }
+
+    float64_array va_pinf(pinf_vals, DataType::float64(10));
+    float64_array va_pinf_str(pinf_vals,
+                              DataType::float64(5, 0, 2 * sizeof(float64)));
+    float64_array va_ninf(ninf_vals, DataType::float64(10));
+    float32_array va_f32_inf(f32_inf_vals, DataType::float32(10));
+    EXPECT_EQ(va_pinf.min(), inf);
+    EXPECT_EQ(va_pinf.max(), inf);
+    EXPECT_EQ(va_pinf.argmin(), 0);
+    EXPECT_EQ(va_pinf.argmax(), 0);
+    EXPECT_EQ(va_pinf_str.min(), inf);
+    EXPECT_EQ(va_pinf_str.argmin(), 0);
+    EXPECT_EQ(va_ninf.min(), -inf);
+    EXPECT_EQ(va_ninf.max(), -inf);
+    EXPECT_EQ(va_ninf.argmin(), 0);
+    EXPECT_EQ(va_ninf.argmax(), 0);
+    EXPECT_EQ(va_f32_inf.min(), (float32)inf);
+    EXPECT_EQ(va_f32_inf.argmin(), 0);
+
+    // all nan
+    float64_array va_nan(nan_vals, DataType::float64(10));
+    float64_array va_nan_str(nan_vals,
+                             DataType::float64(5, 0, 2 * sizeof(float64)));
+    EXPECT_TRUE(std::isnan(va_nan.min()));
+    EXPECT_TRUE(std::isnan(va_nan.max()));
+    EXPECT_TRUE(std::isnan(va_nan_str.min()));
+    EXPECT_EQ(va_nan.argmin(), 0);
+    EXPECT_EQ(va_nan.argmax(), 0);
+    EXPECT_EQ(va_nan.count_nonfinite(), 10);
+
+    // a leading nan is skipped
+    nan_vals[5] = 3.0;
+    EXPECT_EQ(va_nan.min(), 3.0);
+    EXPECT_EQ(va_nan.max(), 3.0);
+    EXPECT_EQ(va_nan.argmin(), 5);
+    EXPECT_EQ(va_nan.argmax(), 5);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_array, histogram)
+{
+    float64 vals[10] = {0.0, 0.1, 0.25, 0.5, 0.75, 0.9, 1.0, -1.0, 2.0, 0.5};
+    float64_array va(vals, DataType::float64(10));
+
+    Node res;
+    va.histogram(0.0, 1.0, 4, res);
+    EXPECT_EQ(res.dtype().number_of_elements(), 4);
+    int64_array counts = res.value();
+    // [0,.25) [.25,.5) [.5,.75) [.75,1]
+    EXPECT_EQ(counts[0], 2);
+    EXPECT_EQ(counts[1], 1);
+    EXPECT_EQ(counts[2], 2);
+    EXPECT_EQ(counts[3], 3);
+
+    int16 i16_vals[6] = {0, 1, 2, 3, 4, 5};
+    int16_array va_i16(i16_vals, DataType::int16(6));
+    va_i16.histogram(0, 6, 3, res);
+    counts = res.value();
+    EXPECT_EQ(counts[0], 2);
+    EXPECT_EQ(counts[1], 2);
+    EXPECT_EQ(counts[2], 2);
+
+    EXPECT_THROW(va.histogram(0.0, 1.0, 0, res), conduit::Error);
+    EXPECT_THROW(va.histogram(1.0, 1.0, 4, res), conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_array, benchmark_reductions)
+{
+    // cache resident, many repetitions
+    index_t num_ele = 1 << 15;
+    int num_reps = 2000;
+
+    Node n;
+    n.set(DataType::float64(num_ele));
+    float64_array va = n.value();
+    for(index_t i = 0; i < num_ele; i++)
+    {
+        va[i] = (float64)((i * 37) % 1000);
+    }
+
+    // previous approach: scalar loops over operator[]
+    float64 v_min = 0, v_max = 0, v_sum = 0;
+    std::clock_t start = std::clock();
+    for(int r = 0; r < num_reps; r++)
+    {
+        v_min = va[0];
+        for(index_t i = 0; i < num_ele; i++)
+        {
+            if(va[i] < v_min)
+                v_min = va[i];
+        }
+    }
+    double t_loop_min = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    start = std::clock();
+    for(int r = 0; r < num_reps; r++)
+    {
+        v_max = va[0];
+        for(index_t i = 0; i < num_ele; i++)
+        {
+            if(va[i] > v_max)
+                v_max = va[i];
+        }
+    }
+    double t_loop_max = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    start = std::clock();
+    for(int r = 0; r < num_reps; r++)
+    {
+        v_sum = 0;
+        for(index_t i = 0; i < num_ele; i++)
+        {
+            v_sum += va[i];
+        }
+    }
+    double t_loop_sum = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    float64 r_min = 0, r_max = 0, r_sum = 0;
+    start = std::clock();
+    for(int r = 0; r < num_reps; r++)
+    {
+        r_min = va.min();
+    }
+    double t_min = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    start = std::clock();
+    for(int r = 0; r < num_reps; r++)
+    {
+        r_max = va.max();
+    }
+    double t_max = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    start = std::clock();
+    for(int r = 0; r < num_reps; r++)
+    {
+        r_sum = va.sum();
+    }
+    double t_sum = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    EXPECT_EQ(r_min, v_min);
+    EXPECT_EQ(r_max, v_max);
+    EXPECT_EQ(r_sum, v_sum);
+
+    std::cout << "[benchmark] " << num_ele << " float64 x " << num_reps
+              << " (scalar loop vs reduction): "
+              << "min " << t_loop_min << "s vs " << t_min << "s, "
+              << "max " << t_loop_max << "s vs " << t_max << "s, "
+              << "sum " << t_loop_sum << "s vs " << t_sum << "s"
+              << std::endl;
+}
@@ -502,3 +502,85 @@ TEST(conduit_endianness, node_swap_using_explicit_funcs)
 }
 
 
+
+//-----------------------------------------------------------------------------
+TEST(conduit_endianness, node_swap_strided_arrays)
+{
+    // interleaved uint32 and uint64 values, swap only the uint32s
+    struct rec { uint32 a; uint32 pad; uint64 b; };
+    rec recs[33];
+    for(uint32 i=0; i < 33; i++)
+    {
+        recs[i].a   = 0x01020304 + i;
+        recs[i].pad = 0;
+        recs[i].b   = 0x0102030405060708 + i;
+    }
+
+    Node n;
+    n["a"].set_external(DataType::uint32(33, 0, sizeof(rec)), recs);
+    n["b"].set_external(DataType::uint64(33, 8, sizeof(rec)), recs);
+
+    n["a"].endian_swap(Endianness::machine_is_little_endian() ?
+                       Endianness::BIG_ID : Endianness::LITTLE_ID);
+    for(uint32 i=0; i < 33; i++)
+    {
+        uint32 v = 0x01020304 + i;
+        Endianness::swap32(&v);
+        EXPECT_EQ(recs[i].a, v);
+        EXPECT_EQ(recs[i].pad, 0u);
+        EXPECT_EQ(recs[i].b, 0x0102030405060708 + i);
+    }
+
+    n["a"].endian_swap_to_machine_default();
+    for(uint32 i=0; i < 33; i++)
+    {
+        EXPECT_EQ(recs[i].a, 0x01020304 + i);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_endianness, node_endian_swap_to)
+{
+    index_t other = Endianness::machine_is_little_endian() ?
+                    Endianness::BIG_ID : Endianness::LITTLE_ID;
+
+    uint16 vals16[4] = {0x0102, 0x0304, 0x0506, 0x0708};
+    float64 vals64[6] = {1.0, -1.0, 2.0, -2.0, 3.0, -3.0};
+
+    Node n;
+    n["a/u16"].set_external(vals16, 4);
+    // strided, every other value
+    n["a/f64"].set_external(DataType::float64(3, 0, 2 * sizeof(float64)),
+                            vals64);
+    n["s"] = "string";
+
+    Node n_swp;
+    n.endian_swap_to(n_swp, other);
+
+    // source is untouched
+    EXPECT_EQ(vals16[0], 0x0102);
+    EXPECT_EQ(n["a/u16"].dtype().endianness(),
+              (index_t)Endianness::DEFAULT_ID);
+
+    EXPECT_TRUE(n_swp.is_compact());
+    EXPECT_EQ(n_swp.total_bytes_compact(), n.total_bytes_compact());
+    EXPECT_EQ(n_swp["a/u16"].dtype().endianness(), other);
+    EXPECT_EQ(n_swp["a/f64"].dtype().endianness(), other);
+    EXPECT_EQ(n_swp["a/f64"].dtype().number_of_elements(), 3);
+    EXPECT_EQ(n_swp["s"].as_string(), "string");
+
+    uint16 *u16_ptr = n_swp["a/u16"].value();
+    EXPECT_EQ(u16_ptr[0], 0x0201);
+    EXPECT_EQ(u16_ptr[3], 0x0807);
+
+    // swapping back gives the compact original
+    Node n_back;
+    n_swp.endian_swap_to(n_back, Endianness::DEFAULT_ID);
+    Node n_compact;
+    n.compact_to(n_compact);
+
+    Node info;
+    EXPECT_FALSE(n_back.diff(n_compact, info));
+    float64_array f64_back = n_back["a/f64"].value();
+    EXPECT_EQ(f64_back[2], 3.0);
+}
@@ -51,9 +51,16 @@
 #include "conduit.hpp"
 
 #include <iostream>
+#include <sstream>
 #include <limits>
+#include <ctime>
 #include "gtest/gtest.h"
 
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
 using namespace conduit;
 
 //-----------------------------------------------------------------------------
@@ -509,6 +516,120 @@ TEST(conduit_json, to_base64_json_2)
 }
 
 
+//-----------------------------------------------------------------------------
+TEST(conduit_json, base64_json_strided)
+{
+    // interleaved values are gathered as they are encoded
+    float64 xy[2000];
+    for(int i=0; i < 2000; i++)
+    {
+        xy[i] = i * 0.5;
+    }
+
+    Node n;
+    n["x"].set_external(DataType::float64(1000,0,2*sizeof(float64)),xy);
+    n["y"].set_external(DataType::float64(1000,sizeof(float64),
+                                          2*sizeof(float64)),xy);
+    n["lst"].append() = (int8)-3;
+    n["lst"].append() = "my_string";
+    n["empty"];
+
+    std::string base64_json = n.to_json("conduit_base64_json");
+
+    Node nparse;
+    Generator g(base64_json,"conduit_base64_json");
+    g.walk(nparse);
+
+    Node info;
+    EXPECT_FALSE(n.diff(nparse,info));
+    EXPECT_TRUE(nparse.is_compact());
+    EXPECT_TRUE(nparse.is_contiguous());
+    EXPECT_EQ(nparse["lst"][1].as_string(),"my_string");
+
+    float64_array y_vals = nparse["y"].value();
+    EXPECT_EQ(y_vals[999],1999 * 0.5);
+
+    // same result when read from a stream
+    std::istringstream iss(base64_json);
+    Node nstream;
+    g.walk(iss,nstream);
+    EXPECT_FALSE(n.diff(nstream,info));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_json, base64_json_parse_variants)
+{
+    uint8 vals[6] = {251, 255, 191, 0, 1, 2};
+    // 251,255,191 encode to "+/+/"
+    std::string schema = "{\"dtype\":\"uint8\", \"number_of_elements\": 6}";
+
+    // data before the schema, escaped slashes, extra members
+    std::string txt = "{\"info\": [1, {\"a\": \"}\"}],"
+                      " \"data\": {\"other\": 1, \"base64\": \"+\\/+\\/AAEC\"},"
+                      " \"schema\": " + schema + "}";
+
+    Node n;
+    Generator g(txt,"conduit_base64_json");
+    g.walk(n);
+    ASSERT_EQ(n.dtype().number_of_elements(),6);
+    uint8_array res = n.value();
+    for(int i=0; i < 6; i++)
+    {
+        EXPECT_EQ(res[i],vals[i]);
+    }
+
+    // payload without padding
+    Node n_short;
+    g.set_schema("{\"schema\": {\"dtype\":\"uint8\", \"number_of_elements\": 4},"
+                 " \"data\": {\"base64\": \"+/+/AA\"}}");
+    g.walk(n_short);
+    uint8_array res_short = n_short.value();
+    EXPECT_EQ(res_short[2],191);
+    EXPECT_EQ(res_short[3],0);
+
+    g.set_schema("{\"schema\": " + schema + "}");
+    EXPECT_THROW(g.walk(n),conduit::Error);
+    g.set_schema("{\"data\": {\"base64\": \"AAEC\"}}");
+    EXPECT_THROW(g.walk(n),conduit::Error);
+    g.set_schema("[1, 2]");
+    EXPECT_THROW(g.walk(n),conduit::Error);
+    g.set_schema("{\"schema\": " + schema + ", \"data\": {\"base64\": \"AAEC");
+    EXPECT_THROW(g.walk(n),conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_json, benchmark_base64_json)
+{
+    index_t num_ele = 4 * 1024 * 1024;
+    Node n;
+    n["vals"].set(DataType::float64(num_ele));
+    float64_array vals = n["vals"].value();
+    for(index_t i=0; i < num_ele; i++)
+    {
+        vals[i] = 1.0 / (float64)(i+1);
+    }
+
+    std::clock_t start = std::clock();
+    std::ostringstream oss;
+    n.to_json_stream(oss,"conduit_base64_json");
+    double write_secs = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    std::istringstream iss(oss.str());
+    Generator g("","conduit_base64_json");
+    Node res;
+    start = std::clock();
+    g.walk(iss,res);
+    double read_secs = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    Node info;
+    EXPECT_FALSE(n.diff(res,info));
+
+    std::cout << "[benchmark] conduit_base64_json of " << num_ele
+              << " float64 values: write " << write_secs << " s, "
+              << "read " << read_secs << " s" << std::endl;
+}
+
+
 //-----------------------------------------------------------------------------
 TEST(conduit_json, check_empty)
 {
@@ -837,3 +958,186 @@ TEST(conduit_json, dup_object_name_error)
     
 
 }
+
+//-----------------------------------------------------------------------------
+TEST(conduit_json, json_parse_values)
+{
+    std::string pure_json = "{\"a\": [1, 2, 3],"
+                            " \"b\": [1, 2.5],"
+                            " \"c\": [1, \"two\", 3.0],"
+                            " \"d\": [],"
+                            " \"e\": {},"
+                            " \"f\": [[1, 2], [3.5], []],"
+                            " \"g\": [true, false],"
+                            " \"h\": null,"
+                            " \"i\": 18446744073709551615,"
+                            " \"j\": [1, 18446744073709551615, 0.5],"
+                            " \"k\": \"my_string\"}";
+
+    Node n;
+    n.parse(pure_json,"json");
+    CONDUIT_INFO(n.to_json());
+
+    EXPECT_TRUE(n["a"].dtype().is_int64());
+    EXPECT_EQ(n["a"].dtype().number_of_elements(),3);
+    int64_array a_vals = n["a"].value();
+    EXPECT_EQ(a_vals[2],3);
+
+    EXPECT_TRUE(n["b"].dtype().is_float64());
+    float64_array b_vals = n["b"].value();
+    EXPECT_EQ(b_vals[0],1.0);
+    EXPECT_EQ(b_vals[1],2.5);
+
+    EXPECT_TRUE(n["c"].dtype().is_list());
+    EXPECT_EQ(n["c"].number_of_children(),3);
+    EXPECT_EQ(n["c"][0].as_int64(),1);
+    EXPECT_EQ(n["c"][1].as_string(),"two");
+    EXPECT_EQ(n["c"][2].as_float64(),3.0);
+
+    EXPECT_TRUE(n["d"].dtype().is_list());
+    EXPECT_EQ(n["d"].number_of_children(),0);
+    EXPECT_TRUE(n["e"].dtype().is_object());
+    EXPECT_EQ(n["e"].number_of_children(),0);
+
+    EXPECT_TRUE(n["f"].dtype().is_list());
+    EXPECT_EQ(n["f"].number_of_children(),3);
+    EXPECT_TRUE(n["f"][0].dtype().is_int64());
+    EXPECT_TRUE(n["f"][1].dtype().is_float64());
+    EXPECT_TRUE(n["f"][2].dtype().is_list());
+
+    EXPECT_TRUE(n["g"].dtype().is_list());
+    EXPECT_EQ(n["g"][0].as_uint8(),1);
+    EXPECT_EQ(n["g"][1].as_uint8(),0);
+
+    EXPECT_TRUE(n["h"].dtype().is_empty());
+
+    EXPECT_TRUE(n["i"].dtype().is_uint64());
+    EXPECT_EQ(n["i"].as_uint64(),std::numeric_limits<uint64>::max());
+
+    EXPECT_TRUE(n["j"].dtype().is_float64());
+    float64_array j_vals = n["j"].value();
+    EXPECT_EQ(j_vals[1],18446744073709551615.0);
+
+    EXPECT_EQ(n["k"].as_string(),"my_string");
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_json, json_parse_from_stream)
+{
+    // large enough to span several reads, with comments and
+    // unquoted names that need to be sanitized
+    std::ostringstream oss;
+    oss << "{\n";
+    for(int i=0; i < 5000; i++)
+    {
+        oss << "// entry " << i << "\n"
+            << "field_" << i << ": {value: [" << i << ", " << i+1 << "],"
+            << " name: \"s_" << i << " // not a comment\", flag: true},\n";
+    }
+    oss << "last: null\n}";
+    std::string json = oss.str();
+
+    Node n_mem;
+    n_mem.parse(utils::json_sanitize(json),"json");
+
+    std::istringstream iss(json);
+    Generator g("","json");
+    Node n_stream;
+    g.walk(iss,n_stream);
+
+    Node info;
+    EXPECT_FALSE(n_mem.diff(n_stream,info));
+    EXPECT_EQ(n_stream.number_of_children(),5001);
+    EXPECT_EQ(n_stream["field_4999/name"].as_string(),
+              "s_4999 // not a comment");
+    int64_array vals = n_stream["field_4999/value"].value();
+    EXPECT_EQ(vals[1],5000);
+
+    // other protocols read the whole stream
+    std::istringstream iss_yaml("a: 10\nb: [1, 2]\n");
+    g.set_protocol("yaml");
+    g.walk(iss_yaml,n_stream);
+    EXPECT_EQ(n_stream["a"].as_int64(),10);
+
+    // errors are reported for streams
+    std::istringstream iss_bad("{\"a\": [1, 2,\n ]}");
+    g.set_protocol("json");
+    EXPECT_THROW(g.walk(iss_bad,n_stream),conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_json, json_parse_from_file)
+{
+    Node n;
+    n["a/b"] = DataType::float64(1000);
+    float64_array vals = n["a/b"].value();
+    for(index_t i=0; i < 1000; i++)
+    {
+        vals[i] = i * 0.25;
+    }
+    n["a/c"] = "my_string";
+    n["d"] = (int64)42;
+    n.save("tout_json_parse_from_file.json","json");
+
+    // protocol from the file extension
+    Node n_load;
+    n_load.load("tout_json_parse_from_file.json");
+    Node info;
+    EXPECT_FALSE(n.diff(n_load,info));
+
+#if !defined(CONDUIT_PLATFORM_WINDOWS)
+    int fd = open("tout_json_parse_from_file.json",O_RDONLY);
+    ASSERT_TRUE(fd >= 0);
+    Generator g("","json");
+    Node n_fd;
+    g.walk(fd,n_fd);
+    close(fd);
+    EXPECT_FALSE(n.diff(n_fd,info));
+#endif
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_json, benchmark_json_parse)
+{
+    index_t num_ele = 1000000;
+    Node n;
+    n["ints"].set(DataType::int64(num_ele));
+    n["floats"].set(DataType::float64(num_ele));
+    int64_array ints = n["ints"].value();
+    float64_array floats = n["floats"].value();
+    for(index_t i=0; i < num_ele; i++)
+    {
+        ints[i] = i;
+        floats[i] = 1.0 / (float64)(i+1);
+    }
+    std::string json = n.to_json();
+
+    std::istringstream iss(json);
+    Generator g("","json");
+    Node res;
+
+    utils::reset_memory_stats();
+    Node stats_before;
+    utils::memory_stats(stats_before);
+    int64 live_before = stats_before["allocated/live_bytes"].to_int64();
+
+    std::clock_t start = std::clock();
+    g.walk(iss,res);
+    double secs = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    // the stream is parsed straight into res, without a second copy
+    Node stats_after;
+    utils::memory_stats(stats_after);
+    int64 peak_bytes = stats_after["allocated/peak_bytes"].to_int64();
+    int64 data_bytes = 2 * num_ele * (int64)sizeof(float64);
+    EXPECT_GE(peak_bytes - live_before, data_bytes);
+    EXPECT_LT(peak_bytes - live_before, data_bytes + data_bytes / 2);
+    EXPECT_TRUE(res.is_compact());
+
+    Node info;
+    EXPECT_FALSE(n.diff(res,info));
+
+    std::cout << "[benchmark] json parse of " << 2 * num_ele
+              << " numeric values from a stream: " << secs << " s" 
+              << std::endl;
+}
@@ -0,0 +1,699 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2019, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_conduit_kernels.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+
+#include <algorithm>
+#include <iostream>
+#include <ctime>
+#include <vector>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+// checks strided_copy for one element size and pair of strides,
+// uses odd counts so SIMD remainders are exercised
+//-----------------------------------------------------------------------------
+void
+check_strided_copy(index_t ele_bytes,
+                   index_t src_stride,
+                   index_t dest_stride,
+                   index_t num_ele)
+{
+    std::vector<uint8> src((size_t)(src_stride * num_ele + 1));
+    std::vector<uint8> dest((size_t)(dest_stride * num_ele + 1), 0);
+
+    for(size_t i=0; i < src.size(); i++)
+    {
+        src[i] = (uint8)(i * 7 + 3);
+    }
+
+    // offset by one byte to use unaligned pointers
+    kernels::strided_copy(&dest[1], dest_stride,
+                          &src[1], src_stride,
+                          num_ele, ele_bytes);
+
+    for(index_t i=0; i < num_ele; i++)
+    {
+        for(index_t b=0; b < dest_stride; b++)
+        {
+            uint8 val = dest[(size_t)(1 + i * dest_stride + b)];
+            if(b < ele_bytes)
+            {
+                EXPECT_EQ(val, src[(size_t)(1 + i * src_stride + b)]);
+            }
+            else
+            {
+                // holes are untouched
+                EXPECT_EQ(val, 0);
+            }
+        }
+    }
+    EXPECT_EQ(dest[0], 0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_kernels, strided_copy)
+{
+    index_t ele_sizes[] = {1, 2, 3, 4, 8, 16};
+
+    for(int e = 0; e < 6; e++)
+    {
+        index_t eb = ele_sizes[e];
+        for(index_t ss = eb; ss <= 4 * eb; ss += eb)
+        {
+            for(index_t ds = eb; ds <= 3 * eb; ds += eb)
+            {
+                check_strided_copy(eb, ss, ds, 37);
+                check_strided_copy(eb, ss, ds, 1);
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_kernels, gather_scatter)
+{
+    float64 vals[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+    float64 res[5];
+
+    kernels::gather(res, vals, 2 * sizeof(float64), 5, sizeof(float64));
+    for(int i=0; i < 5; i++)
+    {
+        EXPECT_EQ(res[i], 2.0 * i);
+    }
+
+    float64 out[10] = {0};
+    kernels::scatter(&out[1], 2 * sizeof(float64), res, 5, sizeof(float64));
+    for(int i=0; i < 5; i++)
+    {
+        EXPECT_EQ(out[2*i], 0.0);
+        EXPECT_EQ(out[2*i+1], 2.0 * i);
+    }
+
+    // zero elements is a no-op
+    kernels::strided_copy(NULL, 8, NULL, 8, 0, 8);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_kernels, node_strided_paths)
+{
+    // interleaved x,y values
+    float64 xy[] = {0, 10, 1, 11, 2, 12, 3, 13};
+
+    Node n;
+    n["x"].set_external(DataType::float64(4, 0, 2 * sizeof(float64)), xy);
+    n["y"].set_external(DataType::float64(4,
+                                          sizeof(float64),
+                                          2 * sizeof(float64)), xy);
+
+    // compact_to
+    Node n_c;
+    n.compact_to(n_c);
+    float64_array x_c = n_c["x"].value();
+    float64_array y_c = n_c["y"].value();
+    for(index_t i=0; i < 4; i++)
+    {
+        EXPECT_EQ(x_c[i], (float64)i);
+        EXPECT_EQ(y_c[i], (float64)(10 + i));
+    }
+
+    // serialize
+    std::vector<uint8> sbuff;
+    n.serialize(sbuff);
+    EXPECT_EQ(sbuff.size(), (size_t)(8 * sizeof(float64)));
+    float64 *sptr = (float64*)&sbuff[0];
+    EXPECT_EQ(sptr[3], 3.0);
+    EXPECT_EQ(sptr[7], 13.0);
+
+    // update into strided data preserves the holes
+    Node n_src;
+    n_src["x"].set(DataType::float64(4));
+    float64_array x_src = n_src["x"].value();
+    for(index_t i=0; i < 4; i++)
+    {
+        x_src[i] = -1.0 * i;
+    }
+
+    n.update(n_src);
+    for(index_t i=0; i < 4; i++)
+    {
+        EXPECT_EQ(xy[2*i], -1.0 * i);
+        EXPECT_EQ(xy[2*i+1], (float64)(10 + i));
+    }
+
+    x_src[2] = 42.0;
+    n.update_compatible(n_src);
+    EXPECT_EQ(xy[4], 42.0);
+    EXPECT_EQ(xy[5], 12.0);
+
+    // strings into strided char storage
+    char cbuff[12];
+    memset(cbuff, '*', 12);
+    Node n_str;
+    n_str.set_external(DataType::char8_str(6, 0, 2), cbuff);
+    n_str.set_char8_str("abcde");
+    EXPECT_EQ(cbuff[0], 'a');
+    EXPECT_EQ(cbuff[1], '*');
+    EXPECT_EQ(cbuff[8], 'e');
+    EXPECT_EQ(cbuff[10], 0);
+    n_str.set_string("vwxyz");
+    EXPECT_EQ(cbuff[2], 'w');
+    EXPECT_EQ(cbuff[3], '*');
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_kernels, byte_swap)
+{
+    // odd count to exercise SIMD remainders
+    index_t num_ele = 77;
+
+    std::vector<uint16> v16((size_t)num_ele);
+    std::vector<uint32> v32((size_t)num_ele);
+    std::vector<uint64> v64((size_t)num_ele);
+
+    for(index_t i=0; i < num_ele; i++)
+    {
+        v16[(size_t)i] = (uint16)(0x0102 + i);
+        v32[(size_t)i] = (uint32)(0x01020304 + i);
+        v64[(size_t)i] = (uint64)(0x0102030405060708 + i);
+    }
+
+    std::vector<uint16> v16_exp(v16);
+    std::vector<uint32> v32_exp(v32);
+    std::vector<uint64> v64_exp(v64);
+    for(index_t i=0; i < num_ele; i++)
+    {
+        Endianness::swap16(&v16_exp[(size_t)i]);
+        Endianness::swap32(&v32_exp[(size_t)i]);
+        Endianness::swap64(&v64_exp[(size_t)i]);
+    }
+
+    // in place, contiguous
+    kernels::byte_swap(&v16[0], 2, num_ele, 2);
+    kernels::byte_swap(&v32[0], 4, num_ele, 4);
+    kernels::byte_swap(&v64[0], 8, num_ele, 8);
+    EXPECT_TRUE(v16 == v16_exp);
+    EXPECT_TRUE(v32 == v32_exp);
+    EXPECT_TRUE(v64 == v64_exp);
+
+    // in place, strided (every other value)
+    kernels::byte_swap(&v32[0], 8, num_ele / 2, 4);
+    for(index_t i=0; i < num_ele; i++)
+    {
+        uint32 v = v32_exp[(size_t)i];
+        if(i % 2 == 0 && i / 2 < num_ele / 2)
+        {
+            Endianness::swap32(&v);
+        }
+        EXPECT_EQ(v32[(size_t)i], v);
+    }
+
+    // fused copy, from unaligned strided source to contiguous dest
+    std::vector<uint8> src((size_t)(num_ele * 12 + 1));
+    for(size_t i=0; i < src.size(); i++)
+    {
+        src[i] = (uint8)i;
+    }
+    std::vector<uint64> dest((size_t)num_ele);
+    kernels::byte_swap_copy(&dest[0], 8, &src[1], 12, num_ele, 8);
+    for(index_t i=0; i < num_ele; i++)
+    {
+        uint64 v;
+        Endianness::swap64(&src[(size_t)(1 + i * 12)], &v);
+        EXPECT_EQ(dest[(size_t)i], v);
+    }
+
+    // fused copy, contiguous to contiguous
+    std::vector<uint16> dest16((size_t)num_ele);
+    kernels::byte_swap_copy(&dest16[0], 2, &v16_exp[0], 2, num_ele, 2);
+    for(index_t i=0; i < num_ele; i++)
+    {
+        EXPECT_EQ(dest16[(size_t)i], (uint16)(0x0102 + i));
+    }
+
+    // single byte elements are copied as is
+    uint8 bytes[4] = {1, 2, 3, 4};
+    uint8 bytes_dest[4] = {0, 0, 0, 0};
+    kernels::byte_swap(bytes, 1, 4, 1);
+    EXPECT_EQ(bytes[0], 1);
+    kernels::byte_swap_copy(bytes_dest, 1, bytes, 1, 4, 1);
+    EXPECT_EQ(bytes_dest[3], 4);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_kernels, convert)
+{
+    int32 i32[11] = {-5, -4, -3, -2, -1, 0, 1, 2, 3, 4, 5};
+    int64 i64[11];
+    float64 f64[22];
+
+    kernels::convert(i64, DataType::INT64_ID, sizeof(int64),
+                     i32, DataType::INT32_ID, sizeof(int32),
+                     11);
+    for(int i = 0; i < 11; i++)
+    {
+        EXPECT_EQ(i64[i], (int64)(i - 5));
+    }
+
+    // strided destination
+    for(int i = 0; i < 22; i++)
+    {
+        f64[i] = 100.0;
+    }
+    kernels::convert(f64, DataType::FLOAT64_ID, 2 * sizeof(float64),
+                     i64, DataType::INT64_ID, sizeof(int64),
+                     11);
+    for(int i = 0; i < 11; i++)
+    {
+        EXPECT_EQ(f64[2*i], (float64)(i - 5));
+        EXPECT_EQ(f64[2*i+1], 100.0);
+    }
+
+    // same type copy
+    int32 i32_cpy[11];
+    kernels::convert(i32_cpy, DataType::INT32_ID, sizeof(int32),
+                     i32, DataType::INT32_ID, sizeof(int32),
+                     11);
+    EXPECT_EQ(i32_cpy[10], 5);
+
+    // non-numeric types are not supported
+    EXPECT_THROW(kernels::convert(i32_cpy, DataType::CHAR8_STR_ID, 1,
+                                  i32, DataType::INT32_ID, sizeof(int32),
+                                  11),
+                 conduit::Error);
+    EXPECT_THROW(kernels::convert(i32_cpy, DataType::INT32_ID, sizeof(int32),
+                                  i32, DataType::OBJECT_ID, sizeof(int32),
+                                  11),
+                 conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_kernels, benchmark_strided_copy)
+{
+    index_t num_ele = 1 << 20;
+    int num_reps = 20;
+
+    index_t strides[] = {1, 2, 4, 8};
+
+    for(int s = 0; s < 4; s++)
+    {
+        index_t stride = strides[s];
+        std::vector<float64> src((size_t)(num_ele * stride), 1.0);
+        std::vector<float64> dest((size_t)num_ele, 0.0);
+
+        std::clock_t start = std::clock();
+        for(int r = 0; r < num_reps; r++)
+        {
+            kernels::gather(&dest[0],
+                            &src[0],
+                            stride * sizeof(float64),
+                            num_ele,
+                            sizeof(float64));
+        }
+        double t_kernel = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+        // previous approach: memcpy each element with a runtime size
+        volatile index_t ele_bytes = sizeof(float64);
+        start = std::clock();
+        for(int r = 0; r < num_reps; r++)
+        {
+            const uint8 *s_ptr = (const uint8*)&src[0];
+            uint8 *d_ptr = (uint8*)&dest[0];
+            for(index_t i = 0; i < num_ele; i++)
+            {
+                memcpy(d_ptr, s_ptr + i * stride * sizeof(float64),
+                       (size_t)ele_bytes);
+                d_ptr += ele_bytes;
+            }
+        }
+        double t_memcpy = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+        EXPECT_EQ(dest[num_ele - 1], 1.0);
+
+        std::cout << "[benchmark] gather float64 stride " << stride
+                  << ": kernel " << t_kernel << "s, "
+                  << "per element memcpy " << t_memcpy << "s"
+                  << std::endl;
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_kernels, benchmark_byte_swap)
+{
+    // 256 MB of float64 values
+    index_t num_ele = 1 << 25;
+    int num_reps = 4;
+
+    Node n;
+    n.set(DataType::float64(num_ele));
+    float64_array vals = n.value();
+    for(index_t i = 0; i < num_ele; i++)
+    {
+        vals[i] = 1.0;
+    }
+
+    index_t other = Endianness::machine_is_little_endian() ?
+                    Endianness::BIG_ID : Endianness::LITTLE_ID;
+
+    double gb = (double)(num_ele * sizeof(float64)) / (1024. * 1024. * 1024.);
+
+    // previous approach: swap each element
+    float64 *ptr = n.value();
+    std::clock_t start = std::clock();
+    for(int r = 0; r < num_reps; r++)
+    {
+        for(index_t i = 0; i < num_ele; i++)
+        {
+            Endianness::swap64(&ptr[i]);
+        }
+    }
+    double t_elem = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    start = std::clock();
+    for(int r = 0; r < num_reps; r++)
+    {
+        n.endian_swap(r % 2 == 0 ? other : Endianness::DEFAULT_ID);
+    }
+    double t_swap = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    Node n_swp;
+    start = std::clock();
+    for(int r = 0; r < num_reps; r++)
+    {
+        n.endian_swap_to(n_swp, other);
+    }
+    double t_swap_to = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    Node n_cpy;
+    start = std::clock();
+    for(int r = 0; r < num_reps; r++)
+    {
+        n.compact_to(n_cpy);
+        n_cpy.endian_swap(other);
+    }
+    double t_cpy_swap = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    EXPECT_EQ(n_swp.dtype().endianness(), other);
+
+    std::cout << "[benchmark] byte swap " << gb * num_reps << " GB: "
+              << "per element " << t_elem << "s, "
+              << "endian_swap " << t_swap << "s, "
+              << "endian_swap_to (fused) " << t_swap_to << "s, "
+              << "compact_to + endian_swap " << t_cpy_swap << "s"
+              << std::endl;
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_kernels, benchmark_convert)
+{
+    index_t num_ele = 1 << 23;
+    int num_reps = 10;
+
+    Node n_i32, n_f32;
+    n_i32.set(DataType::int32(num_ele));
+    n_f32.set(DataType::float32(num_ele));
+    int32_array i32_vals = n_i32.value();
+    float32_array f32_vals = n_f32.value();
+    for(index_t i = 0; i < num_ele; i++)
+    {
+        i32_vals[i] = (int32)i;
+        f32_vals[i] = (float32)i;
+    }
+
+    Node res;
+    n_i32.to_int64_array(res);
+    n_f32.to_float64_array(res);
+
+    std::clock_t start = std::clock();
+    for(int r = 0; r < num_reps; r++)
+    {
+        n_i32.to_int64_array(res);
+    }
+    double t_i64 = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    start = std::clock();
+    for(int r = 0; r < num_reps; r++)
+    {
+        n_f32.to_float64_array(res);
+    }
+    double t_f64 = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    start = std::clock();
+    for(int r = 0; r < num_reps; r++)
+    {
+        n_i32.to_data_type(DataType::FLOAT64_ID, res);
+    }
+    double t_i32_f64 = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    // previous approach: element by element through the array accessors
+    int64_array res_vals;
+    start = std::clock();
+    for(int r = 0; r < num_reps; r++)
+    {
+        res.set(DataType::int64(num_ele));
+        res_vals = res.value();
+        for(index_t i = 0; i < num_ele; i++)
+        {
+            res_vals[i] = (int64)i32_vals[i];
+        }
+    }
+    double t_elem = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    EXPECT_EQ(res_vals[num_ele - 1], (int64)(num_ele - 1));
+
+    std::cout << "[benchmark] convert " << num_ele << " values x "
+              << num_reps << ": "
+              << "int32 -> int64 " << t_i64 << "s, "
+              << "float32 -> float64 " << t_f64 << "s, "
+              << "int32 -> float64 " << t_i32_f64 << "s, "
+              << "int32 -> int64 per element " << t_elem << "s"
+              << std::endl;
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_kernels, crc32c)
+{
+    // standard check value
+    const char *check = "123456789";
+    EXPECT_EQ(kernels::crc32c(check,9), (uint32)0xE3069283);
+    EXPECT_EQ(kernels::crc32c(check,0), (uint32)0);
+
+    // continued across buffers, and combined from parts
+    uint32 crc_a = kernels::crc32c(check,4);
+    uint32 crc_b = kernels::crc32c(check + 4,5);
+    EXPECT_EQ(kernels::crc32c(check + 4,5,crc_a), (uint32)0xE3069283);
+    EXPECT_EQ(kernels::crc32c_combine(crc_a,crc_b,5), (uint32)0xE3069283);
+    EXPECT_EQ(kernels::crc32c_combine(crc_a,0,0), crc_a);
+
+    // unaligned starts and lengths
+    std::vector<uint8> data(1000);
+    for(size_t i=0; i < data.size(); i++)
+    {
+        data[i] = (uint8)(i * 7 + 3);
+    }
+    uint32 crc_all = kernels::crc32c(&data[0],1000);
+    for(index_t split = 1; split < 1000; split += 111)
+    {
+        uint32 crc_1 = kernels::crc32c(&data[0],split);
+        uint32 crc_2 = kernels::crc32c(&data[(size_t)split],1000 - split);
+        EXPECT_EQ(kernels::crc32c_combine(crc_1,crc_2,1000 - split),crc_all);
+        EXPECT_EQ(kernels::crc32c(&data[(size_t)split],1000 - split,crc_1),
+                  crc_all);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_kernels, xxhash64)
+{
+    // reference values from the xxHash implementation
+    EXPECT_EQ(kernels::xxhash64("",0), (uint64)0xEF46DB3751D8E999ULL);
+    EXPECT_EQ(kernels::xxhash64("abc",3), (uint64)0x44BC2CF5AD770999ULL);
+    EXPECT_EQ(kernels::xxhash64("abc",3,12345),
+              (uint64)0x01700E64F6F23509ULL);
+    const char *txt = "Nobody inspects the spammish repetition";
+    EXPECT_EQ(kernels::xxhash64(txt,39), (uint64)0xFBCEA83C8A378BF1ULL);
+
+    std::vector<uint8> data(1000);
+    for(size_t i=0; i < data.size(); i++)
+    {
+        data[i] = (uint8)(i * 7 + 3);
+    }
+    EXPECT_EQ(kernels::xxhash64(&data[0],1000),
+              (uint64)0x5F235FA033F1A3FBULL);
+    EXPECT_EQ(kernels::xxhash64(&data[0],1000,42),
+              (uint64)0xD776E8028586FF61ULL);
+
+    // the result doesn't depend on how the stream is split
+    for(index_t piece = 1; piece < 70; piece += 7)
+    {
+        kernels::Hash64 hash;
+        for(index_t i = 0; i < 1000; i += piece)
+        {
+            index_t n = std::min(piece, 1000 - i);
+            hash.update(&data[(size_t)i],n);
+        }
+        EXPECT_EQ(hash.digest(), kernels::xxhash64(&data[0],1000));
+    }
+
+    kernels::Hash64 hash(42);
+    hash.update(&data[0],500);
+    hash.reset(42);
+    hash.update(&data[0],1000);
+    EXPECT_EQ(hash.digest(), kernels::xxhash64(&data[0],1000,42));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_kernels, hash_strided)
+{
+    // elements of 1 to 16 bytes, interleaved with other bytes
+    index_t num_ele = 3001;
+    for(index_t ele_bytes = 1; ele_bytes <= 16; ele_bytes *= 2)
+    {
+        index_t stride = ele_bytes * 3 + 1;
+        std::vector<uint8> compact((size_t)(num_ele * ele_bytes));
+        std::vector<uint8> strided((size_t)(num_ele * stride), 0xAB);
+        for(index_t i = 0; i < num_ele; i++)
+        {
+            for(index_t b = 0; b < ele_bytes; b++)
+            {
+                uint8 val = (uint8)(i * 13 + b);
+                compact[(size_t)(i * ele_bytes + b)] = val;
+                strided[(size_t)(i * stride + b)] = val;
+            }
+        }
+
+        index_t num_bytes = num_ele * ele_bytes;
+        EXPECT_EQ(kernels::crc32c_strided(&strided[0], stride,
+                                          num_ele, ele_bytes),
+                  kernels::crc32c(&compact[0],num_bytes));
+
+        kernels::Hash64 hash;
+        hash.update_strided(&strided[0], stride, num_ele, ele_bytes);
+        EXPECT_EQ(hash.digest(),
+                  kernels::xxhash64(&compact[0],num_bytes));
+    }
+
+    // large elements
+    std::vector<uint8> big(3 * 5000, 1);
+    for(size_t i = 0; i < big.size(); i++)
+    {
+        big[i] = (uint8)(i * 31);
+    }
+    std::vector<uint8> big_compact;
+    big_compact.insert(big_compact.end(), big.begin(), big.begin() + 2000);
+    big_compact.insert(big_compact.end(), big.begin() + 5000,
+                       big.begin() + 7000);
+    big_compact.insert(big_compact.end(), big.begin() + 10000,
+                       big.begin() + 12000);
+    EXPECT_EQ(kernels::crc32c_strided(&big[0], 5000, 3, 2000),
+              kernels::crc32c(&big_compact[0],6000));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_kernels, benchmark_hash)
+{
+    index_t num_ele = 1 << 22;
+    int num_reps = 10;
+    std::vector<float64> src((size_t)(num_ele * 2));
+    for(size_t i = 0; i < src.size(); i++)
+    {
+        src[i] = (float64)i;
+    }
+    float64 mib = (num_ele * sizeof(float64) * num_reps) / (1024.0 * 1024.0);
+
+    uint32 crc = 0;
+    std::clock_t start = std::clock();
+    for(int r = 0; r < num_reps; r++)
+    {
+        crc ^= kernels::crc32c(&src[0], num_ele * sizeof(float64));
+    }
+    double t_crc = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    uint64 xxh = 0;
+    start = std::clock();
+    for(int r = 0; r < num_reps; r++)
+    {
+        xxh ^= kernels::xxhash64(&src[0], num_ele * sizeof(float64));
+    }
+    double t_xxh = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    // every other value
+    start = std::clock();
+    for(int r = 0; r < num_reps; r++)
+    {
+        kernels::Hash64 hash;
+        hash.update_strided(&src[0], 2 * sizeof(float64),
+                            num_ele, sizeof(float64));
+        xxh ^= hash.digest();
+    }
+    double t_xxh_strided = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    // previous option: the string hash in utils
+    start = std::clock();
+    unsigned int str_hash = 0;
+    for(int r = 0; r < num_reps; r++)
+    {
+        str_hash ^= utils::hash((const char*)&src[0],
+                                (unsigned int)(num_ele * sizeof(float64)),
+                                0u);
+    }
+    double t_str = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    EXPECT_TRUE(crc != 1 || xxh != 1 || str_hash != 1);
+
+    std::cout << "[benchmark] hash " << mib << " MiB: "
+              << "crc32c " << mib / t_crc << " MiB/s, "
+              << "xxhash64 " << mib / t_xxh << " MiB/s, "
+              << "xxhash64 strided " << mib / t_xxh_strided << " MiB/s, "
+              << "utils::hash " << mib / t_str << " MiB/s"
+              << std::endl;
+}
@@ -1202,3 +1202,42 @@ TEST(conduit_node, add_child)
 
 
 
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node, summarize)
+{
+    Node n;
+    float64 coords[4] = {-1.0, 2.0, 0.5, 4.5};
+    n["coords/x"].set(coords, 4);
+    n["coords/y"].set(DataType::int32(3));
+    int32_array y_vals = n["coords/y"].value();
+    y_vals[0] = 3;
+    y_vals[1] = -7;
+    y_vals[2] = 1;
+    n["name"] = "mesh";
+    n["fields"].append().set((uint8)42);
+    n["fields"].append().set("not a number");
+
+    Node res;
+    n.summarize(res);
+    res.print();
+
+    EXPECT_FALSE(res.has_child("name"));
+    EXPECT_EQ(res["coords/x/count"].to_index_t(), 4);
+    EXPECT_EQ(res["coords/x/min"].as_float64(), -1.0);
+    EXPECT_EQ(res["coords/x/max"].as_float64(), 4.5);
+    EXPECT_EQ(res["coords/x/sum"].as_float64(), 6.0);
+    EXPECT_EQ(res["coords/x/mean"].as_float64(), 1.5);
+    EXPECT_EQ(res["coords/x/argmax"].to_index_t(), 3);
+    EXPECT_EQ(res["coords/x/nonfinite"].to_index_t(), 0);
+
+    EXPECT_EQ(res["coords/y/min"].as_int32(), -7);
+    EXPECT_EQ(res["coords/y/argmin"].to_index_t(), 1);
+    // sums use a wide accumulator
+    EXPECT_EQ(res["coords/y/sum"].as_int64(), -3);
+    EXPECT_EQ(res["coords/x/sum"].dtype().id(), DataType::FLOAT64_ID);
+
+    // the string list entry is skipped
+    EXPECT_EQ(res["fields"].number_of_children(), 1);
+    EXPECT_EQ(res["fields"][0]["max"].as_uint8(), 42);
+}
@@ -0,0 +1,498 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2019, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_conduit_node_allocators.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+
+#include <iostream>
+#include <cstdlib>
+#include <ctime>
+#include <sstream>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+// simple counting allocator used to check that nodes use the
+// selected allocator
+//-----------------------------------------------------------------------------
+static index_t num_allocs = 0;
+static index_t num_frees  = 0;
+
+//-----------------------------------------------------------------------------
+void *
+counting_allocate(size_t num_items, size_t item_size)
+{
+    num_allocs++;
+    return calloc(num_items, item_size);
+}
+
+//-----------------------------------------------------------------------------
+void
+counting_free(void *data_ptr)
+{
+    num_frees++;
+    free(data_ptr);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_allocators, default_allocator)
+{
+    EXPECT_EQ(utils::default_allocator(),0);
+    EXPECT_TRUE(utils::is_valid_allocator(0));
+    EXPECT_FALSE(utils::is_valid_allocator(-1));
+    EXPECT_FALSE(utils::is_valid_allocator(utils::number_of_allocators()));
+
+    Node n;
+    EXPECT_EQ(n.allocator(),0);
+    n["a"].set(DataType::float64(10));
+    EXPECT_EQ(n["a"].allocator(),0);
+
+    // allocators must provide zero init memory
+    float64_array vals = n["a"].value();
+    for(index_t i=0;i<10;i++)
+    {
+        EXPECT_EQ(vals[i],0.0);
+    }
+
+    EXPECT_THROW(n.set_allocator(utils::number_of_allocators()),
+                 conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_allocators, registered_allocator)
+{
+    index_t alloc_id = utils::register_allocator(counting_allocate,
+                                                 counting_free);
+    EXPECT_TRUE(utils::is_valid_allocator(alloc_id));
+
+    num_allocs = 0;
+    num_frees  = 0;
+    {
+        Node n;
+        n.set_allocator(alloc_id);
+        n["a"] = 10;
+        n["b/c"].set(DataType::int32(100));
+        n["d"].append().set(DataType::float32(5));
+
+        EXPECT_EQ(n["a"].allocator(),alloc_id);
+        EXPECT_EQ(n["b/c"].allocator(),alloc_id);
+        EXPECT_EQ(n["d"][0].allocator(),alloc_id);
+        EXPECT_EQ(num_allocs,3);
+
+        Node info;
+        n.info(info);
+        NodeConstIterator itr = info["mem_spaces"].children();
+        while(itr.has_next())
+        {
+            EXPECT_EQ(itr.next()["allocator_id"].to_index_t(),alloc_id);
+        }
+    }
+    EXPECT_EQ(num_frees,3);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_allocators, default_allocator_change)
+{
+    index_t alloc_id = utils::register_allocator(counting_allocate,
+                                                 counting_free);
+    utils::set_default_allocator(alloc_id);
+
+    num_allocs = 0;
+    num_frees  = 0;
+    {
+        Node n;
+        EXPECT_EQ(n.allocator(),alloc_id);
+        n.set(DataType::int64(4));
+    }
+    EXPECT_EQ(num_allocs,1);
+    EXPECT_EQ(num_frees,1);
+
+    utils::set_default_allocator(0);
+    EXPECT_THROW(utils::set_default_allocator(-1),conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_allocators, set_allocator_moves_data)
+{
+    index_t alloc_id = utils::register_allocator(counting_allocate,
+                                                 counting_free);
+
+    // tree that shares a single allocation
+    Schema s;
+    s["a"].set(DataType::int32(4,0));
+    s["b"].set(DataType::float64(4,16));
+    Node n(s);
+
+    int32_array   a_vals = n["a"].value();
+    float64_array b_vals = n["b"].value();
+    for(index_t i=0;i<4;i++)
+    {
+        a_vals[i] = (int32) i;
+        b_vals[i] = i * 0.5;
+    }
+
+    void *orig_ptr = n.data_ptr();
+
+    num_allocs = 0;
+    num_frees  = 0;
+    n.set_allocator(alloc_id);
+    EXPECT_EQ(num_allocs,1);
+    EXPECT_NE(orig_ptr,n.data_ptr());
+    EXPECT_EQ(n.data_ptr(),n["a"].data_ptr());
+    EXPECT_EQ(n.data_ptr(),n["b"].data_ptr());
+
+    a_vals = n["a"].value();
+    b_vals = n["b"].value();
+    for(index_t i=0;i<4;i++)
+    {
+        EXPECT_EQ(a_vals[i],i);
+        EXPECT_EQ(b_vals[i],i * 0.5);
+    }
+
+    n.reset();
+    EXPECT_EQ(num_frees,1);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_allocators, arena_allocator)
+{
+    index_t arena_id = utils::create_arena_allocator(4096);
+    EXPECT_EQ(utils::arena_allocator_bytes(arena_id),0);
+
+    Node n;
+    n.set_allocator(arena_id);
+    for(index_t i=0;i<100;i++)
+    {
+        Node &chld = n.append();
+        chld.set(DataType::float64(8));
+        EXPECT_EQ(chld.allocator(),arena_id);
+        // 64 byte alignment
+        EXPECT_EQ(((size_t)chld.data_ptr()) % 64,0);
+        float64_array vals = chld.value();
+        for(index_t j=0;j<8;j++)
+        {
+            EXPECT_EQ(vals[j],0.0);
+            vals[j] = (float64)(i*j);
+        }
+    }
+
+    // large requests get their own block
+    n.append().set(DataType::uint8(10000));
+
+    EXPECT_EQ(n[10].as_float64_ptr()[3],30.0);
+    EXPECT_GT(utils::arena_allocator_bytes(arena_id),10000);
+
+    // release the tree, then the arena memory in one call
+    n.reset();
+    utils::reset_arena_allocator(arena_id);
+    EXPECT_EQ(utils::arena_allocator_bytes(arena_id),0);
+
+    // arena can be reused after reset
+    n.set_allocator(arena_id);
+    n["a"] = 42;
+    EXPECT_EQ(n["a"].to_int(),42);
+    n.reset();
+    utils::reset_arena_allocator(arena_id);
+
+    // only arenas can be reset
+    EXPECT_THROW(utils::reset_arena_allocator(0),conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_allocators, destroy_arena_allocator)
+{
+    index_t arena_id = utils::create_arena_allocator(4096);
+    index_t num_allocators = utils::number_of_allocators();
+
+    Node n;
+    n.set_allocator(arena_id);
+    n["a"].set(DataType::float64(100));
+
+    // the default allocator can't be destroyed
+    utils::set_default_allocator(arena_id);
+    EXPECT_THROW(utils::destroy_arena_allocator(arena_id),conduit::Error);
+    utils::set_default_allocator(0);
+
+    utils::destroy_arena_allocator(arena_id);
+    EXPECT_FALSE(utils::is_valid_allocator(arena_id));
+    // ids are not reused
+    EXPECT_EQ(utils::number_of_allocators(),num_allocators);
+    EXPECT_THROW(utils::arena_allocator_bytes(arena_id),conduit::Error);
+    EXPECT_THROW(utils::destroy_arena_allocator(arena_id),conduit::Error);
+    EXPECT_THROW(utils::allocate_memory(arena_id,8),conduit::Error);
+
+    // nodes that used the arena can still be released
+    n.reset();
+
+    // only arenas can be destroyed
+    EXPECT_THROW(utils::destroy_arena_allocator(0),conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+void
+create_arena_task(index_t, void *)
+{
+    index_t arena_id = utils::create_arena_allocator(1024);
+    void *ptr = utils::allocate_memory(arena_id,64);
+    EXPECT_TRUE(ptr != NULL);
+    utils::free_memory(arena_id,ptr);
+    utils::destroy_arena_allocator(arena_id);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_allocators, register_from_threads)
+{
+    index_t num_allocators = utils::number_of_allocators();
+
+    set_num_threads(4);
+    parallel_for(32,create_arena_task,NULL);
+    set_num_threads(1);
+
+    EXPECT_EQ(utils::number_of_allocators(),num_allocators + 32);
+    for(index_t i=num_allocators; i < num_allocators + 32; i++)
+    {
+        EXPECT_FALSE(utils::is_valid_allocator(i));
+    }
+}
+
+//-----------------------------------------------------------------------------
+static double
+build_and_destroy_tree(index_t allocator_id,
+                       index_t num_leaves,
+                       index_t num_cycles)
+{
+    std::clock_t start = std::clock();
+    for(index_t c=0; c < num_cycles; c++)
+    {
+        Node n;
+        n.set_allocator(allocator_id);
+        for(index_t i=0; i < num_leaves; i++)
+        {
+            n.append().set(DataType::float64(4));
+        }
+        n.reset();
+        if(allocator_id != 0)
+        {
+            utils::reset_arena_allocator(allocator_id);
+        }
+    }
+    return double(std::clock() - start) / CLOCKS_PER_SEC;
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_allocators, benchmark_calloc_vs_arena)
+{
+    index_t arena_id = utils::create_arena_allocator();
+    index_t num_leaves = 10000;
+    index_t num_cycles = 20;
+
+    double t_calloc = build_and_destroy_tree(0,num_leaves,num_cycles);
+    double t_arena  = build_and_destroy_tree(arena_id,num_leaves,num_cycles);
+
+    std::cout << "[benchmark] " << num_cycles << " cycles of "
+              << num_leaves << " small leaves" << std::endl
+              << "  calloc: " << t_calloc << " s" << std::endl
+              << "  arena:  " << t_arena  << " s" << std::endl;
+}
+
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_allocators, tree_blocks)
+{
+    EXPECT_EQ(utils::tree_block_threshold(),16);
+    EXPECT_THROW(utils::set_tree_block_threshold(-1),conduit::Error);
+
+    Schema s;
+    for(index_t i=0; i < 40; i++)
+    {
+        std::ostringstream oss;
+        oss << "domain/fields/f" << i;
+        s[oss.str()].set(DataType::float64(4));
+    }
+
+    // build the same tree with and without blocks
+    utils::set_tree_block_threshold(0);
+    Node n_ref(s);
+    utils::set_tree_block_threshold(16);
+    Node n(s);
+
+    Node info;
+    EXPECT_EQ(n.schema().to_json(),n_ref.schema().to_json());
+    EXPECT_FALSE(n.diff(n_ref,info));
+
+    // children carved out of one block are contiguous 
+    const Node *f0 = n.fetch_ptr("domain/fields/f0");
+    const Node *f1 = n.fetch_ptr("domain/fields/f1");
+    EXPECT_EQ(f1 - f0, 1);
+
+    // tree edits still work, including removing block children
+    n["domain/fields"].remove("f3");
+    n["domain/fields"].remove(0);
+    n["domain/fields/f_new"] = 1.0;
+    EXPECT_EQ(n["domain/fields"].number_of_children(),39);
+    n["domain/fields/f5"].set(DataType::int32(100));
+    n["domain"].remove("fields");
+    EXPECT_EQ(n.schema().number_of_children(),1);
+
+    // copies and loads of larger trees
+    Node n_copy;
+    n_copy.set_external(n_ref);
+    EXPECT_FALSE(n_copy.diff(n_ref,info));
+    n_copy.reset();
+    
+    Schema s_copy(s);
+    EXPECT_TRUE(s_copy.equals(s));
+    s_copy["domain/fields"].remove("f10");
+    s_copy.remove("domain");
+}
+
+//-----------------------------------------------------------------------------
+struct ReleaseDomainsContext
+{
+    Node   *node;
+    Schema *schema;
+};
+
+//-----------------------------------------------------------------------------
+void
+release_domain_task(index_t i, void *ctx)
+{
+    // each task empties a different parent, the children share blocks
+    ReleaseDomainsContext &rctx = *(ReleaseDomainsContext*)ctx;
+    Node &dom = rctx.node->child(i);
+    while(dom.number_of_children() > 0)
+    {
+        dom.remove(0);
+    }
+
+    Schema &dom_s = rctx.schema->child(i);
+    while(dom_s.number_of_children() > 0)
+    {
+        dom_s.remove(dom_s.number_of_children() - 1);
+    }
+
+    // changing the threshold while other threads build trees is fine
+    utils::set_tree_block_threshold( (i % 2) == 0 ? 16 : 8);
+    Schema s_task;
+    for(index_t j=0; j < 32; j++)
+    {
+        std::ostringstream oss;
+        oss << "f" << j;
+        s_task[oss.str()].set(DataType::float64(1));
+    }
+    Node n_task(s_task);
+    EXPECT_EQ(n_task.number_of_children(),32);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_allocators, tree_blocks_release_from_threads)
+{
+    Schema s;
+    for(index_t i=0; i < 32; i++)
+    {
+        for(index_t j=0; j < 32; j++)
+        {
+            std::ostringstream oss;
+            oss << "d" << i << "/f" << j;
+            s[oss.str()].set(DataType::float64(1));
+        }
+    }
+
+    Node n(s);
+    Schema s_copy(s);
+
+    ReleaseDomainsContext ctx;
+    ctx.node   = &n;
+    ctx.schema = &s_copy;
+
+    set_num_threads(4);
+    parallel_for(32,release_domain_task,&ctx);
+    set_num_threads(1);
+    utils::set_tree_block_threshold(16);
+
+    EXPECT_EQ(n.number_of_children(),32);
+    EXPECT_EQ(s_copy.number_of_children(),32);
+    for(index_t i=0; i < 32; i++)
+    {
+        EXPECT_EQ(n.child(i).number_of_children(),0);
+        EXPECT_EQ(s_copy.child(i).number_of_children(),0);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_allocators, benchmark_tree_blocks)
+{
+    Schema s;
+    for(index_t i=0; i < 100000; i++)
+    {
+        std::ostringstream oss;
+        oss << "d" << (i / 1000) << "/f" << i;
+        s[oss.str()].set(DataType::float64(1));
+    }
+
+    double t[2];
+    index_t thresholds[2] = {0, 16};
+    for(int pass=0; pass < 2; pass++)
+    {
+        utils::set_tree_block_threshold(thresholds[pass]);
+        std::clock_t start = std::clock();
+        for(int i=0; i < 5; i++)
+        {
+            Node n(s);
+        }
+        t[pass] = double(std::clock() - start) / CLOCKS_PER_SEC;
+    }
+    utils::set_tree_block_threshold(16);
+
+    std::cout << "[benchmark] 5 cycles of building and destroying a tree "
+              << "with 100000 leaves" << std::endl
+              << "  separate objects: " << t[0] << " s" << std::endl
+              << "  tree blocks:      " << t[1] << " s" << std::endl;
+}
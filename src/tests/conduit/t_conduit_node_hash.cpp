@@ -0,0 +1,347 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2019, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//-----------------------------------------------------------------------------
+///
+/// file: t_conduit_node_hash.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+
+#include <cstring>
+#include <ctime>
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+// enables threads for a test, and restores the defaults after
+//-----------------------------------------------------------------------------
+struct ScopedThreads
+{
+    ScopedThreads(index_t num_threads, index_t min_bytes)
+    {
+        set_num_threads(num_threads);
+        set_parallel_min_bytes(min_bytes);
+    }
+    ~ScopedThreads()
+    {
+        set_num_threads(1);
+        set_parallel_min_bytes(1024 * 1024);
+    }
+};
+
+//-----------------------------------------------------------------------------
+void
+make_tree(Node &n)
+{
+    n.reset();
+    n["a"].set(DataType::float64(100));
+    float64_array a_vals = n["a"].value();
+    for(index_t i=0; i < 100; i++)
+    {
+        a_vals[i] = (float64)i * 0.5;
+    }
+    n["b/c"] = (int32)42;
+    n["b/d"] = "a string";
+    n["b"].add_child("e/f").set(DataType::uint8(7));
+    n["empty"];
+    n["lst"].append() = (int64)-1;
+    n["lst"].append()["x"] = (float32)2.5;
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_hash, layout_independent)
+{
+    Node n;
+    make_tree(n);
+    uint64 h = n.hash();
+    EXPECT_EQ(n.hash(), h);
+
+    // compact copy
+    Node n_compact;
+    n.compact_to(n_compact);
+    EXPECT_EQ(n_compact.hash(), h);
+
+    // strided: the same values, every other element of a larger array
+    std::vector<float64> vals(200, -1.0);
+    for(index_t i=0; i < 100; i++)
+    {
+        vals[(size_t)(2 * i)] = (float64)i * 0.5;
+    }
+    Node n_strided;
+    n_strided.set(n);
+    n_strided["a"].set_external(DataType::float64(100, 0, 16), &vals[0]);
+    EXPECT_EQ(n_strided.hash(), h);
+
+    // save and load keep the hash
+    n.save("tout_node_hash.bin","conduit_bin");
+    Node n_load;
+    n_load.load("tout_node_hash.bin","conduit_bin");
+    EXPECT_EQ(n_load.hash(), h);
+
+    // a different value
+    float64_array strided_vals = n_strided["a"].value();
+    strided_vals[99] += 1.0;
+    EXPECT_NE(n_strided.hash(), h);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_hash, options)
+{
+    Node n;
+    make_tree(n);
+
+    Node opts;
+    opts["schema"] = "false";
+    uint64 h_data = n.hash(opts);
+    EXPECT_NE(n.hash(), h_data);
+
+    // renaming changes the schema, not the data
+    Node n_renamed;
+    n_renamed.set(n);
+    n_renamed.rename_child("a","z");
+    EXPECT_NE(n_renamed.hash(), n.hash());
+    EXPECT_EQ(n_renamed.hash(opts), h_data);
+
+    // so does reinterpreting the data
+    Node n_reinterp;
+    n_reinterp.set(n);
+    n_reinterp["b/c"].set((float32)0.0f);
+    memcpy(n_reinterp["b/c"].data_ptr(), n["b/c"].data_ptr(), 4);
+    EXPECT_NE(n_reinterp.hash(), n.hash());
+    EXPECT_EQ(n_reinterp.hash(opts), h_data);
+
+    // seeds
+    Node opts_seed;
+    opts_seed["seed"] = 42;
+    EXPECT_NE(n.hash(opts_seed), n.hash());
+    EXPECT_EQ(n.hash(opts_seed), n.hash(opts_seed));
+
+    // crc32c is the checksum of the data in compact order
+    Node opts_crc;
+    opts_crc["algorithm"] = "crc32c";
+    std::vector<uint8> data;
+    n.serialize(data);
+    EXPECT_EQ(n.hash(opts_crc),
+              (uint64)kernels::crc32c(&data[0],(index_t)data.size()));
+    EXPECT_EQ(n_renamed.hash(opts_crc), n.hash(opts_crc));
+
+    // a leaf root
+    Node n_leaf;
+    n_leaf.set(DataType::int32(4));
+    n_leaf.as_int32_ptr()[0] = 7;
+    EXPECT_EQ(n_leaf.hash(opts_crc),
+              (uint64)kernels::crc32c(n_leaf.data_ptr(),16));
+
+    Node opts_bad;
+    opts_bad["algorithm"] = "md5";
+    EXPECT_THROW(n.hash(opts_bad),conduit::Error);
+    opts_bad.reset();
+    opts_bad["schema"] = "yes";
+    EXPECT_THROW(n.hash(opts_bad),conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_hash, leaf_hashes)
+{
+    Node n;
+    make_tree(n);
+
+    Node hashes;
+    n.leaf_hashes(hashes);
+    EXPECT_TRUE(hashes["a"].dtype().is_uint64());
+    EXPECT_TRUE(hashes["b"].child("e/f").dtype().is_uint64());
+    EXPECT_TRUE(hashes["empty"].dtype().is_empty());
+    EXPECT_TRUE(hashes["lst"].dtype().is_list());
+    EXPECT_EQ(hashes["lst"].number_of_children(),2);
+    EXPECT_TRUE(hashes["lst"][1]["x"].dtype().is_uint64());
+
+    // a change only changes the hash of its leaf
+    Node n_changed;
+    n_changed.set(n);
+    n_changed["b/c"] = (int32)43;
+    Node hashes_changed;
+    n_changed.leaf_hashes(hashes_changed);
+    EXPECT_NE(hashes_changed["b/c"].as_uint64(), hashes["b/c"].as_uint64());
+    EXPECT_EQ(hashes_changed["a"].as_uint64(), hashes["a"].as_uint64());
+    EXPECT_EQ(hashes_changed["lst"][0].as_uint64(),
+              hashes["lst"][0].as_uint64());
+
+    // crc32c leaf hashes are the checksums of the leaf data
+    Node opts_crc;
+    opts_crc["algorithm"] = "crc32c";
+    n.leaf_hashes(hashes,opts_crc);
+    EXPECT_EQ(hashes["a"].as_uint64(),
+              (uint64)kernels::crc32c(n["a"].data_ptr(),800));
+
+    // a leaf root
+    n["b/c"].leaf_hashes(hashes);
+    EXPECT_TRUE(hashes.dtype().is_uint64());
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_hash, parallel)
+{
+    Node n;
+    for(index_t f=0; f < 16; f++)
+    {
+        std::ostringstream oss;
+        oss << "fields/f" << f;
+        n[oss.str()].set(DataType::float64(1000 * (f + 1)));
+        float64_array vals = n[oss.str()].value();
+        for(index_t i=0; i < vals.number_of_elements(); i++)
+        {
+            vals[i] = (float64)(f * i);
+        }
+    }
+    // a leaf larger than a parallel piece, and a strided one
+    n["big"].set(DataType::uint8(300 * 1024 + 17));
+    uint8_array big_vals = n["big"].value();
+    for(index_t i=0; i < big_vals.number_of_elements(); i++)
+    {
+        big_vals[i] = (uint8)(i * 7);
+    }
+    n["strided"].set_external(DataType::float64(4000, 0, 16),
+                              n["fields/f7"].data_ptr());
+
+    Node opts_crc;
+    opts_crc["algorithm"] = "crc32c";
+
+    uint64 h = n.hash();
+    uint64 h_crc = n.hash(opts_crc);
+    Node hashes;
+    n.leaf_hashes(hashes);
+
+    ScopedThreads threads(4,0);
+    EXPECT_EQ(n.hash(), h);
+    EXPECT_EQ(n.hash(opts_crc), h_crc);
+    Node hashes_par;
+    n.leaf_hashes(hashes_par);
+    Node info;
+    EXPECT_FALSE(hashes.diff(hashes_par,info));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_hash, checksum)
+{
+    Node n;
+    make_tree(n);
+
+    std::string crc = n.checksum();
+    EXPECT_EQ(crc.substr(0,7),"crc32c:");
+    EXPECT_TRUE(n.verify_checksum(crc));
+
+    std::string xxh = n.checksum("xxhash64");
+    EXPECT_EQ(xxh.substr(0,9),"xxhash64:");
+    EXPECT_TRUE(n.verify_checksum(xxh));
+
+    Node n_changed;
+    n_changed.set(n);
+    n_changed["a"].as_float64_ptr()[3] = -1.0;
+    EXPECT_FALSE(n_changed.verify_checksum(crc));
+    EXPECT_FALSE(n_changed.verify_checksum(xxh));
+
+    EXPECT_THROW(n.verify_checksum("crc32c"),conduit::Error);
+    EXPECT_THROW(n.verify_checksum("crc32c:xyz"),conduit::Error);
+    EXPECT_THROW(n.verify_checksum("md5:1234"),conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_hash, benchmark_hash)
+{
+    // 32 fields of 128k float64 (32 MiB), one copy compact and one strided
+    index_t num_ele = 128 * 1024;
+    Node n;
+    std::vector<float64> strided_vals((size_t)(num_ele * 2 * 32), 0.0);
+    for(index_t f=0; f < 32; f++)
+    {
+        std::ostringstream oss;
+        oss << "f" << f;
+        n["compact"][oss.str()].set(DataType::float64(num_ele));
+        float64_array vals = n["compact"][oss.str()].value();
+        float64 *s_vals = &strided_vals[(size_t)(f * num_ele * 2)];
+        for(index_t i=0; i < num_ele; i++)
+        {
+            vals[i] = (float64)(f + i);
+            s_vals[2 * i] = vals[i];
+        }
+        n["strided"][oss.str()].set_external(DataType::float64(num_ele,0,16),
+                                             s_vals);
+    }
+
+    Node opts_crc;
+    opts_crc["algorithm"] = "crc32c";
+
+    std::clock_t start = std::clock();
+    uint64 h_compact = n["compact"].hash();
+    double t_compact = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    start = std::clock();
+    uint64 h_strided = n["strided"].hash();
+    double t_strided = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    start = std::clock();
+    uint64 crc_compact = n["compact"].hash(opts_crc);
+    double t_crc = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    // previous option: compact the strided tree, then hash it
+    start = std::clock();
+    Node n_tmp;
+    n["strided"].compact_to(n_tmp);
+    uint64 h_tmp = n_tmp.hash();
+    double t_compact_first = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    EXPECT_EQ(h_compact, h_strided);
+    EXPECT_EQ(h_tmp, h_strided);
+    EXPECT_NE(crc_compact, (uint64)0);
+
+    std::cout << "[benchmark] hash 32 MiB tree: xxhash64 compact "
+              << t_compact << " s, strided " << t_strided 
+              << " s (compact first " << t_compact_first << " s), "
+              << "crc32c compact " << t_crc << " s" << std::endl;
+}
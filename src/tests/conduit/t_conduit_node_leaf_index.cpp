@@ -0,0 +1,358 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2019, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//-----------------------------------------------------------------------------
+///
+/// file: t_conduit_node_leaf_index.cpp
+///
+//-----------------------------------------------------------------------------
+
+
+#include "conduit.hpp"
+
+#include <ctime>
+#include <iostream>
+#include <sstream>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_leaf_index, build)
+{
+    Node n;
+    n["a/b"].set(DataType::float64(10));
+    n["a/c"] = (int32)42;
+    n["a"].add_child("d/e").set("string");
+    n["empty"];
+    Node &lst = n["lst"];
+    lst.append().set(DataType::uint8(3));
+    lst.append()["x"] = (float32)1.5;
+
+    NodeLeafIndex idx(n);
+    EXPECT_EQ(idx.root(),&n);
+    EXPECT_EQ(idx.number_of_leaves(),5);
+
+    // empty nodes aren't leaves
+    EXPECT_EQ(idx.path(0),"a/b");
+    EXPECT_EQ(idx.path(1),"a/c");
+    EXPECT_EQ(idx.path(2),"a/{d/e}");
+    EXPECT_EQ(idx.path(3),"lst/[0]");
+    EXPECT_EQ(idx.path(4),"lst/[1]/x");
+
+    // paths match Schema::path
+    const NodeLeafIndex::Leaf *leaves = idx.leaves();
+    index_t offset = 0;
+    for(index_t i=0; i < idx.number_of_leaves(); i++)
+    {
+        const NodeLeafIndex::Leaf &l = idx.leaf(i);
+        EXPECT_EQ(&l,&leaves[i]);
+        EXPECT_EQ(l.path_id,i);
+        EXPECT_EQ(idx.path(l.path_id),l.node->path());
+        EXPECT_TRUE(l.dtype.equals(l.node->dtype()));
+        EXPECT_EQ(l.data,l.node->element_ptr(0));
+        EXPECT_EQ(l.offset,offset);
+        offset += l.dtype.bytes_compact();
+    }
+    EXPECT_EQ(idx.total_bytes_compact(),n.total_bytes_compact());
+
+    // offsets match the compact form of the tree
+    Node n_compact;
+    n.compact_to(n_compact);
+    const uint8 *base = (const uint8*)n_compact.contiguous_data_ptr();
+    EXPECT_TRUE(base != NULL);
+    NodeLeafIndex idx_compact(n_compact);
+    EXPECT_EQ(idx_compact.number_of_leaves(),idx.number_of_leaves());
+    for(index_t i=0; i < idx.number_of_leaves(); i++)
+    {
+        EXPECT_EQ(idx_compact.path(i),idx.path(i));
+        EXPECT_EQ(idx_compact.leaf(i).data,
+                  (void*)(base + idx.leaf(i).offset));
+    }
+
+    EXPECT_THROW(idx.leaf(5),conduit::Error);
+    EXPECT_THROW(idx.path(-1),conduit::Error);
+
+    // a leaf root
+    Node n_leaf;
+    n_leaf = (int64)5;
+    idx.build(n_leaf);
+    EXPECT_EQ(idx.number_of_leaves(),1);
+    EXPECT_EQ(idx.path(0),"");
+    EXPECT_EQ(idx.total_bytes_compact(),8);
+
+    idx.reset();
+    EXPECT_EQ(idx.number_of_leaves(),0);
+    EXPECT_TRUE(idx.leaves() == NULL);
+    EXPECT_FALSE(idx.refresh());
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_leaf_index, iterator)
+{
+    Node n;
+    n["a"] = (int32)1;
+    n["b/c"] = (int32)2;
+    n["b/d"] = (int32)3;
+    n["e"] = (int32)4;
+
+    NodeLeafIndex idx(n);
+    NodeLeafIterator itr(idx);
+
+    const char *paths[] = {"a", "b/c", "b/d", "e"};
+    int32 i = 0;
+    while(itr.has_next())
+    {
+        Node &leaf = itr.next();
+        EXPECT_EQ(itr.index(),i);
+        EXPECT_EQ(itr.path(),paths[i]);
+        EXPECT_EQ(&leaf,&itr.node());
+        EXPECT_EQ(leaf.as_int32(),i+1);
+        i++;
+    }
+    EXPECT_EQ(i,4);
+    EXPECT_THROW(itr.next(),conduit::Error);
+    EXPECT_THROW(itr.peek_next(),conduit::Error);
+
+    itr.to_back();
+    while(itr.has_previous())
+    {
+        i--;
+        EXPECT_EQ(itr.peek_previous().as_int32(),i+1);
+        Node &leaf = itr.previous();
+        EXPECT_EQ(itr.path(),paths[i]);
+        EXPECT_EQ(leaf.as_int32(),i+1);
+    }
+    EXPECT_EQ(i,0);
+    EXPECT_THROW(itr.previous(),conduit::Error);
+
+    itr.to_front();
+    EXPECT_EQ(itr.peek_next().as_int32(),1);
+
+    NodeLeafIterator itr_cpy;
+    EXPECT_FALSE(itr_cpy.has_next());
+    itr_cpy = itr;
+    EXPECT_EQ(itr_cpy.next().as_int32(),1);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_leaf_index, refresh)
+{
+    Node n;
+    n["a"].set(DataType::float64(4));
+    n["b"].set(DataType::int32(2));
+
+    NodeLeafIndex idx(n);
+    EXPECT_EQ(idx.total_bytes_compact(),40);
+
+    // same structure, new data pointer
+    float64 vals[4] = {1.0, 2.0, 3.0, 4.0};
+    n["a"].set_external(vals,4);
+    EXPECT_FALSE(idx.refresh());
+    EXPECT_EQ(idx.leaf(0).data,(void*)vals);
+
+    // new dtype
+    n["a"].set(DataType::float32(4));
+    EXPECT_TRUE(idx.refresh());
+    EXPECT_EQ(idx.leaf(0).dtype.id(),DataType::FLOAT32_ID);
+    EXPECT_EQ(idx.leaf(1).offset,16);
+    EXPECT_EQ(idx.total_bytes_compact(),24);
+
+    // new leaf
+    n["c/d"] = (uint8)1;
+    EXPECT_TRUE(idx.refresh());
+    EXPECT_EQ(idx.number_of_leaves(),3);
+    EXPECT_EQ(idx.path(2),"c/d");
+
+    // same schema, but a new node
+    n.remove("b");
+    n["b"].set(DataType::int32(2));
+    EXPECT_TRUE(idx.refresh());
+    EXPECT_EQ(idx.path(1),"c/d");
+    EXPECT_EQ(idx.path(2),"b");
+    EXPECT_EQ(idx.leaf(2).node,n.fetch_ptr("b"));
+
+    EXPECT_FALSE(idx.refresh());
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_leaf_index, partition)
+{
+    Node n;
+    // leaves of 8, 8, 80, 8, 8 bytes
+    n["a"] = (int64)0;
+    n["b"] = (int64)1;
+    n["c"].set(DataType::int64(10));
+    n["d"] = (int64)3;
+    n["e"] = (int64)4;
+
+    NodeLeafIndex idx(n);
+    std::vector<index_t> starts;
+
+    idx.partition(1,starts);
+    EXPECT_EQ(starts.size(),2);
+    EXPECT_EQ(starts[0],0);
+    EXPECT_EQ(starts[1],5);
+
+    idx.partition(2,starts);
+    EXPECT_EQ(starts.size(),3);
+    EXPECT_EQ(starts[0],0);
+    EXPECT_EQ(starts[1],3);
+    EXPECT_EQ(starts[2],5);
+
+    // more parts than leaves, some are empty
+    idx.partition(8,starts);
+    EXPECT_EQ(starts.size(),9);
+    EXPECT_EQ(starts[0],0);
+    EXPECT_EQ(starts[8],5);
+    for(size_t i=1; i < starts.size(); i++)
+    {
+        EXPECT_TRUE(starts[i-1] <= starts[i]);
+    }
+
+    EXPECT_THROW(idx.partition(0,starts),conduit::Error);
+
+    NodeLeafIndex idx_empty;
+    idx_empty.partition(3,starts);
+    EXPECT_EQ(starts.size(),4);
+    EXPECT_EQ(starts[3],0);
+}
+
+//-----------------------------------------------------------------------------
+float64
+sum_leaves_recursive(const Node &n)
+{
+    float64 res = 0.0;
+    if(n.dtype().is_object() || n.dtype().is_list())
+    {
+        NodeConstIterator itr = n.children();
+        while(itr.has_next())
+        {
+            res += sum_leaves_recursive(itr.next());
+        }
+    }
+    else if(n.dtype().is_float64())
+    {
+        float64_array vals = n.value();
+        for(index_t i=0; i < vals.number_of_elements(); i++)
+        {
+            res += vals[i];
+        }
+    }
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_leaf_index, benchmark_leaf_loop)
+{
+    // many small leaves, where the walk dominates
+    Node n;
+    index_t num_domains = 1000;
+    for(index_t d=0; d < num_domains; d++)
+    {
+        std::ostringstream oss;
+        oss << "domain_" << d << "/fields/";
+        for(index_t f=0; f < 8; f++)
+        {
+            std::ostringstream oss_f;
+            oss_f << oss.str() << "f" << f;
+            n[oss_f.str()].set(DataType::float64(4));
+            float64_array vals = n[oss_f.str()].value();
+            for(index_t i=0; i < 4; i++)
+            {
+                vals[i] = 1.0;
+            }
+        }
+    }
+
+    int num_iters = 50;
+
+    std::clock_t start = std::clock();
+    float64 walk_res = 0.0;
+    for(int it=0; it < num_iters; it++)
+    {
+        walk_res += sum_leaves_recursive(n);
+    }
+    double walk_secs = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    start = std::clock();
+    NodeLeafIndex idx(n);
+    double build_secs = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    start = std::clock();
+    for(int it=0; it < num_iters; it++)
+    {
+        idx.refresh();
+    }
+    double refresh_secs = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    start = std::clock();
+    float64 idx_res = 0.0;
+    for(int it=0; it < num_iters; it++)
+    {
+        const NodeLeafIndex::Leaf *leaves = idx.leaves();
+        index_t nleaves = idx.number_of_leaves();
+        for(index_t l=0; l < nleaves; l++)
+        {
+            const NodeLeafIndex::Leaf &leaf = leaves[l];
+            if(leaf.dtype.is_float64())
+            {
+                float64_array vals(leaf.data,leaf.dtype);
+                for(index_t i=0; i < vals.number_of_elements(); i++)
+                {
+                    idx_res += vals[i];
+                }
+            }
+        }
+    }
+    double idx_secs = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    EXPECT_EQ(walk_res,idx_res);
+    EXPECT_EQ(walk_res,(float64)(num_domains * 8 * 4 * num_iters));
+
+    std::cout << "[benchmark] " << idx.number_of_leaves() << " leaves x "
+              << num_iters << ": recursive walk " << walk_secs
+              << " s, leaf loop " << idx_secs << " s (build "
+              << build_secs << " s, " << num_iters << " refreshes "
+              << refresh_secs << " s)" << std::endl;
+}
@@ -0,0 +1,270 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2019, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//-----------------------------------------------------------------------------
+///
+/// file: t_conduit_node_memory_stats.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+
+#include <iostream>
+#include <vector>
+#include <ctime>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+// Note: memory_stats() allocates the result node, so allocation counts
+// include the allocations of earlier calls. Tests use tags for exact counts.
+int64
+stat(const std::string &path)
+{
+    Node stats;
+    utils::memory_stats(stats);
+    if(!stats.has_path(path))
+    {
+        return 0;
+    }
+    return stats[path].to_int64();
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_memory_stats, allocations)
+{
+    int64 live   = stat("allocated/live_bytes");
+    int64 allocs = stat("allocated/num_allocations");
+    int64 frees  = stat("allocated/num_frees");
+
+    {
+        Node n;
+        {
+            utils::MemoryTag tag("allocations");
+            n.set(DataType::float64(1000));
+        }
+        EXPECT_EQ(stat("allocated/live_bytes"),live + 8000);
+        EXPECT_EQ(stat("tags/allocations/num_allocations"),1);
+        EXPECT_TRUE(stat("allocated/num_allocations") > allocs);
+        EXPECT_TRUE(stat("allocated/peak_bytes") >= live + 8000);
+
+        n.set(DataType::int32(10));
+        EXPECT_EQ(stat("allocated/live_bytes"),live + 40);
+        EXPECT_EQ(stat("tags/allocations/live_bytes"),0);
+        EXPECT_TRUE(stat("allocated/num_frees") > frees);
+    }
+
+    EXPECT_EQ(stat("allocated/live_bytes"),live);
+
+    // trees built from a schema own one buffer
+    Schema s;
+    s["a"].set(DataType::int64(100));
+    s["b"].set(DataType::float32(50,800));
+    {
+        Node n(s);
+        EXPECT_EQ(stat("allocated/live_bytes"),live + 1000);
+        // copies of leaves
+        Node n_a(n["a"]);
+        EXPECT_EQ(stat("allocated/live_bytes"),live + 1800);
+    }
+    EXPECT_EQ(stat("allocated/live_bytes"),live);
+
+    // buffers handed to nodes while parsing
+    {
+        Generator g("{\"a\": [1, 2, 3, 4], \"b\": 5.0}","json");
+        Node n;
+        g.walk(n);
+        EXPECT_EQ(n["a"].dtype().number_of_elements(),4);
+        EXPECT_TRUE(stat("allocated/live_bytes") > live);
+    }
+    EXPECT_EQ(stat("allocated/live_bytes"),live);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_memory_stats, peak_and_reset)
+{
+    utils::reset_memory_stats();
+    Node stats;
+    utils::memory_stats(stats);
+    int64 live = stats["allocated/live_bytes"].to_int64();
+    EXPECT_EQ(stats["allocated/peak_bytes"].to_int64(),live);
+    EXPECT_EQ(stats["allocated/num_allocations"].to_int64(),0);
+    EXPECT_EQ(stats["allocated/num_frees"].to_int64(),0);
+    stats.reset();
+
+    {
+        Node n(DataType::uint8(1024 * 1024));
+    }
+    EXPECT_EQ(stat("allocated/live_bytes"),live);
+    EXPECT_EQ(stat("allocated/peak_bytes"),live + 1024 * 1024);
+
+    // histogram, 1 MiB is in the [2^20, 2^21) bucket
+    utils::memory_stats(stats);
+    int64_array min_bytes = stats["histogram/min_bytes"].value();
+    int64_array counts    = stats["histogram/num_allocations"].value();
+    EXPECT_EQ(min_bytes.number_of_elements(),21);
+    EXPECT_EQ(min_bytes[20],1024 * 1024);
+    EXPECT_EQ(counts[20],1);
+    EXPECT_EQ(min_bytes[0],0);
+    EXPECT_EQ(min_bytes[1],2);
+
+    stats.reset();
+    utils::reset_memory_stats();
+    utils::memory_stats(stats);
+    EXPECT_EQ(stats["allocated/peak_bytes"].to_int64(),live);
+    EXPECT_EQ(stats["histogram/min_bytes"].dtype().number_of_elements(),0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_memory_stats, mmap)
+{
+    Node n(DataType::float64(512));
+    n.save("tout_memory_stats_mmap.conduit_bin");
+
+    int64 live = stat("mmaped/live_bytes");
+    int64 maps = stat("mmaped/num_maps");
+    {
+        Node n_mmap;
+        n_mmap.mmap("tout_memory_stats_mmap.conduit_bin");
+        EXPECT_EQ(stat("mmaped/live_bytes"),live + 4096);
+        EXPECT_EQ(stat("mmaped/num_maps"),maps + 1);
+    }
+    EXPECT_EQ(stat("mmaped/live_bytes"),live);
+    EXPECT_TRUE(stat("mmaped/peak_bytes") >= live + 4096);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_memory_stats, tags)
+{
+    Node n_mesh;
+    Node n_io;
+    {
+        utils::MemoryTag tag("mesh");
+        n_mesh["coords"].set(DataType::float64(100));
+        {
+            utils::MemoryTag io_tag("io");
+            n_io.set(DataType::int8(10));
+        }
+        n_mesh["extra"].set(DataType::int32(4));
+    }
+
+    // the bytes stay with a tag until they are freed
+    EXPECT_EQ(stat("tags/mesh/live_bytes"),816);
+    EXPECT_EQ(stat("tags/io/live_bytes"),10);
+    EXPECT_EQ(stat("tags/io/num_allocations"),1);
+
+    n_mesh.reset();
+    EXPECT_EQ(stat("tags/mesh/live_bytes"),0);
+    EXPECT_EQ(stat("tags/mesh/peak_bytes"),816);
+    EXPECT_EQ(stat("tags/io/live_bytes"),10);
+
+    // shared buffers are counted once, under the tag they were 
+    // allocated with
+    {
+        Node n_shared;
+        {
+            utils::MemoryTag tag("mesh");
+            n_mesh.set(DataType::float64(100));
+        }
+        n_shared.set_shared(n_mesh);
+        n_mesh.reset();
+        EXPECT_EQ(stat("tags/mesh/live_bytes"),800);
+
+        // copy-on-write copies are counted as new allocations
+        int64 live = stat("allocated/live_bytes");
+        Node n_copy(n_shared);
+        n_copy.set(DataType::float64(100));
+        EXPECT_EQ(stat("allocated/live_bytes"),live + 800);
+    }
+    EXPECT_EQ(stat("tags/mesh/live_bytes"),0);
+
+    Node about_info;
+    about(about_info);
+    EXPECT_TRUE(about_info.has_path("memory/allocated/live_bytes"));
+    EXPECT_TRUE(about_info.has_path("memory/tags/io"));
+}
+
+//-----------------------------------------------------------------------------
+void
+alloc_task(index_t task, void *)
+{
+    // tags are per thread
+    utils::MemoryTag tag("tasks");
+    for(int i=0; i < 100; i++)
+    {
+        Node n(DataType::float64(task + i));
+        Node n2(n);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_memory_stats, threads)
+{
+    int64 live = stat("allocated/live_bytes");
+
+    set_num_threads(4);
+    parallel_for(64,alloc_task,NULL);
+    set_num_threads(1);
+
+    EXPECT_EQ(stat("allocated/live_bytes"),live);
+    EXPECT_EQ(stat("tags/tasks/live_bytes"),0);
+    // two allocations per loop, except for the copy of task 0's first 
+    // (empty) array, which doesn't allocate
+    EXPECT_EQ(stat("tags/tasks/num_allocations"),64 * 200 - 1);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_memory_stats, benchmark_allocate)
+{
+    int nruns = 200000;
+    std::clock_t start = std::clock();
+    for(int i=0; i < nruns; i++)
+    {
+        Node n(DataType::float64(16));
+    }
+    double secs = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    std::cout << "[benchmark] allocate and free a 128 byte leaf: "
+              << (secs / nruns) * 1e9 << " ns" << std::endl;
+}
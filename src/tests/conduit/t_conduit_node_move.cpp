@@ -0,0 +1,245 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2019, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//-----------------------------------------------------------------------------
+///
+/// file: t_conduit_node_move.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+
+#include <iostream>
+#include <cstdlib>
+#include <vector>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+// counting allocator used to check that swaps and moves don't
+// allocate new data buffers
+//-----------------------------------------------------------------------------
+static index_t num_allocs = 0;
+
+//-----------------------------------------------------------------------------
+void *
+counting_allocate(size_t num_items, size_t item_size)
+{
+    num_allocs++;
+    return calloc(num_items, item_size);
+}
+
+//-----------------------------------------------------------------------------
+void
+counting_free(void *data_ptr)
+{
+    free(data_ptr);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_move, schema_swap)
+{
+    Schema s1;
+    s1["a"].set(DataType::int32());
+    s1["b/c"].set(DataType::float64(10));
+
+    Schema s2(DataType::float32(4));
+
+    const Schema *s1_a = s1.child_ptr(0);
+
+    s1.swap(s2);
+
+    EXPECT_EQ(s1.dtype().id(),DataType::FLOAT32_ID);
+    EXPECT_EQ(s1.number_of_children(),0);
+    EXPECT_TRUE(s2.dtype().is_object());
+    EXPECT_TRUE(s2.has_path("b/c"));
+
+    // children are not copied, and now point to the new parent
+    EXPECT_EQ(s2.child_ptr(0),s1_a);
+    EXPECT_EQ(s2["a"].parent(),&s2);
+    EXPECT_EQ(s2["b"].parent(),&s2);
+    EXPECT_EQ(s2["b/c"].path(),"b/c");
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_move, node_swap)
+{
+    index_t alloc_id = utils::register_allocator(counting_allocate,
+                                                 counting_free);
+    Node n1;
+    n1.set_allocator(alloc_id);
+    n1["a"].set(DataType::float64(1000));
+    n1["b/c"].set(DataType::int32(100));
+    n1["b/c"].as_int32_ptr()[10] = 42;
+
+    Node n2;
+    n2.set_allocator(alloc_id);
+    n2.set(DataType::uint8(10));
+
+    void *n1_a_ptr  = n1["a"].data_ptr();
+    void *n1_bc_ptr = n1["b/c"].data_ptr();
+    void *n2_ptr    = n2.data_ptr();
+    Node *n1_b      = &n1["b"];
+
+    num_allocs = 0;
+    n1.swap(n2);
+    EXPECT_EQ(num_allocs,0);
+
+    EXPECT_EQ(n1.dtype().id(),DataType::UINT8_ID);
+    EXPECT_EQ(n1.data_ptr(),n2_ptr);
+    EXPECT_EQ(n1.number_of_children(),0);
+
+    EXPECT_EQ(n2["a"].data_ptr(),n1_a_ptr);
+    EXPECT_EQ(n2["b/c"].data_ptr(),n1_bc_ptr);
+    EXPECT_EQ(n2["b/c"].as_int32_ptr()[10],42);
+    EXPECT_EQ(&n2["b"],n1_b);
+    EXPECT_EQ(n2["b"].parent(),&n2);
+    EXPECT_EQ(n2["b"].schema().parent(),n2.schema_ptr());
+    EXPECT_EQ(num_allocs,0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_move, move_into_child_slot)
+{
+    index_t alloc_id = utils::register_allocator(counting_allocate,
+                                                 counting_free);
+    Node mesh;
+    mesh["coordsets/coords/type"] = "uniform";
+
+    Node field;
+    field.set_allocator(alloc_id);
+    field["association"] = "element";
+    field["values"].set(DataType::float64(10000));
+    field["values"].as_float64_ptr()[0] = 3.14;
+
+    void *vals_ptr = field["values"].data_ptr();
+
+    num_allocs = 0;
+    mesh["fields/pressure"].move(field);
+    EXPECT_EQ(num_allocs,0);
+
+    // the subtree is in place, without copying
+    Node &pressure = mesh["fields/pressure"];
+    EXPECT_EQ(pressure["values"].data_ptr(),vals_ptr);
+    EXPECT_EQ(pressure["values"].as_float64_ptr()[0],3.14);
+    EXPECT_EQ(pressure["association"].as_string(),"element");
+    EXPECT_EQ(pressure["values"].path(),"fields/pressure/values");
+    EXPECT_EQ(pressure.parent(),&mesh["fields"]);
+    EXPECT_EQ(pressure.schema().parent(),mesh["fields"].schema_ptr());
+    EXPECT_TRUE(mesh.schema().has_path("fields/pressure/values"));
+
+    // the source is left empty and usable
+    EXPECT_TRUE(field.dtype().is_empty());
+    EXPECT_EQ(field.number_of_children(),0);
+    field["x"] = 1;
+    EXPECT_EQ(field["x"].to_int64(),1);
+
+    // copies of the tree still work
+    Node mesh_copy(mesh);
+    EXPECT_EQ(mesh_copy["fields/pressure/values"].as_float64_ptr()[0],3.14);
+}
+
+#ifdef CONDUIT_HAS_MOVE_SEMANTICS
+//-----------------------------------------------------------------------------
+Node
+make_field(index_t alloc_id, void *&vals_ptr)
+{
+    Node res;
+    res.set_allocator(alloc_id);
+    res["values"].set(DataType::float64(1000));
+    vals_ptr = res["values"].data_ptr();
+    return res;
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_move, move_construct_and_assign)
+{
+    index_t alloc_id = utils::register_allocator(counting_allocate,
+                                                 counting_free);
+    void *vals_ptr = NULL;
+
+    num_allocs = 0;
+    Node n(make_field(alloc_id, vals_ptr));
+    EXPECT_EQ(num_allocs,1);
+    EXPECT_EQ(n["values"].data_ptr(),vals_ptr);
+    EXPECT_EQ(n["values"].parent(),&n);
+
+    num_allocs = 0;
+    Node n2;
+    n2["other"] = 10;
+    n2 = std::move(n);
+    EXPECT_EQ(num_allocs,0);
+    EXPECT_EQ(n2["values"].data_ptr(),vals_ptr);
+    EXPECT_FALSE(n2.has_child("other"));
+    EXPECT_TRUE(n.dtype().is_empty());
+
+    // move into a child slot
+    Node mesh;
+    mesh["fields/f"] = std::move(n2);
+    EXPECT_EQ(num_allocs,0);
+    EXPECT_EQ(mesh["fields/f/values"].data_ptr(),vals_ptr);
+
+    // vectors of nodes
+    std::vector<Node> nodes;
+    for(int i=0; i < 8; i++)
+    {
+        nodes.push_back(make_field(alloc_id, vals_ptr));
+    }
+    num_allocs = 0;
+    nodes.reserve(128);
+    EXPECT_EQ(num_allocs,0);
+    EXPECT_EQ(nodes[7]["values"].data_ptr(),vals_ptr);
+    EXPECT_EQ(nodes[7]["values"].parent(),&nodes[7]);
+
+    // schema moves
+    Schema s;
+    s["a/b"].set(DataType::int64());
+    Schema s2(std::move(s));
+    EXPECT_TRUE(s2.has_path("a/b"));
+    EXPECT_TRUE(s.dtype().is_empty());
+    s = std::move(s2);
+    EXPECT_TRUE(s.has_path("a/b"));
+    EXPECT_EQ(s["a"].parent(),&s);
+}
+#endif
@@ -0,0 +1,340 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2019, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//-----------------------------------------------------------------------------
+///
+/// file: t_conduit_node_parallel.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+
+#include <iostream>
+#include <sstream>
+#include <vector>
+#include <chrono>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+// restores serial settings when a test ends
+struct ScopedThreads
+{
+    ScopedThreads(index_t num_threads, index_t min_bytes)
+    {
+        set_num_threads(num_threads);
+        set_parallel_min_bytes(min_bytes);
+    }
+    ~ScopedThreads()
+    {
+        set_num_threads(1);
+        set_parallel_min_bytes(1024 * 1024);
+    }
+};
+
+//-----------------------------------------------------------------------------
+void
+add_task(index_t task, void *ctx)
+{
+    std::vector<index_t> &vals = *(std::vector<index_t>*)ctx;
+    vals[(size_t)task] += task;
+}
+
+//-----------------------------------------------------------------------------
+void
+nested_task(index_t task, void *ctx)
+{
+    std::vector<index_t> &vals = *(std::vector<index_t>*)ctx;
+    // runs serially inside the task
+    std::vector<index_t> inner(4,0);
+    parallel_for(4,add_task,&inner);
+    vals[(size_t)task] = inner[0] + inner[1] + inner[2] + inner[3];
+}
+
+//-----------------------------------------------------------------------------
+void
+error_task(index_t task, void *)
+{
+    if(task == 7)
+    {
+        CONDUIT_ERROR("task " << task << " failed");
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_parallel, thread_pool)
+{
+    EXPECT_EQ(num_threads(),1);
+    EXPECT_EQ(parallel_min_bytes(),1024 * 1024);
+
+    ScopedThreads threads(4,0);
+    EXPECT_EQ(num_threads(),4);
+
+    Node n;
+    about(n);
+    EXPECT_EQ(n["num_threads"].to_index_t(),4);
+
+    for(int run = 0; run < 10; run++)
+    {
+        std::vector<index_t> vals(1000,1);
+        parallel_for(1000,add_task,&vals);
+        for(index_t i = 0; i < 1000; i++)
+        {
+            EXPECT_EQ(vals[(size_t)i],i + 1);
+        }
+    }
+
+    std::vector<index_t> vals(16,0);
+    parallel_for(16,nested_task,&vals);
+    EXPECT_EQ(vals[15],6);
+
+    EXPECT_THROW(parallel_for(100,error_task,NULL),conduit::Error);
+    // the pool is still usable after an error
+    parallel_for(16,nested_task,&vals);
+    parallel_for(0,add_task,&vals);
+
+    set_num_threads(0);
+    EXPECT_TRUE(num_threads() >= 1);
+    set_num_threads(2);
+    EXPECT_EQ(num_threads(),2);
+    parallel_for(16,nested_task,&vals);
+}
+
+//-----------------------------------------------------------------------------
+void
+build_tree(Node &n, index_t num_ele)
+{
+    n.reset();
+    n["coords/x"].set(DataType::float64(num_ele));
+    n["coords/y"].set(DataType::float64(num_ele));
+    float64_array x = n["coords/x"].value();
+    float64_array y = n["coords/y"].value();
+    for(index_t i = 0; i < num_ele; i++)
+    {
+        x[i] = (float64)i;
+        y[i] = 0.5 * (float64)i;
+    }
+    n["ids"].set(DataType::int32(3 * num_ele));
+    int32_array ids = n["ids"].value();
+    for(index_t i = 0; i < 3 * num_ele; i++)
+    {
+        ids[i] = (int32)i;
+    }
+    // interleaved (strided) leaves
+    n["xy"].set(DataType::float64(2 * num_ele));
+    float64_array xy = n["xy"].value();
+    for(index_t i = 0; i < 2 * num_ele; i++)
+    {
+        xy[i] = (float64)(2 * num_ele - i);
+    }
+    n["sx"].set_external(DataType::float64(num_ele,0,16),
+                         n["xy"].data_ptr());
+    n["sy"].set_external(DataType::float64(num_ele,8,16),
+                         n["xy"].data_ptr());
+    n["name"] = "parallel";
+    n["list"].append() = (int64) 1;
+    n["list"].append().set(DataType::uint8(num_ele));
+    n["list"].append();
+    n["empty"];
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_parallel, copy_ops)
+{
+    Node n;
+    build_tree(n,100000);
+
+    // serial results
+    Node s_set, s_compact, s_update, info;
+    s_set.set(n);
+    n.compact_to(s_compact);
+    s_update["ids"].set(DataType::int32(10));
+    s_update.update(n);
+
+    ScopedThreads threads(4,0);
+
+    Node p_set;
+    p_set.set(n);
+    EXPECT_FALSE(s_set.diff(p_set,info,0.0));
+    EXPECT_EQ(p_set.to_json(),s_set.to_json());
+
+    // set_node into a node with the same layout reuses its buffer
+    Node p_compact;
+    n.compact_to(p_compact);
+    EXPECT_FALSE(s_compact.diff(p_compact,info,0.0));
+    EXPECT_TRUE(p_compact.is_compact());
+    void *p_compact_data = p_compact.data_ptr();
+    p_compact.set(s_compact);
+    EXPECT_EQ(p_compact.data_ptr(),p_compact_data);
+    EXPECT_FALSE(s_compact.diff(p_compact,info,0.0));
+
+    Node p_update;
+    p_update["ids"].set(DataType::int32(10));
+    p_update.update(n);
+    EXPECT_FALSE(s_update.diff(p_update,info,0.0));
+
+    // update with compatible leaves copies in place
+    Node n2;
+    build_tree(n2,100000);
+    n2["coords/x"].as_float64_ptr()[5] = -5.0;
+    n2["sy"].as_float64_array()[17] = -17.0;
+    p_update.update(n2);
+    EXPECT_EQ(p_update["coords/x"].as_float64_ptr()[5],-5.0);
+    EXPECT_EQ(p_update["sy"].as_float64_ptr()[17],-17.0);
+    EXPECT_FALSE(n2.diff(p_update,info,0.0));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_parallel, diff)
+{
+    Node n_a, n_b;
+    build_tree(n_a,50000);
+    build_tree(n_b,50000);
+    n_b["coords/y"].as_float64_ptr()[100] = -1.0;
+    n_b["list"][1].as_uint8_ptr()[3] = 9;
+    n_b.remove_child("name");
+    n_b["extra"] = 1;
+    n_b["ids"].set(DataType::int64(10));
+
+    Node s_info, p_info;
+    bool s_res = n_a.diff(n_b,s_info,0.0);
+    EXPECT_TRUE(s_res);
+    EXPECT_FALSE(n_a.diff(n_a,s_info,0.0));
+    s_res = n_a.diff(n_b,s_info,0.0);
+
+    ScopedThreads threads(4,0);
+    bool p_res = n_a.diff(n_b,p_info,0.0);
+    EXPECT_EQ(s_res,p_res);
+    EXPECT_EQ(s_info.to_json(),p_info.to_json());
+
+    Node p_same;
+    EXPECT_FALSE(n_a.diff(n_a,p_same,0.0));
+    EXPECT_EQ(p_same["valid"].as_string(),"true");
+
+    // differences limited to a leaf are reported up to the root
+    Node n_c;
+    n_c.set(n_a);
+    n_c["coords/x"].as_float64_ptr()[99] = 1e10;
+    EXPECT_TRUE(n_a.diff(n_c,p_info,0.0));
+    EXPECT_EQ(p_info["valid"].as_string(),"false");
+    EXPECT_EQ(p_info["children/diff/coords/valid"].as_string(),"false");
+    EXPECT_EQ(p_info["children/diff/ids/valid"].as_string(),"true");
+
+    // info trees that use an (unsynchronized) arena allocator
+    index_t arena_id = utils::create_arena_allocator();
+    Node a_info;
+    a_info.set_allocator(arena_id);
+    p_res = n_a.diff(n_b,a_info,0.0);
+    EXPECT_EQ(s_res,p_res);
+    EXPECT_EQ(s_info.to_json(),a_info.to_json());
+    a_info.reset();
+    utils::destroy_arena_allocator(arena_id);
+}
+
+//-----------------------------------------------------------------------------
+double
+elapsed_secs(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() -
+                                         start).count();
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_parallel, benchmark_scaling)
+{
+    // 64 leaves of 256k float64 (128 MiB), plus a strided leaf
+    index_t num_fields = 64;
+    index_t num_ele = 256 * 1024;
+    Node n;
+    for(index_t f = 0; f < num_fields; f++)
+    {
+        std::ostringstream oss;
+        oss << "fields/f" << f;
+        n[oss.str()].set(DataType::float64(num_ele));
+        float64_array vals = n[oss.str()].value();
+        for(index_t i = 0; i < num_ele; i++)
+        {
+            vals[i] = (float64)(f + i);
+        }
+    }
+    n["strided"].set_external(DataType::float64(num_ele / 2, 0, 16),
+                              n["fields/f0"].data_ptr());
+
+    Node n_other;
+    n_other.set(n);
+
+    index_t thread_counts[] = {1, 2, 4, 8};
+    for(int t = 0; t < 4; t++)
+    {
+        ScopedThreads threads(thread_counts[t],1024 * 1024);
+
+        std::chrono::steady_clock::time_point start =
+            std::chrono::steady_clock::now();
+        Node n_set;
+        n_set.set(n);
+        double set_secs = elapsed_secs(start);
+
+        start = std::chrono::steady_clock::now();
+        Node n_compact;
+        n.compact_to(n_compact);
+        double compact_secs = elapsed_secs(start);
+
+        start = std::chrono::steady_clock::now();
+        n_set.update(n_other);
+        double update_secs = elapsed_secs(start);
+
+        start = std::chrono::steady_clock::now();
+        Node info;
+        bool res = n.diff(n_compact,info,0.0);
+        double diff_secs = elapsed_secs(start);
+        EXPECT_FALSE(res);
+
+        std::cout << "[benchmark] " << thread_counts[t] << " thread(s), "
+                  << n.total_bytes_compact() / (1024 * 1024) << " MiB: "
+                  << "set " << set_secs << " s, "
+                  << "compact_to " << compact_secs << " s, "
+                  << "update " << update_secs << " s, "
+                  << "diff " << diff_secs << " s (wall time)" << std::endl;
+    }
+}
@@ -53,6 +53,8 @@
 #include <vector>
 #include <string>
 #include <iostream>
+#include <ctime>
+#include <sstream>
 #include "gtest/gtest.h"
 
 using namespace conduit;
@@ -155,3 +157,130 @@ TEST(conduit_node_paths, path_empty_slashes)
 
 
 
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_paths, path_parent_and_errors)
+{
+    Node n;
+    n["a/b/c"] = 10;
+    n["a/d"]   = 20;
+
+    EXPECT_EQ(n.fetch_existing("a/b/../d").to_int64(),20);
+    EXPECT_EQ(n["a/b"].fetch_existing("../d").to_int64(),20);
+    EXPECT_EQ(n.fetch_existing("a//b/c/").to_int64(),10);
+
+    const Node &n_const = n;
+    EXPECT_EQ(n_const.fetch_existing("a/b/../d").to_int64(),20);
+    EXPECT_EQ(n_const["/a/b/c"].to_int64(),10);
+
+    EXPECT_THROW(n.fetch_existing("a/bad"),conduit::Error);
+    EXPECT_THROW(n.fetch_existing("a/b/c/d"),conduit::Error);
+    EXPECT_THROW(n.fetch_existing(".."),conduit::Error);
+    EXPECT_THROW(n.fetch_existing(""),conduit::Error);
+    EXPECT_THROW(n.fetch(""),conduit::Error);
+    EXPECT_THROW(n.fetch("/"),conduit::Error);
+
+    EXPECT_TRUE(n.has_path("a/b/c"));
+    EXPECT_FALSE(n.has_path("a/b/c/d"));
+    EXPECT_FALSE(n.has_path("a/e"));
+
+    // schema paths
+    const Schema &s = n.schema();
+    EXPECT_EQ(s.fetch_existing("a/b/c").dtype().id(),DataType::INT32_ID);
+    EXPECT_EQ(s.fetch_existing("a/b/../d").dtype().id(),DataType::INT32_ID);
+    EXPECT_THROW(s.fetch_existing("a/bad"),conduit::Error);
+    EXPECT_TRUE(s.has_path("a/d"));
+    EXPECT_FALSE(s.has_path("a/d/e"));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_paths, node_path)
+{
+    Node n;
+    n["fields/pressure/values"] = 1.0;
+    n["fields/density/values"]  = 2.0;
+
+    NodePath np("fields/pressure/values");
+    EXPECT_EQ(np.number_of_components(),3);
+    EXPECT_EQ(np.path(),"fields/pressure/values");
+
+    EXPECT_TRUE(n.has_path(np));
+    EXPECT_EQ(n.fetch_existing(np).to_float64(),1.0);
+    EXPECT_EQ(&n.fetch_existing(np),&n["fields/pressure/values"]);
+
+    // empty components are ignored, ".." goes to the parent
+    NodePath np_parent("//fields/density/../pressure//values");
+    EXPECT_EQ(np_parent.number_of_components(),5);
+    EXPECT_EQ(&n.fetch_existing(np_parent),&n["fields/pressure/values"]);
+
+    // a second node with a different layout, the cached indices 
+    // won't match and are resolved again
+    Node n2;
+    n2["fields/density/values"]  = 3.0;
+    n2["fields/pressure/values"] = 4.0;
+    EXPECT_EQ(n2.fetch_existing(np).to_float64(),4.0);
+    EXPECT_EQ(n.fetch_existing(np).to_float64(),1.0);
+
+    // changes to the tree are picked up
+    n["fields"].remove("pressure");
+    EXPECT_FALSE(n.has_path(np));
+    EXPECT_TRUE(np.find(n) == NULL);
+    EXPECT_THROW(n.fetch_existing(np),conduit::Error);
+
+    n["fields/pressure/values"] = 5.0;
+    EXPECT_EQ(n.fetch_existing(np).to_float64(),5.0);
+
+    const Node &n_const = n;
+    EXPECT_EQ(n_const.fetch_existing(np).to_float64(),5.0);
+
+    // non-object in the middle of the path
+    NodePath np_bad("fields/pressure/values/more");
+    EXPECT_FALSE(n.has_path(np_bad));
+    EXPECT_THROW(n.fetch_existing(np_bad),conduit::Error);
+
+    NodePath np_empty;
+    EXPECT_THROW(n.fetch_existing(np_empty),conduit::Error);
+
+    np_empty.set("fields/density");
+    EXPECT_EQ(&n.fetch_existing(np_empty),&n["fields/density"]);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_paths, benchmark_fetch_paths)
+{
+    Node n;
+    for(int i=0; i < 32; i++)
+    {
+        std::ostringstream oss;
+        oss << "fields/field_" << i << "/values";
+        n[oss.str()] = (float64) i;
+    }
+
+    std::string path = "fields/field_31/values";
+    NodePath np(path);
+    int num_reps = 200000;
+    float64 sum = 0.0;
+
+    std::clock_t start = std::clock();
+    for(int i=0; i < num_reps; i++)
+    {
+        sum += n.fetch_existing(path).as_float64();
+    }
+    double str_secs = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    start = std::clock();
+    for(int i=0; i < num_reps; i++)
+    {
+        sum += n.fetch_existing(np).as_float64();
+    }
+    double np_secs = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    EXPECT_EQ(sum, 31.0 * num_reps * 2);
+
+    std::cout << "[benchmark] " << num_reps 
+              << " fetch_existing(std::string): " << str_secs << " s"
+              << std::endl;
+    std::cout << "[benchmark] " << num_reps 
+              << " fetch_existing(NodePath): " << np_secs << " s"
+              << std::endl;
+}
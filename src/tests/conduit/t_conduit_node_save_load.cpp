@@ -51,6 +51,9 @@
 #include "conduit.hpp"
 
 #include <iostream>
+#include <sstream>
+#include <fstream>
+#include <ctime>
 #include "gtest/gtest.h"
 
 
@@ -245,6 +248,161 @@ TEST(conduit_node_save_load, mmap_simple_file)
     delete [] data;
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_node_save_load, bin_schema_protocols)
+{
+    Node nsrc;
+    nsrc["a"] = (int32) 10;
+    nsrc["b"].set(DataType::float64(4));
+    float64_array b_vals = nsrc["b"].value();
+    for(index_t i=0; i < 4; i++)
+    {
+        b_vals[i] = 0.5 * i;
+    }
+    nsrc["c/d"] = "string value";
+
+    std::string path = "tout_conduit_bin_schema_protocols.conduit_bin";
+
+    Node opts;
+    opts["schema_protocol"] = "binary";
+    nsrc.save(path,"conduit_bin",opts);
+
+    EXPECT_TRUE(utils::is_file(path + "_schema_bin"));
+    EXPECT_FALSE(utils::is_file(path + "_json"));
+
+    Node n, info;
+    n.load(path);
+    EXPECT_FALSE(nsrc.diff(n,info,0.0));
+
+    Node nmmap;
+    nmmap.mmap(path);
+    EXPECT_FALSE(nsrc.diff(nmmap,info,0.0));
+    nmmap.reset();
+
+    // switching back to json removes the stale binary schema
+    nsrc["a"] = (int32) 20;
+    nsrc.save(path);
+
+    EXPECT_TRUE(utils::is_file(path + "_json"));
+    EXPECT_FALSE(utils::is_file(path + "_schema_bin"));
+
+    n.load(path);
+    EXPECT_EQ(n["a"].as_int32(), 20);
+
+    opts["schema_protocol"] = "xml";
+    EXPECT_THROW(nsrc.save(path,"conduit_bin",opts),conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_save_load, bin_checksum)
+{
+    Node nsrc;
+    nsrc["a"] = (int32) 10;
+    nsrc["b"].set(DataType::float64(4));
+    float64_array b_vals = nsrc["b"].value();
+    for(index_t i=0; i < 4; i++)
+    {
+        b_vals[i] = 0.5 * i;
+    }
+
+    std::string path = "tout_conduit_bin_checksum.conduit_bin";
+
+    Node opts;
+    opts["checksum"] = "crc32c";
+    nsrc.save(path,"conduit_bin",opts);
+    EXPECT_TRUE(utils::is_file(path + "_checksum"));
+
+    Node n, info;
+    n.load(path);
+    EXPECT_FALSE(nsrc.diff(n,info,0.0));
+
+    opts["checksum"] = "xxhash64";
+    nsrc.save(path,"conduit_bin",opts);
+    n.load(path);
+    EXPECT_FALSE(nsrc.diff(n,info,0.0));
+
+    // corrupt a byte of the data
+    {
+        std::fstream fs(path.c_str(),
+                        std::ios::in | std::ios::out | std::ios::binary);
+        fs.seekp(6);
+        fs.put((char)0x7F);
+    }
+    EXPECT_THROW(n.load(path),conduit::Error);
+
+    // lazy loads don't verify
+    Node n_lazy;
+    n_lazy.load_lazy(path);
+    EXPECT_EQ(n_lazy["a"].as_int32(), 10);
+    n_lazy.reset();
+
+    // saving without a checksum removes the stale checksum file
+    nsrc.save(path);
+    EXPECT_FALSE(utils::is_file(path + "_checksum"));
+    n.load(path);
+    EXPECT_FALSE(nsrc.diff(n,info,0.0));
+
+    opts["checksum"] = "md5";
+    EXPECT_THROW(nsrc.save(path,"conduit_bin",opts),conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_save_load, bin_load_endianness)
+{
+    index_t other = Endianness::machine_is_little_endian() ?
+                    Endianness::BIG_ID : Endianness::LITTLE_ID;
+
+    Node nsrc;
+    nsrc["a"] = (int32) 10;
+    nsrc["b"].set(DataType::float64(100));
+    nsrc["c"] = "string";
+    float64_array b_vals = nsrc["b"].value();
+    for(index_t i=0; i < 100; i++)
+    {
+        b_vals[i] = 0.5 * i;
+    }
+
+    // data saved on a machine with the other endianness
+    Node n_other;
+    nsrc.endian_swap_to(n_other,other);
+    std::string path = "tout_conduit_bin_load_endianness.conduit_bin";
+    Node opts;
+    opts["checksum"] = "crc32c";
+    n_other.save(path,"conduit_bin",opts);
+
+    // by default the data keeps its endianness
+    Node n;
+    n.load(path);
+    EXPECT_EQ(n["b"].dtype().endianness(),other);
+
+    Node load_opts;
+    load_opts["endianness"] = "default";
+    n.load(path,"conduit_bin",load_opts);
+    EXPECT_TRUE(n["b"].dtype().endianness_matches_machine());
+    EXPECT_EQ(n["a"].as_int32(),10);
+    EXPECT_EQ(n["b"].as_float64_ptr()[99],49.5);
+    EXPECT_EQ(n["c"].as_string(),"string");
+
+    Node info;
+    EXPECT_FALSE(n.diff(nsrc,info,0.0));
+
+    // already in the requested endianness
+    load_opts["endianness"] = Endianness::id_to_name(other);
+    n.load(path,"conduit_bin",load_opts);
+    EXPECT_EQ(n["b"].dtype().endianness(),other);
+    EXPECT_FALSE(n.diff(n_other,info,0.0));
+
+    // text protocols
+    std::string json_path = "tout_conduit_bin_load_endianness.json";
+    nsrc.save(json_path,"conduit_base64_json");
+    n.load(json_path,"conduit_base64_json",load_opts);
+    EXPECT_EQ(n["b"].dtype().endianness(),other);
+    EXPECT_FALSE(n.diff(n_other,info,0.0));
+
+    load_opts["endianness"] = "middle";
+    EXPECT_THROW(n.load(path,"conduit_bin",load_opts),conduit::Error);
+}
+
 
 //-----------------------------------------------------------------------------
 TEST(conduit_node_save_load, simple_restore)
@@ -506,3 +664,302 @@ TEST(conduit_node_save_load, load_save_array)
 
 
 
+//-----------------------------------------------------------------------------
+TEST(conduit_node_save_load, lazy_load)
+{
+    index_t num_ele = 100000;
+    Node nsrc;
+    nsrc["a"].set(DataType::float64(num_ele));
+    nsrc["b"].set(DataType::int32(num_ele));
+    float64_array a_vals = nsrc["a"].value();
+    int32_array b_vals = nsrc["b"].value();
+    for(index_t i=0; i < num_ele; i++)
+    {
+        a_vals[i] = 0.5 * i;
+        b_vals[i] = (int32)(num_ele - i);
+    }
+    nsrc["c/d"] = "string value";
+    nsrc["c/e"].append() = (int64) 42;
+    nsrc["c/e"].append() = (uint8) 7;
+
+    std::string path = "tout_conduit_lazy_load.conduit_bin";
+    nsrc.save(path);
+
+    Node n, info;
+    n.load_lazy(path);
+    EXPECT_FALSE(nsrc.diff(n,info,0.0));
+
+    n.lazy_load_info(info);
+    info.print();
+    EXPECT_EQ(info["bytes_total"].to_index_t(),
+              nsrc.total_bytes_compact());
+    EXPECT_EQ(info["bytes_prefetched"].to_index_t(),0);
+    EXPECT_EQ(info["num_evicts"].to_index_t(),0);
+    EXPECT_TRUE(info["bytes_resident"].to_index_t() <= 
+                info["bytes_total"].to_index_t());
+
+    // prefetch reads whole pages
+    Node nlazy;
+    nlazy.load_lazy(path);
+    nlazy.prefetch("b");
+    nlazy.lazy_load_info(info);
+    index_t b_nbytes = num_ele * (index_t)sizeof(int32);
+    EXPECT_TRUE(info["bytes_prefetched"].to_index_t() >= b_nbytes);
+    EXPECT_TRUE(info["bytes_prefetched"].to_index_t() <= b_nbytes + 8192);
+
+    std::vector<std::string> paths;
+    paths.push_back("c");
+    paths.push_back("a");
+    // also works from a descendant
+    nlazy["c"].prefetch("e");
+    nlazy.prefetch(paths);
+    int32_array lazy_b_vals = nlazy["b"].value();
+    EXPECT_EQ(lazy_b_vals[10],(int32)(num_ele - 10));
+
+    // modifications stay in memory, evict drops them
+    lazy_b_vals[10] = -1;
+    EXPECT_EQ(nlazy["b"].as_int32_ptr()[10],-1);
+    nlazy.evict();
+    EXPECT_EQ(nlazy["b"].as_int32_ptr()[10],(int32)(num_ele - 10));
+    nlazy.lazy_load_info(info);
+    EXPECT_EQ(info["num_evicts"].to_index_t(),1);
+    EXPECT_FALSE(nsrc.diff(nlazy,info,0.0));
+
+    Node nload;
+    nload.load(path);
+    EXPECT_FALSE(nsrc.diff(nload,info,0.0));
+
+    // errors
+    EXPECT_THROW(nlazy.prefetch("bad"),conduit::Error);
+    EXPECT_THROW(nload.prefetch("a"),conduit::Error);
+    EXPECT_THROW(nload.evict(),conduit::Error);
+    EXPECT_THROW(nlazy.load_lazy("tout_conduit_lazy_load_missing",
+                                 nsrc.schema()),
+                 conduit::Error);
+
+    // file shorter than the schema
+    Schema s_big(nsrc.schema());
+    s_big["a"].set(DataType::float64(2 * num_ele));
+    EXPECT_THROW(nlazy.load_lazy(path,s_big),conduit::Error);
+
+    // empty tree
+    Node nempty;
+    nempty["empty"];
+    nempty.save("tout_conduit_lazy_load_empty.conduit_bin");
+    nlazy.load_lazy("tout_conduit_lazy_load_empty.conduit_bin");
+    nlazy.prefetch("empty");
+    EXPECT_TRUE(nlazy.has_child("empty"));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_save_load, benchmark_lazy_load)
+{
+    // read one field of many
+    index_t num_fields = 64;
+    index_t num_ele = 256 * 1024;
+    Node nsrc;
+    for(index_t f=0; f < num_fields; f++)
+    {
+        std::ostringstream oss;
+        oss << "fields/f" << f;
+        nsrc[oss.str()].set(DataType::float64(num_ele));
+        float64_array vals = nsrc[oss.str()].value();
+        for(index_t i=0; i < num_ele; i++)
+        {
+            vals[i] = (float64)(f + i);
+        }
+    }
+    std::string path = "tout_conduit_benchmark_lazy_load.conduit_bin";
+    nsrc.save(path);
+
+    std::clock_t start = std::clock();
+    Node n;
+    n.load(path);
+    float64 sum = n["fields/f17"].as_float64_array().sum();
+    double load_secs = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    start = std::clock();
+    Node nlazy;
+    nlazy.load_lazy(path);
+    float64 lazy_sum = nlazy["fields/f17"].as_float64_array().sum();
+    double lazy_secs = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    EXPECT_EQ(sum,lazy_sum);
+
+    Node info;
+    nlazy.lazy_load_info(info);
+    std::cout << "[benchmark] read 1 of " << num_fields << " fields ("
+              << num_ele << " float64 each): load " << load_secs << " s, "
+              << "load_lazy " << lazy_secs << " s" << std::endl;
+}
+
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_save_load, mmap_modes)
+{
+    index_t num_ele = 10000;
+    Node nsrc;
+    nsrc["a"].set(DataType::float64(num_ele));
+    nsrc["b"].set(DataType::int32(num_ele));
+    float64_array a_vals = nsrc["a"].value();
+    int32_array b_vals = nsrc["b"].value();
+    for(index_t i=0; i < num_ele; i++)
+    {
+        a_vals[i] = 0.5 * i;
+        b_vals[i] = (int32)i;
+    }
+
+    std::string path = "tout_conduit_mmap_modes.conduit_bin";
+    nsrc.save(path);
+
+    Node opts, info;
+
+    // read only
+    Node nro;
+    opts["mode"] = "ro";
+    nro.mmap(path,opts);
+    EXPECT_FALSE(nsrc.diff(nro,info,0.0));
+    nro.lazy_load_info(info);
+    EXPECT_EQ(info["mode"].as_string(),"ro");
+    EXPECT_EQ(info["offset"].to_index_t(),0);
+
+    // private, changes don't reach the file
+    Node npriv;
+    opts["mode"] = "private";
+    npriv.mmap(path,opts);
+    npriv["b"].as_int32_ptr()[5] = -5;
+    EXPECT_EQ(npriv["b"].as_int32_ptr()[5],-5);
+    // ro map of the same file still sees the original value
+    EXPECT_EQ(nro["b"].as_int32_ptr()[5],5);
+    npriv.evict();
+    EXPECT_EQ(npriv["b"].as_int32_ptr()[5],5);
+
+    // read write, changes are written to the file
+    Node nrw;
+    opts["mode"] = "rw";
+    nrw.mmap(path,opts);
+    nrw["b"].as_int32_ptr()[7] = -7;
+    EXPECT_EQ(nro["b"].as_int32_ptr()[7],-7);
+    nrw.reset();
+    Node nload;
+    nload.load(path);
+    EXPECT_EQ(nload["b"].as_int32_ptr()[7],-7);
+    b_vals[7] = -7;
+
+    // hints
+    opts.reset();
+    opts["mode"]       = "ro";
+    opts["populate"]   = "true";
+    opts["advice"]     = "sequential";
+    opts["huge_pages"] = "true";
+    Node nhint;
+    nhint.mmap(path,opts);
+    EXPECT_FALSE(nsrc.diff(nhint,info,0.0));
+    opts["advice"] = "willneed";
+    nhint.mmap(path,opts);
+    EXPECT_FALSE(nsrc.diff(nhint,info,0.0));
+    nhint.lazy_load_info(info);
+    EXPECT_EQ(info["bytes_resident"].to_index_t(),
+              nsrc.total_bytes_compact());
+
+    // data at an unaligned offset inside a container file
+    std::string header = "container header";
+    std::string cont_path = "tout_conduit_mmap_modes_container.bin";
+    {
+        std::ifstream ifs(path.c_str(), std::ios::binary);
+        std::ofstream ofs(cont_path.c_str(), std::ios::binary);
+        ofs << header;
+        ofs << ifs.rdbuf();
+        ofs << "trailer";
+    }
+
+    // schema of the data as written to the file
+    Schema s_file;
+    nsrc.schema().compact_to(s_file);
+
+    for(int i = 0; i < 3; i++)
+    {
+        const char *modes[] = {"ro","private","rw"};
+        opts.reset();
+        opts["mode"]   = modes[i];
+        opts["offset"] = (int64)header.size();
+        Node ncont;
+        ncont.mmap(cont_path,s_file,opts);
+        EXPECT_FALSE(nsrc.diff(ncont,info,0.0));
+        ncont.prefetch("a");
+        ncont.evict();
+        EXPECT_FALSE(nsrc.diff(ncont,info,0.0));
+        ncont.lazy_load_info(info);
+        EXPECT_EQ(info["offset"].to_index_t(),(index_t)header.size());
+        EXPECT_EQ(info["bytes_total"].to_index_t(),
+                  nsrc.total_bytes_compact());
+    }
+
+    // errors
+    Node nerr;
+    opts.reset();
+    opts["mode"] = "bad";
+    EXPECT_THROW(nerr.mmap(path,opts),conduit::Error);
+    opts.reset();
+    opts["advice"] = "bad";
+    EXPECT_THROW(nerr.mmap(path,opts),conduit::Error);
+    // data would extend past the end of the file
+    opts.reset();
+    opts["offset"] = (int64)(header.size() + 8);
+    EXPECT_THROW(nerr.mmap(cont_path,s_file,opts),conduit::Error);
+    opts["offset"] = -1;
+    EXPECT_THROW(nerr.mmap(cont_path,s_file,opts),conduit::Error);
+    EXPECT_THROW(nerr.mmap("tout_conduit_mmap_modes_missing",
+                           s_file,
+                           opts),
+                 conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_save_load, benchmark_mmap_modes)
+{
+    // cold start: map, then read all of the data once
+    index_t num_ele = 8 * 1024 * 1024;
+    Node nsrc;
+    nsrc["vals"].set(DataType::float64(num_ele));
+    float64_array vals = nsrc["vals"].value();
+    for(index_t i=0; i < num_ele; i++)
+    {
+        vals[i] = (float64)i;
+    }
+    std::string path = "tout_conduit_benchmark_mmap_modes.conduit_bin";
+    nsrc.save(path);
+    float64 sum = vals.sum();
+
+    const char *modes[]  = {"rw","ro","private","private","ro","ro"};
+    const char *advice[] = {"normal","normal","normal",
+                            "random","sequential","normal"};
+    const char *populate[] = {"false","false","false",
+                              "false","false","true"};
+
+    for(int i = 0; i < 6; i++)
+    {
+        Node opts;
+        opts["mode"]     = modes[i];
+        opts["advice"]   = advice[i];
+        opts["populate"] = populate[i];
+
+        // drop the file from the os cache
+        Node n;
+        n.mmap(path,opts);
+        n.evict();
+        n.reset();
+
+        std::clock_t start = std::clock();
+        n.mmap(path,opts);
+        float64 mode_sum = n["vals"].as_float64_array().sum();
+        double secs = double(std::clock() - start) / CLOCKS_PER_SEC;
+        EXPECT_EQ(sum,mode_sum);
+
+        std::cout << "[benchmark] cold mmap + read of "
+                  << num_ele * 8 / (1024 * 1024) << " MiB, mode "
+                  << modes[i] << ", advice " << advice[i]
+                  << ", populate " << populate[i] << ": "
+                  << secs << " s" << std::endl;
+    }
+}
@@ -0,0 +1,422 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2019, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+//-----------------------------------------------------------------------------
+///
+/// file: t_conduit_node_shared.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+
+#include <iostream>
+
+#include "conduit.hpp"
+
+#include <iostream>
+#include <vector>
+#include <ctime>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+// a tree with one compact buffer: a float64 coordset and an int32 topology
+void
+make_mesh(index_t npts, Node &res)
+{
+    Schema s;
+    s["coords/x"].set(DataType::float64(npts));
+    s["coords/y"].set(DataType::float64(npts,npts * 8));
+    s["topo/conn"].set(DataType::int32(npts,npts * 16));
+    res.set(s);
+
+    float64 *x = res["coords/x"].as_float64_ptr();
+    float64 *y = res["coords/y"].as_float64_ptr();
+    int32  *c = res["topo/conn"].as_int32_ptr();
+    for(index_t i=0; i < npts; i++)
+    {
+        x[i] = (float64)i;
+        y[i] = (float64)(2 * i);
+        c[i] = (int32)i;
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_shared, set_shared)
+{
+    Node mesh;
+    make_mesh(100,mesh);
+    EXPECT_FALSE(mesh.is_data_shared());
+    EXPECT_EQ(mesh.shared_use_count(),0);
+
+    Node derived;
+    derived.set_shared(mesh["coords"]);
+
+    // no copies, both trees use mesh's buffer
+    EXPECT_EQ(derived["x"].data_ptr(),mesh["coords/x"].data_ptr());
+    EXPECT_EQ(derived["y"].data_ptr(),mesh["coords/y"].data_ptr());
+    EXPECT_EQ(derived.shared_use_count(),2);
+    EXPECT_EQ(mesh.shared_use_count(),2);
+    EXPECT_TRUE(mesh["topo/conn"].is_data_shared());
+    Node diff_info;
+    EXPECT_FALSE(derived.diff(mesh["coords"],diff_info));
+    EXPECT_EQ(derived["y"].as_float64_ptr()[10],20.0);
+
+    // the mesh's buffer is now owned by the shared buffer
+    EXPECT_EQ(mesh.total_bytes_allocated(),0);
+    EXPECT_FALSE(mesh.is_data_external());
+
+    Node info;
+    derived.info(info);
+    NodeConstIterator itr = info["mem_spaces"].children();
+    const Node &mem_space = itr.next();
+    EXPECT_EQ(mem_space["type"].as_string(),"shared");
+    EXPECT_EQ(mem_space["use_count"].to_index_t(),2);
+    EXPECT_EQ(mem_space["bytes"].to_index_t(),100 * 20);
+
+    // the buffer lives as long as one of its users
+    mesh.reset();
+    EXPECT_EQ(derived.shared_use_count(),1);
+    EXPECT_EQ(derived["x"].as_float64_ptr()[99],99.0);
+    EXPECT_EQ(derived["y"].as_float64_ptr()[99],198.0);
+
+    derived.reset();
+    EXPECT_FALSE(derived.is_data_shared());
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_shared, copy_on_write)
+{
+    Node mesh;
+    make_mesh(10,mesh);
+
+    Node coords;
+    coords.set_shared(mesh["coords"]);
+    float64 *mesh_x = mesh["coords/x"].as_float64_ptr();
+
+    // set on a shared leaf copies it first
+    std::vector<float64> vals(10,-1.0);
+    coords["x"].set(vals);
+    EXPECT_NE(coords["x"].data_ptr(),(void*)mesh_x);
+    EXPECT_EQ(coords["x"].as_float64_ptr()[3],-1.0);
+    EXPECT_EQ(mesh["coords/x"].as_float64_ptr()[3],3.0);
+    EXPECT_EQ(mesh["coords/x"].data_ptr(),(void*)mesh_x);
+    EXPECT_FALSE(coords["x"].is_data_shared());
+    EXPECT_EQ(coords["x"].total_bytes_allocated(),80);
+    // the other leaf is still shared
+    EXPECT_EQ(coords["y"].data_ptr(),mesh["coords/y"].data_ptr());
+
+    // the original is copy-on-write as well
+    mesh["coords/y"].set_float64_vector(vals);
+    EXPECT_EQ(mesh["coords/y"].as_float64_ptr()[5],-1.0);
+    EXPECT_EQ(coords["y"].as_float64_ptr()[5],10.0);
+
+    // scalars
+    Node a;
+    a["v"] = (int64) 42;
+    Node b;
+    b.set_shared(a);
+    b["v"] = (int64) 7;
+    EXPECT_EQ(a["v"].as_int64(),42);
+    EXPECT_EQ(b["v"].as_int64(),7);
+
+    // a single user writes in place
+    Node c;
+    c.set_shared(a["v"]);
+    a.reset();
+    void *c_ptr = c.data_ptr();
+    c = (int64) 11;
+    EXPECT_EQ(c.data_ptr(),c_ptr);
+    EXPECT_EQ(c.as_int64(),11);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_shared, update)
+{
+    Node mesh;
+    make_mesh(10,mesh);
+
+    Node mesh_copy;
+    mesh_copy.set_shared(mesh);
+
+    Node vals;
+    make_mesh(10,vals);
+    vals["coords/x"].as_float64_ptr()[0] = 100.0;
+    vals["topo/conn"].as_int32_ptr()[0]  = 100;
+
+    // same compact layout, update must not write to the shared buffer
+    mesh_copy.update(vals);
+    EXPECT_EQ(mesh_copy["coords/x"].as_float64_ptr()[0],100.0);
+    EXPECT_EQ(mesh_copy["topo/conn"].as_int32_ptr()[0],100);
+    EXPECT_EQ(mesh["coords/x"].as_float64_ptr()[0],0.0);
+    EXPECT_EQ(mesh["topo/conn"].as_int32_ptr()[0],0);
+
+    Node conn;
+    conn.set_shared(mesh["topo"]);
+    conn.update_compatible(vals["topo"]);
+    EXPECT_EQ(conn["conn"].as_int32_ptr()[0],100);
+    EXPECT_EQ(mesh["topo/conn"].as_int32_ptr()[0],0);
+
+    Node swapped;
+    swapped.set_shared(mesh["coords/x"]);
+    swapped.endian_swap(Endianness::machine_default() == Endianness::LITTLE_ID ?
+                        Endianness::BIG_ID : Endianness::LITTLE_ID);
+    EXPECT_NE(swapped.data_ptr(),mesh["coords/x"].data_ptr());
+    EXPECT_EQ(mesh["coords/x"].as_float64_ptr()[1],1.0);
+
+    // unshare before writing through pointers
+    Node y;
+    y.set_shared(mesh["coords/y"]);
+    y.unshare();
+    y.as_float64_ptr()[1] = -1.0;
+    EXPECT_EQ(mesh["coords/y"].as_float64_ptr()[1],2.0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_shared, set_node)
+{
+    Node mesh;
+    make_mesh(1000,mesh);
+
+    // not shared yet, set_node copies
+    Node copy;
+    copy.set(mesh["coords"]);
+    EXPECT_NE(copy["x"].data_ptr(),mesh["coords/x"].data_ptr());
+    EXPECT_FALSE(copy.is_data_shared());
+
+    Node shared;
+    shared.set_shared(mesh);
+
+    // set_node, the copy constructor and assignment still copy
+    Node coords;
+    coords.set(mesh["coords"]);
+    EXPECT_NE(coords["x"].data_ptr(),mesh["coords/x"].data_ptr());
+    EXPECT_FALSE(coords.is_data_shared());
+
+    Node topo(mesh["topo"]);
+    EXPECT_NE(topo["conn"].data_ptr(),mesh["topo/conn"].data_ptr());
+
+    Node x;
+    x = mesh["coords/x"];
+    EXPECT_NE(x.data_ptr(),mesh["coords/x"].data_ptr());
+    EXPECT_EQ(x.as_float64_ptr()[999],999.0);
+    EXPECT_EQ(mesh.shared_use_count(),2);
+
+    // so writes through pointers don't reach the source
+    coords["x"].as_float64_ptr()[3] = -1.0;
+    topo["conn"].as_int32_ptr()[3] = -1;
+    float64 *x_ptr = x.value();
+    x_ptr[3] = -1.0;
+    float64_array y_vals = coords["y"].value();
+    y_vals[3] = -1.0;
+    EXPECT_EQ(mesh["coords/x"].as_float64_ptr()[3],3.0);
+    EXPECT_EQ(mesh["coords/y"].as_float64_ptr()[3],6.0);
+    EXPECT_EQ(mesh["topo/conn"].as_int32_ptr()[3],3);
+    EXPECT_EQ(shared["coords/x"].as_float64_ptr()[3],3.0);
+
+    std::vector<Node> nodes(4,shared);
+    EXPECT_EQ(mesh.shared_use_count(),2);
+    nodes[0]["coords/y"].as_float64_ptr()[4] = -1.0;
+    EXPECT_EQ(shared["coords/y"].as_float64_ptr()[4],8.0);
+    nodes.clear();
+
+    // strided data is still compacted
+    Node strided;
+    strided.set_external(DataType::float64(500,0,16),
+                         mesh["coords/x"].data_ptr());
+    Node s_copy;
+    s_copy.set(strided);
+    EXPECT_TRUE(s_copy.dtype().is_compact());
+    EXPECT_FALSE(s_copy.is_data_shared());
+    EXPECT_EQ(s_copy.as_float64_ptr()[10],20.0);
+
+    // in the same tree
+    mesh["topo_copy"].set_shared(mesh["topo"]);
+    EXPECT_EQ(mesh["topo_copy/conn"].data_ptr(),
+              mesh["topo/conn"].data_ptr());
+    mesh["topo_copy/conn"].set(std::vector<int32>(1000,-1));
+    EXPECT_EQ(mesh["topo/conn"].as_int32_ptr()[5],5);
+
+    // topo_copy/conn has its own buffer now, so the whole mesh is copied
+    Node mixed;
+    mixed.set_shared(mesh);
+    EXPECT_NE(mixed["coords/x"].data_ptr(),mesh["coords/x"].data_ptr());
+    EXPECT_EQ(mixed.shared_use_count(),1);
+
+    // with an ancestor
+    Node tree;
+    tree.set_shared(mesh["coords"]);
+    tree.set_shared(tree["x"]);
+    EXPECT_EQ(tree.as_float64_ptr()[7],7.0);
+    EXPECT_EQ(tree.data_ptr(),mesh["coords/x"].data_ptr());
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_shared, copied_sources)
+{
+    // leaves allocated one by one can't share one buffer, the data 
+    // is copied into a new shared buffer
+    Node src;
+    src["a"].set(DataType::int64(10));
+    src["b"].set(DataType::float32(5));
+    src["a"].as_int64_ptr()[9] = 9;
+
+    Node n;
+    n.set_shared(src);
+    EXPECT_NE(n["a"].data_ptr(),src["a"].data_ptr());
+    EXPECT_EQ(n["a"].as_int64_ptr()[9],9);
+    EXPECT_EQ(n.shared_use_count(),1);
+    EXPECT_FALSE(src.is_data_shared());
+
+    Node n2;
+    n2.set_shared(n);
+    EXPECT_EQ(n2["a"].data_ptr(),n["a"].data_ptr());
+    EXPECT_EQ(n.shared_use_count(),2);
+
+    // external data
+    std::vector<int32> vals(8,3);
+    Node ext;
+    ext.set_external(vals);
+    Node n3;
+    n3.set_shared(ext);
+    EXPECT_NE(n3.data_ptr(),(void*)&vals[0]);
+    EXPECT_EQ(n3.as_int32_ptr()[7],3);
+
+    // no data
+    Node empty;
+    empty["a"];
+    Node n4;
+    n4.set_shared(empty);
+    EXPECT_FALSE(n4.is_data_shared());
+    EXPECT_TRUE(n4["a"].dtype().is_empty());
+}
+
+//-----------------------------------------------------------------------------
+struct ShareTaskCtx
+{
+    const Node *src;
+    std::vector<index_t> errors;
+};
+
+//-----------------------------------------------------------------------------
+void
+share_task(index_t task, void *ctx)
+{
+    ShareTaskCtx &tctx = *(ShareTaskCtx*)ctx;
+    for(int i=0; i < 200; i++)
+    {
+        Node n;
+        n.set_shared(*tctx.src);
+        Node n2;
+        n2.set_shared(n);
+        Node n3;
+        n3.set_shared(n2["coords"]);
+        if(n3["x"].as_float64_ptr()[5] != 5.0)
+        {
+            tctx.errors[(size_t)task]++;
+        }
+        if(i % 10 == 0)
+        {
+            // copy-on-write of a leaf
+            n2["coords/x"] = (float64) task;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_shared, threads)
+{
+    Node mesh;
+    make_mesh(100,mesh);
+    mesh.set_shared(mesh);
+    EXPECT_EQ(mesh.shared_use_count(),1);
+
+    set_num_threads(4);
+    ShareTaskCtx ctx;
+    ctx.src = &mesh;
+    ctx.errors.resize(64,0);
+    parallel_for(64,share_task,&ctx);
+    set_num_threads(1);
+
+    for(size_t i=0; i < ctx.errors.size(); i++)
+    {
+        EXPECT_EQ(ctx.errors[i],0);
+    }
+
+    EXPECT_EQ(mesh.shared_use_count(),1);
+    EXPECT_EQ(mesh["coords/x"].as_float64_ptr()[5],5.0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_shared, benchmark_set_node)
+{
+    // 16 MB coordset
+    Node mesh;
+    make_mesh(1000 * 1000,mesh);
+
+    int nruns = 20;
+    std::clock_t start = std::clock();
+    for(int i=0; i < nruns; i++)
+    {
+        Node n;
+        n.set(mesh["coords"]);
+    }
+    double copy_secs = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    Node shared;
+    shared.set_shared(mesh);
+
+    start = std::clock();
+    for(int i=0; i < nruns; i++)
+    {
+        Node n;
+        n.set_shared(mesh["coords"]);
+        EXPECT_EQ(n["x"].data_ptr(),mesh["coords/x"].data_ptr());
+    }
+    double share_secs = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    std::cout << "[benchmark] 16 MB coordset, set_node: " 
+              << (copy_secs / nruns) * 1e3 << " ms, set_shared: "
+              << (share_secs / nruns) * 1e3 << " ms" << std::endl;
+}
@@ -156,3 +156,136 @@ TEST(conduit_node_to_array, dynamic_type_to_vector)
         }
     }
 }
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_to_array, dynamic_type_strided)
+{
+    // enough values to cover the vectorized paths and their remainders,
+    // every other value is used
+    const index_t num_vals = 37;
+    float64 src_vals[2 * num_vals];
+    for(index_t i = 0; i < 2 * num_vals; i++)
+    {
+        src_vals[i] = (i % 2 == 0) ? (float64)(i / 2) : -1.0;
+    }
+
+    Node src_node;
+    src_node.set_external(DataType::float64(num_vals, 0, 2 * sizeof(float64)),
+                          src_vals);
+
+    for(index_t ti = 0; ti < 10; ti++)
+    {
+        Node base_node;
+        src_node.to_data_type(CONVERT_TYPES[ti], base_node);
+
+        // make a strided copy of the converted values
+        index_t ele_bytes = base_node.dtype().element_bytes();
+        std::vector<uint8> strided((size_t)(3 * ele_bytes * num_vals), 0);
+        Node strided_node;
+        strided_node.set_external(DataType(base_node.dtype().id(),
+                                           num_vals,
+                                           ele_bytes,
+                                           3 * ele_bytes,
+                                           ele_bytes,
+                                           Endianness::DEFAULT_ID),
+                                  &strided[0]);
+        strided_node.update(base_node);
+
+        for(index_t tj = 0; tj < 10; tj++)
+        {
+            Node to_node;
+            strided_node.to_data_type(CONVERT_TYPES[tj], to_node);
+            EXPECT_EQ(to_node.dtype().id(), CONVERT_TYPES[tj]);
+            EXPECT_TRUE(to_node.is_compact());
+
+            Node f64_node;
+            to_node.to_float64_array(f64_node);
+            float64_array f64_vals = f64_node.value();
+            for(index_t i = 0; i < num_vals; i++)
+            {
+                EXPECT_EQ(f64_vals[i], (float64)i);
+            }
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_to_array, signed_and_fractional_values)
+{
+    int32 i32_vals[9] = {-4, -3, -2, -1, 0, 1, 2, 3, 2147483647};
+    Node n;
+    n.set_external(i32_vals, 9);
+
+    Node res;
+    n.to_int64_array(res);
+    int64_array i64_vals = res.value();
+    for(index_t i = 0; i < 9; i++)
+    {
+        EXPECT_EQ(i64_vals[i], (int64)i32_vals[i]);
+    }
+
+    // back to int32 keeps the low bits
+    i64_vals[0] = -5;
+    Node res_i32;
+    res.to_int32_array(res_i32);
+    int32_array i32_res = res_i32.value();
+    EXPECT_EQ(i32_res[0], -5);
+    EXPECT_EQ(i32_res[8], 2147483647);
+
+    float32 f32_vals[5] = {-1.5f, 0.25f, 3.75f, 1e10f, -2.0f};
+    n.set_external(f32_vals, 5);
+    n.to_float64_array(res);
+    float64_array f64_vals = res.value();
+    for(index_t i = 0; i < 5; i++)
+    {
+        EXPECT_EQ(f64_vals[i], (float64)f32_vals[i]);
+    }
+
+    // float to int truncates
+    n.to_int32_array(res_i32);
+    i32_res = res_i32.value();
+    EXPECT_EQ(i32_res[0], -1);
+    EXPECT_EQ(i32_res[2], 3);
+
+    f64_vals[1] = 0.125;
+    Node res_f32;
+    res.to_float32_array(res_f32);
+    float32_array f32_res = res_f32.value();
+    EXPECT_EQ(f32_res[1], 0.125f);
+    EXPECT_EQ(f32_res[4], -2.0f);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_node_to_array, to_data_type_if_needed)
+{
+    int64 vals[4] = {1, 2, 3, 4};
+    Node n;
+    n["a"].set_external(vals, 4);
+
+    // same type: zero-copy view
+    Node res;
+    EXPECT_FALSE(n["a"].to_data_type_if_needed(DataType::INT64_ID, res));
+    EXPECT_EQ(res.data_ptr(), (void*)vals);
+    EXPECT_EQ(res.dtype().number_of_elements(), 4);
+    int64_array res_vals = res.value();
+    res_vals[0] = 10;
+    EXPECT_EQ(vals[0], 10);
+
+    // strided views keep their layout
+    n["b"].set_external(DataType::int64(2, sizeof(int64), 2 * sizeof(int64)),
+                        vals);
+    EXPECT_FALSE(n["b"].to_data_type_if_needed(DataType::INT64_ID, res));
+    EXPECT_EQ(res.as_int64_array()[1], 4);
+
+    // different type: converted copy
+    EXPECT_TRUE(n["a"].to_data_type_if_needed(DataType::INT32_ID, res));
+    EXPECT_EQ(res.dtype().id(), (index_t)DataType::INT32_ID);
+    EXPECT_EQ(res.as_int32_array()[0], 10);
+    EXPECT_NE(res.data_ptr(), (void*)vals);
+
+    // non-numeric input is an error
+    Node n_str;
+    n_str.set("abc");
+    EXPECT_THROW(n_str.to_data_type_if_needed(DataType::CHAR8_STR_ID, res),
+                 conduit::Error);
+}
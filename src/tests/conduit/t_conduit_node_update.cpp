@@ -52,6 +52,8 @@
 #include "conduit.hpp"
 
 #include <iostream>
+#include <ctime>
+#include <sstream>
 #include "gtest/gtest.h"
 #include "rapidjson/document.h"
 using namespace conduit;
@@ -279,4 +281,129 @@ TEST(conduit_node_update, update_external)
 }
 
 
+//-----------------------------------------------------------------------------
+TEST(conduit_node_update, update_contiguous)
+{
+    Schema s;
+    s["a"].set(DataType::int32(4));
+    s["b/c"].set(DataType::float64(3,16));
+    s["b/d"].set(DataType::uint8(2,40));
+
+    Node n_src(s);
+    Node n_dest(s);
+
+    int32 *a_src = n_src["a"].value();
+    float64 *c_src = n_src["b/c"].value();
+    uint8 *d_src = n_src["b/d"].value();
+    for(int i=0; i < 4; i++)
+    {
+        a_src[i] = i + 1;
+    }
+    for(int i=0; i < 3; i++)
+    {
+        c_src[i] = i * 0.5;
+    }
+    d_src[0] = 7;
+    d_src[1] = 8;
+
+    void *dest_data = n_dest.data_ptr();
+    Node info;
+
+    n_dest.update(n_src);
+    EXPECT_EQ(n_dest.data_ptr(),dest_data);
+    EXPECT_FALSE(n_dest.diff(n_src,info));
+
+    // set reuses the buffer when the layouts match
+    n_src["a"].as_int32_ptr()[0] = -1;
+    n_dest.set(n_src);
+    EXPECT_EQ(n_dest.data_ptr(),dest_data);
+    EXPECT_EQ(n_dest["a"].as_int32_ptr()[0],-1);
+    EXPECT_FALSE(n_dest.diff(n_src,info));
+    EXPECT_TRUE(n_dest.schema().equals(n_src.schema()));
+
+    // children in a different order, but at the same offsets
+    Schema s_reorder;
+    s_reorder["b/d"].set(DataType::uint8(2,40));
+    s_reorder["b/c"].set(DataType::float64(3,16));
+    s_reorder["a"].set(DataType::int32(4));
+    EXPECT_TRUE(s_reorder.equals(s));
+    Node n_reorder(s_reorder);
+    n_reorder.update(n_src);
+    EXPECT_EQ(n_reorder["a"].as_int32_ptr()[0],-1);
+    EXPECT_EQ(n_reorder["b/c"].as_float64_ptr()[2],1.0);
+    EXPECT_EQ(n_reorder["b/d"].as_uint8_ptr()[1],8);
+
+    // strided layouts use the regular path
+    Schema s_strided;
+    s_strided["a"].set(DataType::int32(4,0,8));
+    Node n_strided(s_strided);
+    int32 *a_strided = n_strided["a"].value();
+    for(int i=0; i < 4; i++)
+    {
+        a_strided[i*2] = 10 + i;
+    }
+    // the hole between the first two values
+    a_strided[1] = -10;
+
+    Schema s_compact;
+    s_compact["a"].set(DataType::int32(4));
+    Node n_compact(s_compact);
+    n_compact.update(n_strided);
+    EXPECT_EQ(n_compact["a"].as_int32_ptr()[3],13);
+
+    // update into the strided node leaves the holes alone
+    n_strided.update(n_compact);
+    EXPECT_EQ(a_strided[1],-10);
+    EXPECT_EQ(a_strided[6],13);
+
+    // a node with a different layout still gets updated
+    Node n_other;
+    n_other["a"].set(DataType::int32(4));
+    n_other["e"] = 3.0;
+    n_other.update(n_src);
+    EXPECT_EQ(n_other["a"].as_int32_ptr()[0],-1);
+    EXPECT_EQ(n_other["b/d"].as_uint8_ptr()[1],8);
+    EXPECT_EQ(n_other["e"].to_float64(),3.0);
+}
 
+//-----------------------------------------------------------------------------
+TEST(conduit_node_update, benchmark_update_contiguous)
+{
+    Schema s;
+    index_t num_children = 2000;
+    for(index_t i=0; i < num_children; i++)
+    {
+        std::ostringstream oss;
+        oss << "field_" << i;
+        s[oss.str()].set(DataType::float64(16,i * 16 * 8));
+    }
+
+    Node n_src(s);
+    Node n_dest(s);
+    n_src["field_10"].as_float64_ptr()[3] = 42.0;
+
+    index_t num_reps = 200;
+    std::clock_t start = std::clock();
+    for(index_t rep=0; rep < num_reps; rep++)
+    {
+        n_dest.update(n_src);
+    }
+    double fast_secs = double(std::clock() - start) / CLOCKS_PER_SEC;
+    EXPECT_EQ(n_dest["field_10"].as_float64_ptr()[3],42.0);
+
+    // per child update (different layout in the destination)
+    Node n_other;
+    n_other.set(n_src);
+    start = std::clock();
+    for(index_t rep=0; rep < num_reps; rep++)
+    {
+        n_other.update(n_src);
+    }
+    double slow_secs = double(std::clock() - start) / CLOCKS_PER_SEC;
+    EXPECT_EQ(n_other["field_10"].as_float64_ptr()[3],42.0);
+
+    std::cout << "[benchmark] " << num_reps << " updates of "
+              << num_children << " children, contiguous: " 
+              << fast_secs << " s, per child: " 
+              << slow_secs << " s" << std::endl;
+}
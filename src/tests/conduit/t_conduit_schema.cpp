@@ -51,6 +51,8 @@
 #include "conduit.hpp"
 
 #include <iostream>
+#include <sstream>
+#include <ctime>
 #include "gtest/gtest.h"
 
 
@@ -472,6 +474,415 @@ TEST(schema_basics, schema_to_string)
 }
 
 
+//-----------------------------------------------------------------------------
+TEST(schema_basics, large_object_lookup)
+{
+    Schema s;
+    index_t num_children = 200;
+
+    for(index_t i=0; i < num_children; i++)
+    {
+        std::ostringstream oss;
+        oss << "child_" << i;
+        s[oss.str()].set(DataType::int64());
+    }
+
+    EXPECT_EQ(s.number_of_children(),num_children);
+
+    for(index_t i=0; i < num_children; i++)
+    {
+        std::ostringstream oss;
+        oss << "child_" << i;
+        EXPECT_TRUE(s.has_child(oss.str()));
+        EXPECT_EQ(s.child_index(oss.str()),i);
+        EXPECT_EQ(s.child_name(i),oss.str());
+    }
+
+    EXPECT_FALSE(s.has_child("child_200"));
+    EXPECT_FALSE(s.has_path("child_200"));
+
+    // remove from the front, middle and back
+    s.remove("child_0");
+    s.remove(100);
+    s.remove("child_199");
+
+    EXPECT_EQ(s.number_of_children(),num_children - 3);
+    EXPECT_FALSE(s.has_child("child_0"));
+    EXPECT_FALSE(s.has_child("child_101"));
+    EXPECT_FALSE(s.has_child("child_199"));
+
+    // remaining children keep their order and indices match
+    for(index_t i=0; i < s.number_of_children(); i++)
+    {
+        EXPECT_EQ(s.child_index(s.child_name(i)),i);
+    }
+
+    // renames keep the lookup in sync
+    s.rename_child("child_50","renamed_50");
+    EXPECT_FALSE(s.has_child("child_50"));
+    EXPECT_TRUE(s.has_child("renamed_50"));
+    EXPECT_EQ(s.child_name(s.child_index("renamed_50")),"renamed_50");
+
+    for(index_t i=0; i < s.number_of_children(); i++)
+    {
+        EXPECT_EQ(s.child_index(s.child_name(i)),i);
+    }
+
+    // copies and comparisons use the same lookup
+    Schema s2(s);
+    EXPECT_TRUE(s.equals(s2));
+    EXPECT_TRUE(s.compatible(s2));
+    EXPECT_EQ(s2.child_index("renamed_50"),s.child_index("renamed_50"));
+
+    s2.remove("renamed_50");
+    EXPECT_FALSE(s.equals(s2));
+    // compatible only checks the children both schemas share
+    EXPECT_TRUE(s.compatible(s2));
+    EXPECT_TRUE(s2.compatible(s));
+}
+
+//-----------------------------------------------------------------------------
+TEST(schema_basics, large_object_remove_many)
+{
+    Schema s;
+    index_t num_children = 20000;
+    std::vector<std::string> names;
+
+    for(index_t i=0; i < num_children; i++)
+    {
+        std::ostringstream oss;
+        oss << "field_" << i;
+        names.push_back(oss.str());
+        s[oss.str()].set(DataType::float64());
+    }
+
+    // remove every other child by name, looking up the rest in between
+    std::clock_t start = std::clock();
+    for(index_t i=0; i < num_children; i+=2)
+    {
+        s.remove_child(names[(size_t)i]);
+        if(i + 1 < num_children)
+        {
+            EXPECT_EQ(s.child_index(names[(size_t)i+1]),i/2);
+        }
+    }
+    double remove_secs = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    EXPECT_EQ(s.number_of_children(),num_children / 2);
+    for(index_t i=0; i < num_children; i++)
+    {
+        EXPECT_EQ(s.has_child(names[(size_t)i]), (i % 2) == 1);
+    }
+    for(index_t i=0; i < s.number_of_children(); i++)
+    {
+        EXPECT_EQ(s.child_name(i),names[(size_t)(2*i+1)]);
+        EXPECT_EQ(s.child_index(s.child_name(i)),i);
+    }
+
+    // remove from the back by index down to the small object case
+    while(s.number_of_children() > 4)
+    {
+        s.remove(s.number_of_children() - 1);
+    }
+    EXPECT_EQ(s.child_index("field_7"),3);
+    EXPECT_FALSE(s.has_child("field_9"));
+
+    // and grow again
+    s["field_9"].set(DataType::int32());
+    EXPECT_EQ(s.child_index("field_9"),4);
+
+    std::cout << "[benchmark] remove " << num_children / 2
+              << " children from a wide object: "
+              << remove_secs << " s" << std::endl;
+}
+
+//-----------------------------------------------------------------------------
+TEST(schema_basics, benchmark_large_object_lookup)
+{
+    Schema s;
+    index_t num_children = 10000;
+    std::vector<std::string> names;
+
+    for(index_t i=0; i < num_children; i++)
+    {
+        std::ostringstream oss;
+        oss << "field_" << i;
+        names.push_back(oss.str());
+    }
+
+    std::clock_t start = std::clock();
+    for(index_t i=0; i < num_children; i++)
+    {
+        s[names[(size_t)i]].set(DataType::float64());
+    }
+    double build_secs = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    index_t found = 0;
+    start = std::clock();
+    for(int rep=0; rep < 10; rep++)
+    {
+        for(index_t i=0; i < num_children; i++)
+        {
+            if(s.has_child(names[(size_t)i]))
+            {
+                found++;
+            }
+        }
+    }
+    double lookup_secs = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    EXPECT_EQ(found, num_children * 10);
+
+    std::cout << "[benchmark] build object with "
+              << num_children << " children: "
+              << build_secs << " s" << std::endl;
+    std::cout << "[benchmark] " << num_children * 10 << " child lookups: "
+              << lookup_secs << " s" << std::endl;
+}
+
+
+//-----------------------------------------------------------------------------
+TEST(schema_basics, fingerprint)
+{
+    Schema s;
+    s["a"].set(DataType::int64(10));
+    s["b/c"].set(DataType::float64(5,80));
+    s["d"].append().set(DataType::int32());
+    s["d"].append().set(DataType::uint8(4));
+
+    uint64 fp = s.fingerprint();
+    // cached value
+    EXPECT_EQ(s.fingerprint(),fp);
+
+    // copies share the fingerprint
+    Schema s2(s);
+    EXPECT_EQ(s2.fingerprint(),fp);
+    EXPECT_TRUE(s.equals(s2));
+    EXPECT_TRUE(s.compatible(s2));
+
+    // a fresh schema with the same layout has the same fingerprint
+    Schema s3;
+    s3["a"].set(DataType::int64(10));
+    s3["b/c"].set(DataType::float64(5,80));
+    s3["d"].append().set(DataType::int32());
+    s3["d"].append().set(DataType::uint8(4));
+    EXPECT_EQ(s3.fingerprint(),fp);
+
+    // object children order doesn't matter
+    Schema s4;
+    s4["d"].append().set(DataType::int32());
+    s4["d"].append().set(DataType::uint8(4));
+    s4["b/c"].set(DataType::float64(5,80));
+    s4["a"].set(DataType::int64(10));
+    EXPECT_EQ(s4.fingerprint(),fp);
+    EXPECT_TRUE(s.equals(s4));
+
+    // list children order does
+    Schema s5(s);
+    s5["d"].remove(0);
+    s5["d"].append().set(DataType::int32());
+    EXPECT_NE(s5.fingerprint(),fp);
+    EXPECT_FALSE(s.equals(s5));
+
+    // changes to descendants invalidate ancestors
+    s2["b/c"].set(DataType::float64(6,80));
+    EXPECT_NE(s2.fingerprint(),fp);
+    EXPECT_FALSE(s.equals(s2));
+    s2["b/c"].set(DataType::float64(5,80));
+    EXPECT_EQ(s2.fingerprint(),fp);
+
+    s2["a"].dtype().set_offset(8);
+    EXPECT_NE(s2.fingerprint(),fp);
+    EXPECT_FALSE(s.equals(s2));
+    s2["a"].dtype().set_offset(0);
+    EXPECT_EQ(s2.fingerprint(),fp);
+
+    s2.rename_child("a","aa");
+    EXPECT_NE(s2.fingerprint(),fp);
+    s2.rename_child("aa","a");
+    EXPECT_EQ(s2.fingerprint(),fp);
+
+    s2["e"];
+    EXPECT_NE(s2.fingerprint(),fp);
+    // compatible only checks the children both schemas share
+    EXPECT_TRUE(s2.compatible(s));
+    EXPECT_FALSE(s.equals(s2));
+    s2.remove_child("e");
+    EXPECT_EQ(s2.fingerprint(),fp);
+
+    s2["d"].append().set(DataType::int32());
+    EXPECT_NE(s2.fingerprint(),fp);
+    s2["d"].remove(2);
+    EXPECT_EQ(s2.fingerprint(),fp);
+
+    // swap moves fingerprints with contents and updates parents
+    Schema s6;
+    s6.set(DataType::int32(3));
+    s2["a"].swap(s6);
+    EXPECT_NE(s2.fingerprint(),fp);
+    s2["a"].swap(s6);
+    EXPECT_EQ(s2.fingerprint(),fp);
+    EXPECT_EQ(s6.fingerprint(),Schema(DataType::int32(3)).fingerprint());
+
+    // compatible schemas don't need matching fingerprints
+    Schema s7(s);
+    s7["a"].dtype().set_offset(16);
+    EXPECT_NE(s7.fingerprint(),fp);
+    EXPECT_TRUE(s.compatible(s7));
+    EXPECT_TRUE(s7.compatible(s));
+    EXPECT_FALSE(s.equals(s7));
+    EXPECT_TRUE(s7.equals(s7));
+    EXPECT_TRUE(s7.compatible(s7));
+
+    // leaves with different types differ
+    EXPECT_NE(Schema(DataType::int32(3)).fingerprint(),
+              Schema(DataType::uint32(3)).fingerprint());
+    EXPECT_NE(Schema(DataType::int32(3)).fingerprint(),
+              Schema(DataType::int32(4)).fingerprint());
+}
+
+//-----------------------------------------------------------------------------
+TEST(schema_basics, benchmark_equals)
+{
+    Schema s;
+    index_t num_children = 10000;
+    for(index_t i=0; i < num_children; i++)
+    {
+        std::ostringstream oss;
+        oss << "field_" << i;
+        s[oss.str()].set(DataType::float64(10));
+    }
+
+    Schema s2(s);
+    index_t num_reps = 1000;
+    index_t num_equal = 0;
+    std::clock_t start = std::clock();
+    for(index_t rep=0; rep < num_reps; rep++)
+    {
+        if(s.equals(s2) && s.compatible(s2))
+        {
+            num_equal++;
+        }
+    }
+    double secs = double(std::clock() - start) / CLOCKS_PER_SEC;
+    EXPECT_EQ(num_equal,num_reps);
+
+    std::cout << "[benchmark] " << num_reps 
+              << " equals + compatible checks of " << num_children
+              << " children: " << secs << " s" << std::endl;
+}
+
+//-----------------------------------------------------------------------------
+TEST(schema_basics, binary_encoding)
+{
+    Schema s;
+    s["a"].set(DataType::int32(10));
+    s["b"].set(DataType::float64(5,40,16));
+    s["c/d"].set(DataType::uint8(3,200,1,1,Endianness::BIG_ID));
+    s["c/e"].set(DataType::char8_str(6));
+    s["c/empty"].set(DataType::object());
+    s["l"].append().set(DataType::int64(2));
+    s["l"].append().set(DataType::float32(1,0,4,4,Endianness::LITTLE_ID));
+    s["l"].append()["x"].set(DataType::int16(7));
+    s["n"].set(DataType::empty());
+
+    std::vector<uint8> buff;
+    s.serialize_binary(buff);
+    EXPECT_TRUE(Schema::is_binary(&buff[0],(index_t)buff.size()));
+    EXPECT_LT(buff.size(),s.to_json().size());
+
+    Schema res;
+    res["stale"].set(DataType::int8());
+    res.parse_binary(buff);
+    EXPECT_TRUE(res.equals(s));
+    EXPECT_FALSE(res.has_child("stale"));
+    EXPECT_EQ(res["c/d"].dtype().endianness(),(index_t)Endianness::BIG_ID);
+    EXPECT_EQ(res["b"].dtype().stride(),16);
+    EXPECT_EQ(res["c/d"].dtype().offset(),200);
+    EXPECT_TRUE(res["c/empty"].dtype().is_object());
+    EXPECT_EQ(res.child_name(1),"b");
+
+    // a leaf root
+    Schema leaf(DataType::float32(3));
+    leaf.serialize_binary(buff);
+    res.parse_binary(buff);
+    EXPECT_TRUE(res.equals(leaf));
+
+    // file round trip
+    s.serialize_binary("tout_schema_binary_encoding.schema_bin");
+    res.load_binary("tout_schema_binary_encoding.schema_bin");
+    EXPECT_TRUE(res.equals(s));
+
+    // json text is not detected as binary
+    std::string json = s.to_json();
+    EXPECT_FALSE(Schema::is_binary((const uint8*)json.c_str(),
+                                   (index_t)json.size()));
+
+    // truncated data
+    s.serialize_binary(buff);
+    EXPECT_THROW(res.parse_binary(&buff[0],(index_t)buff.size()-1),
+                 conduit::Error);
+    EXPECT_THROW(res.parse_binary(&buff[0],3),conduit::Error);
+    // trailing bytes
+    std::vector<uint8> extra(buff);
+    extra.push_back(0);
+    EXPECT_THROW(res.parse_binary(extra),conduit::Error);
+    // bad magic
+    std::vector<uint8> bad(buff);
+    bad[1] = 'X';
+    EXPECT_THROW(res.parse_binary(bad),conduit::Error);
+    EXPECT_FALSE(Schema::is_binary(&bad[0],(index_t)bad.size()));
+    // bad version
+    bad = buff;
+    bad[4] = 255;
+    EXPECT_THROW(res.parse_binary(bad),conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(schema_basics, benchmark_binary_encoding)
+{
+    Schema s_src;
+    index_t num_children = 10000;
+    for(index_t i=0; i < num_children; i++)
+    {
+        std::ostringstream oss;
+        oss << "group_" << (i % 100) << "/field_" << i;
+        s_src[oss.str()].set(DataType::float64(10));
+    }
+
+    Schema s;
+    s_src.compact_to(s);
+
+    std::string json = s.to_json();
+    std::vector<uint8> buff;
+    s.serialize_binary(buff);
+
+    index_t num_reps = 10;
+    Schema res;
+
+    std::clock_t start = std::clock();
+    for(index_t rep=0; rep < num_reps; rep++)
+    {
+        res.set(json);
+    }
+    double json_secs = double(std::clock() - start) / CLOCKS_PER_SEC;
+    // json resolves default endianness, so only check compatibility
+    EXPECT_TRUE(res.compatible(s));
+
+    start = std::clock();
+    for(index_t rep=0; rep < num_reps; rep++)
+    {
+        res.parse_binary(buff);
+    }
+    double bin_secs = double(std::clock() - start) / CLOCKS_PER_SEC;
+    EXPECT_TRUE(res.equals(s));
+
+    std::cout << "[benchmark] schema with " << num_children
+              << " leaves: json " << json.size() << " bytes, "
+              << json_secs << " s; binary " << buff.size() << " bytes, "
+              << bin_secs << " s (" << num_reps << " parses)" << std::endl;
+}
+
 //-----------------------------------------------------------------------------
 ///
 /// commented out b/c spanned_bytes is now private, 
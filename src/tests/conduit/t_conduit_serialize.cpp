@@ -51,6 +51,9 @@
 #include "conduit.hpp"
 
 #include <iostream>
+#include <fstream>
+#include <iterator>
+#include <ctime>
 #include "gtest/gtest.h"
 using namespace conduit;
 
@@ -232,4 +235,148 @@ TEST(conduit_serialize, seralize_multiple)
     EXPECT_EQ(node["a/e"].as_uint8(), third_node["a/e"].as_uint8());
 }
 
+//-----------------------------------------------------------------------------
+std::vector<uint8>
+read_file_bytes(const std::string &path)
+{
+    std::ifstream ifs(path.c_str(), std::ios::binary);
+    return std::vector<uint8>(std::istreambuf_iterator<char>(ifs),
+                              std::istreambuf_iterator<char>());
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_serialize, iovecs)
+{
+    // compact tree: a single block
+    Node n_compact;
+    n_compact.set(DataType::float64(10));
+    Node n;
+    n["a"].set(DataType::float64(10));
+    n["b"].set(DataType::int32(5));
+    n.compact_to(n_compact);
+
+    std::vector<Node::IOVec> iovecs;
+    n_compact.serialize_iovecs(iovecs);
+    EXPECT_EQ(iovecs.size(),1);
+    EXPECT_TRUE(iovecs[0].is_contiguous());
+    EXPECT_EQ(iovecs[0].number_of_bytes(),n.total_bytes_compact());
+    EXPECT_EQ(iovecs[0].data,n_compact.data_ptr());
+
+    // separately allocated leaves: one block each
+    n.serialize_iovecs(iovecs);
+    EXPECT_EQ(iovecs.size(),2);
+    EXPECT_EQ(iovecs[0].data,n["a"].data_ptr());
+    EXPECT_EQ(iovecs[1].number_of_bytes(),20);
+
+    // strided leaf
+    float64 vals[] = {1.0, -1.0, 2.0, -2.0, 3.0, -3.0, 4.0, -4.0};
+    Node n_strided;
+    n_strided["s"].set_external(DataType::float64(4,0,16),vals);
+    n_strided["empty"];
+    n_strided["zero"].set(DataType::float64(0));
+    n_strided["c"] = (int64)42;
+    n_strided.serialize_iovecs(iovecs);
+    EXPECT_EQ(iovecs.size(),2);
+    EXPECT_FALSE(iovecs[0].is_contiguous());
+    EXPECT_EQ(iovecs[0].data,(void*)vals);
+    EXPECT_EQ(iovecs[0].element_bytes,8);
+    EXPECT_EQ(iovecs[0].stride,16);
+    EXPECT_EQ(iovecs[0].num_elements,4);
+    EXPECT_EQ(iovecs[0].number_of_bytes(),32);
+    EXPECT_TRUE(iovecs[1].is_contiguous());
+
+    index_t total = 0;
+    for(size_t i = 0; i < iovecs.size(); i++)
+    {
+        total += iovecs[i].number_of_bytes();
+    }
+    EXPECT_EQ(total,n_strided.total_bytes_compact());
+
+    // empty
+    Node n_empty;
+    n_empty.serialize_iovecs(iovecs);
+    EXPECT_TRUE(iovecs.empty());
+}
 
+//-----------------------------------------------------------------------------
+TEST(conduit_serialize, file_without_compaction)
+{
+    // a strided leaf larger than the writer's bounce buffer, 
+    // mixed with contiguous leaves
+    index_t num_ele = 300000;
+    std::vector<float64> vals(2 * num_ele);
+    for(index_t i = 0; i < 2 * num_ele; i++)
+    {
+        vals[i] = (float64)i;
+    }
+
+    Node n;
+    n["x"].set_external(DataType::float64(num_ele,0,16),&vals[0]);
+    n["y"].set_external(DataType::float64(num_ele,8,16),&vals[0]);
+    n["name"] = "strided";
+    n["ids"].set(DataType::int32(1000));
+    int32_array ids = n["ids"].value();
+    for(index_t i = 0; i < 1000; i++)
+    {
+        ids[i] = (int32)i;
+    }
+    n["pad"].set_external(DataType::uint8(3,0,2),&vals[0]);
+
+    std::vector<uint8> expected;
+    n.serialize(expected);
+
+    std::string path = "tout_conduit_serialize_iovecs.bin";
+    n.serialize(path);
+    EXPECT_EQ(read_file_bytes(path),expected);
+
+    {
+        std::ofstream ofs(path.c_str(), std::ios::binary);
+        n.serialize(ofs);
+    }
+    EXPECT_EQ(read_file_bytes(path),expected);
+
+    // conduit_bin save writes the compact schema, and the data straight
+    // from the leaves
+    n.save("tout_conduit_serialize_iovecs.conduit_bin");
+    Node n_load, info;
+    n_load.load("tout_conduit_serialize_iovecs.conduit_bin");
+    EXPECT_FALSE(n.diff(n_load,info,0.0));
+    EXPECT_TRUE(n_load.is_compact());
+    EXPECT_EQ(n_load["y"].as_float64_array()[10],21.0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_serialize, benchmark_save_strided)
+{
+    // 64 MiB of interleaved x/y values
+    index_t num_ele = 4 * 1024 * 1024;
+    std::vector<float64> vals(2 * num_ele);
+    for(index_t i = 0; i < 2 * num_ele; i++)
+    {
+        vals[i] = (float64)i;
+    }
+
+    Node n;
+    n["x"].set_external(DataType::float64(num_ele,0,16),&vals[0]);
+    n["y"].set_external(DataType::float64(num_ele,8,16),&vals[0]);
+
+    // compact copy, then write (the previous approach)
+    std::clock_t start = std::clock();
+    Node n_compact;
+    n.compact_to(n_compact);
+    n_compact.serialize("tout_conduit_benchmark_save_compact.bin");
+    double compact_secs = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    start = std::clock();
+    n.serialize("tout_conduit_benchmark_save_iovecs.bin");
+    double iovec_secs = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    EXPECT_EQ(read_file_bytes("tout_conduit_benchmark_save_compact.bin"),
+              read_file_bytes("tout_conduit_benchmark_save_iovecs.bin"));
+
+    std::cout << "[benchmark] write 64 MiB of strided data: "
+              << "compact_to + serialize " << compact_secs << " s ("
+              << n.total_bytes_compact() << " extra bytes), "
+              << "serialize " << iovec_secs << " s (1 MiB bounce buffer)"
+              << std::endl;
+}
@@ -0,0 +1,342 @@
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+// Copyright (c) 2014-2019, Lawrence Livermore National Security, LLC.
+// 
+// Produced at the Lawrence Livermore National Laboratory
+// 
+// LLNL-CODE-666778
+// 
+// All rights reserved.
+// 
+// This file is part of Conduit. 
+// 
+// For details, see: http://software.llnl.gov/conduit/.
+// 
+// Please also read conduit/LICENSE
+// 
+// Redistribution and use in source and binary forms, with or without 
+// modification, are permitted provided that the following conditions are met:
+// 
+// * Redistributions of source code must retain the above copyright notice, 
+//   this list of conditions and the disclaimer below.
+// 
+// * Redistributions in binary form must reproduce the above copyright notice,
+//   this list of conditions and the disclaimer (as noted below) in the
+//   documentation and/or other materials provided with the distribution.
+// 
+// * Neither the name of the LLNS/LLNL nor the names of its contributors may
+//   be used to endorse or promote products derived from this software without
+//   specific prior written permission.
+// 
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+// AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+// IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+// ARE DISCLAIMED. IN NO EVENT SHALL LAWRENCE LIVERMORE NATIONAL SECURITY,
+// LLC, THE U.S. DEPARTMENT OF ENERGY OR CONTRIBUTORS BE LIABLE FOR ANY
+// DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL 
+// DAMAGES  (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS
+// OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+// HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, 
+// STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING
+// IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE 
+// POSSIBILITY OF SUCH DAMAGE.
+// 
+//~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~~//
+
+//-----------------------------------------------------------------------------
+///
+/// file: t_conduit_trace.cpp
+///
+//-----------------------------------------------------------------------------
+
+#include "conduit.hpp"
+
+#include <iostream>
+#include <ctime>
+#include "gtest/gtest.h"
+
+using namespace conduit;
+
+//-----------------------------------------------------------------------------
+// index of a span name in the results, -1 if missing
+index_t
+span_id(const Node &trace,
+        const std::string &name)
+{
+    const std::vector<std::string> &names = trace["summary"].child_names();
+    for(size_t i=0; i < names.size(); i++)
+    {
+        if(names[i] == name)
+        {
+            return (index_t)i;
+        }
+    }
+    return -1;
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_trace, spans)
+{
+    utils::reset_trace();
+    utils::set_trace_enabled(true);
+    EXPECT_TRUE(utils::trace_enabled());
+    {
+        utils::TraceSpan outer("outer");
+        outer.add_bytes(100);
+        for(int i=0; i < 3; i++)
+        {
+            utils::TraceSpan inner("inner");
+            inner.add_bytes(10);
+        }
+    }
+    utils::set_trace_enabled(false);
+
+    // not recorded
+    {
+        utils::TraceSpan outer("outer");
+    }
+
+    Node res;
+    utils::trace_results(res);
+    res.print();
+
+    EXPECT_EQ(res["num_dropped_events"].to_int64(),0);
+    EXPECT_EQ(res["summary/outer/count"].to_int64(),1);
+    EXPECT_EQ(res["summary/outer/bytes"].to_int64(),100);
+    EXPECT_EQ(res["summary/inner/count"].to_int64(),3);
+    EXPECT_EQ(res["summary/inner/bytes"].to_int64(),30);
+    EXPECT_TRUE(res["summary/inner/min_time"].to_float64() <= 
+                res["summary/inner/max_time"].to_float64());
+    EXPECT_TRUE(res["summary/outer/total_time"].to_float64() >= 
+                res["summary/inner/total_time"].to_float64());
+
+    // events are recorded when their span ends
+    Node &n_events = res["events"];
+    EXPECT_EQ(n_events["name_id"].dtype().number_of_elements(),4);
+    int64_array   name_ids  = n_events["name_id"].value();
+    int64_array   depths    = n_events["depth"].value();
+    float64_array starts    = n_events["start"].value();
+    float64_array durations = n_events["duration"].value();
+
+    index_t outer_id = span_id(res,"outer");
+    index_t inner_id = span_id(res,"inner");
+    for(index_t i=0; i < 3; i++)
+    {
+        EXPECT_EQ(name_ids[i],inner_id);
+        EXPECT_EQ(depths[i],1);
+        EXPECT_TRUE(starts[i] >= starts[3]);
+        EXPECT_TRUE(starts[i] + durations[i] <= starts[3] + durations[3]);
+    }
+    EXPECT_EQ(name_ids[3],outer_id);
+    EXPECT_EQ(depths[3],0);
+
+    utils::reset_trace();
+    utils::trace_results(res);
+    EXPECT_EQ(res["summary"].number_of_children(),0);
+    EXPECT_EQ(res["events/name_id"].dtype().number_of_elements(),0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_trace, max_events)
+{
+    index_t max_events = utils::trace_max_events();
+    utils::reset_trace();
+    utils::set_trace_max_events(2);
+    utils::set_trace_enabled(true);
+    for(int i=0; i < 5; i++)
+    {
+        utils::TraceSpan span("span");
+    }
+    utils::set_trace_enabled(false);
+    utils::set_trace_max_events(max_events);
+
+    // the summary includes dropped events
+    Node res;
+    utils::trace_results(res);
+    EXPECT_EQ(res["num_dropped_events"].to_int64(),3);
+    EXPECT_EQ(res["summary/span/count"].to_int64(),5);
+    EXPECT_EQ(res["events/name_id"].dtype().number_of_elements(),2);
+    utils::reset_trace();
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_trace, node_io)
+{
+    Node n;
+    n["a"].set(DataType::float64(100));
+    n["b"].set(DataType::int32(50));
+
+    utils::reset_trace();
+    utils::set_trace_enabled(true);
+    n.save("tout_trace_node_io.conduit_bin");
+    Node n_load;
+    n_load.load("tout_trace_node_io.conduit_bin");
+    utils::set_trace_enabled(false);
+
+    Node res;
+    utils::trace_results(res);
+    res["summary"].print();
+#ifdef CONDUIT_ENABLE_TRACING
+    EXPECT_EQ(res["summary/conduit::Node::save/count"].to_int64(),1);
+    EXPECT_EQ(res["summary/conduit::Node::save/bytes"].to_int64(),1000);
+    EXPECT_EQ(res["summary/conduit::Node::load/count"].to_int64(),1);
+    EXPECT_EQ(res["summary/conduit::Node::load/bytes"].to_int64(),1000);
+#else
+    EXPECT_EQ(res["summary"].number_of_children(),0);
+#endif
+    utils::reset_trace();
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_trace, merge)
+{
+    utils::reset_trace();
+    utils::set_trace_enabled(true);
+    {
+        utils::TraceSpan span("a");
+        span.add_bytes(8);
+    }
+    utils::set_trace_enabled(false);
+
+    Node traces;
+    utils::trace_results(traces.append());
+
+    utils::reset_trace();
+    utils::set_trace_enabled(true);
+    {
+        utils::TraceSpan span("b");
+    }
+    {
+        utils::TraceSpan span("a");
+        span.add_bytes(4);
+    }
+    utils::set_trace_enabled(false);
+    utils::trace_results(traces.append());
+    utils::reset_trace();
+
+    // round trip one of them through json
+    Node n_json;
+    n_json.parse(traces[1].to_json(),"json");
+    traces[1].set(n_json);
+
+    Node res;
+    utils::merge_trace_results(traces,res);
+    res.print();
+
+    EXPECT_EQ(res["summary"].number_of_children(),2);
+    EXPECT_EQ(res["summary/a/count"].to_int64(),2);
+    EXPECT_EQ(res["summary/a/bytes"].to_int64(),12);
+    EXPECT_EQ(res["summary/b/count"].to_int64(),1);
+
+    int64_array name_ids = res["events/name_id"].value();
+    int64_array ranks    = res["events/rank"].value();
+    EXPECT_EQ(name_ids.number_of_elements(),3);
+    EXPECT_EQ(name_ids[0],span_id(res,"a"));
+    EXPECT_EQ(ranks[0],0);
+    EXPECT_EQ(name_ids[1],span_id(res,"b"));
+    EXPECT_EQ(ranks[1],1);
+    EXPECT_EQ(name_ids[2],span_id(res,"a"));
+    EXPECT_EQ(ranks[2],1);
+
+    // bad name ids are caught
+    traces[0]["events/name_id"].set(DataType::int64(1));
+    traces[0]["events/name_id"].as_int64_ptr()[0] = 10;
+    EXPECT_THROW(utils::merge_trace_results(traces,res),conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_trace, chrome_json)
+{
+    utils::reset_trace();
+    utils::set_trace_enabled(true);
+    {
+        utils::TraceSpan span("write \"data\"");
+        span.add_bytes(64);
+    }
+    utils::set_trace_enabled(false);
+
+    Node trace;
+    utils::trace_results(trace);
+    utils::reset_trace();
+
+    std::string json = utils::trace_to_chrome_json(trace);
+    std::cout << json << std::endl;
+
+    Node res;
+    res.parse(json,"json");
+    EXPECT_EQ(res["displayTimeUnit"].as_string(),"ms");
+
+    // process name and the span
+    Node &n_events = res["traceEvents"];
+    EXPECT_EQ(n_events.number_of_children(),2);
+    EXPECT_EQ(n_events[0]["ph"].as_string(),"M");
+    EXPECT_EQ(n_events[0]["args/name"].as_string(),"rank 0");
+
+    Node &n_span = n_events[1];
+    EXPECT_EQ(n_span["name"].as_string(),"write \"data\"");
+    EXPECT_EQ(n_span["ph"].as_string(),"X");
+    EXPECT_EQ(n_span["pid"].to_int64(),0);
+    EXPECT_EQ(n_span["args/bytes"].to_int64(),64);
+    EXPECT_TRUE(n_span["dur"].to_float64() >= 0.0);
+}
+
+//-----------------------------------------------------------------------------
+void
+span_task(index_t, void *)
+{
+    utils::TraceSpan span("task");
+    span.add_bytes(1);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_trace, threads)
+{
+    utils::reset_trace();
+    utils::set_trace_enabled(true);
+    set_num_threads(4);
+    parallel_for(64,span_task,NULL);
+    set_num_threads(1);
+    utils::set_trace_enabled(false);
+
+    Node res;
+    utils::trace_results(res);
+    utils::reset_trace();
+
+    EXPECT_EQ(res["summary/task/count"].to_int64(),64);
+    EXPECT_EQ(res["summary/task/bytes"].to_int64(),64);
+
+    int64_array threads = res["events/thread"].value();
+    EXPECT_EQ(threads.number_of_elements(),64);
+    for(index_t i=0; i < 64; i++)
+    {
+        EXPECT_TRUE(threads[i] >= 0);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_trace, benchmark_span)
+{
+    int nruns = 200000;
+
+    utils::reset_trace();
+    std::clock_t start = std::clock();
+    for(int i=0; i < nruns; i++)
+    {
+        utils::TraceSpan span("disabled");
+    }
+    double secs = double(std::clock() - start) / CLOCKS_PER_SEC;
+    std::cout << "[benchmark] span while tracing is disabled: "
+              << (secs / nruns) * 1e9 << " ns" << std::endl;
+
+    utils::set_trace_enabled(true);
+    start = std::clock();
+    for(int i=0; i < nruns; i++)
+    {
+        utils::TraceSpan span("enabled");
+    }
+    secs = double(std::clock() - start) / CLOCKS_PER_SEC;
+    utils::set_trace_enabled(false);
+    utils::reset_trace();
+
+    std::cout << "[benchmark] span while tracing is enabled: "
+              << (secs / nruns) * 1e9 << " ns" << std::endl;
+}
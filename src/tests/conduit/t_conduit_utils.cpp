@@ -53,6 +53,12 @@
 
 #include <iostream>
 #include <limits>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <sstream>
+#include <vector>
+#include <algorithm>
 #include "gtest/gtest.h"
 
 #include "t_config.hpp"
@@ -239,6 +245,147 @@ TEST(conduit_utils, float64_to_string)
     EXPECT_EQ("nan",utils::float64_to_string(v));
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_utils, float_to_string_shortest)
+{
+    EXPECT_EQ("0.1",utils::float64_to_string(0.1));
+    EXPECT_EQ("0.3",utils::float64_to_string(0.3));
+    // grisu2 output always round trips, but the last digit is not always
+    // the closest one
+    EXPECT_EQ(strtod(utils::float64_to_string(0.1+0.2).c_str(),NULL),0.1+0.2);
+    EXPECT_EQ("-2.5",utils::float64_to_string(-2.5));
+    EXPECT_EQ("0.0",utils::float64_to_string(0.0));
+    EXPECT_EQ("-0.0",utils::float64_to_string(-0.0));
+    EXPECT_EQ("0.0001",utils::float64_to_string(0.0001));
+    EXPECT_EQ("1.5e-05",utils::float64_to_string(0.000015));
+    EXPECT_EQ("123456789012345.0",
+              utils::float64_to_string(123456789012345.0));
+    EXPECT_EQ("1.2345678901234568e+15",
+              utils::float64_to_string(1234567890123456.8));
+    EXPECT_EQ("1e+300",utils::float64_to_string(1e300));
+    EXPECT_EQ("1.7976931348623157e+308",
+              utils::float64_to_string(std::numeric_limits<float64>::max()));
+
+    // float32 values use the shortest float32 representation
+    EXPECT_EQ("0.1",utils::float32_to_string(0.1f));
+    EXPECT_EQ("3.4028235e+38",
+              utils::float32_to_string(std::numeric_limits<float32>::max()));
+    EXPECT_EQ("16777216.0",utils::float32_to_string(16777216.0f));
+    EXPECT_EQ("inf",
+              utils::float32_to_string(
+                  std::numeric_limits<float32>::infinity()));
+
+    char buff[32];
+    EXPECT_EQ(utils::int64_to_chars(std::numeric_limits<int64>::min(),buff),
+              20);
+    EXPECT_EQ(std::string(buff,20),"-9223372036854775808");
+    EXPECT_EQ(utils::uint64_to_chars(std::numeric_limits<uint64>::max(),buff),
+              20);
+    EXPECT_EQ(std::string(buff,20),"18446744073709551615");
+    EXPECT_EQ(utils::int64_to_chars(0,buff),1);
+    EXPECT_EQ(buff[0],'0');
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_utils, float_to_string_round_trip)
+{
+    // random bit patterns, covering subnormals and the full exponent range
+    uint64 state = 88172645463325252ULL;
+    char buff[32];
+    index_t num_tests = 200000;
+    for(index_t i=0; i < num_tests; i++)
+    {
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+
+        float64 v64;
+        memcpy(&v64,&state,sizeof(float64));
+        if(v64 == v64 && (v64 - v64) == 0)
+        {
+            index_t len = utils::float64_to_chars(v64,buff);
+            buff[len] = 0;
+            EXPECT_EQ(strtod(buff,NULL),v64) << buff;
+        }
+
+        uint32 bits32 = (uint32) (state >> 32);
+        float32 v32;
+        memcpy(&v32,&bits32,sizeof(float32));
+        if(v32 == v32 && (v32 - v32) == 0)
+        {
+            index_t len = utils::float32_to_chars(v32,buff);
+            buff[len] = 0;
+            EXPECT_EQ((float32)strtod(buff,NULL),v32) << buff;
+        }
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_utils, text_writer)
+{
+    std::ostringstream oss;
+    {
+        utils::TextWriter w(oss);
+        w.write('[');
+        w.write_int64(-42);
+        w.write(", ");
+        w.write_uint64(42);
+        w.write(std::string(", "));
+        w.write_float64(0.25);
+        w.write(", ",2);
+        w.write_float32(1.5f);
+        w.write(']');
+        w.write_indent(2,2,"-");
+        // nothing is written until the writer flushes
+        EXPECT_EQ(oss.str(),"");
+    }
+    EXPECT_EQ(oss.str(),"[-42, 42, 0.25, 1.5]----");
+
+    // writes larger than the internal buffer
+    std::string big(1000000,'x');
+    oss.str("");
+    {
+        utils::TextWriter w(oss);
+        w.write('a');
+        w.write(big);
+        w.write('b');
+        w.flush();
+        EXPECT_EQ(oss.str().size(),big.size() + 2);
+    }
+    EXPECT_EQ(oss.str(),"a" + big + "b");
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_utils, benchmark_float64_to_json)
+{
+    index_t num_ele = 1000000;
+    Node n;
+    n["values"].set(DataType::float64(num_ele));
+    float64_array vals = n["values"].value();
+    for(index_t i=0; i < num_ele; i++)
+    {
+        vals[i] = 1.0 / (float64)(i+1);
+    }
+
+    std::clock_t start = std::clock();
+    std::string json = n.to_json();
+    double secs = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    Node res;
+    res.parse(json,"json");
+    float64_array res_vals = res["values"].value();
+    EXPECT_EQ(res_vals.number_of_elements(),num_ele);
+    index_t num_diff = 0;
+    for(index_t i=0; i < num_ele; i++)
+    {
+        num_diff += (res_vals[i] != vals[i]) ? 1 : 0;
+    }
+    EXPECT_EQ(num_diff,0);
+
+    std::cout << "[benchmark] to_json of " << num_ele
+              << " float64 values: " << secs << " s" << std::endl;
+}
+
 
 
 //-----------------------------------------------------------------------------
@@ -310,7 +457,7 @@ TEST(conduit_utils, base64_enc_dec)
     Node n;
     n_src.compact_to(n);
     
-    // use libb64 to encode the data
+    // base64 encode the data
     index_t nbytes = n.schema().total_strided_bytes();
     Node bb64_data;
     index_t enc_buff_size = utils::base64_encode_buffer_size(nbytes);
@@ -325,7 +472,7 @@ TEST(conduit_utils, base64_enc_dec)
 
     index_t dec_buff_size = utils::base64_decode_buffer_size(enc_buff_size);
 
-    // use libb64 to decode the data
+    // base64 decode the data
     
     // decode buffer
     Node bb64_decode;
@@ -346,6 +493,174 @@ TEST(conduit_utils, base64_enc_dec)
     EXPECT_EQ(n_src["c"].as_int32(), n_res["c"].as_int32());
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_utils, base64_rfc4648_vectors)
+{
+    const char *plain[]   = {"", "f", "fo", "foo", "foob", "fooba", "foobar"};
+    const char *encoded[] = {"", "Zg==", "Zm8=", "Zm9v", "Zm9vYg==",
+                             "Zm9vYmE=", "Zm9vYmFy"};
+
+    for(int i=0; i < 7; i++)
+    {
+        index_t nbytes = (index_t)strlen(plain[i]);
+        std::vector<char> enc((size_t)utils::base64_encode_buffer_size(nbytes));
+        utils::base64_encode(plain[i],nbytes,&enc[0]);
+        EXPECT_EQ(std::string(&enc[0]),std::string(encoded[i]));
+
+        index_t enc_len = (index_t)strlen(encoded[i]);
+        std::vector<char> dec((size_t)utils::base64_decode_buffer_size(enc_len));
+        utils::base64_decode(encoded[i],enc_len,&dec[0]);
+        EXPECT_EQ(std::string(&dec[0],(size_t)nbytes),std::string(plain[i]));
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_utils, base64_round_trip)
+{
+    // sizes around the vectorized block sizes and a few large ones
+    std::vector<index_t> sizes;
+    for(index_t i=0; i < 200; i++)
+    {
+        sizes.push_back(i);
+    }
+    sizes.push_back(1000);
+    sizes.push_back(4099);
+    sizes.push_back(65536);
+    sizes.push_back(1000003);
+
+    srand(42);
+    for(size_t s=0; s < sizes.size(); s++)
+    {
+        index_t nbytes = sizes[s];
+        std::vector<unsigned char> src((size_t)nbytes + 1);
+        for(index_t i=0; i < nbytes; i++)
+        {
+            src[(size_t)i] = (unsigned char)(rand() % 256);
+        }
+
+        std::vector<char> enc((size_t)utils::base64_encode_buffer_size(nbytes));
+        utils::base64_encode(&src[0],nbytes,&enc[0]);
+        index_t enc_len = (index_t)strlen(&enc[0]);
+        EXPECT_EQ(enc_len, ((nbytes + 2) / 3) * 4);
+
+        std::vector<unsigned char> dec((size_t)utils::base64_decode_buffer_size(enc_len));
+        utils::base64_decode(&enc[0],enc_len,&dec[0]);
+        EXPECT_EQ(memcmp(&src[0],&dec[0],(size_t)nbytes),0) << nbytes;
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_utils, base64_decode_skips_whitespace)
+{
+    index_t nbytes = 1000;
+    std::vector<unsigned char> src((size_t)nbytes);
+    for(index_t i=0; i < nbytes; i++)
+    {
+        src[(size_t)i] = (unsigned char)(i * 7 + 3);
+    }
+
+    std::vector<char> enc((size_t)utils::base64_encode_buffer_size(nbytes));
+    utils::base64_encode(&src[0],nbytes,&enc[0]);
+    std::string enc_str(&enc[0]);
+
+    // wrap lines like mime, and add a few stray spaces
+    std::string wrapped;
+    for(size_t i=0; i < enc_str.size(); i++)
+    {
+        if(i > 0 && i % 76 == 0)
+        {
+            wrapped += "\r\n";
+        }
+        if(i % 101 == 0)
+        {
+            wrapped += ' ';
+        }
+        wrapped += enc_str[i];
+    }
+    wrapped += "\n";
+
+    std::vector<unsigned char> dec((size_t)utils::base64_decode_buffer_size(
+                                                    (index_t)wrapped.size()));
+    utils::base64_decode(wrapped.c_str(),(index_t)wrapped.size(),&dec[0]);
+    EXPECT_EQ(memcmp(&src[0],&dec[0],(size_t)nbytes),0);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_utils, base64_streaming)
+{
+    index_t nbytes = 100000;
+    std::vector<unsigned char> src((size_t)nbytes);
+    for(index_t i=0; i < nbytes; i++)
+    {
+        src[(size_t)i] = (unsigned char)((i * 31) ^ (i >> 5));
+    }
+
+    std::vector<char> enc((size_t)utils::base64_encode_buffer_size(nbytes));
+    utils::base64_encode(&src[0],nbytes,&enc[0]);
+    std::string enc_str(&enc[0]);
+
+    // odd sized pieces
+    index_t chunk_sizes[] = {1, 2, 5, 64, 1001};
+    for(int c=0; c < 5; c++)
+    {
+        index_t chunk = chunk_sizes[c];
+
+        std::ostringstream oss;
+        utils::Base64Encoder encoder(oss);
+        for(index_t i=0; i < nbytes; i += chunk)
+        {
+            encoder.write(&src[(size_t)i],std::min(chunk, nbytes - i));
+        }
+        encoder.finish();
+        EXPECT_EQ(oss.str(),enc_str);
+
+        // decode in pieces, without the padding
+        std::string txt = enc_str.substr(0,enc_str.find('='));
+        std::vector<unsigned char> dec;
+        std::vector<unsigned char> buff((size_t)(chunk / 4 * 3 + 3));
+        utils::Base64Decoder decoder;
+        for(index_t i=0; i < (index_t)txt.size(); i += chunk)
+        {
+            index_t n = std::min(chunk, (index_t)txt.size() - i);
+            index_t ndec = decoder.decode(txt.c_str() + i, n, &buff[0]);
+            dec.insert(dec.end(),buff.begin(),buff.begin() + ndec);
+        }
+        index_t ndec = decoder.finish(&buff[0]);
+        dec.insert(dec.end(),buff.begin(),buff.begin() + ndec);
+
+        ASSERT_EQ((index_t)dec.size(),nbytes);
+        EXPECT_EQ(memcmp(&src[0],&dec[0],(size_t)nbytes),0);
+    }
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_utils, benchmark_base64)
+{
+    index_t nbytes = 64 * 1024 * 1024;
+    std::vector<unsigned char> src((size_t)nbytes);
+    for(index_t i=0; i < nbytes; i++)
+    {
+        src[(size_t)i] = (unsigned char)(i * 13);
+    }
+
+    std::vector<char> enc((size_t)utils::base64_encode_buffer_size(nbytes));
+    std::clock_t start = std::clock();
+    utils::base64_encode(&src[0],nbytes,&enc[0]);
+    double enc_secs = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    index_t enc_len = ((nbytes + 2) / 3) * 4;
+    std::vector<unsigned char> dec((size_t)utils::base64_decode_buffer_size(enc_len));
+    start = std::clock();
+    utils::base64_decode(&enc[0],enc_len,&dec[0]);
+    double dec_secs = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    EXPECT_EQ(memcmp(&src[0],&dec[0],(size_t)nbytes),0);
+
+    std::cout << "[benchmark] base64 of " << nbytes << " bytes: "
+              << "encode " << enc_secs << " s, "
+              << "decode " << dec_secs << " s" << std::endl;
+}
+
 //-----------------------------------------------------------------------------
 TEST(conduit_utils, dir_create_and_remove_tests)
 {
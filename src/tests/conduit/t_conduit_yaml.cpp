@@ -51,7 +51,9 @@
 #include "conduit.hpp"
 
 #include <iostream>
+#include <sstream>
 #include <limits>
+#include <ctime>
 #include "gtest/gtest.h"
 
 using namespace conduit;
@@ -646,3 +648,156 @@ TEST(conduit_yaml, to_yaml_leaf_nl)
 
 }
 
+
+//-----------------------------------------------------------------------------
+TEST(conduit_yaml, yaml_numbers)
+{
+    std::string yaml_txt = "a: 1e5\n"
+                           "b: -0.5\n"
+                           "c: +7\n"
+                           "d: 007\n"
+                           "e: .5\n"
+                           "f: 0.1\n"
+                           "g: 123456789012345678\n"
+                           "h: 9223372036854775807\n"
+                           "i: 1.2.3\n"
+                           "j: \" 12\"\n"
+                           "k: 1e-300\n"
+                           "l: 12345678901234567890.5\n"
+                           "m: 0x10\n"
+                           "n: [1, 1e5, -3]\n"
+                           "o: [1, two, 3]\n";
+    Node n;
+    n.parse(yaml_txt,"yaml");
+    CONDUIT_INFO(n.to_yaml());
+
+    EXPECT_EQ(n["a"].as_float64(),1e5);
+    EXPECT_EQ(n["b"].as_float64(),-0.5);
+    EXPECT_EQ(n["c"].as_int64(),7);
+    EXPECT_EQ(n["d"].as_int64(),7);
+    EXPECT_EQ(n["e"].as_float64(),0.5);
+    EXPECT_EQ(n["f"].as_float64(),0.1);
+    EXPECT_EQ(n["g"].as_int64(),123456789012345678);
+    EXPECT_EQ(n["h"].as_int64(),std::numeric_limits<int64>::max());
+    EXPECT_EQ(n["i"].as_string(),"1.2.3");
+    // strtol rules still apply to other forms
+    EXPECT_EQ(n["j"].as_int64(),12);
+    EXPECT_EQ(n["k"].as_float64(),1e-300);
+    EXPECT_EQ(n["l"].as_float64(),12345678901234567890.5);
+    // strtod accepts hex values
+    EXPECT_EQ(n["m"].as_float64(),16.0);
+
+    EXPECT_TRUE(n["n"].dtype().is_float64());
+    float64_array n_vals = n["n"].value();
+    EXPECT_EQ(n_vals[1],1e5);
+    EXPECT_EQ(n_vals[2],-3.0);
+
+    EXPECT_TRUE(n["o"].dtype().is_list());
+    EXPECT_EQ(n["o"][0].as_int64(),1);
+    EXPECT_EQ(n["o"][1].as_string(),"two");
+
+    // decimal values round trip
+    Node vals;
+    vals.set(DataType::float64(1000));
+    float64_array vals_ptr = vals.value();
+    for(index_t i=0; i < 1000; i++)
+    {
+        vals_ptr[i] = 1.0 / (float64)(i+3) * ((i % 2) ? 1e-8 : 1e12);
+    }
+    Node res;
+    res.parse(vals.to_yaml(),"yaml");
+    Node info;
+    EXPECT_FALSE(vals.diff(res,info));
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_yaml, yaml_anchors_and_aliases)
+{
+    std::string yaml_txt = "base: &b\n"
+                           "  x: 1\n"
+                           "  y: [1, 2]\n"
+                           "other: *b\n"
+                           "v: &s 5\n"
+                           "w: [*s, 6]\n";
+    Node n;
+    n.parse(yaml_txt,"yaml");
+    CONDUIT_INFO(n.to_yaml());
+
+    Node info;
+    EXPECT_FALSE(n["base"].diff(n["other"],info));
+    EXPECT_EQ(n["v"].as_int64(),5);
+    int64_array w_vals = n["w"].value();
+    EXPECT_EQ(w_vals[0],5);
+    EXPECT_EQ(w_vals[1],6);
+
+    Node n_err;
+    EXPECT_THROW(n_err.parse("a: *missing\n","yaml"),conduit::Error);
+    EXPECT_THROW(n_err.parse("a: &r\n  b: *r\n","yaml"),conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_yaml, yaml_parse_from_stream)
+{
+    std::ostringstream oss;
+    for(int i=0; i < 5000; i++)
+    {
+        oss << "field_" << i << ":\n"
+            << "  value: [" << i << ", " << i+1 << "]\n"
+            << "  name: \"s_" << i << "\"\n";
+    }
+    std::string yaml_txt = oss.str();
+
+    Node n_mem;
+    n_mem.parse(yaml_txt,"yaml");
+
+    std::istringstream iss(yaml_txt);
+    Generator g("","yaml");
+    Node n_stream;
+    g.walk(iss,n_stream);
+
+    Node info;
+    EXPECT_FALSE(n_mem.diff(n_stream,info));
+    EXPECT_EQ(n_stream.number_of_children(),5000);
+    EXPECT_EQ(n_stream["field_4999/name"].as_string(),"s_4999");
+
+    // Node::load reads yaml files as a stream
+    n_mem.save("tout_yaml_parse_from_stream.yaml","yaml");
+    Node n_load;
+    n_load.load("tout_yaml_parse_from_stream.yaml");
+    EXPECT_FALSE(n_mem.diff(n_load,info));
+
+    // errors are reported for streams
+    std::istringstream iss_bad("a: [1, 2\nb: 3\n");
+    EXPECT_THROW(g.walk(iss_bad,n_stream),conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_yaml, benchmark_yaml_parse)
+{
+    index_t num_ele = 1000000;
+    Node n;
+    n["ints"].set(DataType::int64(num_ele));
+    n["floats"].set(DataType::float64(num_ele));
+    int64_array ints = n["ints"].value();
+    float64_array floats = n["floats"].value();
+    for(index_t i=0; i < num_ele; i++)
+    {
+        ints[i] = i;
+        floats[i] = (float64)i * 0.25;
+    }
+    std::string yaml_txt = n.to_yaml();
+
+    std::istringstream iss(yaml_txt);
+    Generator g("","yaml");
+    Node res;
+    std::clock_t start = std::clock();
+    g.walk(iss,res);
+    double secs = double(std::clock() - start) / CLOCKS_PER_SEC;
+
+    Node info;
+    EXPECT_FALSE(n.diff(res,info));
+
+    std::cout << "[benchmark] yaml parse of " << 2 * num_ele
+              << " numeric values from a stream: " << secs << " s" 
+              << std::endl;
+}
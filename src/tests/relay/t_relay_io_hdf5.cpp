@@ -1411,3 +1411,106 @@ TEST(conduit_relay_io_hdf5, conduit_hdf5_list)
 }
 
 
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_hdf5, conduit_hdf5_checksum)
+{
+    std::string tout = "tout_hdf5_checksum.hdf5";
+
+    Node n;
+    n["a"].set(DataType::float64(10));
+    float64_array a_vals = n["a"].value();
+    for(index_t i=0; i < 10; i++)
+    {
+        a_vals[i] = i * 0.25;
+    }
+    n["b"] = "a string";
+    n["c"].set(DataType::int32(8));
+    // strided and non-native endianness leaves
+    n["d"].set_external(DataType::float64(5,0,16),n["a"].data_ptr());
+    n["e"].set(n["c"]);
+    n["e"].endian_swap(Endianness::machine_is_big_endian() ? 
+                        Endianness::LITTLE_ID : Endianness::BIG_ID);
+
+    Node opts;
+    opts["hdf5/checksum"] = "crc32c";
+    io::save(n,tout,"hdf5",opts);
+
+    // save restores the global options
+    Node curr_opts;
+    io::hdf5_options(curr_opts);
+    EXPECT_EQ(curr_opts["checksum"].as_string(),"none");
+
+    Node n_load, info;
+    io::load(tout,"hdf5",n_load);
+    EXPECT_FALSE(n.diff(n_load,info));
+
+    opts["hdf5/checksum"] = "xxhash64";
+    io::save(n,tout,"hdf5",opts);
+    io::load(tout,"hdf5",n_load);
+    EXPECT_FALSE(n.diff(n_load,info));
+
+    // change data behind conduit's back
+    hid_t h5_file_id = io::hdf5_open_file_for_read_write(tout);
+    hid_t h5_dset_id = H5Dopen(h5_file_id,"a",H5P_DEFAULT);
+    std::vector<float64> other_vals(10,-1.0);
+    H5Dwrite(h5_dset_id,H5T_NATIVE_DOUBLE,H5S_ALL,H5S_ALL,H5P_DEFAULT,
+             &other_vals[0]);
+    H5Dclose(h5_dset_id);
+    io::hdf5_close_file(h5_file_id);
+
+    EXPECT_THROW(io::load(tout,"hdf5",n_load),conduit::Error);
+
+    // other datasets are still fine
+    n_load.reset();
+    io::hdf5_read(tout + ":c",n_load);
+    EXPECT_FALSE(n["c"].diff(n_load,info));
+
+    // rewriting without a checksum removes the stale one
+    h5_file_id = io::hdf5_open_file_for_read_write(tout);
+    io::hdf5_write(n,h5_file_id);
+    io::hdf5_close_file(h5_file_id);
+    io::load(tout,"hdf5",n_load);
+    EXPECT_FALSE(n.diff(n_load,info));
+
+    opts["hdf5/checksum"] = "md5";
+    EXPECT_THROW(io::save(n,tout,"hdf5",opts),conduit::Error);
+}
+
+//-----------------------------------------------------------------------------
+TEST(conduit_relay_io_hdf5, trace)
+{
+    Node n;
+    n["a"].set(DataType::float64(10));
+    n["b"].set(DataType::int64(5));
+
+    std::string tout = "tout_hdf5_trace.hdf5";
+
+    utils::reset_trace();
+    utils::set_trace_enabled(true);
+    io::save(n,tout,"hdf5");
+    Node n_load;
+    io::load(tout,"hdf5",n_load);
+    utils::set_trace_enabled(false);
+
+    Node res;
+    utils::trace_results(res);
+    utils::reset_trace();
+    res["summary"].print();
+
+#ifdef CONDUIT_ENABLE_TRACING
+    EXPECT_EQ(res["summary/relay::io::save/count"].to_int64(),1);
+    EXPECT_EQ(res["summary/relay::io::save/bytes"].to_int64(),120);
+    EXPECT_EQ(res["summary/relay::io::hdf5_write/count"].to_int64(),1);
+    EXPECT_EQ(res["summary/relay::io::hdf5_write/bytes"].to_int64(),120);
+    EXPECT_EQ(res["summary/relay::io::load/bytes"].to_int64(),120);
+    EXPECT_EQ(res["summary/relay::io::hdf5_read/bytes"].to_int64(),120);
+
+    // the hdf5 spans are nested in the relay io spans
+    int64_array depths = res["events/depth"].value();
+    EXPECT_EQ(depths[0],1);
+    EXPECT_EQ(depths[1],0);
+#else
+    EXPECT_EQ(res["summary"].number_of_children(),0);
+#endif
+}
@@ -812,6 +812,53 @@ TEST(conduit_mpi_test, all_gather_using_schema_simple)
 
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, using_schema_protocols)
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+
+    EXPECT_EQ(mpi::schema_protocol(),"binary");
+    EXPECT_THROW(mpi::set_schema_protocol("yaml"),conduit::Error);
+
+    // receivers detect the encoding, so ranks can use different ones
+    mpi::set_schema_protocol(rank == 0 ? "json" : "binary");
+
+    Node n;
+    n["values/a"] = rank+1;
+    n["values/b"].set(DataType::float64(3));
+    float64_array b_vals = n["values/b"].value();
+    b_vals[0] = 0.5 * rank;
+    b_vals[1] = 1.5;
+    b_vals[2] = -2.0;
+    n["values/c"] = "text";
+
+    Node rcv;
+    mpi::all_gather_using_schema(n,rcv,MPI_COMM_WORLD);
+    EXPECT_EQ(rcv.number_of_children(),2);
+    EXPECT_EQ(rcv[0]["values/a"].to_int(),1);
+    EXPECT_EQ(rcv[1]["values/a"].to_int(),2);
+    EXPECT_EQ(rcv[1]["values/b"].as_float64_ptr()[0],0.5);
+    EXPECT_EQ(rcv[1]["values/c"].as_string(),"text");
+
+    Node n_msg;
+    if(rank == 0)
+    {
+        mpi::send_using_schema(n,1,0,MPI_COMM_WORLD);
+        mpi::recv_using_schema(n_msg,1,0,MPI_COMM_WORLD);
+    }
+    else if(rank == 1)
+    {
+        mpi::recv_using_schema(n_msg,0,0,MPI_COMM_WORLD);
+        mpi::send_using_schema(n,0,0,MPI_COMM_WORLD);
+    }
+
+    EXPECT_TRUE(n_msg.schema().compatible(n.schema()));
+    EXPECT_EQ(n_msg["values/a"].to_int(),rank == 0 ? 2 : 1);
+    EXPECT_EQ(n_msg["values/c"].as_string(),"text");
+
+    mpi::set_schema_protocol("binary");
+}
+
 
 //-----------------------------------------------------------------------------
 TEST(conduit_mpi_test, bcast)
@@ -1056,6 +1103,62 @@ TEST(conduit_mpi_test, bcast_using_schema_non_empty_node)
     }
 }
 
+//-----------------------------------------------------------------------------
+TEST(conduit_mpi_test, trace_results)
+{
+    int rank = mpi::rank(MPI_COMM_WORLD);
+    int com_size = mpi::size(MPI_COMM_WORLD);
+
+    utils::reset_trace();
+    utils::set_trace_enabled(true);
+    {
+        utils::TraceSpan span("rank_work");
+        span.add_bytes(rank + 1);
+    }
+    Node n;
+    n.set((int64)rank);
+    mpi::broadcast(n,0,MPI_COMM_WORLD);
+    utils::set_trace_enabled(false);
+
+    Node res;
+    mpi::trace_results(res,0,MPI_COMM_WORLD);
+    utils::reset_trace();
+
+    if(rank != 0)
+    {
+        EXPECT_TRUE(res.dtype().is_empty());
+        return;
+    }
+
+    res.print();
+    EXPECT_EQ(res["summary/rank_work/count"].to_int64(),com_size);
+    EXPECT_EQ(res["summary/rank_work/bytes"].to_int64(),
+              com_size * (com_size + 1) / 2);
+#ifdef CONDUIT_ENABLE_TRACING
+    EXPECT_EQ(res["summary/relay::mpi::broadcast/count"].to_int64(),com_size);
+    EXPECT_EQ(res["summary/relay::mpi::broadcast/bytes"].to_int64(),
+              8 * com_size);
+#endif
+
+    // every rank contributes its events
+    int64_array ranks = res["events/rank"].value();
+    std::vector<int> counts(com_size,0);
+    for(index_t i=0; i < ranks.number_of_elements(); i++)
+    {
+        counts[(size_t)ranks[i]]++;
+    }
+    for(int i=0; i < com_size; i++)
+    {
+        EXPECT_TRUE(counts[(size_t)i] > 0);
+    }
+
+    std::string json = utils::trace_to_chrome_json(res);
+    Node n_json;
+    n_json.parse(json,"json");
+    EXPECT_EQ(n_json["traceEvents"].number_of_children(),
+              ranks.number_of_elements() + com_size);
+}
+
 //-----------------------------------------------------------------------------
 int main(int argc, char* argv[])
 {